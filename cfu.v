@@ -27,16 +27,66 @@ module Cfu (
   input               clk
 );
 
+  wire [2:0] funct3 = cmd_payload_function_id[2:0];
+  wire [6:0] funct7 = cmd_payload_function_id[9:3];
+
   // Trivial handshaking for a combinational CFU
   assign rsp_valid = cmd_valid;
   assign cmd_ready = rsp_ready;
 
   //
-  // select output -- note that we're not fully decoding the 3 function_id bits
+  // funct3 = 2: four-way int8 multiply-accumulate
+  //   acc = (funct7[0] ? 0 : acc) + sum((in0.byte[i] + input_offset) * in1.byte[i])
+  //
+  reg signed [31:0] input_offset;
+  reg signed [31:0] acc;
+
+  wire signed [31:0] prod_0 = ($signed(cmd_payload_inputs_0[ 7: 0]) + input_offset)
+                                * $signed(cmd_payload_inputs_1[ 7: 0]);
+  wire signed [31:0] prod_1 = ($signed(cmd_payload_inputs_0[15: 8]) + input_offset)
+                                * $signed(cmd_payload_inputs_1[15: 8]);
+  wire signed [31:0] prod_2 = ($signed(cmd_payload_inputs_0[23:16]) + input_offset)
+                                * $signed(cmd_payload_inputs_1[23:16]);
+  wire signed [31:0] prod_3 = ($signed(cmd_payload_inputs_0[31:24]) + input_offset)
+                                * $signed(cmd_payload_inputs_1[31:24]);
+  wire signed [31:0] mac_acc = (funct7[0] ? 32'sd0 : acc)
+                                + prod_0 + prod_1 + prod_2 + prod_3;
+
+  //
+  // funct3 = 3: accumulator and offset control
+  //   funct7 = 0: input_offset = in0     funct7 = 1: acc = in0
+  //   funct7 = 2: return acc             funct7 = 3: return input_offset
+  //
+  reg [31:0] ctrl_out;
+  always @(*) begin
+    case (funct7)
+      7'd2:    ctrl_out = acc;
+      7'd3:    ctrl_out = input_offset;
+      default: ctrl_out = cmd_payload_inputs_0;
+    endcase
+  end
+
+  always @(posedge clk) begin
+    if (reset) begin
+      input_offset <= 32'sd0;
+      acc <= 32'sd0;
+    end else if (cmd_valid && rsp_ready) begin
+      if (funct3 == 3'd2) begin
+        acc <= mac_acc;
+      end else if (funct3 == 3'd3) begin
+        if (funct7 == 7'd0) input_offset <= cmd_payload_inputs_0;
+        if (funct7 == 7'd1) acc <= cmd_payload_inputs_0;
+      end
+    end
+  end
+
+  //
+  // funct3 = 0/1: select output (template pass-through)
   //
-  assign rsp_payload_outputs_0 = cmd_payload_function_id[0] ? 
-                                           cmd_payload_inputs_1 :
-                                           cmd_payload_inputs_0 ;
+  assign rsp_payload_outputs_0 = (funct3 == 3'd2) ? mac_acc :
+                                 (funct3 == 3'd3) ? ctrl_out :
+                                 funct3[0] ? cmd_payload_inputs_1 :
+                                             cmd_payload_inputs_0 ;
 
 
 endmodule
@@ -0,0 +1,194 @@
+#include "bn5_bench.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+
+#include "bn5_data.h"
+#include "conv_kernels.h"
+#include "perf.h"
+#include "tensorflow/lite/kernels/internal/reference/integer_ops/depthwise_conv.h"
+#include "tensorflow/lite/kernels/internal/reference/integer_ops/fused_bottleneck.h"
+
+namespace {
+
+constexpr int kHeight = 20;
+constexpr int kWidth = 20;
+constexpr int kPixels = kHeight * kWidth;
+constexpr int kInputDepth = 16;
+constexpr int kExpandDepth = 96;
+constexpr int kOutputDepth = 16;
+
+// Output of the stage being run; the largest is kPixels * kExpandDepth.
+alignas(4) int8_t output[kPixels * kExpandDepth];
+
+// Three expanded rows and a pixel, for FusedBottleneckPerChannel.
+int8_t scratch[(3 * kWidth + 1) * kExpandDepth];
+
+tflite::ConvParams PointwiseParams(int32_t input_zero_point,
+                                   int32_t output_zero_point,
+                                   int32_t activation_min,
+                                   int32_t activation_max) {
+  tflite::ConvParams params = {};
+  params.stride_width = 1;
+  params.stride_height = 1;
+  params.dilation_width_factor = 1;
+  params.dilation_height_factor = 1;
+  params.input_offset = -input_zero_point;
+  params.output_offset = output_zero_point;
+  params.quantized_activation_min = activation_min;
+  params.quantized_activation_max = activation_max;
+  return params;
+}
+
+tflite::DepthwiseParams DepthwiseStageParams() {
+  tflite::DepthwiseParams params = {};
+  params.stride_width = 1;
+  params.stride_height = 1;
+  params.padding_values.width = 1;
+  params.padding_values.height = 1;
+  params.dilation_width_factor = 1;
+  params.dilation_height_factor = 1;
+  params.depth_multiplier = 1;
+  params.input_offset = -bn5_dw_input_offset;
+  params.output_offset = bn5_dw_output_offset;
+  params.quantized_activation_min = bn5_relu6_min;
+  params.quantized_activation_max = bn5_relu6_max;
+  return params;
+}
+
+// A 1x1 stage through the kernel conv.cc picks for it.
+void Pointwise(const tflite::ConvParams& params,
+               const int32_t* output_multiplier, const int32_t* output_shift,
+               const int8_t* input, int input_depth, const int8_t* filter,
+               const int32_t* bias, int output_depth) {
+  tflite::OptimizedConvPerChannel(
+      params, output_multiplier, output_shift,
+      tflite::RuntimeShape({1, kHeight, kWidth, input_depth}), input,
+      tflite::RuntimeShape({output_depth, 1, 1, input_depth}), filter,
+      tflite::RuntimeShape({output_depth}), bias,
+      tflite::RuntimeShape({1, kHeight, kWidth, output_depth}), output);
+}
+
+void Expand() {
+  Pointwise(PointwiseParams(bn5_ex_input_offset, bn5_ex_output_offset,
+                            bn5_relu6_min, bn5_relu6_max),
+            bn5_ex_output_multiplier, bn5_ex_output_shift, bn5_ex_ifmap,
+            kInputDepth, bn5_ex_filter, bn5_ex_bias, kExpandDepth);
+}
+
+// As depthwise_conv.cc runs it.
+void Depthwise() {
+  const tflite::RuntimeShape shape({1, kHeight, kWidth, kExpandDepth});
+  tflite::reference_integer_ops::DepthwiseConvPerChannel(
+      DepthwiseStageParams(), bn5_dw_output_multiplier, bn5_dw_output_shift,
+      shape, bn5_dw_ifmap, tflite::RuntimeShape({1, 3, 3, kExpandDepth}),
+      bn5_dw_filter, tflite::RuntimeShape({kExpandDepth}), bn5_dw_bias, shape,
+      output);
+}
+
+void Project() {
+  Pointwise(PointwiseParams(bn5_pr_input_offset, bn5_pr_output_offset, -128,
+                            127),
+            bn5_pr_output_multiplier, bn5_pr_output_shift, bn5_pr_ifmap,
+            kExpandDepth, bn5_pr_filter, bn5_pr_bias, kOutputDepth);
+}
+
+// The whole block through FusedBottleneckPerChannel.
+void Fused() {
+  using tflite::reference_integer_ops::BottleneckStage;
+  const BottleneckStage ex = {bn5_ex_filter, bn5_ex_bias,
+                              bn5_ex_output_multiplier, bn5_ex_output_shift};
+  const BottleneckStage dw = {bn5_dw_filter, bn5_dw_bias,
+                              bn5_dw_output_multiplier, bn5_dw_output_shift};
+  const BottleneckStage pr = {bn5_pr_filter, bn5_pr_bias,
+                              bn5_pr_output_multiplier, bn5_pr_output_shift};
+  tflite::reference_integer_ops::FusedBottleneckPerChannel(
+      PointwiseParams(bn5_ex_input_offset, bn5_ex_output_offset, bn5_relu6_min,
+                      bn5_relu6_max),
+      ex, DepthwiseStageParams(), dw,
+      tflite::RuntimeShape({1, 3, 3, kExpandDepth}),
+      PointwiseParams(bn5_pr_input_offset, bn5_pr_output_offset, -128, 127),
+      pr, tflite::RuntimeShape({1, kHeight, kWidth, kInputDepth}),
+      bn5_ex_ifmap, tflite::RuntimeShape({1, kHeight, kWidth, kOutputDepth}),
+      output, scratch);
+}
+
+struct Stage {
+  const char* name;
+  void (*run)();
+  const int8_t* expected;
+  const char* expected_name;
+  int size;
+};
+
+const Stage kFirmwareStages[] = {
+    {"ex", Expand, bn5_dw_ifmap, "bn5_dw_ifmap", kPixels * kExpandDepth},
+    {"dw", Depthwise, bn5_pr_ifmap, "bn5_pr_ifmap", kPixels * kExpandDepth},
+    {"pr", Project, bn5_final_output, "bn5_final_output",
+     kPixels * kOutputDepth},
+};
+
+const Stage kFusedStages[] = {
+    {"ex+dw+pr", Fused, bn5_final_output, "bn5_final_output",
+     kPixels * kOutputDepth},
+};
+
+struct Kernel {
+  const char* name;
+  const Stage* stages;
+  int num_stages;
+};
+
+const Kernel kKernels[] = {
+    {"firmware", kFirmwareStages,
+     sizeof(kFirmwareStages) / sizeof(kFirmwareStages[0])},
+    {"fused", kFusedStages, sizeof(kFusedStages) / sizeof(kFusedStages[0])},
+};
+constexpr int kNumKernels = sizeof(kKernels) / sizeof(kKernels[0]);
+
+// Runs `stage` `runs` times and prints how it went. Returns its median
+// cycles.
+unsigned RunStage(const Stage& stage, int runs) {
+  unsigned cycles[kMaxBn5Runs];
+  for (int i = 0; i < runs; ++i) {
+    const unsigned start = perf_get_mcycle();
+    stage.run();
+    cycles[i] = perf_get_mcycle() - start;
+  }
+  std::sort(cycles, cycles + runs);
+  const unsigned median = cycles[runs / 2];
+
+  int mismatches = 0;
+  int first = 0;
+  for (int i = 0; i < stage.size; ++i) {
+    if (output[i] != stage.expected[i] && mismatches++ == 0) first = i;
+  }
+  printf("%s: min %u, median %u cycles; ", stage.name, cycles[0], median);
+  if (mismatches == 0) {
+    printf("OK against %s\n", stage.expected_name);
+  } else {
+    printf("FAIL: %d mismatches against %s, the first at %d: got %d, "
+           "expected %d\n",
+           mismatches, stage.expected_name, first, output[first],
+           stage.expected[first]);
+  }
+  return median;
+}
+
+}  // namespace
+
+int NumBn5Kernels() { return kNumKernels; }
+
+const char* Bn5KernelName(int kernel) { return kKernels[kernel].name; }
+
+void RunBn5Benchmark(int kernel, int runs) {
+  runs = std::min(std::max(runs, 1), kMaxBn5Runs);
+  const Kernel& k = kKernels[kernel];
+  printf("bn5 stages, %s kernels, %d runs each\n", k.name, runs);
+  unsigned total = 0;
+  for (int i = 0; i < k.num_stages; ++i) {
+    total += RunStage(k.stages[i], runs);
+  }
+  printf("ex + dw + pr: %u cycles (medians)\n", total);
+}
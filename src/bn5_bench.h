@@ -0,0 +1,28 @@
+#pragma once
+
+// Microbenchmark of bottleneck 5 (ops 15-17), one stage at a time, on the
+// data captured in bn5_data.h, for kernel work that should not wait for a
+// whole inference.
+//
+// Each stage runs `runs` times on its captured input, and its output is
+// checked against the captured input of the next stage, or bn5_final_output
+// for the last. For each stage the benchmark prints the fewest and the median
+// cycles over the runs, then the sum of the medians.
+//
+// Kernels, by number:
+//   0 firmware: expansion, depthwise and projection as separate stages,
+//     through the code an inference runs: OptimizedConvPerChannel
+//     (conv_kernels.h) for the 1x1 convs and the depthwise kernel that
+//     depthwise_conv.cc calls. With FUSE_RESIDUAL_ADD the projection runs
+//     Conv1x1ResidualPerChannel instead, which also needs the ADD; that is
+//     not captured, so it is not timed here.
+//   1 fused: the whole block as one stage, through FusedBottleneckPerChannel
+//     (fused_bottleneck.h).
+
+// Most runs per stage.
+constexpr int kMaxBn5Runs = 63;
+
+int NumBn5Kernels();
+const char* Bn5KernelName(int kernel);
+
+void RunBn5Benchmark(int kernel, int runs);
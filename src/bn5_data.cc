@@ -0,0 +1,5988 @@
+// Generated from data_capture_output.log (bottleneck 5 of mnv2, ops 15-17).
+
+#include "bn5_data.h"
+
+alignas(4) const int8_t bn5_ex_ifmap[6400] = {
+    -18, -5, -31, -33, -2, 11, 25, 1, -16, -6, 0, 6, 20, -13, -38, 11,
+    -14, -4, -29, -23, -6, 17, 24, 1, -13, -1, -2, 7, 14, -18, -35, 18,
+    -15, -4, -29, -22, -6, 17, 24, 2, -13, 0, -2, 7, 14, -18, -35, 18,
+    -15, -4, -29, -22, -6, 17, 24, 2, -13, 0, -2, 7, 14, -18, -35, 18,
+    -15, -4, -29, -22, -6, 17, 24, 2, -13, 0, -2, 7, 14, -18, -35, 18,
+    -15, -4, -29, -22, -6, 17, 24, 2, -13, 0, -2, 7, 14, -18, -35, 18,
+    -15, -4, -29, -22, -6, 17, 24, 2, -13, 0, -2, 7, 14, -18, -35, 18,
+    -15, -4, -29, -22, -6, 17, 24, 2, -13, 0, -2, 7, 14, -18, -35, 18,
+    -14, -4, -29, -23, -6, 17, 24, 2, -14, 0, -2, 7, 14, -18, -36, 18,
+    -14, -4, -29, -23, -6, 17, 25, 1, -14, -1, -2, 7, 14, -18, -35, 19,
+    -14, -4, -29, -23, -6, 17, 25, 1, -14, -1, -2, 7, 14, -18, -35, 19,
+    -14, -4, -29, -23, -6, 17, 25, 2, -14, -1, -2, 7, 15, -18, -35, 19,
+    -14, -4, -30, -23, -6, 16, 25, 1, -14, -2, -3, 7, 14, -18, -35, 19,
+    -14, -4, -29, -23, -5, 17, 25, 2, -14, 0, -2, 7, 14, -18, -35, 18,
+    -14, -4, -29, -23, -6, 17, 24, 1, -14, 1, -2, 7, 14, -18, -35, 18,
+    -14, -4, -29, -23, -6, 17, 24, 1, -14, 0, -2, 7, 14, -19, -35, 18,
+    -15, -4, -29, -23, -6, 17, 24, 2, -14, 0, -2, 7, 14, -18, -36, 18,
+    -14, -4, -29, -23, -6, 17, 24, 2, -14, 0, -2, 7, 14, -18, -36, 19,
+    -15, -4, -33, -20, -3, 17, 25, 4, -12, -4, 0, 8, 17, -14, -39, 18,
+    -24, -9, -15, -26, -11, -9, 19, 3, -13, 2, -11, 9, 9, -25, -31, 4,
+    -3, 0, -26, -38, -24, 6, 52, -11, -40, -19, -16, -2, 24, 23, -46, 9,
+    0, 5, -25, -28, -25, 16, 46, -15, -45, -16, -18, -5, 9, 14, -44, 13,
+    1, 5, -25, -28, -26, 17, 47, -16, -44, -16, -18, -7, 9, 13, -42, 13,
+    1, 5, -25, -28, -26, 17, 47, -15, -44, -16, -18, -7, 9, 13, -42, 13,
+    1, 5, -25, -28, -26, 17, 47, -15, -44, -16, -18, -7, 9, 13, -42, 13,
+    1, 5, -25, -28, -26, 17, 47, -15, -44, -16, -18, -7, 9, 13, -42, 13,
+    1, 5, -25, -28, -26, 17, 47, -15, -44, -16, -18, -7, 9, 13, -42, 13,
+    1, 5, -25, -28, -26, 17, 47, -15, -44, -16, -18, -7, 9, 13, -42, 13,
+    1, 5, -24, -28, -26, 16, 47, -16, -44, -16, -18, -7, 9, 13, -42, 13,
+    0, 4, -25, -27, -24, 16, 47, -15, -43, -12, -19, -5, 10, 14, -43, 12,
+    2, 5, -26, -28, -26, 17, 48, -16, -44, -16, -18, -7, 10, 14, -44, 14,
+    2, 5, -27, -26, -23, 17, 48, -14, -43, -17, -20, -2, 10, 15, -46, 14,
+    0, 3, -25, -26, -23, 16, 46, -14, -41, -8, -18, -4, 12, 15, -45, 12,
+    -1, 2, -30, -22, -19, 15, 42, -14, -33, -19, -19, 3, 11, 9, -43, 15,
+    -7, 1, -26, -20, -18, 17, 37, -9, -30, -20, -16, -5, 10, 1, -35, 13,
+    -5, 1, -24, -25, -22, 15, 37, -11, -34, -15, -12, -3, 10, 5, -39, 12,
+    -1, 2, -26, -24, -27, 15, 42, -18, -39, -18, -22, -4, 8, 13, -42, 15,
+    -4, 0, -28, -23, -15, 15, 35, -14, -32, -16, -19, -2, 9, 3, -39, 11,
+    -3, 1, -28, -24, -20, 14, 38, -9, -34, -16, -15, -6, 12, 9, -42, 11,
+    -8, -2, -13, -24, -28, -3, 38, -21, -33, -10, -17, -2, 5, 1, -30, 4,
+    34, 3, 8, 24, -11, 0, -11, -32, -28, 3, -27, -12, -7, 32, -27, 29,
+    28, -5, 11, 34, -9, 20, -13, -25, -13, -5, -15, -24, -33, 38, -24, 42,
+    26, -6, 10, 32, -17, 23, -14, -25, -16, -4, -16, -27, -27, 37, -28, 40,
+    27, -6, 10, 32, -16, 23, -14, -25, -16, -4, -16, -27, -26, 36, -28, 40,
+    27, -6, 10, 32, -16, 22, -14, -25, -16, -4, -16, -27, -26, 36, -28, 40,
+    27, -6, 10, 32, -17, 22, -14, -25, -16, -3, -16, -27, -26, 36, -27, 39,
+    26, -5, 10, 32, -17, 23, -14, -25, -16, -4, -16, -28, -27, 37, -28, 40,
+    27, -5, 10, 32, -17, 22, -14, -25, -16, -5, -16, -27, -26, 36, -27, 41,
+    27, -5, 9, 33, -17, 23, -14, -25, -16, -7, -16, -26, -26, 37, -28, 41,
+    32, -4, 3, 41, -17, 21, -19, -32, -15, -6, -16, -29, -23, 36, -28, 33,
+    33, -1, 1, 51, -9, 10, -34, -35, -14, 7, 8, -34, -16, 38, -26, 40,
+    38, -5, 17, 36, 10, 5, -28, -1, -13, 7, -9, -12, -28, 34, -18, 48,
+    37, -5, -1, 60, -4, 6, -40, -22, -10, -11, -11, -24, -19, 40, -31, 32,
+    25, -14, 29, 15, 33, -14, -23, 1, -26, 11, 5, -47, -5, 41, -19, -3,
+    19, -12, 15, -12, -3, 1, 23, -18, -25, 26, -5, -12, 0, 22, -11, -29,
+    21, -10, 26, -5, -9, -6, 29, -19, -31, 1, -24, -7, -13, 26, -5, -4,
+    23, -6, 16, 33, -5, 11, 12, -26, -22, -2, -23, -16, -20, 32, -12, 23,
+    19, -10, 28, -11, 8, -4, 40, -20, -38, -2, -19, -29, -9, 30, -8, -16,
+    19, -11, 16, -4, 0, -5, 12, -33, -28, 25, -22, -7, -11, 21, -8, -8,
+    30, -20, 27, 0, -4, -8, 2, -25, -15, 29, -7, -11, -11, 1, -7, -22,
+    5, -11, -19, 23, -2, 2, -21, -23, 5, 0, -13, -1, -16, -12, 4, -2,
+    -15, -18, -28, 25, -16, 13, -22, -7, 15, -13, -2, 1, -14, -17, 8, -1,
+    -13, -18, -34, 23, -26, 14, -18, -8, 14, -18, -4, -8, -8, -22, 6, -2,
+    -13, -18, -35, 22, -27, 15, -16, -9, 14, -18, -4, -10, -8, -22, 7, -1,
+    -13, -18, -35, 23, -27, 15, -18, -8, 13, -19, -3, -9, -7, -22, 6, -1,
+    -15, -18, -32, 23, -26, 15, -19, -6, 13, -14, -3, -4, -7, -20, 5, -1,
+    -8, -17, -35, 29, -26, 14, -21, -12, 13, -24, -6, -5, -6, -19, 4, -2,
+    1, -14, -32, 43, -19, 10, -35, -19, 11, -46, -3, -14, -4, -10, -1, 8,
+    3, -14, -29, 42, -18, 10, -30, -7, 13, -43, -4, -4, -8, -4, -2, 11,
+    7, -16, -17, 55, 2, -6, -38, -13, 2, -50, -8, -26, -6, 5, 10, 3,
+    -15, -11, 26, 0, 5, -33, -11, 9, -9, 40, 42, -14, 3, 28, -3, 8,
+    -13, -12, 20, -23, -4, -33, -6, 32, -19, 35, -6, 28, -11, 52, -46, 13,
+    -14, -15, 21, 4, -8, -15, -46, 15, 2, 12, 27, 22, -14, 40, -26, 32,
+    -18, -13, 11, -19, -13, -28, -5, -22, -22, 19, 44, -5, -3, 63, -46, -9,
+    -2, -19, 14, 9, 23, -25, -5, -17, -11, 20, 2, 13, -13, 14, 2, -26,
+    12, -23, 26, -6, -5, -6, 5, 3, -10, 7, 0, -3, -6, -14, 13, -20,
+    -12, -12, -31, 23, -9, 14, 6, -13, 10, -28, -15, 17, -17, -12, 6, 6,
+    6, -22, 35, 2, 6, -2, 14, 5, -9, 8, -12, -26, -10, -7, 16, -36,
+    14, -17, 3, 20, 0, -2, 8, -10, -2, -10, -7, 10, -14, -8, 15, -20,
+    -8, -16, -7, 4, -27, -13, -1, -9, 7, -17, -21, -4, -14, -21, 0, 15,
+    -8, -20, -34, 21, -21, 6, -28, -10, 18, -11, -4, -8, -14, -18, 10, -1,
+    -9, -20, -31, 17, -23, 10, -23, -9, 12, 0, -4, -10, -8, -19, 6, -4,
+    -11, -19, -31, 22, -24, 12, -25, -9, 13, -6, -7, -2, -7, -22, 6, -7,
+    -10, -18, -35, 23, -26, 14, -21, -11, 15, -18, -7, -8, -7, -23, 5, -5,
+    -2, -18, -37, 29, -25, 10, -24, -14, 14, -28, -11, -12, -7, -18, 3, -4,
+    1, -16, -29, 39, -18, 10, -32, -6, 14, -29, -10, -8, -7, -12, -2, 6,
+    9, -14, -20, 53, -6, -1, -42, -9, 9, -41, -8, -17, -5, 3, -1, 4,
+    -4, -13, 23, 10, 4, -22, -30, 6, -6, 22, 40, -28, 14, 34, -3, 17,
+    -8, -13, 30, 2, -8, -27, -6, 36, -16, 37, 10, 24, -1, 41, -18, 15,
+    -15, -8, 22, 2, -12, -23, -37, 16, 6, 22, 25, 7, -2, 43, -24, 38,
+    2, -14, 24, 8, 29, -28, 20, -4, -13, 24, 1, 10, 7, 32, -13, -29,
+    -9, -17, 2, 16, 16, -1, -15, 8, -3, 27, 3, -31, -3, 13, -7, 0,
+    -15, -13, 25, -9, -10, 8, 30, -8, -21, 19, -2, -14, 6, -4, -1, -18,
+    4, -20, 26, -7, 0, 1, -1, -35, -22, 37, -14, 1, -7, 7, -8, -10,
+    -8, -18, 16, -11, 16, -9, 8, 0, -21, 6, -1, -10, -1, 2, -9, -14,
+    -17, -16, 23, -27, -16, -25, 20, 5, -26, -14, -2, 19, -8, -10, 12, -25,
+    -12, -12, -26, 12, -21, 1, 8, -19, 8, -27, -18, 13, -19, -18, 16, 10,
+    -4, -15, 3, 7, -21, -1, 9, -2, 1, -17, -7, -13, -9, -13, 18, -10,
+    -5, -15, -4, 5, -6, 0, 2, -7, 8, -6, -9, 2, -11, -16, 10, -14,
+    -14, -20, -4, -3, -21, -10, 1, -12, 4, -5, -15, -9, -5, -35, 6, 7,
+    -11, -20, -31, 22, -21, 9, -29, -10, 15, -11, -8, 3, -12, -22, 7, -3,
+    -6, -18, -35, 26, -25, 11, -24, -14, 14, -17, -7, -10, -6, -20, 4, -7,
+    2, -17, -35, 42, -21, 10, -33, -12, 16, -31, -15, -9, -7, -13, -1, -3,
+    3, -13, -21, 44, -14, -1, -39, -11, 6, -19, 9, -7, -1, 1, 1, 12,
+    1, -16, 5, 43, 14, -16, -45, 27, 4, -4, 0, -3, -15, 18, 9, 21,
+    3, -16, 30, 21, 6, -27, -8, 48, -6, 29, 4, 4, -1, 30, 13, -8,
+    -5, -11, 26, 19, -5, -9, -21, 35, 6, 12, 22, -2, 9, 35, -12, 9,
+    -2, -13, 33, -1, 10, -31, 12, 12, -19, 22, 6, 12, 9, 38, -11, -19,
+    -5, -16, 12, 12, 10, -9, -11, -1, -6, 33, 4, -29, -1, 10, -4, 6,
+    -6, -12, 13, -18, -4, -5, 18, -5, -23, 21, 5, -1, 8, 8, -27, -15,
+    20, -23, 24, 1, 18, -10, -1, -14, -17, 21, -11, 0, -10, 0, 3, -16,
+    -12, -11, 17, -9, -10, -14, 25, 13, -24, 11, 4, -10, 6, 18, -6, -2,
+    -3, -14, 14, 7, 0, -4, 19, -24, -18, 17, -17, 15, -7, 7, 3, -9,
+    3, -19, 10, 14, -9, 8, -11, -15, 0, 6, 4, -3, -11, 0, -3, -5,
+    -9, -18, 8, 14, 2, -4, 4, -12, -1, 5, -3, -11, -13, -3, 12, -8,
+    -25, -15, 13, -3, -4, -17, 25, -5, -24, -27, -14, -5, -12, -2, 19, -33,
+    -20, -14, -23, 16, -12, 5, 6, -13, 9, -20, -6, 13, -13, -12, 5, 1,
+    -13, -17, 8, 4, -7, 10, 3, 7, 2, -9, 3, -6, -9, -22, 15, -6,
+    -10, -14, 8, -1, -11, 1, 1, 2, 5, 10, -6, 6, -7, -20, 13, -2,
+    -10, -18, 7, 7, -19, -6, -2, -9, 6, 5, -13, -7, -5, -39, 5, -3,
+    8, -19, -33, 33, -14, -5, -37, -13, 13, -38, -11, -2, -7, -6, -5, -3,
+    4, -15, -5, 44, 5, -3, -51, 7, 10, -21, 12, -3, -12, 15, -1, 22,
+    4, -13, 16, 26, -7, -29, -23, 42, -7, 14, 35, 5, 0, 36, 1, 22,
+    -16, -19, 28, 6, 17, -30, -24, 31, -8, 36, 18, -15, -4, 29, 2, 16,
+    -4, -18, 15, -13, -5, -17, -7, 30, -14, 24, -15, -3, 2, 48, -41, 4,
+    -3, -10, 16, 8, 12, -16, 7, -4, -11, 20, 18, 25, -8, 13, 1, 0,
+    -2, -6, 13, -5, -4, -16, 22, -4, -21, 21, 26, -28, 13, 6, -4, -9,
+    7, -16, 6, 2, 28, -17, 8, -34, -19, 19, -6, 17, -5, 12, -6, -21,
+    -7, -13, 9, -9, -10, -20, 18, 14, -18, 8, 4, -26, 7, 0, 7, -1,
+    -5, -10, 2, -9, -3, -16, 27, -29, -27, 8, -10, 21, -3, 12, -4, -12,
+    -1, -18, 7, 15, -3, 1, -9, -17, 1, 5, -4, 5, -14, 1, 17, 4,
+    -9, -17, 5, 8, -4, -17, 11, 2, -16, -8, -8, -28, -3, -2, 26, -12,
+    -10, -9, 6, 3, -6, 6, 28, -8, -17, 5, -11, 11, -1, -8, 7, 1,
+    -7, -15, 18, 12, -1, 11, -1, -11, 2, 23, -7, 0, -12, -16, 6, -2,
+    -6, -19, 3, 11, -4, 4, -3, 2, 5, 7, 4, -9, -8, -12, 1, -16,
+    -40, -9, -3, -5, -13, -12, 27, -3, -14, -35, 1, -2, -4, -13, 15, -11,
+    -18, -15, -16, 12, -4, 7, 10, -16, 1, -19, -17, 6, -11, -15, 7, -2,
+    -17, -20, -4, -1, -10, 0, 2, -8, 1, -6, -5, -6, -14, -16, 16, -8,
+    -15, -16, 6, 0, -6, 3, 9, -8, -3, 0, -16, -1, -7, -16, 18, -7,
+    -12, -19, 6, 7, -17, 0, 0, -5, 3, 10, -13, 0, -4, -36, 4, -3,
+    19, -28, 16, 24, 31, -35, -44, 35, 11, -6, 8, -4, -16, 6, 11, -18,
+    -11, -15, 24, -9, 18, -24, 1, 46, -15, 27, 9, -18, 11, 37, -21, 0,
+    1, -16, 29, 0, 21, -19, 16, 12, -21, 12, 3, -12, 0, 14, -2, -15,
+    -16, -10, 22, -2, 17, -8, 37, 9, -26, 24, -6, 5, 10, 9, -16, -31,
+    -13, -11, 13, -6, 6, -3, 20, -4, -22, 19, 11, -14, 10, 9, -15, -9,
+    5, -12, 8, 13, 12, -8, 22, -19, -17, 20, -14, 7, -10, 2, 13, -13,
+    -6, -14, 15, -7, 4, -16, 36, 8, -26, 0, -15, -16, 7, -5, 19, -28,
+    3, -16, 4, 19, 4, -7, -3, -14, -3, 9, -4, 17, -14, 0, 16, -3,
+    -11, -17, -3, 7, -1, -8, 16, 0, -7, -7, -16, -38, -4, -9, 22, -13,
+    -10, -15, 16, -2, 5, 0, 6, -9, -13, 20, -14, 25, -11, -1, -2, -21,
+    -2, -21, 11, 13, -4, 14, -14, -13, 12, -3, -4, 3, -17, -4, -3, -21,
+    -27, -14, -12, 1, -5, 1, 10, -2, -7, 1, 8, -28, 6, -17, 16, -4,
+    -2, -14, 6, -14, 3, 2, 7, -14, -11, 21, -15, 10, -2, -14, -7, -7,
+    -8, -15, 16, 17, 1, 17, 8, -17, 6, 20, -10, 1, -18, -5, 4, -5,
+    -5, -21, -2, 7, 1, 6, -1, 1, 4, 11, -2, -24, -10, -15, 7, -17,
+    -12, -10, -4, -7, -2, -5, 34, -3, -15, -3, -4, -11, -2, -15, 5, -7,
+    -11, -13, -18, 18, -2, 7, 3, -11, 8, -19, -6, 9, -15, -13, 7, -8,
+    -13, -16, -3, 0, -15, -10, -5, -7, 1, -17, 6, -2, -8, -14, 17, 0,
+    -2, -13, 7, 0, -8, -7, -6, -10, 3, 1, 9, 9, -7, -6, 11, -5,
+    -11, -17, 3, 8, -25, 2, -7, -20, 5, -1, -10, -9, -3, -28, -6, 2,
+    1, -12, 9, 7, 6, -31, -19, 5, -4, -7, 9, -6, -19, -11, 22, -2,
+    -12, -12, 15, 2, 0, -21, 28, 5, -18, -8, 13, -32, 2, -1, 11, -28,
+    -1, -16, 23, 2, 4, -8, 24, -8, -17, 1, -18, 1, -11, -9, 22, -9,
+    0, -14, 15, 3, 8, -11, 26, -22, -17, 0, -6, -2, -4, -6, 22, -15,
+    1, -18, 10, -4, 6, -12, 11, 2, -16, 3, -8, -17, 1, -8, 13, -24,
+    0, -13, -3, 37, 16, 1, 13, -18, -2, 8, -3, 5, -15, -1, 15, -12,
+    -15, -11, -5, 1, 4, -13, 28, 3, -10, 4, -5, -16, 12, 0, 10, -27,
+    -3, -18, 19, 12, 18, 3, 0, -4, -6, 16, 0, 12, -11, -14, 10, -11,
+    -17, -12, -1, 6, -5, 1, 16, 4, 2, 0, -1, -26, -4, -15, 16, -6,
+    -7, -14, 8, 1, 0, 2, 17, -7, -9, 25, -16, 21, -2, 0, -5, -13,
+    -3, -21, 8, 14, 3, 10, -7, 7, 9, 3, 1, -3, -14, -16, 10, -15,
+    -19, -13, -18, -2, -6, -2, 17, -7, -7, -7, 0, -25, 7, -17, 9, -5,
+    -4, -14, -12, 0, -8, 3, 6, -21, -4, -2, -16, 13, -6, -14, 4, 0,
+    -6, -15, -18, 19, -12, 7, -1, -19, 10, 9, -12, 6, -17, -10, 9, -2,
+    -16, -18, -13, 18, -5, 1, -3, -1, 0, 0, 1, -32, -6, -18, 20, -4,
+    -21, -10, -13, 0, -1, 0, 34, -6, -8, -17, -14, -1, -3, -16, 6, 2,
+    -9, -12, -17, 18, -16, 6, 8, -17, 4, -17, -18, -1, -17, -18, 18, 0,
+    -21, -13, 3, 0, 1, -11, 17, 11, -14, -21, -1, -18, -4, 0, 15, -17,
+    -4, -12, 18, 9, 12, -11, 34, 7, -18, -1, -13, 33, -6, 21, 8, -47,
+    -20, -18, 17, 9, -11, 5, -12, -4, 4, 12, 11, -10, 1, -29, -11, -17,
+    -16, -11, 28, -1, 7, -7, -10, 9, -6, 8, 10, 2, -9, -8, 4, -10,
+    -14, -12, 5, 22, -2, -3, 27, 13, -3, -9, -7, -23, -10, -13, 28, -6,
+    -19, -13, 5, 10, 6, -7, 26, -17, -9, -12, 9, -3, -4, -15, 27, -21,
+    -22, -12, -5, 11, 0, -5, 26, -27, -10, -5, 8, 7, -5, -12, 25, -7,
+    -22, -6, -3, 8, -12, 6, 33, -19, -1, -25, 0, -4, 0, -18, 21, -1,
+    -13, -14, -4, 28, 0, 9, -1, -15, 5, -2, 1, 2, -12, 1, 0, -3,
+    -6, -12, 12, 2, -6, -1, 26, 8, -5, 13, 1, -6, 6, -5, 2, -22,
+    -6, -17, -3, 19, 4, -7, -5, 1, -2, 18, -5, 10, -13, -10, 14, 0,
+    -23, -10, -15, -1, 0, -1, 19, -7, 0, 8, 6, -14, 11, -14, 6, -2,
+    3, -13, -6, 1, -8, 2, 2, -23, -7, 16, -13, 10, -6, -17, 6, -4,
+    -1, -19, 2, 10, 11, -5, -10, -10, 4, 5, 18, -9, -17, -20, 16, -2,
+    -21, -10, -10, -3, -5, -1, 18, -2, -8, -1, 4, -19, 4, -21, 9, -1,
+    -13, -15, -14, 10, -4, 4, 4, -12, 2, 11, -11, 20, -8, -15, 6, -3,
+    -12, -17, -16, 18, -13, 8, -12, -6, 8, 6, -9, 9, -10, -14, 3, -11,
+    -16, -14, -14, 23, -9, 4, 7, -1, 2, -15, -4, -30, -3, -24, 25, 4,
+    -28, -8, -12, 0, -9, 1, 40, -11, -6, -21, -7, -4, 1, -17, 4, 2,
+    -10, -14, -2, 22, -9, 15, 3, -9, 5, 9, -13, 5, -16, -8, 7, 2,
+    -16, -13, -6, 8, -8, 6, 14, -2, -2, -2, -13, -28, -7, -17, 20, -11,
+    -12, -10, 22, 2, 5, 1, 26, -10, -13, 2, -20, 1, -4, -4, 13, -18,
+    -2, -23, 29, 3, -21, 0, -9, -6, -5, 10, -4, -13, -2, -9, -16, -24,
+    -10, -16, 8, 1, 4, -3, -4, 7, 9, 6, 18, -1, -10, -17, 14, 3,
+    -27, -13, 7, 7, -14, 1, 24, 1, -5, -27, -1, -9, -8, -24, 31, 2,
+    -15, -11, 1, 16, -2, -3, 21, -1, -5, -17, 4, -1, 1, -16, 23, -18,
+    -18, -9, 0, 23, 13, -5, 24, 3, -9, 4, -2, 6, 3, -5, 14, -5,
+    -18, -12, 3, 15, -4, 8, 27, 7, 0, -14, 6, 1, -1, -13, 10, -20,
+    -16, -14, 1, 24, 4, 2, -3, 1, -2, 7, 0, 1, -8, -7, 11, -1,
+    -10, -14, 18, 2, -9, 6, 14, 14, -5, 12, 0, -12, 2, -10, 8, -15,
+    1, -20, 15, 6, 7, -6, -4, 11, -1, 12, 3, 10, -7, -15, 12, -16,
+    -28, -11, -8, 2, -10, 4, 17, 1, 4, -6, -4, -8, 3, -19, 11, -1,
+    -8, -15, 9, 5, -6, 6, -8, 3, -2, 10, -6, 18, -9, -20, 8, -5,
+    1, -20, -8, 12, -2, -7, -19, 2, 8, 9, -2, -9, -16, -14, 12, 0,
+    -18, -11, -15, -2, -13, 1, 15, -2, -5, -8, -4, -24, 3, -17, 14, -1,
+    -24, -13, -6, 11, -3, 8, 5, 4, 2, 13, -10, 28, -4, -11, 5, -3,
+    -18, -17, -8, 19, -13, 14, -20, -7, 11, 3, -7, 13, -12, -11, -5, -1,
+    -16, -17, -2, 21, -2, 11, -7, 4, 6, 3, 11, -25, -5, -14, 9, -1,
+    -26, -10, -5, -6, -4, -6, 35, 4, -7, -21, -13, -9, 8, -18, 6, 2,
+    -9, -13, -3, 24, -2, 5, 5, -3, -1, -16, -13, 7, -12, -10, 11, 4,
+    -20, -13, -11, 14, -10, 11, 8, -4, 3, -10, -4, -21, -5, -17, 20, -10,
+    -16, -11, 10, 5, 3, -2, 26, 8, -10, -2, -13, 2, 0, -9, 21, -15,
+    -14, -18, -1, 8, -23, 1, 0, -18, 6, -3, -17, -15, -6, -31, 9, 6,
+    -17, -13, -8, -9, -8, -1, 15, 10, -5, -1, -5, -4, 6, -5, -6, 4,
+    -22, -12, 12, 4, -5, -5, 28, 3, -10, -15, 3, 5, -9, -17, 26, -7,
+    -14, -10, 3, 15, 0, -13, 16, 2, -8, -19, 2, 2, 7, -5, 21, -32,
+    -7, -13, 11, 4, 10, -16, 28, 18, -13, 9, -1, 15, 7, 6, 16, -29,
+    -11, -16, 15, -4, -4, -11, 20, 22, -10, 1, 2, -9, 12, 1, 4, -42,
+    -13, -14, 21, 10, 9, -5, 0, -6, -11, 24, 7, 13, -9, 4, 7, -10,
+    -22, -12, 33, -6, -8, 2, 18, 9, -12, 23, 5, -13, 4, -6, 5, -15,
+    1, -19, 16, 1, 1, -4, 6, 11, -8, 13, -6, 21, -6, -11, 13, -23,
+    -24, -14, -6, 10, -8, -4, 23, 13, -6, 5, -2, -11, 1, -8, 15, -6,
+    -10, -15, 12, -5, -21, 1, 9, 6, -6, 4, 2, 16, -1, -12, 8, -3,
+    -8, -20, 12, 5, -1, -1, 0, 12, -2, 9, -3, 13, -4, -17, 9, -18,
+    -23, -14, -7, 7, -13, -5, 17, 4, -4, -4, -3, -33, 4, -5, 11, -9,
+    -13, -14, 20, -4, -6, -1, 22, 0, -14, 28, -13, 29, 4, 9, -11, -22,
+    -13, -16, 4, 16, -7, 14, 2, -10, 2, 20, -18, 8, -7, -13, 5, -9,
+    -9, -16, -1, 12, -18, 4, 11, 4, -1, 0, -6, -20, -3, -23, 17, -10,
+    -17, -7, -8, 0, -14, -9, 41, 6, -9, -27, -20, -18, 5, -18, 10, 3,
+    -18, -13, -7, 14, -6, -6, 20, 0, -14, -42, -17, 17, -15, -11, 19, -7,
+    -20, -14, -13, 7, -8, 9, 9, -5, 6, -15, -9, -8, -16, -14, 12, -9,
+    -6, -16, 12, 1, 2, -4, 1, -1, -6, 4, -7, 2, -7, -9, 7, -15,
+    -14, -18, -6, 5, -23, -4, -10, -15, 13, 15, -15, -4, -6, -29, -7, -3,
+    -22, -14, -9, 8, -1, 0, 4, 7, 1, 5, 0, -11, -5, -8, -1, -11,
+    -23, -8, 30, 1, 4, -5, 27, -4, -17, 9, 13, 3, -1, -17, 18, -15,
+    -26, -10, -5, 16, -3, -8, 27, 0, -11, -13, 6, 2, 2, -2, 16, -21,
+    -16, -12, -3, 10, 10, -10, 25, -7, -9, 10, 11, 20, 0, -1, 9, -24,
+    -19, -13, 7, 8, 3, 1, 21, 3, -5, 7, 5, -14, 7, 0, 9, -22,
+    -5, -11, 5, 35, 13, 7, 16, -14, -7, 12, -2, 4, -9, -5, 7, -16,
+    -10, -14, 18, -3, -2, 0, 18, 1, -12, 19, 4, -17, -3, -12, 8, -12,
+    -1, -16, 26, 2, -4, 5, 17, -1, -11, 8, 0, 13, -4, -9, 15, -33,
+    -30, -10, -4, 0, -3, -10, 27, -1, -8, -9, 5, -12, 11, -7, 14, -8,
+    3, -16, 19, -2, -19, -7, 8, -20, -17, 6, -4, 14, -3, -3, 8, -14,
+    -5, -18, 24, 8, -1, 5, 2, -3, -7, 2, 0, 7, -6, -9, 12, -22,
+    -28, -11, -17, 7, -2, 5, 13, 6, 0, -9, -1, -17, 6, -7, 3, -1,
+    -11, -11, 16, 8, -4, 13, 15, -17, -12, 19, -4, 19, 3, 5, -2, -17,
+    -13, -16, 14, 21, -1, 12, -8, -9, -3, 13, -5, 8, -9, -8, 6, -4,
+    -15, -15, 16, 25, -1, 10, -3, 4, -5, -4, 4, -18, -4, -11, 11, -19,
+    -19, -11, -1, -6, 10, 3, 28, 13, -8, -16, 1, -13, 8, -5, 4, -2,
+    7, -22, 9, 9, 16, -1, 14, 3, -7, -27, -6, 11, -13, -14, 16, -37,
+    -8, -16, -16, 9, -2, 7, 11, -11, 4, -15, -4, -11, -9, -8, 4, -5,
+    -13, -13, 32, 0, 0, -24, 29, 18, -18, 3, 7, 3, -11, 2, 11, -37,
+    -16, -13, -12, 4, -23, -9, -5, -12, 11, 5, -16, -6, -5, -35, -3, 4,
+    -19, -10, -5, -1, -7, -3, 9, 10, -5, 2, 13, -1, -1, -9, 5, 5,
+    -19, -11, 17, 3, 24, -8, 29, -7, -16, 6, 7, -10, 4, 1, 10, -20,
+    -20, -12, 6, 14, 25, -18, 20, -15, -23, -14, 5, -2, 6, 19, 8, -31,
+    -17, -9, 1, 4, 21, -9, 36, -10, -20, 4, -4, 17, 4, 7, 8, -26,
+    -26, -11, 7, 1, 19, -13, 21, 19, -22, 11, 13, -7, 13, 9, -9, -28,
+    -8, -10, 5, 28, 26, 0, 12, -12, -10, 0, -14, 9, -7, 2, 8, 0,
+    -26, -12, 3, -6, -5, -3, 23, 11, -6, 10, 3, -6, 6, 2, 3, -9,
+    6, -13, -2, 18, -14, -6, 7, -25, -10, -28, -14, 6, -8, -2, 20, 4,
+    -27, -12, 4, 12, 6, -3, 22, 13, -11, 2, -17, -26, 6, 5, 1, -12,
+    -5, -15, 15, 8, -10, 4, 8, -6, -12, 2, -10, 21, -5, -1, 3, -9,
+    2, -16, 6, 13, -15, 6, -12, -20, -1, -8, -8, 1, -3, -5, 2, -2,
+    -17, -16, -5, 8, -15, -1, 17, -2, -10, -7, -13, -37, 1, 1, 7, -6,
+    -13, -12, 11, 13, 0, 3, 18, -14, -13, 7, -15, 27, 0, 14, -4, -19,
+    -18, -13, 7, 28, -5, 17, -10, -19, -2, 8, -8, 4, -7, -2, -5, -3,
+    -17, -12, 18, 20, 0, 13, 14, 2, -4, -11, -7, -10, -11, -13, 17, -5,
+    -14, -9, -7, 0, -4, -7, 39, 5, -10, -27, -24, -22, 8, 3, 3, -5,
+    -10, -12, -10, 26, 8, -13, 20, -5, -14, -36, -21, 12, -7, 4, 17, -21,
+    -19, -14, -24, 17, -1, 1, 1, -2, 5, -5, -8, -2, -7, -10, -1, -10,
+    -8, -16, 19, -2, -3, -6, 15, -4, -2, -7, -4, -15, -10, -15, 21, -17,
+    -18, -17, -6, 6, -13, -5, -3, -8, 10, 12, -6, -3, -8, -30, 6, 2,
+    0, -16, 15, -17, -8, -15, 9, 4, -15, 24, -8, -7, 6, 19, -12, -20,
+    -22, -13, 13, -8, 1, 1, 14, -1, -13, 9, -2, -4, 1, 16, -14, -6,
+    -17, -12, 18, 4, -1, 0, 11, -3, -14, 3, -1, -4, -11, 18, -5, -5,
+    -8, -8, 12, 12, 16, -5, 15, -2, -14, 4, 1, -1, -5, 8, 21, -6,
+    -21, -7, -2, -2, 3, -10, 32, -4, -22, 12, 9, -9, 5, 20, -9, -24,
+    -10, -9, 10, 25, 17, 0, 5, -14, -8, -6, 0, 3, -19, 12, 12, -3,
+    -21, -10, 6, -13, -6, -7, 34, 21, -25, 0, -6, -13, 14, 21, -10, -25,
+    -8, -10, 13, 12, 7, -5, 18, -8, -17, -5, -12, 15, -9, -2, 14, -1,
+    -15, -15, 18, 8, -3, 14, 16, 5, -7, 11, -3, -32, 3, 6, -5, -16,
+    -13, -8, -13, -4, 0, -17, 36, 12, -20, -9, -16, 28, 5, 12, -2, -17,
+    -3, -15, 9, 14, -14, 9, -12, -6, -3, -5, -10, 3, -3, -3, 6, -4,
+    -22, -16, 18, 8, -9, 12, -2, 8, -12, 18, 0, -35, 0, 1, -3, -14,
+    -5, -10, -8, 1, 15, -12, 38, 27, -16, -6, -15, 29, 10, 10, -3, -27,
+    -18, -13, -16, 17, -12, 4, -1, -2, 3, -4, -14, 14, -4, -10, 7, -4,
+    -9, -18, 26, 14, 3, 15, 9, -3, -7, -4, -16, -6, -9, 0, -6, -16,
+    -24, -15, 33, -2, -10, -5, 17, -12, -19, -1, 2, -13, -1, 15, 0, -27,
+    -12, -16, -3, 15, 4, -12, 1, -13, -4, -28, 8, 28, -5, 7, 6, -38,
+    -25, -13, -11, 10, 3, 3, 0, -13, 1, -10, -4, -3, -8, -7, 0, -10,
+    -9, -11, 14, 2, 9, -4, 20, -9, 0, -7, -8, -4, -12, 0, 11, -9,
+    -19, -13, -7, 0, -16, -2, -2, -8, 8, 12, -3, -15, 2, -32, -8, 4,
+    -2, -15, -4, 5, -6, -1, -27, -10, 0, 19, -10, -21, -2, -8, -16, -7,
+    -12, -15, 7, -6, -8, 6, -8, -3, -6, 25, -25, -34, 5, 0, -32, -16,
+    -1, -15, 13, -3, -9, 3, -3, -21, -6, 20, -18, -9, 0, -7, -21, -19,
+    -1, -14, 3, 6, -12, 3, -5, -5, -2, 23, -5, -25, 8, -2, -11, -5,
+    6, -3, 16, -8, -7, -6, 20, 1, -5, 16, -17, -15, 19, 5, -35, -12,
+    -9, 2, 21, 2, -2, -2, 15, -9, 8, 10, -1, -3, 3, 1, -26, 9,
+    -10, -8, 16, -6, 3, -8, 16, -41, -6, 16, -9, -5, 13, 31, -37, -17,
+    11, -19, 9, 12, -1, -12, 0, -17, -5, -6, -9, 4, -20, 29, 2, -23,
+    -10, -16, -2, 10, -10, 10, -28, 6, -1, 7, -7, -29, 3, 20, -25, -7,
+    2, -17, 11, -6, 3, -1, -4, 9, -21, 20, -11, -9, 4, 25, -20, -17,
+    0, -14, 6, 15, 5, 0, -16, 6, -4, 13, 9, 25, -1, 10, 8, -5,
+    -13, -10, 1, 16, -9, 20, 6, 10, 3, 7, 5, -31, -2, 3, 12, -9,
+    -13, -6, -6, -17, -4, 5, 18, 10, -14, 1, 8, 5, 10, 22, -10, -3,
+    -15, -5, 8, 6, -21, 5, 8, 3, -3, 19, -6, 27, 3, 21, -13, 10,
+    -4, -12, -4, 17, 0, 7, 9, -10, 6, 15, -15, 0, -2, 3, -14, -5,
+    23, -17, 16, -1, 1, -9, 14, -7, -8, 12, -14, -9, 1, 5, 0, -5,
+    -9, -16, 8, 9, 1, 14, -15, -4, 1, 6, -2, 6, -2, 0, -8, -6,
+    -17, -15, 12, -2, 1, 13, -8, -5, 4, 15, -2, 2, 6, 13, -17, -12,
+    4, -17, 19, 7, 15, -3, -10, -11, 6, 23, -3, -3, -15, 10, -2, -4,
+    0, -15, 31, -12, -6, -13, -10, -10, 7, 19, 8, -10, 10, -24, -18, -26,
+    -6, -16, 28, 10, 3, 0, -26, -3, 3, 16, 10, 6, -5, 9, 0, 4,
+    4, -10, 7, 26, -8, 0, -15, -18, 6, -5, -13, -8, -8, 2, -9, 18,
+    -5, -18, 2, 28, 3, 8, -32, -13, 5, 3, -8, -7, -11, 4, -6, 7,
+    -15, -12, 16, 24, 0, 15, -24, -3, 8, 11, -7, -17, -4, -4, -15, 12,
+    9, -10, 17, 22, 0, 0, -16, -21, -1, 7, -17, -9, 1, 18, -19, 16,
+    -11, -5, 10, 17, 4, 10, -32, -22, -1, -1, 3, -7, -14, 8, -2, 10,
+    5, 2, 15, 20, 14, -2, -32, -22, -15, 0, 3, -1, -15, 8, 19, 10,
+    -6, 5, 34, 35, 11, 1, -25, -30, -28, -4, -3, -22, -1, 29, 16, 11,
+    -7, -15, 32, -1, 2, -5, -3, -1, -11, 5, -10, 0, 2, 23, -5, 1,
+    -9, -3, 29, 16, -3, 3, -10, -10, 6, 15, -8, -6, 19, 4, -15, 10,
+    5, -6, 23, 7, 4, -11, -5, -25, -6, 18, -9, 5, 14, 19, -14, 6,
+    -11, -7, 24, 12, -2, 0, -15, 2, 4, 24, -15, -23, 8, 3, -13, 8,
+    3, 0, 30, -9, 4, -12, 4, -19, -1, 16, -28, -9, 25, -3, -32, 11,
+    32, -1, 24, 17, -1, -15, -1, -38, -9, 9, -20, 7, 11, 25, -20, 23,
+    3, -14, 20, 39, 15, 9, -28, -7, -2, 0, -10, -2, -14, 15, 0, 18,
+    5, -14, 6, 34, -1, 16, -36, -7, 8, 1, -1, -6, -9, 2, -4, 24,
+    2, -15, 6, 34, -5, 30, -31, -9, 12, -3, -8, -16, -8, 10, -19, 11,
+    -15, -15, 8, 32, 15, 11, -30, -2, -1, -6, -6, -14, -10, 14, 0, 0,
+    1, -7, 27, 29, 27, -11, -8, 7, -10, -15, -4, 13, -9, 14, 1, -26,
+    7, -11, -1, 31, -10, 4, -31, -24, 4, -16, 4, -1, 3, -2, -18, 8,
+    -23, -7, 24, -11, -24, 10, -10, -1, -22, -1, 5, 11, -2, 34, -53, 34,
+    -25, -6, 28, 3, -26, 21, -11, 5, -24, 0, -7, 12, -8, 41, -50, 39,
+    -23, -8, 25, 3, -29, 26, -16, -4, -23, -9, -4, 9, -10, 45, -56, 32,
+    -26, -5, 25, 7, -33, 28, -13, -9, -25, -8, -5, 7, -8, 47, -54, 35,
+    -23, -6, 23, 9, -29, 28, -15, -5, -25, -9, 1, 10, -6, 49, -54, 32,
+    -28, -8, 28, -6, -18, 25, -10, -6, -26, -5, -1, 4, -6, 40, -52, 31,
+    -16, -7, 31, -1, -14, 19, -5, 6, -26, -2, 6, 13, -4, 32, -44, 39,
+    -28, -7, 30, -8, -14, 14, -5, -2, -21, -2, 1, 14, -11, 40, -51, 21,
+    -19, -7, 23, 6, -18, 17, -13, -17, -23, -7, -6, 12, -6, 44, -56, 27,
+    -17, -4, 25, 8, -29, 27, -11, -4, -27, -4, -3, 5, 2, 38, -44, 37,
+    -25, -6, 24, 9, -29, 26, -14, -5, -27, -6, -4, 8, 1, 43, -46, 32,
+    -22, -6, 24, 4, -27, 23, -9, -5, -25, -1, -3, 6, -4, 38, -49, 31,
+    -12, -7, 25, 0, -19, 13, -15, -18, -27, -4, 0, 8, -5, 40, -45, 41,
+    -18, 0, 21, 15, -29, 28, -19, 1, -28, -14, 0, 15, 2, 53, -51, 42,
+    -24, -9, 26, 4, -32, 25, -18, -9, -24, -11, -5, 6, -2, 50, -58, 33,
+    -29, -8, 28, 0, -25, 23, -15, -9, -25, -9, -4, 8, -8, 46, -57, 33,
+    -28, -8, 28, 3, -25, 26, -15, -8, -21, -11, -7, 6, -12, 49, -64, 34,
+    -33, -6, 29, 3, -18, 13, -9, 2, -24, -11, 6, 15, -10, 47, -53, 24,
+    -4, -6, 47, 1, -5, 7, 19, -3, -30, -17, 16, 14, 6, 32, -38, 6,
+    -7, -14, 31, 1, -22, 7, -7, 9, -14, -7, 14, 16, 3, 14, -48, -7,
+    -16, -5, -33, -30, 0, 13, 33, -5, -20, -10, -8, 0, 16, -17, -30, 7,
+    -11, -4, -31, -21, -3, 21, 27, -7, -17, -2, -10, 1, 10, -21, -23, 14,
+    -11, -4, -31, -21, -3, 21, 27, -7, -17, -3, -10, 1, 10, -21, -22, 14,
+    -11, -4, -31, -21, -3, 21, 27, -8, -17, -3, -10, 1, 10, -21, -22, 14,
+    -12, -4, -31, -21, -3, 21, 27, -7, -17, -3, -10, 1, 10, -21, -22, 14,
+    -12, -3, -31, -21, -3, 21, 26, -7, -17, -3, -10, 1, 10, -21, -23, 14,
+    -11, -3, -32, -21, -3, 21, 27, -7, -17, -3, -10, 1, 11, -20, -23, 14,
+    -13, -4, -31, -20, -3, 22, 27, -5, -17, -3, -10, 2, 10, -21, -23, 14,
+    -12, -3, -31, -22, -3, 21, 26, -6, -17, -3, -10, 1, 10, -21, -22, 14,
+    -11, -4, -31, -21, -3, 21, 27, -7, -17, -3, -10, 1, 10, -21, -22, 14,
+    -12, -4, -30, -20, -3, 21, 28, -5, -17, -2, -11, -1, 9, -21, -21, 13,
+    -11, -4, -31, -21, -3, 20, 28, -7, -17, -2, -11, -2, 10, -20, -22, 13,
+    -12, -4, -30, -21, -3, 21, 29, -8, -17, -5, -11, 0, 10, -21, -21, 14,
+    -11, -4, -30, -21, -3, 21, 27, -8, -17, -2, -11, 2, 10, -21, -22, 14,
+    -11, -4, -31, -20, -3, 21, 27, -6, -17, -3, -10, 0, 10, -21, -23, 14,
+    -12, -4, -29, -21, -4, 21, 28, -7, -17, -3, -11, 0, 10, -22, -21, 13,
+    -12, -4, -31, -21, -3, 21, 29, -6, -17, -5, -11, -1, 10, -20, -23, 14,
+    -12, -3, -31, -21, -3, 21, 27, -7, -17, -3, -10, 1, 10, -20, -23, 14,
+    -13, -3, -36, -19, 0, 21, 27, -1, -16, -7, -8, 0, 12, -16, -29, 12,
+    -23, -6, -21, -20, -10, 6, 24, -5, -19, -5, -14, -3, 4, -26, -20, 7,
+    -6, -6, -24, -27, -17, 3, 26, -1, -17, 10, -10, -13, 12, -23, -37, 7,
+    -7, -3, -23, -20, -15, 15, 24, -2, -19, 13, -8, -10, 7, -24, -29, 9,
+    -7, -3, -23, -20, -15, 15, 24, -2, -19, 13, -8, -10, 7, -24, -29, 9,
+    -7, -3, -23, -20, -15, 15, 24, -2, -19, 13, -8, -10, 7, -24, -29, 9,
+    -7, -3, -23, -20, -15, 15, 24, -2, -19, 13, -8, -10, 7, -24, -29, 9,
+    -7, -3, -23, -20, -15, 15, 24, -2, -19, 13, -8, -10, 7, -24, -29, 9,
+    -7, -3, -23, -20, -15, 15, 24, -2, -19, 13, -8, -10, 7, -24, -29, 9,
+    -7, -3, -23, -20, -15, 15, 24, -2, -19, 13, -8, -10, 7, -24, -29, 9,
+    -7, -3, -23, -20, -15, 15, 24, -2, -19, 13, -8, -10, 7, -24, -29, 9,
+    -7, -3, -23, -20, -15, 15, 24, -2, -19, 13, -8, -10, 7, -24, -29, 9,
+    -7, -3, -23, -20, -15, 15, 24, -2, -19, 13, -8, -10, 7, -24, -29, 9,
+    -7, -3, -23, -20, -15, 15, 24, -2, -19, 13, -8, -10, 7, -24, -29, 9,
+    -7, -3, -23, -20, -15, 15, 24, -2, -19, 13, -8, -10, 7, -24, -29, 9,
+    -7, -3, -23, -20, -15, 15, 24, -2, -19, 13, -8, -10, 7, -24, -29, 9,
+    -7, -3, -23, -20, -15, 15, 24, -2, -19, 13, -8, -10, 7, -24, -29, 9,
+    -7, -3, -23, -20, -15, 15, 24, -2, -19, 13, -8, -10, 7, -24, -29, 9,
+    -7, -3, -23, -20, -15, 15, 24, -2, -19, 13, -8, -10, 7, -24, -29, 9,
+    -7, -3, -23, -20, -15, 15, 24, -2, -19, 13, -8, -10, 7, -24, -29, 9,
+    -7, -2, -25, -20, -16, 15, 25, -2, -19, 12, -7, -10, 8, -22, -31, 11,
+    -18, -6, -16, -19, -21, -2, 20, -12, -18, 17, -11, 0, 3, -26, -26, 3,
+};
+
+alignas(4) const int8_t bn5_ex_filter[1536] = {
+    61, -9, -127, -60, 1, -57, -57, 25, 15, 20, 32, 9, 9, -20, -21, -17,
+    11, -38, 5, 29, 9, -13, -61, 127, 2, 49, -123, 10, -25, 65, -51, 24,
+    51, -34, -47, -12, -61, 123, 6, 4, 34, 24, -12, 6, 33, -127, -48, -16,
+    -7, 100, 90, -114, -43, -20, 95, 74, -122, 52, 70, 38, 29, 127, -93, -22,
+    7, -127, 23, -36, 21, -15, 40, 2, 68, -3, 12, -2, 21, 96, 37, 18,
+    99, -49, -76, -41, 62, 63, 30, -111, 11, 2, -127, -76, 13, -127, 15, -126,
+    -33, 0, -61, 52, -29, 118, -93, 19, 127, 34, 47, 62, -57, -119, 29, 18,
+    -36, 45, -44, 26, 65, -5, 127, 20, 30, -81, 37, 2, 21, -82, 73, -61,
+    -93, -93, -120, 127, -14, 106, 93, -24, 42, -61, -17, -13, 27, -59, -37, -4,
+    -89, -18, -75, -5, 127, -43, 23, 4, 3, -22, -9, 20, 18, -72, 51, -106,
+    37, 61, 102, 84, -12, -95, -22, 8, 28, 29, 31, -38, -8, 127, 82, -8,
+    -75, -34, -12, -77, 104, -102, 34, -32, -37, -17, -2, 54, -6, -85, 99, -127,
+    -46, 35, -31, 127, -78, -62, -100, -20, 91, -5, -16, 7, -5, 84, 80, -57,
+    34, 23, -86, -127, 20, -96, -96, -50, 8, -40, 66, -6, 12, -34, 25, -28,
+    29, -25, -33, -22, 6, 6, 7, -26, -5, 17, -26, -127, 19, -14, 4, -49,
+    -23, 36, 21, 121, 6, -46, -127, -3, 7, -37, -16, -16, 110, 23, 61, 8,
+    9, -60, 118, -127, -7, 69, -120, 58, -52, -5, -34, -12, -3, -102, -53, -11,
+    -57, -4, 53, -22, -86, 40, -93, 55, 42, -16, 73, -127, 41, 15, -60, -12,
+    -7, 88, -14, -61, 21, 47, 13, 1, 127, 0, -28, 0, -17, 56, 44, -4,
+    49, 7, 127, -27, 51, 13, -52, 11, -9, 33, 25, 31, -1, 1, -40, -22,
+    120, 0, -16, -52, -127, 97, -65, 1, 32, 60, 17, -13, 27, -34, -76, 55,
+    43, -12, 65, 71, 124, -60, -44, 4, 26, -7, 10, -13, -39, 18, 28, 127,
+    -1, -9, -2, -9, -11, 21, -5, -11, -4, 8, 22, 127, -23, -29, 4, 1,
+    19, 127, -65, -5, 33, 69, 2, 18, -7, -31, 23, -22, -14, 102, 38, -6,
+    -125, 21, -4, -38, -68, 65, 1, 111, 36, -89, 127, 125, 27, -45, -45, 12,
+    74, 9, 26, -34, -127, 50, 3, 9, 3, 16, 16, -3, 7, -43, 26, 92,
+    32, -39, -24, -38, -30, -48, -48, 28, -27, -127, 61, 28, 26, 94, -67, -53,
+    29, -14, 73, -127, 42, 113, 37, 45, -53, -31, 47, 24, 32, -98, -101, -32,
+    86, -24, 68, -68, -95, 98, -94, -46, -10, 123, -13, -56, -1, 61, -127, 116,
+    -11, 127, 56, 2, 3, -62, 27, -3, 118, 4, -26, -3, 14, -30, -48, -9,
+    9, -127, -41, -21, 9, 34, 17, 25, -116, 14, 27, 6, -40, 0, 2, 18,
+    -15, -36, 20, 81, -28, -51, -19, -11, -103, -5, -8, 0, 38, -127, -81, -4,
+    -22, -15, 26, 105, -25, -118, 4, -9, -88, -19, 3, -26, -47, -127, -78, 4,
+    -4, 19, -3, 127, -9, -62, -104, 18, -70, -1, 22, 7, 2, -55, -9, -2,
+    -21, 13, 7, -13, -29, -43, 35, 7, 32, 44, -7, 33, 127, 65, 77, -67,
+    -43, -9, 97, 7, -25, 0, -61, -21, -28, 39, -33, -23, -22, 127, -60, 45,
+    0, 118, 88, -101, -5, 10, 45, 88, -127, 81, 95, 55, 11, 44, -122, 32,
+    17, 33, 17, 118, -35, -3, -81, 20, 75, -19, 19, 127, -26, -14, 28, 21,
+    -99, -9, -110, -3, 112, 21, -24, -16, 42, 36, -50, 15, 0, -127, 27, -39,
+    1, -21, -127, 32, -27, 31, 35, -17, 20, -50, 0, 8, 5, -37, -11, -25,
+    127, -42, -17, -51, 41, 46, 24, -111, -25, 37, -126, 107, -20, -62, 16, -38,
+    -2, 13, -78, -40, 3, -46, -35, -127, 33, 23, 96, 12, 0, -21, -7, 1,
+    32, -23, 18, -18, -45, 93, -64, -40, 8, -37, -6, 127, -16, -44, -27, 55,
+    -25, -4, -2, 7, -15, 4, -8, 17, -2, 1, 1, 127, -20, -4, 10, 51,
+    -127, 8, 36, 39, 56, 41, 79, -26, -4, -67, -40, 1, -6, -84, 51, -51,
+    15, 48, 6, 127, -8, -59, -92, 12, -79, -6, 23, -18, 45, -14, 30, 31,
+    3, 4, -76, -57, 6, -101, 38, 16, -16, -34, 1, 4, -10, -83, 127, -24,
+    -2, -14, 2, 21, 5, -29, 4, 14, 15, -1, 39, -23, -127, -35, -38, 13,
+    0, -45, -18, -69, 11, 27, 68, -1, 127, 2, 6, -15, 0, 72, 9, 12,
+    48, -48, -10, -32, 29, 85, 29, -76, 11, -28, -86, 35, 28, -127, -27, 18,
+    -5, -42, 26, 36, -14, -28, -18, 18, 127, -12, 29, 0, -6, 71, 52, 8,
+    -84, 2, -1, 10, 7, 38, -93, -17, -5, 52, -5, 2, 3, 127, -121, 20,
+    -42, -24, -38, -127, -11, 53, 102, 47, -91, -23, 38, 52, 20, -62, -43, 2,
+    20, 0, 127, -22, 1, -44, 39, 12, -44, -9, 25, 12, -14, -14, 101, -9,
+    -2, -36, -14, 19, 12, 12, -9, -6, 127, -8, -5, -14, 1, 27, 54, -31,
+    -16, 20, -15, -37, -3, -35, -11, -127, -4, 21, 87, -8, 2, 9, 6, -3,
+    35, -6, 8, -3, -3, 20, 3, -41, -3, 7, -38, 127, -20, -26, 2, 12,
+    -74, 107, 127, -9, -36, -108, 64, 62, -70, 32, 123, -19, 4, 116, -19, 18,
+    119, -19, -74, -82, -51, -99, -127, 6, 4, 87, 23, -7, 14, 94, -60, 80,
+    6, 91, -10, -52, 15, 66, 6, 6, 53, 7, 2, -2, -37, 127, 85, -23,
+    -67, -32, 55, -127, 50, -105, -66, 79, -37, 26, -29, 44, -25, -108, 97, -105,
+    86, 18, 33, -4, -127, -17, 39, -15, -1, -38, 5, -34, -11, 41, 27, 95,
+    127, 4, 42, -25, 60, -21, 67, -58, -47, 18, -56, -101, 13, 78, -55, 0,
+    -8, -127, -17, -30, 10, 60, 13, 7, 74, 33, -1, 28, 48, -66, 41, -14,
+    20, 50, -14, -46, 53, 52, 52, 10, -15, 12, -8, -7, 32, -24, -127, 12,
+    12, 127, -17, -21, -12, 5, -6, 7, -69, 10, 14, -2, -56, -13, -21, -29,
+    8, 76, 23, -87, -7, -41, 127, 13, -111, -17, 21, -46, 37, 59, -16, -44,
+    -12, -127, -11, 41, -16, -33, 30, -13, -8, 6, -18, 17, 17, -34, -31, 12,
+    -9, -79, -127, 38, -6, 48, 77, -4, 59, -49, 17, 2, 14, 59, -15, 14,
+    18, -36, -62, -32, 9, 83, -3, 0, -127, 18, 15, 14, -3, 40, 60, -5,
+    -96, -6, 4, -19, -31, 18, -3, 127, 5, -29, 94, -93, 20, -20, -32, 9,
+    11, 127, 10, -29, 6, 25, -21, 4, 26, 2, -10, -2, -6, 9, 25, -21,
+    -12, 24, -127, 7, -24, -70, 47, -3, 18, -92, -21, -12, -4, -17, 44, 44,
+    1, -21, -7, -92, -23, -16, 93, 24, 36, 18, 33, -9, -127, 22, -66, -2,
+    -35, -5, -16, -3, 5, 20, -9, 15, 4, 9, 17, -127, 19, -17, -29, 2,
+    52, 19, 127, -8, 53, -63, -57, 25, -36, -53, 32, -10, 11, 67, -3, 22,
+    -4, 9, -33, 10, -3, 36, 11, -82, -25, 26, -95, 127, -26, -33, -37, 22,
+    28, 4, 16, -11, -37, 56, -19, -43, 14, -8, -14, 127, -17, -54, 1, 12,
+    -16, 36, -50, -23, 28, -83, -13, -127, -18, 13, 103, -3, 0, 72, -2, 16,
+    -29, 14, 13, -8, -55, 31, -13, 74, 31, -35, 47, -127, 30, -19, -20, 5,
+    12, -17, -105, 19, -11, -88, -7, 127, -31, 30, -93, 4, -20, 86, 17, 7,
+    -1, 127, 15, -56, 14, 22, -1, -5, 114, 11, -20, -10, -28, 38, 40, -12,
+    -6, 1, 13, -14, -16, 40, -9, -15, -11, 4, -25, 127, -4, -37, 0, 26,
+    71, -21, 60, -98, 12, 12, -127, 4, 10, 97, 60, 7, 13, 8, -69, -33,
+    -47, -35, -50, 59, -42, 28, -127, 20, -103, -27, -14, -56, -33, -1, 126, 26,
+    0, 105, 12, 127, -2, -51, -107, -2, -47, -4, -6, 4, 2, 13, 74, -27,
+    1, -3, -2, -7, -22, -31, -1, 127, -6, 19, -111, -12, -8, -4, 16, 3,
+    7, 12, 15, 61, 35, -61, 92, -127, 12, 32, -121, -119, -53, 12, -24, 9,
+    1, -11, -22, -30, -26, -41, 88, 7, -5, -27, 20, 2, -4, -127, 125, -8,
+    71, 30, 48, -32, 18, -80, 127, -11, -47, -12, 36, 94, -9, 77, -33, 14,
+    -9, 60, -2, 23, 0, -26, 6, 7, -127, 12, 10, 0, -10, -21, -49, -16,
+    3, 127, 112, -99, -2, -94, 92, 10, -104, 43, 15, -15, 1, 100, -16, -33,
+    0, -71, 77, -127, 14, 15, -62, -6, -35, 31, 21, -5, 11, -74, 44, -9,
+    -80, 11, -127, 47, -59, 94, 42, -29, 31, 80, -42, -3, -8, -49, -29, 33,
+    0, 32, -127, 113, -1, 108, 101, 20, 45, 34, 26, 33, 31, -48, -44, -66,
+    -29, -13, -34, -34, -28, -20, -47, 105, -14, -49, -127, -12, -13, -2, -6, -5,
+};
+
+const int32_t bn5_ex_bias[96] = {
+    5477, 5944, -1734, 45228, 5703, -1367, -241, 8507,
+    33094, -1285, 8636, 37865, -1644, 7313, 68, 9739,
+    5951, 4549, 1335, 11941, -273, 4869, 1382, -530,
+    775, 1042, 6904, -4156, 6077, 1909, 544, 447,
+    4501, 8246, 670, 4674, 9595, 50152, -3036, 10594,
+    2776, 1186, 2499, -812, -4074, 4247, 4539, 2375,
+    5048, 5397, 8120, 14265, 6080, 6312, 8660, -624,
+    2259, 9558, 6589, 3729, 7120, 9788, 13302, -752,
+    -1991, 2847, 14386, 11950, 10534, 6229, 2730, 2011,
+    13422, 26025, 5179, 7891, 5559, -1584, 3338, 1616,
+    12090, 3324, 5451, 16838, 7878, 6843, -285, 16859,
+    3948, 9524, 3902, 16831, 6716, -5360, -3508, -927,
+};
+
+const int32_t bn5_ex_input_offset = -4;
+
+const int32_t bn5_ex_output_offset = -128;
+
+const int32_t bn5_ex_output_multiplier[96] = {
+    1643060606, 1310027340, 1417963424, 1094556880, 1443217946, 1991734012, 1460064313, 1410741459,
+    1570448037, 1419145460, 1219791131, 1839738585, 1181334213, 1083693632, 1495713789, 1149810196,
+    1434342718, 1706995259, 2086281873, 1227220671, 1547958929, 1275502112, 1905122470, 1830701232,
+    1505269649, 1648245438, 1356962420, 1183944833, 1106831974, 1597436578, 1358249282, 1405302626,
+    1938560225, 1309935343, 1197448022, 1164544413, 1558276424, 1854767365, 1287247458, 1576367624,
+    1200326326, 1835104515, 1354415209, 1216346306, 1379598014, 1613535604, 1826056288, 1358279459,
+    1115854788, 1571814434, 1398775466, 1663519421, 1491136163, 1812257926, 1307186055, 1127399158,
+    1678886624, 1689877544, 1269280265, 2053950161, 2006026447, 1890809876, 1751658753, 1340401453,
+    1504904104, 2002766104, 1431531000, 1515165277, 1213321881, 1652537298, 1152773044, 1314260679,
+    1095613810, 1681352223, 2144248679, 1255346044, 1556595429, 2065844560, 1564254290, 1544087226,
+    1089358976, 1877751156, 2035109422, 1372581790, 1555557680, 1454736415, 1918262679, 2033541315,
+    1939901698, 1834975744, 1942394909, 1862633189, 1590343384, 1305435909, 1217726630, 1812320357,
+};
+
+const int32_t bn5_ex_output_shift[96] = {
+    -6, -6, -5, -8, -6, -6, -6, -6,
+    -7, -5, -6, -8, -5, -5, -4, -6,
+    -6, -6, -6, -6, -5, -5, -5, -6,
+    -6, -5, -6, -5, -6, -6, -4, -5,
+    -6, -6, -4, -5, -7, -8, -5, -6,
+    -5, -6, -5, -4, -5, -6, -6, -5,
+    -5, -6, -6, -7, -6, -6, -6, -5,
+    -5, -7, -6, -7, -7, -6, -7, -5,
+    -5, -5, -7, -6, -6, -6, -5, -5,
+    -6, -8, -6, -6, -6, -5, -6, -5,
+    -5, -6, -5, -7, -6, -6, -6, -7,
+    -6, -7, -6, -8, -6, -5, -5, -5,
+};
+
+alignas(4) const int8_t bn5_dw_ifmap[38400] = {
+    -29, -90, -45, -22, -75, -128, -128, -15, 100, -120, -128, -3, -128, -3, -128, -113,
+    -54, -81, -120, -49, -58, -128, -51, -128, -25, -82, -43, -25, -63, -119, 37, -80,
+    -87, -103, -123, -103, -22, 17, -124, 42, -64, -93, -42, -108, -128, -128, -75, -128,
+    -5, -6, -110, -29, 86, -118, -87, -128, -59, -74, -67, -123, -102, -18, -43, -97,
+    33, -28, -21, 24, 13, -21, -17, -122, 0, -36, -24, -108, -26, -128, -87, -72,
+    55, -120, 101, -50, -117, -128, -128, -28, -68, -43, -42, -67, -53, -106, -79, -128,
+    -40, -85, -17, -27, -84, -128, -122, -21, 106, -128, -128, -11, -128, -38, -128, -110,
+    -58, -86, -121, -49, -22, -128, -37, -128, -32, -39, -68, -45, -50, -118, 30, -72,
+    -77, -93, -128, -102, -29, 24, -126, 43, -52, -102, -16, -83, -128, -128, -87, -111,
+    -15, 3, -106, -33, 68, -118, -85, -128, -39, -83, -72, -125, -116, -3, -48, -91,
+    19, -29, -34, 26, 12, -24, -31, -120, -3, -38, -29, -115, -14, -117, -103, -75,
+    49, -118, 123, -53, -106, -128, -128, -24, -65, -51, -47, -74, -61, -74, -58, -128,
+    -41, -83, -18, -27, -85, -128, -121, -21, 107, -128, -128, -11, -128, -42, -128, -109,
+    -58, -86, -121, -49, -25, -128, -38, -128, -31, -41, -69, -48, -51, -118, 30, -70,
+    -76, -92, -128, -101, -28, 25, -124, 43, -57, -104, -18, -82, -128, -128, -88, -110,
+    -16, 1, -105, -32, 68, -119, -84, -128, -41, -82, -73, -125, -116, -5, -49, -90,
+    18, -30, -35, 26, 12, -24, -28, -121, -4, -38, -28, -116, -15, -120, -105, -74,
+    51, -119, 122, -53, -104, -128, -128, -24, -66, -51, -46, -74, -62, -70, -55, -128,
+    -41, -83, -18, -27, -85, -128, -121, -21, 107, -128, -128, -11, -128, -42, -128, -109,
+    -58, -86, -121, -49, -25, -128, -38, -128, -31, -41, -69, -48, -51, -118, 30, -70,
+    -76, -92, -128, -101, -28, 25, -124, 43, -57, -104, -18, -82, -128, -128, -88, -110,
+    -16, 1, -105, -32, 68, -119, -84, -128, -41, -82, -73, -125, -116, -5, -49, -90,
+    18, -30, -35, 26, 12, -24, -28, -121, -4, -38, -28, -116, -15, -120, -105, -74,
+    51, -119, 122, -53, -104, -128, -128, -24, -66, -51, -46, -74, -62, -70, -55, -128,
+    -41, -83, -18, -27, -85, -128, -121, -21, 107, -128, -128, -11, -128, -42, -128, -109,
+    -58, -86, -121, -49, -25, -128, -38, -128, -31, -41, -69, -48, -51, -118, 30, -70,
+    -76, -92, -128, -101, -28, 25, -124, 43, -57, -104, -18, -82, -128, -128, -88, -110,
+    -16, 1, -105, -32, 68, -119, -84, -128, -41, -82, -73, -125, -116, -5, -49, -90,
+    18, -30, -35, 26, 12, -24, -28, -121, -4, -38, -28, -116, -15, -120, -105, -74,
+    51, -119, 122, -53, -104, -128, -128, -24, -66, -51, -46, -74, -62, -70, -55, -128,
+    -41, -83, -18, -27, -85, -128, -121, -21, 107, -128, -128, -11, -128, -42, -128, -109,
+    -58, -86, -121, -49, -25, -128, -38, -128, -31, -41, -69, -48, -51, -118, 30, -70,
+    -76, -92, -128, -101, -28, 25, -124, 43, -57, -104, -18, -82, -128, -128, -88, -110,
+    -16, 1, -105, -32, 68, -119, -84, -128, -41, -82, -73, -125, -116, -5, -49, -90,
+    18, -30, -35, 26, 12, -24, -28, -121, -4, -38, -28, -116, -15, -120, -105, -74,
+    51, -119, 122, -53, -104, -128, -128, -24, -66, -51, -46, -74, -62, -70, -55, -128,
+    -41, -83, -18, -27, -85, -128, -121, -21, 107, -128, -128, -11, -128, -42, -128, -109,
+    -58, -86, -121, -49, -25, -128, -38, -128, -31, -41, -69, -48, -51, -118, 30, -70,
+    -76, -92, -128, -101, -28, 25, -124, 43, -57, -104, -18, -82, -128, -128, -88, -110,
+    -16, 1, -105, -32, 68, -119, -84, -128, -41, -82, -73, -125, -116, -5, -49, -90,
+    18, -30, -35, 26, 12, -24, -28, -121, -4, -38, -28, -116, -15, -120, -105, -74,
+    51, -119, 122, -53, -104, -128, -128, -24, -66, -51, -46, -74, -62, -70, -55, -128,
+    -41, -83, -18, -27, -85, -128, -121, -21, 107, -128, -128, -11, -128, -42, -128, -109,
+    -58, -86, -121, -49, -25, -128, -38, -128, -31, -41, -69, -48, -51, -118, 30, -70,
+    -76, -92, -128, -101, -28, 25, -124, 43, -57, -104, -18, -82, -128, -128, -88, -110,
+    -16, 1, -105, -32, 68, -119, -84, -128, -41, -82, -73, -125, -116, -5, -49, -90,
+    18, -30, -35, 26, 12, -24, -28, -121, -4, -38, -28, -116, -15, -120, -105, -74,
+    51, -119, 122, -53, -104, -128, -128, -24, -66, -51, -46, -74, -62, -70, -55, -128,
+    -40, -83, -16, -26, -85, -128, -124, -23, 106, -128, -128, -12, -128, -40, -128, -111,
+    -56, -86, -123, -48, -20, -128, -37, -128, -32, -39, -68, -42, -49, -119, 36, -69,
+    -75, -92, -128, -101, -27, 24, -127, 42, -53, -104, -17, -83, -128, -128, -88, -110,
+    -17, 2, -107, -32, 70, -119, -86, -128, -40, -81, -71, -126, -116, -4, -47, -92,
+    23, -26, -34, 26, 11, -23, -29, -121, -5, -38, -28, -115, -14, -119, -104, -75,
+    51, -120, 123, -52, -106, -128, -128, -24, -67, -50, -44, -74, -61, -73, -57, -128,
+    -42, -85, -18, -26, -84, -128, -125, -21, 106, -128, -128, -11, -128, -40, -128, -111,
+    -58, -88, -122, -50, -23, -128, -37, -128, -32, -37, -68, -44, -50, -119, 36, -70,
+    -76, -94, -128, -102, -28, 24, -128, 43, -52, -103, -16, -82, -128, -128, -86, -111,
+    -16, 4, -107, -33, 70, -117, -86, -128, -38, -82, -73, -126, -117, -1, -47, -92,
+    21, -28, -33, 26, 12, -23, -31, -122, -3, -38, -29, -115, -14, -118, -103, -76,
+    49, -120, 124, -53, -106, -128, -128, -23, -64, -49, -45, -74, -61, -73, -58, -128,
+    -42, -85, -18, -26, -84, -128, -125, -21, 106, -128, -128, -11, -128, -40, -128, -111,
+    -58, -88, -122, -50, -23, -128, -37, -128, -32, -37, -68, -44, -50, -119, 36, -70,
+    -76, -94, -128, -102, -28, 24, -128, 43, -52, -103, -16, -82, -128, -128, -86, -111,
+    -16, 4, -107, -33, 70, -117, -86, -128, -38, -82, -73, -126, -117, -1, -47, -92,
+    21, -28, -33, 26, 12, -23, -31, -122, -3, -38, -29, -115, -14, -118, -103, -76,
+    49, -120, 124, -53, -106, -128, -128, -23, -64, -49, -45, -74, -61, -73, -58, -128,
+    -41, -84, -17, -26, -84, -128, -125, -20, 106, -128, -128, -11, -128, -41, -128, -110,
+    -58, -87, -123, -49, -22, -128, -38, -128, -31, -37, -68, -43, -51, -119, 35, -70,
+    -77, -94, -128, -103, -27, 24, -128, 43, -54, -104, -17, -82, -128, -128, -86, -113,
+    -16, 3, -107, -33, 71, -117, -86, -128, -40, -81, -72, -126, -117, -1, -47, -91,
+    22, -30, -33, 26, 12, -23, -28, -122, -3, -38, -28, -115, -15, -120, -105, -74,
+    51, -120, 123, -53, -106, -128, -128, -24, -64, -49, -45, -74, -61, -74, -57, -128,
+    -40, -84, -20, -27, -84, -128, -126, -20, 107, -128, -128, -11, -128, -37, -128, -110,
+    -60, -90, -122, -51, -27, -128, -39, -128, -34, -40, -67, -48, -52, -119, 35, -69,
+    -74, -93, -128, -104, -29, 24, -126, 45, -51, -103, -17, -82, -128, -128, -84, -111,
+    -16, 4, -107, -34, 70, -118, -86, -128, -38, -83, -72, -126, -117, -1, -47, -94,
+    20, -29, -33, 27, 13, -23, -32, -122, 0, -38, -29, -116, -13, -120, -103, -77,
+    53, -120, 123, -55, -105, -128, -128, -22, -63, -49, -45, -74, -63, -73, -59, -128,
+    -41, -84, -18, -26, -84, -128, -124, -20, 106, -128, -128, -11, -128, -41, -128, -111,
+    -58, -89, -122, -48, -26, -128, -38, -128, -33, -42, -69, -43, -51, -119, 37, -71,
+    -77, -94, -128, -103, -27, 24, -125, 42, -52, -104, -19, -84, -128, -128, -86, -111,
+    -16, 3, -107, -33, 71, -117, -86, -128, -40, -81, -73, -125, -115, -5, -47, -91,
+    22, -27, -33, 26, 11, -22, -30, -121, -4, -38, -28, -115, -15, -121, -104, -77,
+    51, -119, 122, -53, -106, -128, -128, -24, -65, -49, -45, -73, -61, -74, -56, -128,
+    -40, -84, -17, -26, -85, -128, -123, -23, 105, -128, -128, -11, -128, -39, -128, -111,
+    -57, -87, -123, -48, -20, -128, -37, -128, -35, -39, -70, -45, -48, -119, 36, -70,
+    -76, -93, -128, -101, -27, 24, -125, 42, -50, -102, -17, -83, -128, -128, -87, -111,
+    -17, 3, -107, -32, 69, -118, -86, -128, -38, -82, -71, -125, -115, -4, -47, -91,
+    20, -27, -34, 26, 10, -22, -32, -121, -5, -38, -28, -116, -14, -118, -103, -77,
+    50, -119, 124, -52, -105, -128, -128, -23, -66, -50, -45, -74, -60, -71, -57, -128,
+    -40, -85, -15, -27, -86, -128, -122, -22, 106, -128, -128, -11, -128, -38, -128, -111,
+    -56, -87, -123, -49, -21, -128, -36, -128, -33, -38, -70, -43, -50, -119, 35, -67,
+    -74, -92, -128, -103, -28, 24, -124, 43, -50, -102, -16, -83, -128, -128, -86, -111,
+    -18, 4, -108, -33, 70, -117, -86, -128, -38, -83, -72, -126, -115, -4, -48, -90,
+    20, -26, -34, 26, 10, -23, -31, -121, -4, -38, -28, -116, -13, -117, -104, -76,
+    48, -120, 124, -52, -105, -128, -128, -24, -64, -51, -45, -74, -59, -72, -57, -128,
+    -41, -83, -17, -26, -85, -128, -123, -23, 106, -128, -128, -11, -128, -40, -128, -111,
+    -56, -85, -123, -49, -22, -128, -37, -128, -31, -41, -68, -43, -49, -119, 36, -68,
+    -75, -92, -128, -100, -27, 24, -125, 42, -56, -104, -17, -82, -128, -128, -88, -110,
+    -17, 2, -107, -31, 70, -119, -86, -128, -41, -81, -72, -126, -115, -5, -48, -92,
+    22, -26, -34, 26, 11, -23, -27, -121, -5, -38, -27, -116, -14, -120, -104, -74,
+    51, -120, 123, -52, -105, -128, -128, -24, -67, -51, -44, -74, -61, -71, -57, -128,
+    -40, -82, -17, -26, -85, -128, -123, -24, 106, -128, -128, -12, -128, -40, -128, -111,
+    -56, -86, -123, -48, -18, -128, -37, -128, -32, -37, -68, -43, -48, -119, 37, -69,
+    -75, -92, -128, -100, -26, 24, -128, 42, -54, -104, -16, -81, -128, -128, -89, -110,
+    -17, 2, -107, -32, 70, -119, -87, -128, -39, -81, -70, -126, -116, -3, -47, -92,
+    23, -27, -34, 26, 11, -23, -28, -121, -4, -38, -28, -115, -14, -119, -104, -74,
+    51, -120, 124, -52, -106, -128, -128, -24, -68, -50, -44, -74, -61, -72, -58, -128,
+    -36, -81, -24, -26, -81, -128, -125, -16, 112, -128, -128, -13, -128, -41, -128, -106,
+    -70, -85, -120, -52, -34, -128, -41, -128, -22, -61, -57, -48, -57, -118, 29, -75,
+    -81, -92, -128, -104, -28, 25, -126, 50, -71, -103, -23, -81, -128, -128, -94, -114,
+    -10, -3, -103, -28, 70, -128, -83, -128, -47, -81, -71, -125, -125, -10, -48, -95,
+    32, -36, -34, 27, 23, -25, -20, -124, 0, -38, -27, -114, -18, -128, -100, -71,
+    60, -122, 114, -55, -111, -128, -128, -28, -78, -48, -46, -76, -76, -72, -38, -128,
+    -44, -72, -78, -27, -83, -128, -128, -24, 85, -106, -128, 8, -128, -15, -128, -100,
+    -35, -86, -128, -39, -108, -128, -38, -128, -46, -87, -66, -79, -78, -95, -16, -23,
+    -19, -75, -106, -87, -35, 26, -114, 17, -57, -110, -58, -85, -128, -128, -49, -92,
+    -42, -17, -98, -41, 52, -78, -84, -128, -40, -67, -76, -128, -57, -21, -56, -98,
+    -45, -40, -33, 40, -24, -60, -35, -128, -8, -37, -41, -101, -21, -128, -108, -94,
+    72, -125, 115, -49, -104, -128, -108, -13, -39, -49, -39, -65, -34, -128, -128, -92,
+    -62, -87, -123, -1, -56, -128, -128, -40, 89, -128, -128, -18, -128, -53, -71, -128,
+    -100, -102, -128, -63, -54, -128, -118, -92, -87, -45, 5, -50, -33, -128, 81, -107,
+    -102, -128, -38, -24, 3, -1, -128, 38, -36, -128, -89, -128, -128, -128, -102, -128,
+    10, -27, -128, -23, 102, -98, -116, -128, -69, -36, -48, -104, -128, 84, 17, -128,
+    60, 21, 31, 21, 30, 11, -72, -126, 12, -29, -40, -85, -18, -128, -65, -92,
+    105, -128, 52, -68, -128, -128, -128, 16, -102, 11, -5, -32, -101, -128, -121, -118,
+    -75, -87, -93, -7, -85, -123, -128, -48, 93, -128, -128, -24, -128, -77, -71, -128,
+    -90, -108, -128, -61, -25, -128, -107, -86, -103, -15, -23, -57, -19, -128, 100, -83,
+    -75, -119, -128, -22, -3, 4, -128, 40, -14, -128, -57, -128, -128, -128, -114, -128,
+    -27, -13, -128, -25, 86, -100, -123, -128, -51, -49, -61, -106, -128, 88, 14, -128,
+    52, 69, 19, 14, 18, 20, -88, -114, 7, -30, -37, -93, -2, -128, -77, -96,
+    84, -128, 70, -70, -109, -128, -128, 26, -102, -4, 9, -40, -103, -117, -105, -128,
+    -76, -91, -87, -8, -84, -115, -128, -45, 94, -128, -128, -24, -128, -78, -57, -128,
+    -91, -107, -128, -63, -20, -128, -112, -85, -107, -7, -27, -59, -19, -128, 97, -86,
+    -77, -122, -128, -27, -6, 4, -128, 41, -12, -128, -59, -128, -128, -128, -111, -128,
+    -24, -11, -128, -28, 85, -98, -121, -128, -54, -51, -64, -104, -128, 93, 15, -128,
+    48, 67, 19, 13, 19, 20, -89, -112, 8, -30, -34, -95, -4, -128, -78, -91,
+    80, -128, 65, -71, -108, -128, -128, 29, -96, -5, 6, -40, -102, -113, -103, -128,
+    -76, -90, -87, -8, -84, -116, -128, -45, 94, -128, -128, -24, -128, -78, -58, -128,
+    -91, -106, -128, -63, -20, -128, -113, -85, -106, -6, -27, -59, -20, -128, 98, -87,
+    -77, -121, -128, -27, -6, 4, -128, 41, -14, -128, -60, -128, -128, -128, -111, -128,
+    -24, -12, -128, -28, 85, -98, -121, -128, -55, -50, -64, -104, -128, 93, 14, -128,
+    48, 67, 19, 13, 19, 20, -86, -112, 8, -30, -34, -95, -5, -128, -79, -89,
+    82, -128, 65, -71, -108, -128, -128, 28, -96, -5, 6, -40, -102, -114, -103, -128,
+    -76, -90, -87, -8, -84, -116, -128, -45, 94, -128, -128, -24, -128, -78, -58, -128,
+    -91, -106, -128, -63, -20, -128, -113, -85, -106, -6, -27, -59, -20, -128, 98, -87,
+    -77, -121, -128, -27, -6, 4, -128, 41, -14, -128, -60, -128, -128, -128, -111, -128,
+    -24, -12, -128, -28, 85, -98, -121, -128, -55, -50, -64, -104, -128, 93, 14, -128,
+    48, 67, 19, 13, 19, 20, -86, -112, 8, -30, -34, -95, -5, -128, -79, -89,
+    82, -128, 65, -71, -108, -128, -128, 28, -96, -5, 6, -40, -102, -114, -103, -128,
+    -76, -90, -87, -8, -84, -116, -128, -45, 94, -128, -128, -24, -128, -78, -58, -128,
+    -91, -106, -128, -63, -20, -128, -113, -85, -106, -6, -27, -59, -20, -128, 98, -87,
+    -77, -121, -128, -27, -6, 4, -128, 41, -14, -128, -60, -128, -128, -128, -111, -128,
+    -24, -12, -128, -28, 85, -98, -121, -128, -55, -50, -64, -104, -128, 93, 14, -128,
+    48, 67, 19, 13, 19, 20, -86, -112, 8, -30, -34, -95, -5, -128, -79, -89,
+    82, -128, 65, -71, -108, -128, -128, 28, -96, -5, 6, -40, -102, -114, -103, -128,
+    -76, -90, -87, -8, -84, -116, -128, -45, 94, -128, -128, -24, -128, -78, -58, -128,
+    -91, -106, -128, -63, -20, -128, -113, -85, -106, -6, -27, -59, -20, -128, 98, -87,
+    -77, -121, -128, -27, -6, 4, -128, 41, -14, -128, -60, -128, -128, -128, -111, -128,
+    -24, -12, -128, -28, 85, -98, -121, -128, -55, -50, -64, -104, -128, 93, 14, -128,
+    48, 67, 19, 13, 19, 20, -86, -112, 8, -30, -34, -95, -5, -128, -79, -89,
+    82, -128, 65, -71, -108, -128, -128, 28, -96, -5, 6, -40, -102, -114, -103, -128,
+    -76, -90, -87, -8, -84, -116, -128, -45, 94, -128, -128, -24, -128, -78, -58, -128,
+    -91, -106, -128, -63, -20, -128, -113, -85, -106, -6, -27, -59, -20, -128, 98, -87,
+    -77, -121, -128, -27, -6, 4, -128, 41, -14, -128, -60, -128, -128, -128, -111, -128,
+    -24, -12, -128, -28, 85, -98, -121, -128, -55, -50, -64, -104, -128, 93, 14, -128,
+    48, 67, 19, 13, 19, 20, -86, -112, 8, -30, -34, -95, -5, -128, -79, -89,
+    82, -128, 65, -71, -108, -128, -128, 28, -96, -5, 6, -40, -102, -114, -103, -128,
+    -77, -91, -90, -8, -84, -117, -128, -46, 93, -128, -128, -24, -128, -77, -58, -128,
+    -91, -107, -128, -62, -22, -128, -113, -87, -108, -7, -27, -60, -20, -128, 94, -85,
+    -75, -121, -128, -25, -6, 4, -128, 39, -13, -128, -61, -128, -128, -128, -110, -128,
+    -24, -12, -128, -28, 84, -96, -121, -128, -54, -49, -64, -105, -128, 94, 15, -128,
+    47, 67, 19, 14, 17, 19, -89, -113, 7, -30, -35, -94, -5, -128, -78, -92,
+    79, -128, 65, -70, -109, -128, -128, 29, -95, -5, 6, -40, -101, -118, -107, -128,
+    -75, -85, -90, -8, -82, -117, -128, -48, 94, -128, -128, -23, -128, -83, -64, -128,
+    -93, -111, -128, -61, -26, -128, -108, -89, -110, -19, -30, -63, -19, -128, 95, -87,
+    -79, -121, -128, -23, -5, 4, -128, 39, -8, -128, -63, -128, -128, -128, -114, -128,
+    -22, -13, -128, -25, 82, -101, -119, -128, -50, -50, -62, -105, -128, 84, 14, -128,
+    50, 60, 17, 16, 19, 19, -93, -115, 4, -31, -37, -96, -1, -128, -79, -101,
+    87, -128, 69, -69, -113, -128, -128, 29, -101, -5, 5, -40, -103, -110, -98, -128,
+    -74, -90, -85, -7, -83, -115, -128, -47, 95, -128, -128, -25, -128, -79, -56, -128,
+    -94, -107, -128, -64, -13, -128, -114, -84, -108, -5, -25, -58, -16, -128, 98, -86,
+    -78, -123, -128, -26, -5, 3, -128, 43, -11, -128, -59, -128, -128, -128, -114, -128,
+    -21, -10, -128, -27, 86, -102, -122, -128, -54, -51, -60, -105, -128, 95, 17, -128,
+    56, 66, 20, 14, 22, 20, -89, -114, 8, -30, -34, -96, -3, -128, -77, -91,
+    82, -128, 64, -71, -112, -128, -128, 29, -100, -3, 6, -40, -106, -111, -99, -128,
+    -74, -83, -87, -8, -83, -120, -128, -45, 97, -128, -128, -25, -128, -85, -85, -128,
+    -97, -118, -128, -63, -24, -128, -101, -83, -102, -20, -22, -58, -22, -128, 95, -86,
+    -79, -122, -128, -27, -4, 6, -128, 45, -3, -128, -51, -128, -128, -128, -118, -128,
+    -21, -8, -128, -25, 86, -108, -121, -128, -40, -53, -62, -105, -128, 87, 15, -128,
+    62, 62, 17, 16, 25, 18, -97, -115, 9, -30, -43, -95, 5, -128, -81, -107,
+    91, -128, 79, -72, -118, -128, -128, 27, -106, -1, 6, -41, -112, -111, -89, -126,
+    -72, -80, -87, -7, -79, -122, -128, -53, 93, -128, -128, -24, -128, -87, -68, -128,
+    -94, -108, -128, -58, -18, -128, -106, -92, -109, -23, -31, -64, -14, -128, 91, -87,
+    -82, -120, -128, -18, -3, 5, -128, 37, -11, -128, -64, -128, -128, -128, -122, -128,
+    -18, -15, -128, -21, 79, -106, -117, -128, -50, -50, -56, -106, -128, 78, 14, -128,
+    55, 51, 15, 18, 19, 16, -91, -117, 0, -31, -36, -97, -1, -128, -78, -103,
+    89, -128, 69, -65, -119, -128, -128, 27, -110, -5, 3, -41, -104, -105, -91, -128,
+    -65, -83, -78, -15, -80, -118, -128, -36, 105, -128, -128, -22, -128, -71, -116, -123,
+    -100, -121, -128, -65, -38, -128, -81, -95, -89, -36, -26, -76, -37, -128, 60, -85,
+    -78, -113, -128, -48, -21, 13, -128, 53, -4, -127, -33, -128, -128, -128, -108, -128,
+    -16, 0, -126, -27, 72, -116, -107, -128, -28, -67, -66, -110, -128, 69, 0, -128,
+    41, 26, 1, 22, 30, 3, -99, -119, 14, -34, -49, -101, 8, -128, -83, -114,
+    86, -128, 96, -73, -115, -128, -128, 19, -98, -11, -13, -53, -112, -103, -78, -125,
+    -73, -88, -71, -20, -84, -115, -128, -24, 107, -128, -128, -18, -128, -70, -88, -112,
+    -85, -96, -128, -65, -56, -128, -101, -101, -80, -35, -39, -76, -49, -128, 47, -80,
+    -70, -105, -128, -61, -31, 14, -128, 49, -40, -128, -49, -128, -128, -128, -95, -128,
+    -24, -5, -119, -34, 64, -104, -99, -128, -59, -69, -86, -112, -128, 58, -12, -128,
+    13, 16, -6, 19, 21, -3, -63, -115, 12, -36, -29, -101, -14, -128, -97, -72,
+    71, -125, 73, -74, -91, -128, -128, 14, -78, -30, -21, -58, -96, -106, -87, -115,
+    -68, -90, -77, -14, -82, -128, -128, -39, 97, -128, -128, -19, -128, -61, -94, -121,
+    -79, -92, -128, -58, -31, -128, -92, -104, -80, -23, -31, -64, -33, -128, 67, -79,
+    -72, -108, -128, -43, -17, 12, -128, 40, -37, -125, -46, -128, -128, -128, -104, -128,
+    -25, -14, -123, -29, 72, -100, -107, -128, -55, -58, -68, -111, -128, 65, -7, -128,
+    21, 32, 1, 18, 15, 3, -66, -117, 4, -34, -33, -96, -13, -128, -84, -80,
+    69, -128, 77, -65, -100, -128, -128, 10, -89, -21, -12, -51, -89, -116, -102, -128,
+    -76, -83, -89, -13, -81, -117, -128, -52, 99, -128, -128, -25, -128, -78, -78, -125,
+    -94, -109, -128, -66, -23, -128, -104, -95, -108, -13, -26, -86, -21, -128, 76, -83,
+    -73, -115, -128, -21, -19, 9, -128, 45, -8, -128, -43, -128, -128, -128, -114, -128,
+    -23, -7, -128, -25, 69, -107, -113, -128, -42, -60, -61, -108, -128, 91, 8, -128,
+    29, 41, 8, 20, 22, 10, -100, -119, 11, -32, -41, -97, 5, -128, -80, -102,
+    86, -128, 78, -72, -101, -128, -128, 30, -102, -12, -5, -47, -107, -106, -108, -118,
+    -63, -84, -74, -19, -84, -97, -128, -36, 102, -128, -128, -16, -128, -57, -80, -118,
+    -83, -110, -128, -60, -49, -128, -92, -104, -97, -51, -36, -74, -41, -128, 60, -78,
+    -72, -107, -128, -53, -29, 12, -128, 47, -6, -123, -43, -128, -128, -128, -100, -128,
+    -25, 1, -125, -29, 64, -111, -102, -128, -42, -74, -71, -113, -128, 49, -5, -128,
+    25, 23, -5, 21, 18, 1, -90, -117, 8, -36, -36, -101, 0, -128, -87, -104,
+    76, -127, 83, -68, -100, -128, -128, 19, -91, -26, -17, -56, -93, -108, -93, -119,
+    -62, -81, -82, -14, -79, -122, -128, -40, 99, -128, -128, -21, -128, -63, -69, -119,
+    -87, -92, -128, -62, -34, -128, -111, -96, -90, -39, -24, -72, -33, -128, 67, -84,
+    -76, -110, -128, -42, -18, 9, -128, 45, -40, -128, -63, -128, -128, -128, -107, -128,
+    -19, -17, -124, -25, 70, -112, -106, -128, -67, -60, -61, -110, -128, 64, 0, -128,
+    33, 30, 4, 18, 22, 4, -66, -118, 8, -34, -27, -96, -16, -128, -85, -76,
+    89, -128, 57, -67, -104, -128, -128, 15, -99, -20, -11, -51, -100, -115, -93, -117,
+    -79, -98, -123, -16, -78, -119, -128, -40, 82, -128, -110, -6, -128, -49, -86, -115,
+    -84, -108, -128, -54, -88, -128, -89, -128, -113, -37, -42, -114, -49, -119, 23, -55,
+    -35, -99, -97, -34, -29, 13, -128, 23, -15, -114, -73, -128, -128, -128, -73, -118,
+    -38, -22, -114, -40, 49, -62, -102, -115, -42, -48, -73, -119, -119, 71, -7, -128,
+    -43, 19, 2, 29, -8, -20, -102, -125, 3, -33, -50, -90, -10, -128, -72, -116,
+    64, -128, 73, -67, -100, -128, -128, 33, -58, -15, -13, -44, -74, -128, -128, -128,
+    -102, -22, -128, -32, -75, -128, -128, -128, 38, -128, 7, -51, -128, -112, -118, -20,
+    -101, -105, -128, -1, 6, 91, -128, -102, -128, -16, -56, -128, 48, -125, -86, -82,
+    -38, -23, -128, 125, -58, 44, -128, -41, 5, -128, -28, -128, -128, -10, -128, -97,
+    -97, -62, -63, 0, -128, -70, -83, -128, -24, -61, 19, -100, -128, 125, 38, -128,
+    -128, -12, -50, 5, -42, -33, -128, -101, -42, -57, -67, -6, -13, -128, -57, -128,
+    94, -115, 24, -39, -29, -12, -128, 69, -128, -31, -29, -58, -119, -128, -128, -128,
+    -128, -16, -128, -40, -55, -128, -128, -128, 60, -128, 14, -68, -126, -128, -128, -33,
+    -105, -63, -123, -6, 17, 127, -128, -77, -128, 8, -66, -128, 62, -128, -41, -128,
+    -62, -33, -128, 127, -75, 51, -128, -37, -75, -128, -6, -128, -128, -28, -128, -18,
+    -52, -79, -26, 9, -128, -80, -58, -128, -64, -67, -5, -82, -128, 127, 24, -128,
+    -128, -46, -73, -1, -15, -36, -128, -110, -45, -48, -40, -8, -42, -128, -75, -108,
+    68, -97, -11, -46, 0, -25, -128, 67, -128, -53, -68, -76, -128, -128, -128, -128,
+    -128, -17, -128, -38, -60, -128, -128, -128, 64, -128, 5, -71, -128, -128, -114, -32,
+    -93, -42, -128, -9, 54, 117, -128, -83, -128, 28, -62, -128, 75, -128, -32, -128,
+    -60, -33, -128, 127, -71, 48, -128, -32, -82, -128, -2, -128, -128, -28, -128, -33,
+    -57, -76, -34, 13, -128, -89, -63, -128, -75, -67, -2, -87, -128, 127, 23, -128,
+    -128, -45, -69, 3, -15, -31, -128, -114, -48, -49, -29, -15, -42, -128, -80, -84,
+    65, -106, -13, -44, 4, -31, -128, 63, -128, -58, -62, -76, -128, -128, -128, -128,
+    -128, -17, -128, -39, -60, -128, -128, -128, 64, -128, 4, -71, -128, -128, -111, -32,
+    -92, -44, -128, -8, 55, 119, -128, -84, -128, 28, -62, -128, 75, -128, -32, -128,
+    -59, -33, -128, 127, -72, 48, -128, -32, -79, -128, -2, -128, -128, -27, -128, -35,
+    -58, -73, -35, 12, -128, -89, -63, -128, -74, -68, -2, -88, -128, 127, 24, -128,
+    -128, -46, -69, 3, -15, -31, -128, -114, -48, -50, -28, -15, -42, -128, -81, -85,
+    63, -107, -13, -43, 2, -31, -128, 63, -128, -58, -62, -76, -128, -128, -128, -128,
+    -128, -17, -128, -39, -60, -128, -128, -128, 64, -128, 5, -71, -128, -128, -111, -32,
+    -93, -44, -128, -8, 53, 120, -128, -85, -128, 27, -62, -128, 74, -128, -34, -128,
+    -58, -32, -128, 127, -72, 48, -128, -32, -80, -128, -4, -128, -128, -26, -128, -34,
+    -59, -74, -35, 12, -128, -88, -63, -128, -74, -68, -1, -88, -128, 127, 24, -128,
+    -128, -46, -69, 3, -16, -32, -128, -114, -47, -50, -29, -14, -43, -128, -80, -86,
+    64, -107, -14, -43, 2, -30, -128, 63, -128, -58, -62, -76, -128, -128, -128, -128,
+    -128, -18, -128, -39, -60, -128, -128, -128, 63, -128, 6, -70, -128, -128, -108, -31,
+    -93, -44, -128, -9, 54, 116, -128, -85, -128, 29, -63, -128, 74, -128, -34, -128,
+    -59, -32, -128, 127, -72, 48, -128, -33, -79, -128, -5, -128, -128, -26, -128, -36,
+    -59, -75, -34, 11, -128, -87, -63, -128, -74, -68, -1, -88, -128, 127, 24, -128,
+    -128, -45, -69, 3, -16, -32, -128, -113, -48, -50, -29, -15, -43, -128, -80, -86,
+    65, -107, -14, -43, 3, -29, -128, 63, -128, -58, -62, -75, -128, -128, -128, -128,
+    -128, -17, -128, -38, -61, -128, -128, -128, 64, -128, 6, -72, -128, -128, -109, -32,
+    -94, -41, -128, -9, 54, 117, -128, -81, -128, 28, -62, -128, 75, -128, -37, -128,
+    -60, -33, -128, 127, -71, 47, -128, -33, -85, -128, -5, -128, -128, -27, -128, -33,
+    -58, -77, -35, 13, -128, -89, -63, -128, -78, -66, -2, -86, -128, 127, 24, -128,
+    -128, -41, -69, 1, -16, -32, -128, -111, -47, -49, -27, -15, -44, -128, -80, -81,
+    64, -105, -17, -44, 4, -30, -128, 64, -128, -59, -61, -75, -128, -128, -128, -128,
+    -128, -18, -128, -39, -61, -128, -128, -128, 63, -128, 6, -71, -128, -128, -115, -30,
+    -94, -44, -128, -9, 54, 120, -128, -83, -128, 33, -62, -128, 73, -128, -39, -128,
+    -58, -32, -128, 127, -72, 48, -128, -32, -82, -128, -2, -128, -128, -25, -128, -35,
+    -60, -75, -34, 11, -128, -87, -63, -128, -74, -67, -1, -87, -128, 127, 24, -128,
+    -128, -44, -69, 2, -16, -33, -128, -112, -45, -50, -29, -14, -43, -128, -80, -84,
+    64, -106, -13, -44, 4, -29, -128, 63, -128, -58, -62, -76, -128, -128, -128, -128,
+    -128, -18, -128, -39, -61, -128, -128, -128, 66, -128, 4, -72, -128, -128, -122, -30,
+    -96, -45, -128, -11, 53, 119, -128, -80, -128, 30, -58, -128, 72, -128, -38, -128,
+    -59, -32, -128, 127, -73, 49, -128, -29, -83, -128, 3, -128, -128, -24, -128, -36,
+    -59, -74, -34, 12, -128, -91, -63, -128, -72, -68, -2, -87, -128, 127, 23, -128,
+    -128, -44, -70, 2, -13, -32, -128, -113, -44, -50, -31, -14, -41, -128, -80, -85,
+    65, -107, -10, -46, 4, -28, -128, 62, -128, -57, -62, -77, -128, -128, -128, -128,
+    -117, -24, -128, -44, -69, -128, -128, -128, 71, -128, 10, -72, -91, -128, -73, -15,
+    -112, -47, -128, -15, 58, 112, -128, -77, -128, 9, -56, -128, 67, -128, -66, -116,
+    -48, -17, -128, 127, -87, 51, -128, -17, -68, -128, -8, -128, -128, -7, -128, -42,
+    -73, -73, -34, 11, -128, -105, -57, -128, -76, -80, 3, -90, -128, 127, 26, -128,
+    -128, -41, -74, 4, -9, -33, -128, -111, -41, -55, -27, -19, -40, -128, -69, -92,
+    64, -111, -32, -45, 12, -9, -128, 70, -128, -65, -59, -82, -128, -128, -128, -128,
+    -94, -38, -128, -45, -71, -128, -128, -128, 56, -128, 43, -74, -47, -107, -84, 18,
+    -128, -21, -128, -4, 62, 127, -128, -73, -128, -7, -55, -128, 76, -128, -90, -100,
+    -32, 19, -128, 127, -80, 57, -128, -33, -128, -89, -41, -128, -128, 44, -128, -31,
+    -96, -117, -18, 22, -128, -107, -56, -92, -119, -59, 44, -96, -128, 127, 21, -128,
+    -128, -44, -84, -2, -20, -40, -128, -113, -50, -62, -10, 0, -73, -128, -17, -79,
+    51, -119, -81, -29, 28, 28, -128, 58, -128, -70, -52, -83, -128, -128, -128, -128,
+    -102, 21, -128, -39, -52, -128, -128, -128, 25, -128, 39, -62, -128, -128, -128, -9,
+    -82, -80, -128, 26, -7, 127, -128, -90, -128, -16, -68, -128, 51, -128, -36, -128,
+    -55, -1, -128, 127, -58, 62, -128, -73, -90, -128, -17, -117, -128, 12, -128, -15,
+    -81, -108, -15, 4, -128, -53, -61, -128, -52, -55, 32, -89, -128, 109, 15, -128,
+    -128, -59, -84, -5, -46, -43, -128, -107, -60, -54, -63, 29, -62, -128, -86, -128,
+    121, -103, 6, -26, 2, 5, -126, 32, -128, -46, -64, -74, -110, -128, -128, -128,
+    -91, 4, -128, -51, -71, -128, -128, -128, 65, -128, 39, -73, -11, -124, -128, 34,
+    -128, -43, -128, -5, 12, 127, -128, -76, -128, -65, -27, -128, 44, -128, -115, -85,
+    -18, 32, -128, 127, -101, 67, -128, -20, -116, -128, -21, -128, -128, 50, -128, -30,
+    -107, -106, -10, 21, -128, -121, -47, -128, -89, -81, 31, -102, -128, 112, 17, -128,
+    -128, -69, -95, 8, -11, -56, -128, -120, -38, -66, -36, 10, -58, -128, -59, -103,
+    110, -126, -57, -39, 32, 43, -128, 55, -128, -71, -58, -92, -128, -128, -128, -128,
+    -91, -9, -128, -25, -25, -128, -128, -128, 2, -128, 61, -24, -128, -61, 63, -6,
+    -51, -14, -128, 50, -128, 127, -128, -102, -128, -128, -26, -128, 0, -128, -14, -128,
+    -53, -17, -128, 127, -43, 25, -128, -104, -128, -128, -128, -128, -128, -5, -128, -58,
+    -71, -128, -28, 4, -128, -11, -58, -128, -128, -13, 8, -91, -113, 13, 52, -128,
+    -128, -62, -35, -10, -72, -38, -77, -115, -89, -54, 15, 62, -128, -128, -50, -54,
+    102, -117, -128, -4, -23, -9, -128, 45, -128, -45, -37, -43, -50, -128, -128, -128,
+    -91, -74, -128, -15, -34, -80, -128, -73, 33, -128, -17, -1, -128, -77, 30, -94,
+    -73, -101, -128, 14, -110, -101, -128, -128, -128, -119, -62, -128, -27, -128, 14, -128,
+    -102, -94, 34, 19, -32, 16, -128, -45, 23, -128, -128, -128, -128, -119, -119, -120,
+    -20, -76, -68, -34, -47, -1, -64, -109, -73, -36, -53, -83, -93, 22, 29, -128,
+    -115, -18, -7, 8, -47, -6, -128, -104, -76, -38, -54, -39, -66, -128, -70, -128,
+    53, -99, -23, -22, -103, -92, -128, 39, -111, -15, -42, -34, -36, -128, -128, -128,
+    -128, -57, -128, -18, -32, -128, -128, -78, 31, -128, -1, -10, -128, -122, -81, -86,
+    -82, -128, -128, 3, -128, -19, -127, -128, -128, -69, -59, -128, -34, -128, 6, -128,
+    -67, -89, -69, 54, -43, 23, -128, -54, 34, -128, -114, -128, -128, -103, -111, -100,
+    -36, -65, -64, -46, -61, 31, -76, -128, -30, -32, -69, -86, -110, 94, 35, -128,
+    -128, -28, -8, 13, -49, -19, -128, -112, -48, -38, -87, -14, -43, -128, -89, -128,
+    78, -104, 20, -51, -80, -78, -123, 62, -98, 3, -41, -32, -60, -128, -128, -128,
+    -128, -37, -128, -35, -49, -128, -128, -107, 66, -128, 14, -43, -128, -128, -120, -41,
+    -128, -120, -128, -12, -104, 97, -128, -99, -128, -48, -82, -128, 1, -128, -37, -127,
+    -49, -47, -128, 98, -74, 42, -128, -34, -21, -128, -66, -128, -128, -42, -128, -65,
+    -57, -66, -42, -19, -128, -34, -62, -128, -43, -57, -61, -87, -128, 115, 30, -128,
+    -128, -56, -48, 13, -20, -28, -128, -118, -41, -50, -63, -19, -31, -128, -85, -128,
+    72, -110, 3, -63, -29, -31, -128, 81, -128, -29, -52, -61, -128, -128, -128, -128,
+    -128, -74, -128, -13, -24, -79, -128, -50, 33, -128, -1, -1, -128, -116, 70, -98,
+    -83, -123, -128, 7, -128, -27, -128, -113, -128, -128, -54, -128, -50, -128, 38, -128,
+    -72, -108, -63, 48, -36, 4, -128, -59, 5, -128, -128, -128, -128, -118, -109, -103,
+    -21, -71, -78, -47, -45, 39, -78, -128, -111, -20, -95, -80, -107, 66, 64, -128,
+    -106, -14, 16, 4, -46, -7, -128, -110, -54, -36, -41, -3, -82, -128, -76, -128,
+    59, -104, -83, -51, -95, -96, -128, 84, -99, 6, -27, -20, -53, -128, -128, -128,
+    -104, -57, -128, -25, -44, -83, -128, -105, 28, -128, -11, -6, -128, -83, -28, -77,
+    -79, -128, -128, 10, -123, -15, -113, -128, -128, -105, -86, -128, -9, -128, 1, -126,
+    -72, -74, -67, 60, -51, 25, -128, -55, 76, -124, -109, -128, -128, -92, -124, -103,
+    -50, -55, -71, -28, -86, -5, -70, -104, -18, -53, -37, -90, -103, 43, 32, -128,
+    -128, -26, -26, 14, -59, -12, -128, -109, -66, -44, -77, -33, -22, -128, -59, -128,
+    64, -102, 26, -30, -72, -65, -128, 68, -126, -19, -41, -41, -44, -128, -128, -128,
+    -87, -68, -128, -31, -46, -57, -128, -99, 22, -128, -5, -2, -128, -59, 9, -70,
+    -38, -100, -128, 34, -64, -12, -104, -128, -128, -76, -86, -128, -12, -120, -28, -83,
+    -39, -53, -77, 16, -61, 32, -128, -60, 63, -116, -102, -128, -128, -83, -114, -69,
+    -61, -52, -53, -47, -104, 16, -54, -108, -34, -63, -38, -111, -75, 30, 18, -128,
+    -128, -59, -43, 24, -77, -44, -128, -119, -86, -44, -65, -26, -58, -128, -83, -128,
+    18, -111, 5, -9, -79, -61, -128, 46, -98, -36, -60, -52, -8, -128, -128, -128,
+    -52, -67, -117, -62, -82, -74, -58, -53, 87, -128, -52, -7, -59, -19, -105, -18,
+    -99, -110, -116, -38, -109, 15, -63, -128, -128, -110, -90, -128, -79, -124, -115, -94,
+    -41, -13, -128, -69, -128, 59, -110, 27, 0, -80, -23, -128, -128, -43, -74, -54,
+    -73, -33, -31, -42, -128, -85, -21, -128, -19, -126, -64, -108, -103, -4, -53, -115,
+    -128, -82, -97, 21, -18, -52, -128, -105, -12, -59, -61, -84, -23, -105, -86, -128,
+    61, -94, 61, -51, 11, -12, -128, 21, -81, -97, -95, -103, -78, -128, -128, -128,
+    -53, -73, -70, -66, -76, -128, 0, -27, 121, -122, -77, -9, -24, -31, -128, -14,
+    -96, -58, -107, -64, -104, -40, -42, -128, -78, -85, -75, -128, -104, -128, -92, -104,
+    -55, -14, -128, -102, -128, 66, -81, 58, -99, -91, 2, -85, -128, -53, -65, -48,
+    -51, -45, -11, -43, -106, -105, -5, -128, -51, -128, -95, -109, -102, -10, -99, -62,
+    -128, -126, -109, 29, 13, -54, -72, -121, 5, -58, -44, -111, -45, -95, -114, -72,
+    61, -100, 73, -65, 41, -26, -128, -21, -56, -122, -120, -121, -84, -97, -80, -128,
+    -45, -83, -31, -67, -83, -99, -5, -20, 127, -128, -90, -13, -32, -22, -92, -16,
+    -96, -40, -114, -79, -65, -84, -72, -128, -78, -51, -71, -128, -101, -128, -93, -83,
+    -45, -17, -128, -123, -128, 60, -87, 76, -106, -89, -8, -128, -128, -55, -54, -59,
+    -50, -34, -19, -50, -94, -116, -8, -128, -75, -128, -95, -116, -111, 11, -96, -58,
+    -128, -124, -103, 33, 22, -54, -54, -125, 18, -58, -24, -124, -52, -112, -120, -31,
+    60, -108, 48, -70, 44, -36, -128, -16, -39, -128, -118, -123, -88, -72, -62, -112,
+    -46, -87, -27, -67, -81, -94, -7, -18, 127, -128, -91, -13, -36, -23, -78, -19,
+    -99, -40, -112, -83, -61, -88, -77, -128, -80, -44, -73, -128, -100, -128, -89, -88,
+    -49, -21, -128, -126, -128, 59, -88, 78, -106, -88, -12, -128, -128, -58, -51, -59,
+    -46, -32, -20, -51, -91, -116, -7, -128, -79, -128, -96, -115, -114, 16, -94, -56,
+    -128, -124, -102, 33, 25, -51, -52, -125, 20, -58, -20, -127, -54, -117, -120, -26,
+    58, -107, 43, -72, 45, -40, -128, -13, -34, -128, -120, -122, -88, -65, -59, -115,
+    -45, -85, -27, -67, -83, -100, -6, -20, 127, -128, -92, -14, -34, -21, -88, -15,
+    -96, -37, -116, -81, -59, -86, -74, -128, -75, -45, -69, -128, -100, -128, -86, -81,
+    -46, -17, -128, -124, -128, 60, -90, 78, -111, -88, -7, -128, -128, -53, -54, -61,
+    -51, -34, -21, -50, -91, -118, -9, -128, -79, -128, -94, -117, -114, 14, -96, -59,
+    -128, -123, -103, 33, 24, -51, -49, -126, 20, -59, -21, -125, -54, -115, -120, -25,
+    59, -111, 46, -71, 47, -36, -128, -17, -38, -128, -117, -123, -88, -69, -60, -113,
+    -48, -78, -34, -65, -82, -119, -3, -27, 127, -128, -88, -14, -33, -31, -122, -16,
+    -93, -40, -115, -74, -61, -83, -58, -128, -70, -51, -72, -128, -96, -128, -86, -84,
+    -50, -16, -128, -111, -128, 62, -91, 70, -109, -92, -1, -107, -128, -54, -63, -63,
+    -52, -39, -19, -45, -91, -115, -10, -128, -67, -128, -92, -115, -110, 6, -99, -57,
+    -128, -124, -104, 33, 19, -51, -52, -125, 11, -59, -29, -122, -49, -103, -121, -39,
+    62, -109, 64, -67, 42, -35, -128, -22, -47, -127, -116, -121, -85, -70, -62, -116,
+    -46, -82, -35, -69, -86, -95, -9, -24, 127, -128, -85, -16, -14, -23, -106, -4,
+    -105, -48, -120, -79, -62, -73, -68, -128, -85, -56, -59, -128, -102, -128, -109, -73,
+    -41, -9, -128, -119, -128, 64, -103, 82, -92, -88, 9, -123, -128, -42, -63, -67,
+    -61, -29, -19, -48, -107, -123, -8, -128, -60, -128, -92, -118, -124, 18, -92, -73,
+    -128, -126, -106, 34, 26, -54, -76, -125, 21, -62, -34, -118, -44, -96, -116, -47,
+    60, -114, 56, -72, 47, -23, -128, -13, -52, -126, -116, -125, -101, -82, -57, -115,
+    -52, -83, -90, -74, -88, -121, -29, -37, 127, -128, -60, -28, 24, -7, -107, 36,
+    -117, -30, -128, -75, -75, 14, -116, -116, -107, -74, -24, -128, -96, -128, -128, -55,
+    -18, 20, -128, -86, -128, 70, -128, 79, -128, -84, 17, -128, -128, 6, -91, -61,
+    -86, -40, -7, -39, -128, -128, -8, -128, -88, -128, -77, -122, -128, 44, -77, -128,
+    -128, -128, -113, 28, 29, -66, -83, -126, 31, -71, -25, -79, -62, -128, -94, -27,
+    49, -124, 8, -76, 72, 13, -128, -4, -95, -128, -112, -128, -128, -128, -102, -122,
+    -55, -61, -104, -69, -78, -128, -30, -40, 126, -128, -53, -31, 14, -34, -128, 24,
+    -119, -44, -125, -68, -79, 26, -88, -111, -88, -69, -22, -128, -97, -128, -128, -83,
+    -34, 12, -128, -77, -128, 74, -128, 70, -128, -109, 26, -105, -128, -5, -98, -55,
+    -71, -52, 0, -37, -128, -124, -8, -128, -66, -128, -73, -114, -128, 48, -80, -128,
+    -128, -128, -111, 26, 31, -67, -82, -125, 27, -67, -46, -73, -58, -116, -109, -45,
+    79, -117, 37, -75, 55, 5, -128, -16, -102, -113, -116, -126, -128, -128, -99, -103,
+    -75, -58, -128, -74, -68, -128, -95, -35, 108, -128, 1, -20, 57, -23, -64, 68,
+    -128, -45, -128, -56, -128, 121, -128, -105, -128, -128, -15, -128, -125, -128, -128, -63,
+    1, 41, -128, -45, -128, 68, -128, 41, -128, -124, -78, -128, -128, 47, -85, -58,
+    -107, -83, 8, -41, -128, -85, -4, -128, -128, -119, -82, -115, -128, 35, -48, -128,
+    -128, -128, -103, 23, 8, -68, -99, -128, 23, -78, -22, -25, -102, -128, -87, -43,
+    93, -128, -82, -80, 94, 57, -128, 21, -112, -115, -101, -117, -128, -128, -128, -109,
+    -73, -57, -128, -15, -12, -128, -128, -104, -1, -128, 59, -7, -123, -23, -128, -23,
+    -87, 1, -128, 30, -128, 94, -128, -128, -128, -128, -56, -128, -31, -107, -63, -128,
+    -62, -26, 52, 93, -7, 39, -128, -110, -128, -87, -128, -128, -128, -28, -120, -55,
+    -35, -128, 4, -2, -105, 21, -54, -70, -128, 45, 12, -94, -63, 8, -33, -128,
+    -128, -88, -38, 1, -76, -65, 11, -123, -80, -44, -21, 17, -128, -128, -6, -55,
+    79, -99, -89, -3, -52, -32, -128, -23, -128, -33, -57, -36, -21, -128, -128, -128,
+    -57, 59, -128, 6, -12, -128, -128, -128, -15, -128, 3, -20, -128, -83, -128, -83,
+    -39, -63, -128, 40, -127, 19, -35, -128, -89, -128, -2, -128, 17, -101, 18, -128,
+    -88, -64, -14, 127, 43, 39, -128, -111, -128, -128, -101, 23, -128, -101, -128, -66,
+    -16, -128, -32, 41, -37, -38, -92, -128, -44, 37, 65, -92, -62, 8, -20, -128,
+    -102, -34, -25, 14, -65, -59, -61, -128, -82, -25, -104, 14, -55, -128, -69, -128,
+    127, -103, 86, 3, -123, -93, -56, -35, -128, 14, -28, -21, -55, -128, -128, -74,
+    -64, 6, -128, -22, -20, -128, -109, -128, 8, -128, 24, -37, -67, -38, -128, -9,
+    -40, 12, -128, 38, -58, 127, -12, -128, -39, -79, 2, -128, 23, -120, -67, -128,
+    -89, -8, -128, 127, -15, 70, -128, -93, -128, -108, 14, 54, -128, -27, -128, -31,
+    -42, -128, 23, 41, -122, -51, -52, -128, -62, 5, 57, -92, -101, 33, -70, -128,
+    -128, -109, -85, 2, -55, -74, -24, -125, -76, -45, -85, 27, -90, -128, -41, -103,
+    106, -99, 88, 4, -26, -27, -128, -73, -128, -45, -85, -65, -49, -128, -128, -128,
+    -56, -77, -128, 4, -4, -128, -128, -128, 10, -128, 22, -17, -128, 19, -128, -71,
+    -105, 16, -128, 20, -128, -57, -116, -119, -106, -128, 48, -128, 16, -128, 6, -128,
+    -86, -66, 9, 127, 20, 24, -128, -74, -128, -30, -128, -128, -128, -90, -128, -63,
+    0, -128, -24, 49, -56, -53, -78, 4, -128, 55, 52, -84, -122, 28, -3, -128,
+    -128, -20, -6, 4, -31, -39, -30, -128, -75, -27, -36, 10, -116, -128, 69, -100,
+    61, -116, -76, 5, -108, -87, -128, -11, -128, 5, -24, -20, -62, -128, -128, -128,
+    -78, -60, -128, -34, -31, -128, -128, -56, 31, -75, 8, 23, -112, -26, -128, -38,
+    -96, -128, -128, 21, -128, 46, -46, -128, -128, -128, -62, -128, -105, -120, -48, -120,
+    -47, -31, 1, 6, -70, 46, -128, -54, -17, -95, -128, -128, -128, -65, -79, -66,
+    -60, -107, -25, -30, -112, 7, -38, -99, -27, -44, -63, -99, -40, -62, -24, -128,
+    -128, -86, -54, 23, -59, -48, -128, -125, -64, -49, -100, -19, -54, -128, -41, -128,
+    74, -107, 32, -27, -62, -24, -128, 19, -106, -30, -62, -56, -38, -128, -128, -128,
+    -91, -76, -128, -35, -41, -111, -128, -36, 37, -128, -26, 12, -128, -49, -90, -62,
+    -17, -84, -128, 17, -128, -29, -71, -128, -128, -65, -77, -128, -84, -126, -11, -95,
+    -50, -54, -38, -63, -70, 39, -128, -45, -20, -128, -92, -128, -128, -88, -47, -77,
+    -54, -58, -38, -75, -58, 48, -43, -128, -52, -61, -94, -111, -29, 14, -31, -78,
+    -128, -96, -47, 23, -69, -45, -99, -120, -60, -47, -68, -31, -90, -128, -128, -108,
+    30, -111, 38, -30, -47, -66, -117, -8, -17, -50, -82, -62, 13, -128, -128, -128,
+    -77, -83, -92, -61, -71, -114, -41, 11, 127, -105, -94, -5, -85, -69, -128, -43,
+    -128, -128, -89, -79, -128, -41, -3, -122, -76, -102, -74, -128, -128, -128, -83, -127,
+    -63, -46, -128, -127, -128, 63, -92, 76, -24, -111, 23, -19, -104, -87, -50, -61,
+    -28, -11, -28, -57, -67, -96, -17, -128, 18, -128, -128, -102, -123, 9, -83, -87,
+    -128, -111, -90, 32, 36, -46, -128, -119, 30, -52, -88, -117, 1, -43, -116, -128,
+    70, -95, 127, -93, -5, -53, -128, 1, -34, -82, -111, -111, -121, -90, -47, -128,
+    -128, -64, -128, -36, -34, -57, -128, -16, 45, -114, -3, 16, -128, -105, 53, -59,
+    -26, -69, -128, 17, -128, -26, -128, -128, -128, -128, -97, -128, -102, -115, -49, -116,
+    -51, -65, -18, -40, -84, 27, -128, -56, -44, -128, -128, -128, -119, -96, -61, -73,
+    -41, -70, -33, -74, -85, 59, -29, -128, -124, -56, -128, -98, -28, -10, -7, -94,
+    -128, -98, -36, 15, -71, -52, -83, -109, -71, -47, -28, -27, -118, -128, -128, -69,
+    37, -93, -62, -40, -44, -59, -97, 33, -28, -61, -82, -55, 0, -128, -128, -128,
+    -89, -83, -128, -49, -52, -85, -118, -3, 77, -116, -29, 9, -113, -66, -128, -42,
+    -102, -128, -128, -19, -128, -8, -36, -128, -128, -125, -71, -128, -128, -126, -66, -111,
+    -47, -38, -82, -103, -112, 55, -128, 9, 19, -128, -59, -126, -128, -71, -45, -68,
+    -55, -42, -26, -76, -94, -1, -24, -128, 0, -95, -120, -102, -76, 9, -41, -102,
+    -128, -97, -66, 27, -23, -45, -128, -116, -22, -53, -101, -57, -46, -103, -115, -128,
+    52, -105, 69, -61, -34, -33, -128, 10, -26, -51, -91, -82, -67, -128, -128, -128,
+    -73, -66, -120, -53, -67, -128, -97, -42, 88, -128, -69, -7, -118, -33, -128, -45,
+    -70, -80, -125, -56, -104, -25, -79, -128, -116, -13, -78, -128, -82, -98, -119, -65,
+    -3, -41, -128, -66, -117, 50, -128, 20, -64, -120, -26, -99, -128, -77, -37, -43,
+    -45, -29, -31, -61, -75, -50, -36, -128, -39, -99, -76, -128, -84, 66, -63, -113,
+    -128, -118, -76, 41, -20, -90, -95, -128, 16, -47, -55, -83, -38, -115, -121, -81,
+    76, -103, 73, -69, -13, -65, -104, 20, -21, -80, -102, -91, -62, -128, -128, -75,
+    -29, -72, -64, -70, -74, -102, -2, -40, 114, -128, -72, -11, -5, 8, -87, -10,
+    -95, -47, -106, -71, -66, -42, -73, -128, -107, -65, -72, -128, -93, -128, -101, -107,
+    -53, -12, -128, -107, -128, 63, -84, 62, -94, -73, -15, -128, -128, -49, -48, -45,
+    -46, -47, -7, -46, -121, -112, 0, -128, -71, -128, -64, -111, -99, 7, -92, -61,
+    -128, -128, -112, 30, 12, -58, -78, -122, 14, -58, -31, -113, -56, -121, -105, -57,
+    78, -98, 37, -59, 51, -24, -128, -12, -50, -128, -128, -123, -78, -100, -104, -115,
+    -33, -72, -41, -64, -77, -93, -15, -47, 112, -128, -79, -11, -40, -10, -56, -21,
+    -83, -40, -116, -64, -39, -75, -77, -128, -111, -53, -83, -128, -76, -128, -73, -92,
+    -56, -19, -128, -99, -128, 56, -88, 54, -85, -79, -28, -128, -128, -57, -60, -61,
+    -50, -44, -22, -42, -102, -110, -10, -128, -77, -128, -64, -114, -97, 0, -85, -52,
+    -128, -119, -102, 31, 5, -47, -70, -123, -1, -57, -21, -119, -55, -128, -110, -50,
+    71, -105, 37, -53, 39, -37, -128, -12, -54, -127, -115, -116, -66, -83, -91, -128,
+    -38, -71, -30, -66, -85, -91, -1, -39, 119, -128, -85, -10, -22, -18, -102, -12,
+    -83, -49, -118, -65, -52, -84, -51, -128, -93, -62, -79, -128, -90, -128, -95, -77,
+    -49, -11, -128, -109, -128, 62, -74, 63, -73, -85, 0, -114, -128, -51, -60, -68,
+    -62, -34, -21, -44, -103, -113, -9, -128, -51, -128, -80, -117, -96, -8, -96, -48,
+    -128, -122, -108, 34, 7, -51, -80, -122, 2, -61, -36, -122, -41, -91, -120, -65,
+    67, -108, 71, -57, 42, -27, -128, -19, -52, -128, -115, -121, -73, -78, -73, -116,
+    -40, -82, -20, -69, -85, -77, -4, -24, 127, -128, -92, -12, -25, -14, -73, -13,
+    -93, -42, -113, -78, -53, -89, -72, -128, -88, -55, -69, -128, -98, -128, -107, -79,
+    -46, -16, -128, -125, -128, 61, -81, 79, -86, -85, -2, -128, -128, -54, -55, -64,
+    -53, -26, -21, -50, -100, -121, -6, -128, -67, -128, -91, -117, -111, 8, -93, -56,
+    -128, -124, -106, 33, 20, -55, -69, -122, 17, -60, -25, -125, -47, -103, -121, -39,
+    58, -107, 50, -67, 44, -33, -128, -12, -43, -128, -120, -125, -86, -73, -61, -108,
+    -37, -77, -40, -72, -84, -66, -21, -28, 127, -128, -81, -17, -5, -7, -50, 0,
+    -105, -46, -120, -81, -59, -64, -98, -128, -112, -65, -52, -128, -100, -128, -121, -72,
+    -35, -7, -128, -119, -128, 62, -107, 85, -82, -87, -7, -128, -128, -38, -59, -63,
+    -60, -26, -17, -50, -122, -128, -4, -128, -74, -128, -81, -119, -126, 24, -81, -84,
+    -128, -128, -106, 34, 26, -59, -87, -125, 27, -63, -26, -113, -50, -121, -115, -40,
+    72, -113, 25, -72, 51, -20, -128, -1, -57, -128, -119, -126, -105, -99, -73, -93,
+    -48, -52, -72, -71, -84, -125, -19, -47, 124, -128, -62, -27, 6, -36, -128, 19,
+    -100, -41, -127, -65, -59, 6, -96, -128, -107, -70, -47, -128, -87, -128, -128, -66,
+    -28, 12, -128, -82, -128, 70, -128, 65, -112, -110, 10, -128, -128, -12, -93, -56,
+    -76, -42, -8, -38, -128, -127, -8, -128, -70, -128, -70, -120, -128, 27, -80, -110,
+    -128, -128, -115, 31, 19, -69, -83, -125, 16, -67, -33, -87, -54, -122, -123, -43,
+    84, -117, 34, -68, 54, 0, -128, -9, -95, -125, -115, -127, -117, -128, -92, -89,
+    -60, -44, -128, -72, -76, -128, -65, -56, 108, -128, -13, -29, 56, -30, -110, 59,
+    -119, -34, -128, -51, -128, 90, -128, -112, -128, -128, -17, -128, -97, -128, -128, -61,
+    -10, 39, -128, -39, -128, 73, -128, 45, -128, -119, -34, -128, -128, 35, -111, -57,
+    -100, -76, 8, -30, -128, -111, -5, -128, -109, -125, -60, -117, -128, 33, -58, -128,
+    -128, -128, -112, 23, 10, -77, -98, -124, 14, -75, -30, -39, -84, -128, -98, -44,
+    96, -124, -38, -68, 73, 45, -128, 6, -128, -118, -105, -121, -128, -128, -128, -104,
+    -71, -51, -128, -24, -11, -128, -128, -125, 8, -128, 66, -26, -82, -14, -128, 19,
+    -77, 46, -128, 27, -120, 127, -128, -128, -128, -106, -31, -128, -5, -124, -94, -128,
+    -81, -9, 0, 112, -34, 43, -128, -99, -128, -94, -128, -128, -128, 9, -128, -83,
+    -43, -128, 17, 7, -128, -8, -42, -82, -128, 21, 31, -93, -101, 37, -24, -128,
+    -128, -128, -53, -5, -62, -61, 19, -121, -73, -57, 5, 35, -128, -128, -12, 4,
+    68, -106, -128, -2, -8, -8, -128, -26, -128, -59, -76, -53, -33, -128, -128, -128,
+    -86, 30, -128, -4, -12, -128, -128, -128, -4, -128, 42, -22, -128, -124, -128, -40,
+    -63, -53, -128, 39, -128, 66, -36, -128, -84, -97, -34, -128, -12, -111, -10, -128,
+    -77, -32, 57, 127, 20, 53, -128, -114, -128, -128, -110, 20, -128, -46, -128, -80,
+    -44, -128, -5, 12, -74, 9, -74, -128, -63, 40, 25, -94, -67, 29, -40, -128,
+    -128, -83, -40, 15, -70, -56, -40, -128, -86, -40, -102, 19, -91, -128, -86, -128,
+    127, -115, 71, -9, -76, -45, -71, -49, -128, -2, -45, -33, -53, -128, -128, -128,
+    -67, 4, -128, -18, -14, -128, -128, -128, 2, -128, 44, -42, -64, -44, -128, -3,
+    -62, 30, -115, 29, -48, 127, -80, -128, -66, -55, -17, -128, 33, -94, -128, -128,
+    -95, -19, -73, 127, -9, 62, -128, -104, -128, -109, -57, -12, -128, -23, -128, -55,
+    -22, -128, 27, 39, -128, -47, -51, -120, -117, 24, 70, -89, -110, 58, -55, -128,
+    -128, -116, -72, -3, -58, -91, -3, -114, -70, -46, -56, 26, -114, -128, -33, -59,
+    121, -81, 24, 1, -41, -30, -128, -52, -128, -43, -87, -55, -58, -128, -128, -128,
+    -99, -44, -128, -16, -7, -128, -128, -45, 27, -100, 28, 16, -128, -89, -128, -49,
+    -121, -128, -128, 33, -128, 32, -97, -128, -128, -128, -46, -128, -101, -93, -84, -128,
+    -71, -60, 127, 35, -32, 34, -128, -73, -55, -128, -128, -128, -128, -83, -117, -111,
+    -23, -128, -27, -21, -88, 15, -48, -128, -66, -4, -67, -93, -64, -54, 10, -128,
+    -128, -98, -19, 22, -49, -59, -128, -125, -76, -45, -92, 2, -77, -128, -48, -128,
+    101, -104, -17, -28, -128, -53, -128, 28, -128, 8, -47, -31, -68, -128, -128, -128,
+    -76, -23, -128, -39, -40, -128, -128, -83, 59, -128, -5, -15, -125, -81, -10, -21,
+    -74, -19, -127, -3, -128, 65, -128, -128, -128, -128, -91, -128, -40, -128, -39, -128,
+    -70, -28, -108, 37, -72, 35, -128, -45, -128, -128, -128, -128, -128, -44, -128, -60,
+    -38, -125, -20, -7, -124, -61, -32, -128, -128, -51, -41, -98, -93, -34, -23, -128,
+    -128, -110, -66, 12, -36, -48, -27, -122, -61, -53, 18, -38, -120, -128, -87, -38,
+    105, -101, -99, -26, -9, -37, -119, 17, -128, -89, -77, -74, -55, -128, -128, -128,
+    -128, -96, -128, -21, -49, -126, -128, -27, 64, -128, -46, 6, -128, -124, -37, -85,
+    -47, -63, -128, -3, -128, -118, -116, -128, -128, -86, -104, -109, -64, -118, -10, -90,
+    -63, -87, 27, -15, -38, 19, -128, -42, -68, -128, -128, -128, -122, -118, -93, -115,
+    -34, -61, -69, -49, -10, 22, -64, -128, -99, -29, -128, -104, -66, 6, -18, -104,
+    -128, -60, -16, 20, -53, -29, -58, -116, -67, -42, -26, -63, -76, -128, -112, -74,
+    -1, -108, 15, -45, -77, -100, -128, 22, -42, -44, -49, -44, -12, -128, -128, -128,
+    -110, -65, -128, -29, -45, -96, -128, -118, 30, -128, -28, 0, -128, -80, -79, -71,
+    -32, -112, -128, 29, -99, -24, -61, -128, -128, -101, -107, -128, 3, -128, 6, -92,
+    -67, -64, -59, 67, -50, 30, -128, -69, 70, -107, -60, -128, -128, -96, -128, -103,
+    -60, -42, -66, -19, -80, -1, -65, -88, 2, -59, -49, -106, -73, -1, 2, -124,
+    -128, -70, -46, 26, -77, -22, -128, -123, -93, -47, -74, -41, -15, -126, -68, -128,
+    6, -112, 82, -12, -67, -71, -128, 43, -124, -42, -55, -51, 4, -128, -128, -128,
+    -91, -64, -128, -26, -41, -128, -128, -41, 45, -109, -43, 13, -128, -45, -74, -66,
+    -35, -79, -128, 11, -128, -15, -120, -128, -128, -128, -59, -126, -82, -126, 21, -92,
+    -49, -62, -72, -9, -45, 23, -128, -48, -76, -128, -128, -128, -128, -94, -82, -83,
+    -48, -77, -61, -37, -34, 1, -63, -128, -104, -39, -87, -111, -46, -34, -14, -128,
+    -128, -70, -29, 19, -55, -36, -67, -127, -56, -44, -35, -25, -87, -128, -89, -110,
+    55, -120, -9, -33, -66, -82, -128, 9, -83, -42, -48, -50, -12, -128, -128, -128,
+    -97, -95, -128, -20, -47, -128, -128, -1, 34, -84, -48, 36, -128, -8, -128, -84,
+    -26, -113, -128, -6, -128, -121, -6, -128, -64, -115, -33, -118, -128, -120, 13, -81,
+    -26, -70, 38, -69, -42, 33, -128, -38, -52, -128, -93, -73, -112, -115, 14, -89,
+    -64, -80, -60, -78, 21, 73, -71, -128, -22, -22, -123, -113, 15, 9, -57, -128,
+    -128, -37, -14, 23, -71, -39, -74, -121, -27, -38, -109, -34, -66, -128, -107, -128,
+    59, -118, 108, -52, -59, -82, -106, -28, 26, -16, -45, -39, 13, -128, -128, -118,
+    -75, -97, -110, -60, -69, -110, -60, 6, 118, -123, -86, 2, -85, -35, -128, -48,
+    -128, -128, -94, -84, -128, -52, -11, -128, -93, -50, -83, -128, -128, -122, -96, -120,
+    -46, -51, -128, -128, -128, 58, -114, 64, -14, -98, 12, -26, -109, -89, -8, -59,
+    -31, -12, -29, -72, -64, -64, -21, -128, 18, -123, -120, -106, -100, 45, -82, -92,
+    -128, -107, -83, 34, 17, -54, -128, -119, 40, -50, -92, -115, -3, -42, -106, -128,
+    68, -90, 127, -94, 4, -55, -128, 11, 10, -78, -113, -103, -95, -111, -116, -117,
+    -97, -91, -128, -47, -54, -117, -118, -2, 84, -128, -39, 2, -114, -58, -75, -43,
+    -78, -66, -115, -44, -128, -62, -110, -128, -120, -49, -74, -128, -116, -118, -93, -114,
+    -46, -53, -77, -91, -112, 44, -128, 11, -91, -128, -93, -128, -128, -80, -28, -71,
+    -36, -58, -23, -77, -71, -2, -25, -128, -89, -80, -124, -103, -72, 49, -54, -100,
+    -128, -103, -57, 21, -22, -58, -66, -112, -5, -49, -44, -70, -87, -128, -128, -46,
+    49, -93, 10, -70, -4, -53, -117, 8, 3, -76, -101, -80, -51, -128, -128, -128,
+    -75, -82, -121, -50, -58, -91, -87, -8, 84, -99, -59, 9, -120, -37, -123, -50,
+    -76, -100, -100, -32, -128, -50, -54, -128, -120, -108, -83, -128, -116, -109, -108, -121,
+    -60, -53, -89, -101, -111, 49, -128, 15, -30, -118, -60, -128, -128, -95, -39, -67,
+    -31, -38, -27, -65, -74, -31, -19, -128, -36, -99, -112, -104, -62, -7, -61, -73,
+    -128, -103, -71, 23, -22, -62, -109, -106, -15, -49, -65, -81, -52, -121, -118, -117,
+    47, -83, 63, -57, -32, -58, -128, 3, -22, -77, -106, -87, -48, -128, -128, -128,
+    -72, -89, -83, -54, -70, -91, -89, -25, 89, -128, -85, 6, -128, -17, -83, -50,
+    -46, -73, -128, -49, -113, -53, -81, -128, -118, -23, -104, -128, -89, -104, -89, -39,
+    -2, -45, -128, -99, -114, 42, -116, 15, -50, -105, -49, -128, -128, -85, -16, -60,
+    -51, -12, -45, -71, -53, -34, -38, -128, -55, -102, -96, -128, -55, 29, -67, -60,
+    -128, -128, -73, 46, -34, -80, -77, -128, 1, -49, -35, -95, -47, -126, -122, -70,
+    35, -112, 67, -61, -15, -77, -116, 16, 13, -92, -99, -91, -21, -128, -128, -117,
+    -36, -68, -47, -69, -82, -102, 6, -41, 117, -124, -84, -8, -14, -6, -128, -10,
+    -82, -60, -115, -64, -68, -56, -33, -128, -89, -70, -73, -128, -96, -128, -97, -82,
+    -46, -7, -128, -108, -128, 67, -69, 62, -65, -81, 20, -82, -128, -49, -55, -55,
+    -63, -32, -16, -44, -110, -112, -6, -128, -33, -128, -76, -117, -92, -8, -100, -52,
+    -128, -128, -115, 35, 6, -56, -93, -123, 7, -60, -49, -116, -33, -70, -117, -85,
+    70, -106, 90, -59, 46, -23, -128, -21, -53, -128, -121, -124, -73, -93, -94, -106,
+    -36, -81, -32, -69, -85, -71, -13, -31, 127, -128, -82, -13, -11, -7, -54, -6,
+    -98, -43, -119, -75, -52, -79, -84, -128, -107, -65, -64, -128, -95, -128, -115, -74,
+    -41, -9, -128, -117, -128, 61, -92, 76, -82, -79, -11, -128, -128, -44, -60, -66,
+    -60, -31, -19, -47, -115, -123, -5, -128, -72, -128, -80, -118, -115, 9, -86, -68,
+    -128, -123, -106, 34, 18, -56, -82, -123, 15, -62, -25, -119, -50, -116, -112, -45,
+    62, -110, 34, -65, 45, -23, -128, -7, -54, -128, -117, -124, -91, -86, -67, -118,
+    -42, -57, -56, -75, -88, -82, -15, -41, 127, -128, -66, -24, 35, -27, -86, 23,
+    -111, -47, -125, -74, -63, -23, -100, -128, -122, -87, -44, -128, -97, -128, -128, -61,
+    -26, 14, -128, -96, -128, 71, -119, 82, -86, -101, 7, -128, -128, -13, -86, -62,
+    -77, -32, -8, -40, -128, -128, 0, -128, -65, -128, -75, -120, -128, 20, -80, -104,
+    -128, -128, -118, 35, 26, -69, -104, -124, 22, -68, -34, -100, -45, -116, -122, -53,
+    87, -116, 28, -71, 59, 6, -128, 0, -92, -128, -118, -128, -125, -113, -69, -80,
+    -48, -63, -128, -63, -75, -128, -46, -70, 98, -128, -18, -29, 31, -17, -128, 42,
+    -121, -31, -128, -46, -77, 64, -99, -124, -119, -78, -35, -128, -72, -128, -128, -66,
+    -25, 33, -128, -36, -128, 73, -128, 33, -128, -82, -16, -124, -128, 28, -109, -63,
+    -95, -92, 3, -25, -128, -103, -17, -128, -90, -103, -35, -117, -128, 37, -73, -128,
+    -128, -128, -108, 23, 2, -62, -84, -127, 1, -71, -39, -53, -77, -128, -71, -59,
+    75, -127, 7, -54, 61, 30, -128, -17, -122, -108, -98, -115, -113, -128, -128, -128,
+    -71, 23, -128, -54, -42, -128, -85, -97, 47, -128, 41, -24, 17, -74, -128, 49,
+    -88, -47, -128, -1, -128, 127, -119, -125, -128, -128, -49, -128, -78, -128, -101, -126,
+    -38, 39, -128, 44, -103, 76, -128, -49, -128, -128, -86, -71, -128, 40, -120, -30,
+    -91, -128, 30, -14, -128, -42, -18, -128, -112, -59, -19, -100, -90, 5, -64, -128,
+    -128, -128, -108, 10, -40, -73, -57, -122, -32, -67, -57, 11, -113, -128, -110, -85,
+    127, -109, -15, -41, 62, 49, -84, -27, -128, -90, -98, -95, -92, -128, -128, -92,
+    -91, 29, -128, -22, -8, -128, -128, -82, 7, -128, 75, -7, -64, -128, -128, -3,
+    -79, -59, -128, 31, -128, 103, -114, -128, -128, -128, -57, -128, -85, -112, -67, -128,
+    -77, -13, 115, 55, -36, 57, -128, -101, -128, -128, -128, -104, -128, -17, -102, -82,
+    -52, -128, 22, -28, -128, 44, -33, -128, -125, 11, -30, -84, -38, 0, -39, -128,
+    -128, -123, -52, 8, -70, -61, -35, -115, -76, -52, -79, 21, -128, -128, -128, -98,
+    127, -99, -31, -25, -27, 3, -39, -36, -122, -34, -75, -47, -56, -128, -128, -128,
+    -91, 2, -128, -22, -15, -128, -128, -110, 29, -128, 49, -34, -64, -110, -128, 7,
+    -68, 28, -119, 28, -111, 87, -122, -125, -69, -100, -20, -128, -29, -101, -128, -128,
+    -100, -18, 13, 97, -28, 60, -128, -81, -128, -128, -119, -107, -128, -20, -128, -85,
+    -27, -128, 29, 6, -127, -22, -33, -128, -128, 9, -10, -86, -102, 28, -50, -128,
+    -128, -128, -63, -1, -44, -81, 26, -110, -74, -53, -41, 20, -128, -128, -100, -8,
+    123, -91, -30, -15, -40, -19, -105, -56, -128, -51, -90, -60, -72, -128, -128, -128,
+    -101, -26, -128, -6, -5, -128, -128, -77, 5, -128, 42, 6, -128, -88, -128, -43,
+    -88, -92, -128, 39, -128, 18, -91, -128, -128, -128, -23, -128, -75, -101, -62, -128,
+    -77, -55, 127, 78, -6, 36, -128, -96, -128, -128, -128, -128, -128, -70, -122, -118,
+    -33, -128, -20, -15, -72, 37, -62, -128, -84, 27, -38, -91, -52, -10, -5, -128,
+    -128, -85, -14, 14, -66, -55, -96, -123, -80, -44, -94, 22, -100, -128, -61, -128,
+    127, -109, -3, -20, -112, -50, -113, -6, -128, 10, -41, -23, -49, -128, -128, -128,
+    -85, -37, -128, -36, -38, -128, -128, -94, 44, -128, 7, -14, -128, -75, -25, -24,
+    -71, -30, -128, 5, -128, 76, -128, -128, -128, -128, -102, -128, -24, -119, -55, -113,
+    -54, -30, -82, 50, -63, 34, -128, -63, -128, -125, -128, -128, -128, -40, -128, -64,
+    -45, -120, -23, -14, -124, -32, -41, -128, -128, -38, -30, -104, -89, -5, -15, -128,
+    -128, -110, -60, 16, -54, -55, -54, -125, -66, -52, 5, -29, -113, -128, -73, -60,
+    81, -103, -82, -23, -22, -38, -128, 27, -128, -76, -72, -65, -39, -128, -128, -128,
+    -81, -71, -128, -12, -48, -128, -128, -68, 44, -128, -55, 1, -128, -60, -104, -92,
+    -44, -66, -128, 12, -117, -106, -85, -128, -123, -124, -51, -90, -36, -115, 12, -83,
+    -62, -79, -6, 13, -9, 20, -128, -43, -66, -122, -123, -128, -128, -116, -120, -106,
+    -35, -79, -76, -21, -1, -23, -81, -115, -78, -21, -56, -112, -74, -9, -10, -128,
+    -75, -31, -14, 21, -48, -33, -70, -124, -68, -37, -43, -45, -64, -128, -73, -114,
+    43, -121, 30, -21, -115, -110, -128, 1, -110, -22, -30, -39, -25, -128, -128, -128,
+    -89, -53, -128, -36, -37, -80, -128, -72, 25, -128, -12, 11, -128, -56, -76, -56,
+    -38, -128, -128, 33, -128, 50, -78, -128, -128, -128, -88, -128, -58, -128, 8, -97,
+    -50, -47, -79, -6, -68, 37, -128, -63, 59, -128, -101, -128, -128, -76, -87, -78,
+    -65, -50, -49, -50, -96, 25, -50, -128, -17, -69, -61, -109, -48, -16, 2, -117,
+    -128, -91, -51, 25, -74, -34, -128, -125, -76, -50, -82, -16, -53, -128, -94, -128,
+    49, -116, 38, -20, -61, -51, -128, 30, -85, -37, -66, -58, -3, -128, -128, -128,
+    -106, -56, -128, -12, -29, -128, -128, -49, 43, -128, -12, -3, -128, -97, -128, -70,
+    -77, -57, -128, -9, -128, -54, -128, -128, -117, -100, -52, -128, -68, -120, 9, -119,
+    -62, -73, 42, 23, -18, 23, -128, -54, -128, -128, -128, -128, -128, -88, -87, -104,
+    -28, -128, -48, -35, -18, 16, -73, -128, -128, 7, -70, -99, -74, 39, -17, -128,
+    -128, -59, -8, 16, -42, -34, -20, -127, -44, -39, -38, -27, -107, -128, -89, -63,
+    105, -116, -23, -46, -70, -85, -104, 1, -76, -19, -40, -34, -46, -128, -128, -128,
+    -122, -71, -128, -31, -45, -128, -128, -50, 60, -128, -28, 8, -128, -112, -128, -65,
+    -99, -128, -128, -6, -128, -28, -30, -128, -128, -128, -99, -128, -77, -123, -29, -106,
+    -59, -64, -8, -1, -66, 40, -128, -32, 44, -128, -74, -95, -128, -93, -91, -106,
+    -51, -48, -54, -42, -65, 4, -56, -126, 23, -58, -101, -100, -81, 5, -19, -128,
+    -128, -78, -42, 31, -43, -29, -128, -123, -50, -48, -106, -58, -6, -114, -83, -128,
+    51, -109, 109, -52, -68, -59, -128, 38, -73, -26, -58, -55, -53, -128, -128, -128,
+    -92, -72, -128, -44, -51, -128, -98, -75, 68, -128, -29, -13, -117, -70, -128, -38,
+    -61, -57, -128, -2, -82, -2, -67, -128, -128, -73, -73, -128, -42, -128, -61, -107,
+    -60, -36, -128, -4, -87, 51, -128, -18, -61, -111, -33, -128, -128, -66, -125, -60,
+    -49, -64, -22, -32, -105, -36, -32, -127, -49, -78, -70, -105, -102, 18, -42, -110,
+    -128, -105, -75, 22, -34, -50, -111, -121, -54, -51, -54, -51, -61, -128, -93, -108,
+    13, -105, 46, -33, -25, -46, -128, 2, -103, -73, -92, -83, -45, -128, -128, -128,
+    -106, -79, -128, -46, -43, -128, -126, -28, 74, -128, -20, 5, -116, -74, -91, -39,
+    -93, -89, -122, -21, -128, 14, -107, -128, -128, -128, -97, -128, -99, -120, -69, -120,
+    -47, -44, -87, -36, -101, 43, -128, -18, -78, -124, -121, -128, -128, -72, -68, -56,
+    -38, -74, -21, -51, -101, -9, -25, -128, -84, -69, -109, -101, -75, -2, -40, -109,
+    -128, -115, -64, 24, -32, -55, -102, -123, -34, -50, -44, -57, -75, -128, -92, -114,
+    43, -96, 0, -55, -19, -43, -128, 27, -51, -70, -92, -76, -50, -128, -128, -128,
+    -128, -99, -128, -33, -48, -119, -128, 34, 73, -21, -35, 35, -128, -55, -96, -57,
+    -83, -116, -128, -37, -128, -98, -106, -128, -124, -128, -47, -128, -128, -127, -24, -94,
+    -19, -62, 6, -71, -90, 28, -128, -9, -80, -128, -128, -128, -18, -97, 6, -85,
+    -60, -80, -51, -76, -28, 46, -48, -128, -90, -42, -128, -101, -21, -9, -42, -128,
+    -128, -57, -18, 23, -39, -37, -79, -121, -6, -45, -67, -47, -79, -128, -106, -119,
+    69, -113, 4, -84, -18, -52, -113, 23, 15, -41, -51, -51, -41, -128, -128, -107,
+    -77, -93, -119, -55, -64, -128, -58, 5, 122, -96, -83, 1, -88, -51, -128, -45,
+    -126, -115, -101, -69, -128, -58, -15, -128, -67, -112, -71, -128, -128, -121, -89, -115,
+    -53, -47, -128, -110, -123, 57, -104, 56, -66, -97, -13, -43, -109, -89, -45, -60,
+    -27, -35, -25, -53, -60, -77, -20, -128, -13, -107, -125, -107, -102, 1, -85, -85,
+    -128, -115, -81, 34, 20, -56, -101, -126, 18, -50, -75, -109, -21, -81, -99, -128,
+    56, -98, 109, -82, -15, -59, -128, -3, -29, -79, -106, -101, -97, -115, -82, -128,
+    -101, -88, -111, -47, -58, -128, -77, 0, 85, -119, -60, 5, -128, -67, -128, -49,
+    -42, -55, -116, -24, -128, -36, -69, -128, -76, -66, -91, -128, -112, -123, -52, -108,
+    -56, -50, -124, -96, -95, 47, -128, -2, -107, -128, -63, -128, -107, -86, -46, -60,
+    -41, -50, -28, -69, -50, -3, -28, -128, -80, -80, -128, -107, -55, 0, -73, -60,
+    -128, -109, -68, 18, -32, -52, -28, -112, -27, -50, -39, -70, -87, -128, -128, -41,
+    16, -96, 51, -57, -9, -64, -125, -21, -5, -86, -101, -86, -22, -128, -128, -128,
+    -87, -71, -115, -44, -58, -128, -79, -30, 67, -128, -53, 5, -128, -61, -128, -53,
+    -47, -85, -107, -17, -128, -37, -33, -128, -100, -46, -109, -128, -88, -106, -93, -113,
+    -65, -53, -61, -74, -85, 50, -128, -17, -52, -128, -46, -85, -128, -91, -48, -75,
+    -39, -48, -30, -61, -59, -7, -32, -128, -29, -78, -101, -107, -47, 3, -70, -58,
+    -128, -105, -71, 21, -47, -61, -83, -104, -35, -49, -67, -76, -54, -103, -128, -105,
+    42, -83, 100, -46, -32, -64, -112, -14, -17, -76, -102, -80, -18, -128, -128, -128,
+    -86, -83, -65, -54, -80, -85, -72, -28, 84, -128, -70, 5, -128, -51, -91, -42,
+    -35, -67, -128, -28, -103, -47, -70, -128, -125, -32, -119, -128, -85, -93, -125, -18,
+    9, -30, -128, -93, -109, 48, -118, 1, -42, -119, -50, -128, -128, -73, -40, -56,
+    -71, -15, -42, -71, -73, -22, -34, -128, -46, -99, -110, -128, -50, 10, -67, -53,
+    -128, -120, -79, 43, -51, -90, -84, -128, -24, -53, -39, -89, -49, -110, -128, -73,
+    14, -109, 73, -52, -24, -59, -116, 14, 2, -95, -94, -90, -18, -128, -128, -128,
+    -22, -55, -116, -70, -75, -106, -50, -50, 110, -128, -56, -17, 22, 25, -126, 23,
+    -107, -61, -128, -61, -94, 8, -87, -128, -125, -120, -9, -128, -103, -128, -128, -67,
+    -23, 14, -128, -86, -128, 70, -128, 68, -79, -85, 6, -128, -128, -12, -72, -59,
+    -76, -46, -5, -38, -128, -127, -6, -128, -53, -128, -45, -123, -125, 20, -71, -128,
+    -128, -128, -110, 35, 19, -73, -122, -128, 25, -66, -55, -71, -50, -123, -94, -88,
+    102, -122, 27, -63, 42, 4, -128, -7, -102, -110, -113, -123, -116, -128, -128, -78,
+    -60, -20, -128, -60, -53, -128, -51, -96, 70, -128, 14, -34, 26, -36, -128, 50,
+    -95, -21, -128, -12, -122, 127, -99, -111, -110, -119, -21, -128, -62, -128, -128, -118,
+    -46, 37, -128, 25, -118, 80, -128, -11, -128, -119, -14, -81, -128, 35, -128, -31,
+    -84, -128, 28, -8, -128, -83, -13, -128, -99, -82, -18, -103, -128, 23, -71, -128,
+    -128, -128, -117, 9, -14, -73, -62, -122, -21, -69, -50, -4, -101, -128, -81, -62,
+    102, -112, 1, -41, 60, 39, -128, -35, -128, -100, -109, -110, -104, -128, -128, -128,
+    -60, 2, -128, -22, -16, -128, -128, -111, 12, -128, 73, -31, -43, -72, -128, 15,
+    -104, -10, -128, 16, -128, 127, -95, -125, -75, -74, -10, -128, -49, -128, -38, -128,
+    -59, 15, -9, 75, -24, 67, -128, -82, -128, -128, -128, -42, -128, 26, -128, -50,
+    -64, -128, 33, -9, -128, 3, -47, -128, -128, 27, 30, -95, -94, 60, -58, -128,
+    -128, -114, -63, 6, -46, -60, 18, -128, -51, -53, -68, 33, -128, -128, -69, -45,
+    127, -124, -33, -21, -1, 12, -99, -70, -128, -33, -68, -58, -81, -128, -128, -128,
+    -81, 10, -128, -23, -6, -128, -128, -121, -1, -128, 58, -10, -110, -65, -128, -5,
+    -53, -6, -128, 34, -128, 127, -128, -128, -128, -128, -67, -128, -35, -120, -26, -128,
+    -66, -13, -14, 116, -26, 44, -128, -122, -128, -128, -128, -128, -128, -16, -125, -48,
+    -45, -128, 13, 3, -128, 16, -45, -128, -128, 21, 10, -94, -42, -13, -37, -128,
+    -128, -128, -57, 6, -80, -64, 15, -128, -80, -49, -21, 29, -128, -128, -68, -55,
+    127, -103, -80, -7, -9, -17, -87, -24, -128, -54, -72, -48, -19, -128, -128, -128,
+    -66, 53, -128, -6, -9, -128, -128, -128, 15, -128, -2, -29, -128, -104, -128, -60,
+    -35, -18, -128, 23, -88, -4, -128, -128, -128, -128, -7, -128, 19, -114, -3, -128,
+    -102, -67, -15, 127, 2, 30, -128, -84, -128, -128, -128, -128, -128, -92, -128, -97,
+    -5, -128, -28, 30, -64, -61, -70, -128, -124, 1, 39, -93, -90, 18, -1, -128,
+    -101, -85, -29, 16, -43, -54, -35, -128, -76, -35, -43, 2, -91, -128, -103, -83,
+    127, -108, -18, -7, -91, -91, -51, -11, -128, -23, -52, -37, -63, -128, -128, -47,
+    -90, -70, -128, -25, -34, -128, -128, -51, 34, -128, 3, 6, -128, -64, -128, -51,
+    -107, -128, -128, 17, -128, 57, 5, -128, -116, -128, -68, -128, -87, -115, -36, -128,
+    -64, -40, -12, -1, -35, 53, -128, -56, -77, -106, -83, -27, -128, -64, -93, -68,
+    -48, -117, -24, -33, -71, 15, -54, -110, -8, -17, -61, -96, -70, -12, -42, -128,
+    -128, -71, -49, 15, -50, -44, -128, -119, -58, -46, -113, -20, -55, -128, -48, -128,
+    59, -104, 94, -33, -79, -43, -128, -17, -91, -12, -58, -52, -50, -128, -128, -128,
+    -83, -109, -128, -17, -44, -128, -128, -33, 41, -128, -3, 0, -128, -39, 1, -61,
+    -94, -35, -128, -5, -128, -45, -128, -128, -128, -98, -68, -128, -63, -112, -33, -94,
+    -44, -59, 41, -20, -25, 18, -128, -47, -128, -103, -128, -128, -128, -66, -75, -94,
+    -40, -128, -52, -46, -40, 13, -67, -83, -128, 5, -60, -106, -84, 30, -5, -128,
+    -128, -38, -7, 8, -49, -40, -16, -117, -50, -43, 0, -31, -128, -128, -43, -29,
+    32, -114, -102, -33, -76, -72, -128, 14, -56, -31, -34, -37, -34, -128, -128, -128,
+    -76, -81, -128, -32, -38, -88, -128, -50, 41, -79, -25, 22, -128, -24, -128, -60,
+    -107, -128, -128, 15, -128, 19, -32, -128, -128, -128, -69, -128, -91, -125, -17, -110,
+    -60, -54, -15, -14, -65, 36, -128, -36, 80, -77, -106, -128, -128, -87, -84, -99,
+    -54, -54, -58, -33, -80, -12, -54, -79, 19, -63, -65, -102, -67, -55, 0, -128,
+    -128, -70, -41, 27, -46, -27, -128, -126, -57, -49, -109, -34, -13, -128, -27, -128,
+    47, -114, 70, -31, -95, -53, -128, 39, -106, -14, -49, -53, -44, -128, -128, -128,
+    -81, -70, -128, -25, -38, -128, -128, -28, 46, -128, -17, 3, -128, -46, -26, -55,
+    -70, -44, -128, -25, -128, -37, -128, -128, -128, -74, -69, -128, -85, -119, -11, -100,
+    -40, -60, 16, -37, -49, 22, -128, -39, -128, -128, -128, -128, -128, -71, -33, -91,
+    -37, -116, -44, -60, -35, 18, -60, -128, -128, -17, -68, -109, -55, 43, -23, -128,
+    -128, -76, -19, 18, -46, -44, -2, -126, -24, -44, -8, -38, -128, -128, -97, -15,
+    104, -115, -75, -49, -36, -74, -94, 7, -23, -46, -55, -47, -28, -128, -128, -128,
+    -91, -95, -128, -22, -45, -128, -128, -38, 54, -128, -45, 17, -128, -46, -128, -84,
+    -116, -128, -128, -19, -128, -82, -15, -128, -128, -128, -60, -128, -94, -126, 2, -106,
+    -57, -77, 28, -21, -48, 31, -128, -17, 43, -96, -87, -86, -128, -109, -58, -117,
+    -45, -57, -72, -43, -20, -3, -73, -88, 24, -42, -81, -101, -76, 10, -15, -128,
+    -128, -35, -19, 29, -32, -17, -128, -125, -28, -42, -116, -59, -2, -123, -41, -128,
+    64, -117, 110, -54, -92, -79, -128, 29, -60, -1, -36, -42, -57, -128, -128, -128,
+    -98, -71, -128, -49, -41, -128, -96, -58, 65, -128, -17, -3, -88, -64, -128, -27,
+    -88, -107, -114, -15, -128, 44, -46, -128, -128, -82, -93, -128, -74, -128, -70, -128,
+    -75, -37, -102, -20, -105, 56, -128, -21, -36, -112, -35, -91, -128, -59, -82, -71,
+    -44, -64, -11, -45, -117, -13, -23, -128, -18, -82, -79, -94, -86, 21, -51, -103,
+    -128, -127, -81, 20, -34, -43, -128, -116, -36, -55, -82, -52, -47, -114, -87, -128,
+    42, -92, 77, -48, -1, -29, -128, 8, -68, -70, -107, -84, -46, -128, -128, -128,
+    -100, -78, -128, -42, -41, -128, -128, -1, 66, -98, -7, 14, -121, -50, 12, -26,
+    -94, -76, -128, -42, -128, -13, -128, -128, -128, -128, -77, -128, -128, -128, -31, -105,
+    -31, -41, -9, -63, -103, 30, -128, -17, -128, -128, -128, -128, -128, -51, -7, -86,
+    -56, -100, -30, -73, -82, 24, -36, -128, -128, -51, -115, -103, -51, 26, -31, -128,
+    -128, -101, -37, 21, -36, -38, -54, -126, -7, -53, -20, -44, -121, -128, -104, -51,
+    101, -113, -82, -71, 19, -31, -101, 29, -1, -68, -72, -64, -44, -128, -128, -128,
+    -120, -86, -128, -32, -60, -128, -128, -9, 82, -128, -61, 5, -128, -118, -128, -73,
+    -91, -128, -128, -28, -128, -61, -33, -128, -117, -73, -106, -128, -99, -123, -15, -97,
+    -60, -71, -38, -64, -62, 38, -128, -7, -13, -128, -64, -79, -116, -98, -61, -109,
+    -47, -35, -64, -61, -18, -1, -60, -128, -6, -61, -128, -105, -82, 18, -41, -107,
+    -128, -68, -39, 26, -28, -25, -122, -117, -27, -48, -83, -78, -24, -113, -115, -128,
+    43, -109, 116, -68, -57, -78, -128, 12, -22, -38, -60, -63, -54, -128, -128, -128,
+    -117, -67, -116, -45, -62, -127, -79, -54, 69, -128, -40, -3, -128, -113, -128, -50,
+    -48, -88, -118, 3, -121, 7, -49, -128, -128, -71, -128, -128, -55, -109, -85, -98,
+    -55, -45, -120, -25, -83, 49, -128, -34, -24, -128, -46, -122, -128, -81, -105, -62,
+    -52, -39, -35, -45, -91, -12, -33, -128, -24, -81, -109, -108, -72, -12, -50, -70,
+    -128, -104, -78, 23, -55, -58, -119, -108, -65, -51, -56, -70, -41, -108, -125, -128,
+    2, -88, 88, -38, -37, -53, -128, 14, -63, -79, -92, -80, -23, -128, -128, -128,
+    -79, -70, -119, -45, -55, -128, -87, -30, 80, -128, -44, 0, -128, -63, -87, -45,
+    -60, -50, -125, -14, -128, -37, -89, -128, -118, -114, -83, -128, -87, -117, -68, -101,
+    -51, -40, -100, -64, -92, 46, -128, -4, -98, -127, -95, -128, -128, -79, -81, -54,
+    -39, -68, -24, -48, -81, -35, -24, -128, -92, -79, -99, -109, -70, -20, -56, -75,
+    -128, -106, -71, 24, -29, -60, -54, -120, -43, -49, -31, -70, -86, -128, -120, -63,
+    40, -100, 10, -41, -30, -56, -128, -6, -59, -84, -94, -84, -41, -128, -128, -128,
+    -113, -127, -128, -36, -60, -128, -128, 55, 101, -28, -70, 27, -128, -33, -128, -57,
+    -102, -87, -128, -68, -128, -112, -80, -128, -38, -128, -49, -128, -128, -116, -56, -88,
+    -20, -64, -31, -112, -88, 33, -128, 24, -128, -128, -128, -125, -7, -98, 17, -81,
+    -43, -74, -48, -75, 6, 8, -49, -128, -103, -43, -128, -109, -45, 6, -76, -128,
+    -128, -69, -28, 24, -11, -50, -10, -123, 24, -45, -49, -76, -80, -128, -93, -60,
+    43, -109, 34, -96, -17, -71, -128, -4, 39, -54, -63, -65, -57, -128, -128, -123,
+    -93, -90, -121, -54, -65, -90, -88, 8, 117, -77, -87, 7, -128, -65, -128, -49,
+    -106, -128, -108, -61, -128, -53, -44, -128, -105, -128, -86, -128, -128, -125, -67, -101,
+    -49, -54, -128, -105, -123, 48, -93, 44, -24, -118, -34, -90, -75, -95, -42, -75,
+    -37, -14, -42, -59, -54, -60, -28, -128, -17, -112, -128, -109, -90, -8, -67, -85,
+    -128, -111, -72, 34, 7, -47, -120, -124, 10, -52, -67, -102, -17, -102, -112, -128,
+    48, -102, 97, -83, -15, -64, -128, 16, -23, -78, -96, -95, -80, -128, -106, -128,
+    -83, -91, -128, -50, -52, -113, -93, -11, 86, -97, -63, 12, -128, -30, -100, -54,
+    -67, -80, -112, -42, -128, -57, -72, -128, -112, -96, -88, -128, -113, -128, -41, -120,
+    -55, -56, -105, -87, -110, 42, -126, 10, -70, -113, -77, -128, -120, -96, -26, -59,
+    -32, -50, -30, -63, -58, -21, -25, -128, -69, -89, -116, -105, -53, 0, -67, -70,
+    -128, -109, -67, 26, -23, -46, -73, -121, -11, -47, -45, -85, -65, -128, -109, -88,
+    43, -95, 44, -61, -2, -66, -128, 2, -6, -85, -103, -85, -29, -128, -128, -128,
+    -108, -82, -128, -46, -54, -101, -113, -11, 80, -103, -58, 13, -128, -72, -119, -53,
+    -62, -105, -109, -31, -128, -50, -66, -128, -128, -92, -109, -128, -110, -120, -66, -114,
+    -63, -63, -56, -75, -101, 41, -128, -6, -28, -128, -74, -128, -97, -97, -36, -91,
+    -39, -33, -40, -66, -55, -2, -32, -128, -40, -86, -128, -103, -50, -2, -56, -69,
+    -128, -109, -60, 24, -36, -45, -105, -111, -23, -51, -60, -79, -47, -128, -128, -120,
+    40, -90, 76, -63, -18, -64, -117, 12, -7, -75, -96, -78, -26, -128, -128, -128,
+    -89, -74, -57, -51, -78, -98, -68, -31, 87, -128, -76, 4, -128, -71, -128, -48,
+    -34, -77, -128, -25, -101, -57, -45, -128, -112, -36, -123, -128, -82, -103, -89, -26,
+    -6, -35, -114, -88, -99, 49, -112, 0, -32, -128, -36, -113, -128, -79, -51, -66,
+    -69, -15, -46, -65, -60, -26, -38, -128, -28, -98, -113, -128, -51, -2, -71, -42,
+    -128, -118, -79, 44, -48, -76, -85, -128, -31, -52, -48, -94, -39, -92, -128, -91,
+    22, -114, 101, -50, -27, -64, -112, 4, -7, -92, -90, -90, -18, -128, -128, -128,
+    -31, 10, -128, -52, -21, -128, -116, -61, 15, -91, 46, 8, -27, 16, -128, 26,
+    -42, -55, -128, 36, -128, 127, -121, -128, -128, -128, -15, -128, -126, -116, -98, -127,
+    -31, 26, -115, -28, -106, 68, -128, -63, -128, -128, -128, -128, -128, 4, -59, -12,
+    -75, -128, 36, -46, -128, 8, -2, -128, -124, -64, -22, -108, -13, -52, -49, -128,
+    -128, -128, -95, 14, -66, -93, -63, -125, -51, -59, -66, 38, -128, -128, -117, -98,
+    127, -107, -70, -14, 9, 27, -78, -38, -113, -74, -110, -85, -32, -128, -128, -97,
+    -76, 23, -128, -6, -2, -128, -128, -96, 8, -128, 25, -11, -128, -92, -128, -43,
+    -44, -2, -128, 33, -128, 59, -128, -128, -124, -128, -29, -128, -41, -108, -5, -128,
+    -91, -55, 51, 98, 9, 24, -128, -105, -128, -128, -128, -128, -128, -66, -128, -91,
+    -11, -128, -18, 4, -59, -5, -63, -128, -128, 33, -5, -92, -53, -22, -7, -128,
+    -122, -96, -18, 4, -59, -56, 50, -125, -79, -40, -7, 24, -128, -128, -98, -19,
+    127, -106, -109, -11, -82, -73, -58, -25, -128, -26, -48, -30, -39, -128, -128, -118,
+    -108, -47, -128, -20, -23, -128, -128, -37, 27, -128, 11, 11, -128, -87, -98, -54,
+    -63, -88, -128, 25, -128, 44, -128, -128, -128, -128, -60, -128, -93, -115, -5, -114,
+    -48, -55, 2, 12, -34, 26, -128, -77, -115, -128, -128, -128, -128, -73, -86, -81,
+    -44, -121, -39, -43, -63, 41, -59, -128, -128, -7, -85, -102, -47, -16, 1, -128,
+    -128, -81, -19, 15, -64, -46, -66, -125, -67, -44, -45, 6, -119, -128, -93, -112,
+    88, -115, -55, -34, -78, -60, -111, 15, -87, -20, -45, -37, -29, -128, -128, -128,
+    -123, -54, -128, -11, -43, -128, -128, -11, 56, -69, -34, 19, -128, -128, -128, -84,
+    -76, -120, -128, 15, -128, -84, -91, -128, -128, -128, -79, -103, -109, -101, -8, -80,
+    -52, -77, 96, -11, -12, 21, -128, -52, -63, -128, -128, -128, -124, -113, -101, -121,
+    -43, -90, -74, -35, -3, 13, -73, -128, -78, -8, -128, -107, -48, -67, -9, -128,
+    -81, -45, -4, 25, -51, -37, -78, -122, -74, -41, -60, -42, -65, -128, -108, -128,
+    79, -119, 22, -43, -128, -91, -110, 17, -85, -9, -18, -31, -47, -128, -128, -128,
+    -101, -82, -128, -18, -43, -128, -128, -43, 56, -128, -36, 1, -128, -80, -69, -71,
+    -72, -57, -128, 1, -128, -53, -128, -128, -128, -128, -70, -128, -59, -120, 3, -95,
+    -61, -70, -5, 7, -23, 20, -128, -44, -127, -127, -128, -128, -128, -92, -113, -103,
+    -35, -97, -64, -25, -23, -14, -70, -113, -128, -15, -83, -106, -84, -14, -11, -128,
+    -103, -56, -17, 17, -41, -31, -39, -125, -61, -43, -17, -41, -93, -128, -67, -79,
+    36, -119, -28, -34, -86, -90, -128, 12, -97, -34, -36, -43, -37, -128, -128, -128,
+    -109, -75, -128, -36, -47, -94, -128, -22, 59, -111, -17, 14, -128, -99, -126, -61,
+    -120, -128, -128, -10, -128, 7, -59, -128, -128, -128, -115, -128, -105, -124, -24, -115,
+    -52, -56, -11, -46, -78, 39, -128, -27, 46, -128, -127, -128, -128, -80, -58, -91,
+    -55, -54, -51, -59, -80, 13, -47, -128, -3, -64, -108, -97, -73, -9, -13, -128,
+    -128, -68, -43, 26, -42, -25, -128, -116, -42, -50, -96, -58, -26, -128, -82, -128,
+    69, -104, 60, -57, -59, -44, -128, 46, -45, -29, -58, -58, -59, -128, -128, -128,
+    -113, -81, -128, -26, -40, -86, -128, 28, 57, -48, -27, 29, -128, -80, 8, -66,
+    -77, -120, -128, -22, -128, -81, -128, -128, -128, -128, -82, -128, -128, -121, -4, -96,
+    -43, -76, 95, -88, -66, 17, -128, -29, -56, -128, -128, -128, -85, -96, 2, -125,
+    -47, -74, -63, -85, -18, 55, -56, -128, -120, -36, -128, -104, -24, -4, -11, -122,
+    -128, -69, -5, 22, -49, -27, -74, -118, -26, -47, -43, -45, -101, -128, -126, -98,
+    95, -114, -40, -68, -54, -72, -83, 29, 21, -32, -47, -41, -26, -128, -128, -128,
+    -88, -68, -128, -47, -46, -128, -107, -43, 61, -128, -14, 5, -93, -63, -128, -31,
+    -107, -128, -126, -11, -128, 46, -12, -128, -128, -125, -91, -128, -100, -128, -60, -125,
+    -59, -29, -67, -44, -97, 59, -128, -18, -4, -112, -47, -57, -128, -55, -65, -70,
+    -59, -67, -18, -51, -110, -7, -29, -128, 14, -78, -82, -99, -75, 0, -50, -111,
+    -128, -108, -76, 25, -36, -42, -128, -119, -34, -55, -109, -52, -32, -99, -83, -128,
+    66, -101, 100, -50, -21, -21, -128, 6, -59, -52, -90, -79, -58, -128, -128, -128,
+    -98, -79, -128, -48, -45, -65, -128, 13, 87, -74, -32, 12, -128, -62, 96, -39,
+    -95, -71, -120, -55, -128, -34, -128, -128, -128, -128, -98, -128, -128, -125, -54, -115,
+    -40, -57, -46, -87, -118, 24, -128, 3, -115, -128, -128, -128, -97, -75, -9, -80,
+    -31, -71, -35, -75, -79, -5, -25, -128, -128, -75, -128, -102, -61, 12, -27, -110,
+    -128, -111, -42, 23, -21, -45, -47, -121, 0, -51, 7, -70, -115, -128, -121, -25,
+    93, -99, -103, -77, 9, -53, -96, 47, 4, -85, -87, -73, -52, -128, -128, -114,
+    -104, -54, -128, -31, -54, -128, -128, -52, 52, -112, -48, 16, -128, -89, -128, -71,
+    -49, -128, -127, 13, -128, -55, 15, -128, -128, -128, -91, -128, -85, -118, -27, -107,
+    -69, -59, -22, -13, -55, 45, -128, -39, 38, -128, -46, -55, -128, -108, -92, -93,
+    -57, -50, -55, -35, -47, -2, -52, -128, 35, -63, -104, -101, -40, -50, -44, -100,
+    -128, -62, -53, 24, -58, -35, -128, -110, -68, -46, -110, -58, -8, -78, -108, -128,
+    52, -99, 127, -35, -73, -64, -128, 0, -81, -39, -61, -60, -24, -128, -128, -128,
+    -97, -67, -116, -50, -50, -109, -69, -54, 79, -128, -43, -4, -93, -71, -128, -41,
+    -47, -60, -103, 1, -120, -29, -45, -128, -124, -127, -68, -128, -71, -116, -113, -128,
+    -76, -45, -128, -26, -107, 56, -128, -6, -32, -123, -13, -128, -128, -93, -122, -53,
+    -32, -45, -12, -34, -109, -44, -12, -128, -28, -100, -104, -98, -83, -21, -55, -78,
+    -128, -120, -86, 20, -29, -66, -119, -108, -57, -50, -64, -60, -51, -93, -119, -117,
+    2, -83, 69, -35, -34, -50, -128, -3, -102, -85, -114, -91, -43, -128, -128, -128,
+    -80, -110, -128, -45, -59, -127, -117, 13, 98, -67, -63, 10, -128, -30, 10, -42,
+    -88, -39, -127, -58, -128, -71, -128, -128, -108, -109, -99, -128, -119, -128, -28, -98,
+    -52, -52, -43, -102, -95, 28, -107, 14, -128, -107, -128, -128, -106, -74, -20, -89,
+    -36, -74, -44, -60, -38, -33, -35, -123, -128, -66, -122, -109, -66, -11, -61, -77,
+    -128, -100, -48, 20, -14, -34, 10, -123, -5, -52, 17, -92, -111, -128, -92, -1,
+    42, -108, -51, -66, 8, -66, -128, 4, 3, -95, -80, -79, -36, -128, -128, -128,
+    -76, -69, -111, -34, -62, -82, -128, -55, 56, -128, -80, 9, -128, -48, -128, -82,
+    -33, -126, -125, 1, -113, -61, -27, -128, -128, -97, -104, -128, -55, -115, -23, -90,
+    -69, -72, -74, -45, -57, 34, -128, -25, 53, -115, -44, -115, -128, -116, -77, -101,
+    -45, -14, -73, -44, -28, -26, -59, -128, 9, -82, -77, -113, -53, -25, -31, -79,
+    -126, -65, -51, 25, -54, -36, -128, -111, -54, -45, -74, -73, -13, -95, -105, -128,
+    33, -100, 121, -30, -80, -94, -128, 10, -62, -51, -67, -65, -8, -128, -128, -128,
+    -128, -68, -128, -45, -50, -120, -86, -47, 82, -128, -35, -6, -128, -128, -128, -60,
+    -79, -104, -97, -5, -128, 2, -51, -128, -128, -100, -128, -128, -60, -109, -93, -128,
+    -76, -62, -122, -12, -90, 49, -128, -24, -12, -128, -50, -125, -128, -101, -125, -57,
+    -24, -39, -26, -39, -98, -23, -24, -128, -16, -82, -125, -93, -96, -10, -41, -79,
+    -128, -110, -76, 22, -35, -56, -128, -108, -62, -48, -63, -76, -30, -109, -119, -128,
+    2, -76, 83, -48, -50, -61, -128, 31, -81, -71, -101, -80, -51, -128, -128, -128,
+    -74, -69, -109, -49, -53, -74, -94, -24, 83, -105, -50, 3, -128, -56, 27, -52,
+    -57, -49, -117, -23, -128, -37, -128, -128, -128, -121, -102, -128, -87, -126, -42, -115,
+    -58, -49, -114, -78, -104, 36, -123, -1, -86, -128, -128, -128, -128, -87, -63, -51,
+    -30, -59, -30, -54, -84, -38, -19, -128, -127, -91, -102, -106, -64, -26, -44, -62,
+    -128, -107, -68, 22, -28, -50, -50, -118, -38, -48, -4, -79, -97, -128, -124, -42,
+    50, -95, -39, -43, -15, -63, -123, 13, -44, -97, -99, -86, -31, -128, -128, -128,
+    -92, -104, -128, -33, -58, -103, -128, 24, 85, -84, -72, 15, -128, -59, -57, -86,
+    -93, -113, -128, -45, -128, -83, -109, -128, -123, -110, -91, -128, -126, -116, -6, -94,
+    -38, -79, -58, -110, -69, 23, -128, 9, -67, -128, -128, -128, -102, -111, -16, -81,
+    -29, -46, -68, -74, -1, -7, -57, -128, -93, -57, -128, -111, -66, 9, -33, -111,
+    -128, -55, -24, 25, -19, -36, -60, -121, -5, -41, -35, -82, -70, -128, -103, -87,
+    54, -108, 10, -72, -62, -97, -126, 22, 13, -45, -57, -60, -48, -128, -128, -128,
+    -77, -90, -121, -56, -66, -108, -63, 10, 113, -78, -73, 5, -95, -49, -128, -42,
+    -115, -119, -100, -53, -128, -37, -30, -128, -93, -128, -73, -128, -128, -121, -93, -120,
+    -55, -42, -128, -117, -124, 57, -101, 47, -44, -107, -30, -86, -107, -84, -47, -56,
+    -36, -33, -26, -58, -74, -65, -17, -128, -20, -111, -128, -103, -93, -15, -74, -87,
+    -128, -101, -81, 26, 9, -53, -113, -114, 5, -52, -73, -95, -32, -97, -107, -128,
+    49, -92, 86, -75, -17, -48, -128, 0, -34, -80, -103, -100, -89, -128, -84, -128,
+    -71, -102, -128, -48, -53, -128, -99, -14, 74, -128, -47, 8, -107, 8, -128, -33,
+    -75, -66, -123, -41, -128, -28, -64, -128, -86, -68, -59, -128, -117, -124, -78, -110,
+    -44, -39, -95, -87, -105, 49, -128, 7, -115, -96, -60, -115, -128, -68, -16, -63,
+    -45, -70, -20, -65, -66, -12, -29, -123, -73, -74, -93, -109, -58, 28, -74, -99,
+    -128, -109, -67, 21, -26, -57, -59, -119, 1, -51, -56, -62, -81, -128, -87, -74,
+    40, -100, 45, -59, 5, -47, -128, -17, -4, -76, -100, -84, -33, -128, -128, -128,
+    -73, -92, -128, -41, -47, -128, -103, -40, 53, -128, -29, 5, -119, -10, -128, -41,
+    -71, -84, -113, -9, -128, -11, -28, -128, -107, -75, -67, -128, -88, -113, -102, -128,
+    -71, -45, -53, -56, -83, 53, -128, -19, -66, -92, -44, -94, -128, -75, -55, -74,
+    -39, -74, -18, -53, -79, -5, -30, -113, -31, -65, -72, -99, -62, 15, -60, -100,
+    -128, -96, -66, 13, -42, -57, -107, -104, -33, -50, -81, -49, -66, -112, -79, -128,
+    25, -85, 76, -38, -35, -47, -128, -19, -44, -58, -98, -75, -28, -128, -128, -128,
+    -88, -89, -60, -52, -79, -101, -75, -53, 92, -128, -75, -8, -128, -50, -91, -39,
+    -42, -43, -128, -32, -53, -61, -77, -128, -118, -19, -98, -128, -54, -101, -127, -26,
+    -5, -34, -128, -53, -107, 48, -128, 10, -56, -101, -18, -128, -128, -73, -82, -65,
+    -64, -15, -43, -49, -78, -54, -38, -128, -50, -100, -93, -128, -87, 28, -62, -78,
+    -128, -117, -80, 41, -36, -83, -86, -128, -24, -53, -31, -89, -41, -101, -117, -63,
+    -6, -112, 71, -49, -22, -63, -128, 16, -44, -97, -93, -93, -35, -128, -128, -128,
+    -57, -70, -128, -47, -56, -128, -125, -31, 30, -112, 7, 15, -88, 33, -128, -12,
+    -66, -83, -128, -6, -128, 94, -92, -128, -128, -128, -60, -128, -125, -113, -90, -103,
+    -8, -3, -127, -63, -95, 54, -128, -40, -128, -109, -123, -128, -128, -22, -4, -22,
+    -85, -115, -10, -68, -117, 27, -33, -128, -95, -53, -60, -109, -24, 9, -57, -128,
+    -128, -75, -69, 8, -69, -71, -77, -107, -17, -53, -64, -11, -112, -128, -78, -104,
+    86, -97, -10, -42, 15, 1, -121, -11, -22, -66, -80, -73, -22, -128, -128, -128,
+    -107, -109, -128, -27, -40, -128, -128, 29, 62, -73, -3, 20, -128, -49, 29, -51,
+    -97, -49, -128, -24, -128, -57, -128, -128, -128, -128, -54, -128, -128, -111, -48, -91,
+    -15, -56, 34, -72, -66, 20, -128, -26, -128, -128, -128, -128, -109, -73, -19, -73,
+    -43, -123, -39, -73, -45, 42, -47, -128, -128, -11, -128, -106, -48, 7, -19, -128,
+    -128, -62, -8, 15, -40, -53, 2, -123, -23, -44, -3, -31, -128, -128, -84, -11,
+    54, -114, -128, -63, -45, -57, -128, 23, -1, -42, -47, -44, -43, -128, -128, -128,
+    -128, -80, -128, -37, -42, -105, -128, -5, 55, -116, -25, 19, -128, -101, -128, -63,
+    -71, -128, -128, -9, -128, 2, -74, -128, -128, -112, -109, -128, -121, -121, -23, -106,
+    -41, -66, -36, -58, -82, 36, -128, -38, 12, -128, -115, -128, -96, -91, -28, -87,
+    -53, -43, -48, -80, -56, 56, -48, -128, -23, -59, -128, -103, -43, 18, -24, -113,
+    -128, -91, -38, 26, -57, -38, -128, -118, -35, -48, -87, -43, -51, -128, -123, -128,
+    49, -104, 63, -65, -42, -59, -111, 34, 3, -36, -71, -56, -24, -128, -128, -128,
+    -119, -114, -128, -37, -40, -85, -128, 10, 60, -85, -22, 24, -128, -61, -86, -58,
+    -103, -128, -128, -16, -128, -11, -84, -128, -128, -128, -97, -128, -128, -123, -40, -110,
+    -46, -66, 5, -78, -87, 32, -128, -24, 8, -125, -128, -128, -99, -86, -20, -100,
+    -48, -48, -49, -80, -59, 46, -45, -114, -40, -57, -128, -101, -56, 9, -18, -118,
+    -128, -88, -32, 24, -44, -32, -128, -118, -28, -50, -80, -47, -58, -128, -79, -128,
+    20, -105, 30, -65, -51, -55, -128, 39, 5, -31, -68, -55, -33, -128, -128, -128,
+    -84, -75, -128, -36, -45, -79, -128, -9, 53, -78, -30, 20, -128, -36, 11, -51,
+    -55, -92, -128, -11, -128, -41, -128, -128, -128, -128, -76, -128, -117, -127, -18, -96,
+    -46, -55, -1, -75, -80, 27, -128, -27, -52, -128, -128, -128, -128, -81, -25, -97,
+    -53, -69, -50, -70, -56, 21, -44, -128, -113, -60, -105, -108, -33, -14, -20, -107,
+    -128, -83, -33, 20, -52, -36, -83, -118, -36, -50, -36, -43, -100, -128, -113, -93,
+    75, -111, -36, -47, -34, -58, -107, 17, -18, -57, -66, -59, -15, -128, -128, -128,
+    -109, -83, -128, -51, -53, -109, -109, 2, 94, -82, -15, 7, -90, -113, -128, -32,
+    -128, -128, -123, -28, -128, 46, -58, -128, -128, -128, -112, -128, -128, -125, -70, -118,
+    -44, -29, -82, -77, -113, 55, -128, 7, -16, -119, -109, -128, -121, -54, -72, -59,
+    -54, -61, -23, -56, -119, -23, -20, -128, -24, -85, -128, -97, -103, -27, -39, -114,
+    -128, -103, -72, 28, -10, -41, -128, -121, -27, -56, -82, -71, -38, -128, -84, -128,
+    53, -102, 40, -70, -29, -16, -128, 37, -53, -56, -82, -84, -100, -128, -80, -128,
+    -84, -87, -128, -32, -41, -104, -128, 27, 80, -30, -35, 21, -128, -57, 4, -52,
+    -118, -95, -119, -42, -128, -95, -128, -128, -128, -128, -75, -128, -128, -110, -71, -119,
+    -64, -70, 107, -95, -79, 23, -128, 1, -108, -128, -128, -128, -111, -93, -19, -123,
+    -21, -89, -45, -63, -38, -10, -36, -128, -128, -47, -126, -99, -55, -29, -29, -109,
+    -128, -88, -21, 22, -17, -41, -53, -115, -14, -49, -25, -72, -101, -128, -95, -79,
+    97, -100, -59, -67, -58, -68, -113, 22, -14, -51, -65, -56, -63, -128, -126, -128,
+    -107, -69, -128, -43, -54, -128, -102, -28, 59, -96, -35, 13, -128, -88, -128, -47,
+    -51, -127, -128, 17, -128, 41, -17, -128, -128, -128, -112, -128, -100, -123, -31, -95,
+    -51, -36, -95, -54, -76, 51, -128, -40, -8, -128, -60, -93, -128, -73, -79, -64,
+    -67, -49, -37, -54, -78, 13, -38, -128, -7, -74, -120, -109, -45, -50, -49, -74,
+    -128, -102, -71, 23, -59, -44, -128, -117, -66, -53, -84, -46, -47, -114, -116, -128,
+    17, -105, 99, -37, -44, -43, -128, -4, -53, -59, -79, -75, -16, -128, -128, -128,
+    -99, -90, -128, -45, -53, -122, -118, 13, 91, -100, -44, 5, -128, -73, -14, -50,
+    -89, -54, -105, -47, -128, -43, -128, -128, -126, -98, -108, -128, -118, -110, -84, -123,
+    -53, -60, -62, -94, -98, 33, -128, 3, -128, -128, -128, -128, -105, -86, -32, -67,
+    -20, -72, -30, -68, -60, -15, -25, -128, -128, -66, -128, -101, -69, 7, -51, -86,
+    -128, -102, -51, 17, -20, -57, -15, -110, -12, -48, -1, -81, -108, -128, -121, -12,
+    52, -85, -46, -69, -15, -66, -116, 17, 0, -85, -94, -77, -49, -128, -128, -128,
+    -99, -52, -128, -30, -49, -128, -128, -47, 66, -128, -54, 7, -128, -113, -128, -76,
+    -76, -128, -120, -3, -128, -68, -6, -128, -128, -128, -102, -128, -75, -112, -38, -110,
+    -79, -70, 12, -27, -55, 42, -128, -24, 30, -128, -62, -67, -128, -113, -96, -110,
+    -35, -44, -55, -37, -40, -22, -51, -128, 23, -65, -96, -103, -67, -28, -37, -88,
+    -128, -81, -49, 31, -38, -37, -128, -117, -57, -45, -99, -76, -7, -97, -113, -128,
+    69, -100, 127, -42, -89, -80, -120, 9, -77, -36, -67, -61, -47, -128, -128, -128,
+    -89, -62, -114, -51, -52, -123, -62, -22, 79, -115, -43, 2, -125, -76, -128, -41,
+    -47, -66, -113, -6, -128, 0, -64, -128, -113, -114, -93, -128, -100, -121, -66, -120,
+    -64, -38, -128, -78, -102, 53, -128, -9, -73, -128, -65, -128, -128, -79, -76, -46,
+    -40, -56, -15, -57, -91, -20, -14, -128, -65, -93, -117, -104, -58, -30, -64, -53,
+    -128, -123, -83, 20, -34, -58, -67, -113, -47, -51, -48, -64, -81, -128, -128, -80,
+    35, -92, 42, -42, -18, -48, -125, -15, -48, -90, -110, -92, -31, -128, -128, -128,
+    -70, -111, -128, -45, -60, -89, -128, 19, 103, -68, -77, 10, -128, -20, 25, -53,
+    -99, -64, -125, -66, -128, -89, -128, -128, -120, -110, -86, -128, -123, -127, -38, -92,
+    -47, -63, -55, -120, -99, 25, -115, 31, -123, -104, -128, -128, -112, -87, -13, -95,
+    -28, -51, -54, -66, -28, -46, -39, -126, -128, -78, -118, -113, -77, 1, -48, -88,
+    -128, -93, -42, 26, -3, -38, -23, -125, 9, -50, 5, -97, -92, -128, -90, -25,
+    51, -109, -40, -72, -16, -80, -128, 16, 5, -83, -78, -78, -52, -128, -126, -128,
+    -72, -87, -106, -47, -65, -84, -103, -28, 87, -128, -84, 5, -128, -36, -128, -61,
+    -84, -128, -115, -40, -128, -61, -15, -128, -128, -77, -89, -128, -90, -126, -50, -101,
+    -64, -60, -105, -87, -100, 46, -128, 22, 37, -98, -9, -75, -128, -98, -48, -95,
+    -42, -8, -54, -56, -48, -50, -41, -128, 21, -107, -93, -110, -83, 8, -53, -83,
+    -128, -90, -66, 31, -16, -36, -128, -118, -9, -50, -86, -94, -3, -61, -97, -128,
+    46, -102, 127, -60, -38, -72, -128, 10, -34, -63, -88, -85, -52, -128, -128, -128,
+    -72, -74, -100, -56, -63, -99, -52, -36, 101, -128, -59, -5, -72, -67, -128, -46,
+    -119, -121, -98, -51, -121, -38, -33, -128, -128, -83, -111, -128, -87, -123, -89, -128,
+    -66, -43, -122, -78, -123, 56, -112, 32, -7, -93, -30, -88, -128, -82, -67, -59,
+    -31, -36, -23, -47, -101, -73, -15, -128, -5, -114, -90, -100, -103, 4, -65, -74,
+    -128, -107, -89, 31, -2, -49, -128, -116, -11, -51, -71, -111, -15, -86, -99, -128,
+    63, -86, 91, -62, -12, -46, -128, 19, -51, -86, -109, -99, -82, -100, -91, -128,
+    -77, -86, -128, -57, -63, -106, -85, -3, 101, -91, -44, 2, -95, -45, 27, -21,
+    -93, -41, -128, -58, -128, -16, -128, -128, -128, -106, -106, -128, -114, -128, -46, -92,
+    -32, -26, -118, -97, -125, 39, -106, 19, -128, -119, -128, -128, -128, -47, -30, -56,
+    -52, -75, -25, -62, -95, -42, -19, -128, -128, -90, -113, -111, -76, -3, -61, -81,
+    -128, -118, -72, 25, -14, -45, -20, -126, -5, -56, 14, -88, -110, -128, -109, -7,
+    65, -108, -67, -67, 40, -33, -126, 16, -11, -113, -95, -94, -53, -128, -128, -128,
+    -101, -100, -128, -42, -60, -107, -128, 39, 111, -61, -91, 13, -128, -76, -128, -75,
+    -114, -128, -112, -66, -128, -72, -79, -128, -97, -123, -92, -128, -128, -114, -36, -100,
+    -44, -79, -91, -124, -92, 32, -115, 34, -56, -128, -104, -124, -53, -114, -14, -87,
+    -21, -23, -61, -72, -3, -33, -47, -128, -56, -80, -128, -111, -82, 5, -51, -99,
+    -128, -87, -39, 32, 5, -43, -77, -125, 18, -44, -51, -99, -39, -128, -113, -111,
+    61, -104, 61, -92, -51, -95, -124, 23, 14, -53, -74, -74, -76, -128, -108, -128,
+    -91, -93, -108, -59, -72, -79, -72, 5, 114, -120, -68, 1, -88, -65, -126, -42,
+    -118, -124, -103, -71, -128, -48, -60, -128, -128, -68, -100, -128, -126, -124, -94, -109,
+    -42, -45, -128, -116, -128, 53, -118, 48, -23, -118, -38, -110, -98, -79, -26, -62,
+    -44, -20, -32, -72, -81, -50, -20, -128, -23, -117, -128, -104, -97, 31, -67, -93,
+    -128, -99, -78, 29, 3, -49, -128, -113, 18, -53, -65, -108, -26, -99, -118, -122,
+    56, -91, 78, -87, 10, -44, -128, 25, 1, -87, -104, -99, -86, -123, -108, -128,
+    -102, -84, -128, -35, -43, -128, -128, 24, 77, -57, -32, 18, -128, -49, -69, -45,
+    -87, -67, -126, -41, -128, -50, -128, -128, -106, -128, -49, -128, -128, -127, -32, -123,
+    -46, -57, -25, -76, -84, 29, -128, -6, -128, -128, -128, -128, -87, -80, -14, -80,
+    -38, -103, -35, -65, -38, 11, -40, -128, -128, -41, -128, -97, -46, -4, -45, -128,
+    -128, -79, -29, 13, -23, -41, -8, -117, -4, -47, -25, -46, -120, -128, -108, -37,
+    90, -104, -54, -75, -10, -56, -107, 3, -10, -59, -67, -61, -52, -128, -128, -112,
+    -124, -55, -128, -20, -27, -128, -128, 17, 56, -36, -6, 30, -128, -128, -128, -68,
+    -120, -128, -118, 4, -128, -81, -1, -128, -126, -128, -41, -128, -128, -115, -42, -128,
+    -85, -72, 127, -51, -53, 44, -128, -28, 11, -128, -128, -76, -99, -112, -58, -121,
+    -36, -96, -37, -57, -39, 41, -43, -128, 17, -31, -128, -79, -38, -51, -28, -128,
+    -128, -59, -19, 19, -32, -28, -128, -107, -50, -44, -128, -35, -38, -128, -115, -128,
+    115, -99, 96, -63, -103, -50, -107, 0, -57, 7, -51, -40, -79, -128, -128, -128,
+    -93, -87, -74, -44, -79, -128, -66, -43, 80, -128, -61, 1, -128, -60, -102, -36,
+    -11, 1, -128, 4, -96, -65, -75, -128, -80, -94, -93, -128, -65, -98, -113, -15,
+    -6, -22, -116, -45, -77, 47, -128, -19, -128, -111, -64, -128, -128, -69, -107, -54,
+    -75, -55, -39, -38, -69, -34, -38, -128, -98, -70, -112, -128, -55, -40, -72, -60,
+    -128, -104, -76, 31, -58, -86, -13, -124, -66, -53, -10, -70, -84, -128, -122, -23,
+    -35, -116, 37, -27, -38, -58, -128, -16, -64, -100, -78, -85, -7, -128, -128, -128,
+    -103, -64, -128, -33, -56, -128, -122, -44, 36, -128, -18, 10, -128, -51, -128, -38,
+    -19, -48, -128, 24, -128, 22, -59, -128, -91, -128, -77, -128, -89, -103, -85, -101,
+    -45, -33, -79, -10, -51, 47, -128, -65, -128, -128, -92, -119, -128, -66, -82, -55,
+    -68, -101, -28, -40, -69, 24, -46, -128, -80, -33, -99, -105, -26, -34, -60, -121,
+    -128, -71, -58, 4, -79, -66, -38, -99, -67, -49, -55, -19, -95, -128, -107, -89,
+    24, -91, 48, -27, -36, -40, -128, -27, -69, -62, -70, -62, 0, -128, -128, -128,
+    -128, -80, -128, -47, -50, -128, -128, 42, 97, -85, -19, 8, -128, -127, -61, -39,
+    -118, -91, -117, -53, -128, -1, -128, -128, -128, -115, -114, -128, -128, -114, -71, -116,
+    -29, -48, -56, -107, -109, 39, -128, 2, -128, -128, -128, -128, -56, -65, -13, -57,
+    -37, -83, -21, -86, -74, 20, -24, -128, -128, -59, -128, -100, -69, 21, -49, -108,
+    -128, -109, -48, 22, -17, -56, -28, -117, -1, -50, -22, -70, -112, -128, -128, -31,
+    84, -96, -49, -91, 1, -41, -91, 27, 28, -73, -87, -75, -75, -128, -128, -128,
+    -118, -128, -128, -44, -49, -109, -128, 57, 91, -9, -37, 31, -128, -48, -112, -48,
+    -123, -127, -128, -39, -128, -44, -74, -128, -119, -128, -90, -128, -128, -121, -63, -104,
+    -36, -55, 4, -128, -102, 38, -128, 7, -77, -108, -128, -128, -24, -82, 4, -82,
+    -45, -62, -36, -85, -47, 31, -30, -107, -77, -59, -128, -103, -51, -20, -55, -93,
+    -128, -96, -41, 23, -23, -41, -89, -119, -9, -52, -60, -69, -79, -128, -77, -127,
+    -4, -104, 17, -80, -30, -48, -128, 17, 38, -52, -77, -69, -46, -128, -128, -128,
+    -111, -128, -128, -44, -52, -128, -128, 38, 98, -44, -48, 24, -128, -50, -128, -52,
+    -128, -128, -128, -53, -128, -45, -33, -128, -115, -128, -101, -128, -128, -128, -42, -108,
+    -43, -56, -10, -116, -101, 42, -125, 18, -52, -81, -103, -104, -52, -82, -6, -87,
+    -43, -53, -40, -74, -43, 7, -36, -85, -34, -64, -128, -103, -73, -5, -62, -95,
+    -128, -96, -48, 30, -10, -30, -122, -127, 0, -51, -77, -88, -44, -128, -55, -128,
+    2, -108, 70, -83, -27, -52, -128, 18, 27, -49, -76, -73, -60, -128, -125, -128,
+    -128, -128, -128, -46, -59, -119, -121, 57, 116, -86, -66, 12, -128, -76, -128, -54,
+    -128, -111, -100, -67, -128, -78, -75, -128, -82, -78, -96, -128, -128, -108, -117, -115,
+    -53, -75, -47, -128, -108, 40, -128, 35, -87, -116, -86, -128, -18, -99, -12, -96,
+    -20, -30, -39, -85, -28, -4, -31, -124, -64, -73, -128, -101, -94, 35, -63, -93,
+    -128, -101, -44, 22, 3, -51, -74, -109, 17, -50, -52, -95, -58, -128, -98, -81,
+    -15, -88, 55, -98, -33, -72, -128, 18, 42, -60, -93, -78, -73, -128, -107, -128,
+    -104, -77, -128, -50, -56, -128, -81, -30, 102, -128, -37, -8, -80, -98, -128, -29,
+    -119, -89, -115, -32, -128, 7, -60, -128, -120, -128, -83, -128, -94, -121, -96, -116,
+    -55, -33, -128, -35, -106, 56, -128, 12, -89, -111, -55, -112, -128, -63, -111, -57,
+    -40, -66, -17, -32, -106, -61, -21, -128, -49, -83, -113, -100, -117, -11, -58, -113,
+    -128, -115, -80, 25, -3, -56, -107, -122, -27, -54, -57, -75, -46, -128, -88, -126,
+    33, -99, 51, -62, -20, -35, -128, 12, -92, -76, -94, -91, -93, -128, -104, -128,
+    -102, -78, -128, -28, -45, -128, -128, -3, 71, -125, -35, 7, -128, -103, -85, -68,
+    -80, -77, -122, -12, -128, -90, -101, -128, -118, -113, -87, -128, -103, -102, -72, -111,
+    -66, -71, 53, -70, -57, 33, -128, -19, -90, -128, -128, -128, -128, -103, -67, -101,
+    -22, -77, -41, -60, -35, 4, -41, -128, -96, -42, -121, -102, -64, -5, -35, -90,
+    -128, -84, -32, 21, -33, -52, -53, -112, -46, -44, -43, -65, -90, -128, -124, -74,
+    54, -97, 6, -50, -82, -81, -116, 3, -32, -46, -71, -57, -46, -128, -122, -128,
+    -74, -49, -128, -48, -57, -128, -83, -39, 70, -114, -31, 5, -104, -70, -128, -33,
+    -93, -127, -128, -20, -128, 36, -32, -128, -128, -123, -110, -128, -102, -128, -36, -100,
+    -42, -20, -85, -61, -94, 57, -126, -14, -48, -125, -75, -64, -128, -51, -54, -57,
+    -66, -73, -25, -50, -97, -24, -31, -128, -23, -81, -81, -109, -60, -23, -64, -88,
+    -128, -107, -81, 30, -36, -46, -123, -125, -32, -54, -79, -70, -45, -128, -107, -128,
+    97, -108, 81, -50, -7, -26, -116, -2, -48, -71, -85, -85, -53, -128, -128, -128,
+    -72, -109, -128, -41, -54, -126, -121, 14, 98, -67, -71, 9, -128, -36, -49, -55,
+    -111, -75, -109, -54, -128, -74, -117, -128, -105, -122, -102, -128, -114, -111, -75, -112,
+    -69, -68, -4, -108, -84, 30, -100, 18, -124, -92, -128, -128, -124, -95, -34, -103,
+    -12, -59, -46, -55, -29, -49, -35, -115, -123, -67, -112, -108, -80, -20, -54, -71,
+    -128, -104, -46, 24, -5, -47, -32, -118, -7, -49, -9, -99, -81, -128, -79, -57,
+    40, -95, -6, -64, -47, -85, -128, 8, -12, -74, -84, -76, -54, -128, -101, -128,
+    -68, -85, -95, -46, -72, -70, -101, -47, 71, -128, -69, 5, -128, -37, -128, -61,
+    -73, -128, -127, -24, -96, -55, -18, -128, -128, -60, -110, -128, -68, -125, -45, -88,
+    -57, -51, -85, -76, -90, 45, -128, 3, 58, -91, -23, -100, -128, -87, -55, -94,
+    -59, -13, -59, -56, -62, -36, -46, -119, 22, -102, -76, -112, -74, 3, -45, -79,
+    -128, -71, -67, 28, -38, -32, -128, -111, -31, -52, -83, -91, -6, -64, -94, -128,
+    36, -102, 122, -44, -39, -61, -128, 15, -37, -65, -79, -80, -33, -128, -128, -128,
+    -66, -102, -128, -53, -53, -128, -73, -19, 65, -102, -33, 9, -128, -1, -112, -38,
+    -71, -81, -128, -11, -128, 61, -72, -128, -128, -113, -97, -128, -102, -128, -43, -110,
+    -37, -26, -128, -92, -103, 50, -128, -14, -86, -78, -87, -128, -128, -57, -40, -20,
+    -52, -67, -19, -63, -99, -9, -22, -107, -81, -82, -88, -111, -58, -17, -58, -79,
+    -128, -107, -81, 18, -41, -55, -81, -121, -32, -51, -41, -53, -92, -128, -76, -101,
+    5, -99, 9, -39, -7, -39, -128, -4, -24, -82, -100, -89, -19, -128, -128, -128,
+    -80, -109, -128, -41, -66, -122, -126, 17, 94, -80, -75, 10, -128, -36, -38, -59,
+    -85, -66, -127, -53, -128, -74, -126, -128, -101, -92, -99, -128, -117, -119, -38, -86,
+    -41, -60, -67, -113, -83, 28, -119, 15, -128, -112, -128, -128, -108, -87, -18, -84,
+    -37, -55, -56, -66, -19, -29, -46, -128, -128, -66, -123, -114, -68, -1, -55, -88,
+    -128, -78, -42, 22, -18, -42, -14, -118, -3, -48, -5, -91, -89, -128, -98, -31,
+    39, -106, -10, -67, -24, -80, -128, 6, 10, -77, -71, -74, -40, -128, -128, -128,
+    -72, -73, -106, -49, -65, -119, -67, -23, 95, -96, -77, 7, -128, -63, -128, -54,
+    -98, -128, -112, -39, -128, -51, 12, -128, -109, -110, -107, -128, -103, -122, -55, -103,
+    -63, -47, -75, -91, -99, 54, -86, 21, 7, -102, -20, -31, -128, -91, -55, -83,
+    -43, -28, -41, -49, -58, -58, -32, -128, 23, -103, -102, -109, -75, -28, -73, -59,
+    -128, -103, -79, 35, -13, -42, -128, -121, -18, -51, -90, -106, -3, -61, -105, -128,
+    63, -100, 127, -59, -35, -60, -128, -2, -39, -71, -92, -91, -61, -120, -96, -128,
+    -63, -60, -83, -55, -73, -119, -40, -39, 100, -119, -69, -2, -66, -58, -128, -33,
+    -83, -86, -115, -40, -114, -66, -24, -128, -103, -105, -89, -128, -93, -125, -84, -94,
+    -57, -27, -106, -78, -115, 59, -97, 30, -44, -108, -21, -81, -128, -72, -75, -69,
+    -53, -45, -26, -40, -89, -79, -19, -128, -20, -112, -92, -110, -81, -27, -81, -62,
+    -128, -106, -92, 32, -11, -51, -107, -118, -22, -55, -64, -105, -29, -88, -120, -125,
+    70, -100, 98, -52, -3, -39, -128, -11, -64, -98, -101, -102, -67, -118, -90, -128,
+    -95, -99, -121, -60, -68, -102, -82, 26, 118, -93, -52, 0, -100, -67, -5, -17,
+    -110, -57, -123, -74, -128, -14, -128, -128, -128, -74, -111, -128, -128, -128, -81, -85,
+    -25, -30, -128, -128, -128, 43, -109, 36, -128, -128, -128, -128, -81, -45, -13, -65,
+    -51, -53, -26, -78, -86, -36, -18, -128, -128, -97, -128, -113, -90, 24, -66, -82,
+    -128, -128, -71, 27, -1, -52, -21, -124, 17, -59, 6, -95, -102, -128, -126, 3,
+    55, -106, -45, -88, 41, -34, -122, 20, 21, -110, -101, -99, -72, -128, -115, -128,
+    -111, -123, -128, -40, -61, -122, -128, 50, 121, -70, -94, 12, -128, -79, -128, -77,
+    -125, -116, -112, -75, -128, -103, -85, -128, -73, -107, -88, -128, -128, -106, -64, -93,
+    -38, -85, -71, -126, -90, 30, -128, 42, -91, -125, -108, -128, -31, -119, -17, -90,
+    -13, -27, -59, -73, 8, -33, -47, -128, -74, -69, -128, -113, -93, 17, -56, -101,
+    -128, -89, -33, 33, 12, -51, -52, -127, 23, -43, -40, -106, -46, -128, -102, -80,
+    30, -104, 52, -98, -59, -103, -128, 23, 24, -52, -74, -73, -82, -128, -93, -128,
+    -109, -60, -111, -51, -62, -128, -63, -39, 98, -128, -51, -10, -105, -127, -128, -46,
+    -96, -105, -104, -34, -128, -16, -40, -128, -128, -75, -119, -128, -78, -121, -77, -121,
+    -65, -45, -128, -45, -104, 56, -128, 8, -36, -128, -29, -80, -128, -80, -98, -62,
+    -39, -41, -26, -43, -92, -50, -25, -128, -14, -97, -115, -99, -103, 5, -62, -83,
+    -128, -108, -84, 27, -14, -48, -124, -114, -31, -51, -67, -94, -24, -96, -128, -128,
+    51, -90, 99, -62, -15, -47, -128, 14, -65, -82, -100, -92, -75, -122, -104, -128,
+    -101, -87, -126, -50, -62, -69, -115, 12, 99, -88, -54, 7, -128, -78, 34, -48,
+    -87, -68, -106, -57, -128, -68, -128, -128, -128, -100, -116, -128, -121, -123, -68, -116,
+    -52, -59, -76, -100, -115, 32, -118, 16, -99, -128, -128, -128, -84, -86, -25, -76,
+    -33, -52, -40, -71, -66, -23, -24, -128, -128, -87, -128, -100, -69, 5, -48, -83,
+    -128, -93, -54, 19, -18, -43, -46, -108, -7, -51, -2, -95, -90, -128, -128, -29,
+    60, -88, -37, -75, 7, -58, -108, 30, 5, -96, -92, -82, -51, -128, -128, -128,
+    -128, -81, -128, -33, -48, -100, -128, 1, 68, -95, -34, 18, -128, -121, -122, -63,
+    -75, -128, -112, -10, -128, -47, -81, -128, -128, -128, -107, -128, -120, -106, -82, -118,
+    -64, -76, 8, -44, -76, 33, -128, -32, -5, -128, -122, -128, -65, -106, -59, -111,
+    -40, -43, -52, -64, -48, 31, -45, -128, -35, -57, -128, -95, -53, -11, -26, -113,
+    -128, -81, -34, 18, -49, -43, -128, -101, -43, -49, -74, -55, -45, -128, -124, -128,
+    33, -87, 62, -65, -62, -65, -120, 34, -26, -41, -69, -55, -38, -128, -128, -128,
+    -104, -59, -113, -34, -58, -128, -128, -86, 55, -128, -33, -7, -128, -80, -53, -47,
+    2, -5, -128, 19, -63, -79, -107, -128, -128, -73, -63, -128, -30, -107, -84, -36,
+    -19, -38, -83, 19, -68, 40, -128, -42, -77, -128, -74, -128, -128, -80, -128, -71,
+    -67, -63, -39, -33, -82, -12, -46, -128, -87, -59, -80, -127, -63, 9, -33, -104,
+    -128, -99, -57, 32, -67, -76, -65, -128, -79, -48, -29, -41, -82, -128, -128, -48,
+    4, -121, 15, -19, -51, -64, -128, 5, -101, -75, -72, -68, -7, -128, -128, -128,
+    -75, -86, -128, -44, -44, -128, -71, -18, 61, -123, -37, 6, -128, -26, -128, -46,
+    -56, -61, -109, -8, -128, 34, -52, -128, -82, -82, -93, -128, -99, -111, -71, -128,
+    -65, -44, -108, -81, -80, 51, -128, -25, -128, -109, -78, -108, -128, -77, -46, -40,
+    -27, -81, -11, -59, -68, -1, -24, -128, -82, -62, -92, -104, -48, -11, -73, -65,
+    -128, -118, -74, 13, -42, -65, -33, -111, -36, -47, -47, -52, -99, -128, -102, -70,
+    23, -84, 42, -39, -29, -60, -128, -30, -23, -75, -108, -82, -14, -128, -128, -128,
+    -128, -120, -128, -47, -56, -128, -113, 51, 103, -84, -55, 15, -128, -83, -128, -46,
+    -88, -84, -120, -60, -128, -44, -88, -128, -66, -61, -98, -128, -128, -121, -62, -100,
+    -29, -58, -82, -125, -108, 42, -128, 13, -128, -128, -100, -126, -9, -82, 9, -69,
+    -42, -52, -30, -93, -30, 30, -33, -128, -94, -64, -128, -108, -56, 37, -78, -86,
+    -128, -114, -50, 24, -19, -52, -20, -120, 12, -50, -43, -77, -88, -128, -128, -37,
+    17, -101, 42, -96, 10, -60, -124, 1, 63, -74, -94, -79, -43, -128, -128, -128,
+    -109, -115, -128, -45, -58, -128, -125, 52, 98, -41, -41, 19, -128, -69, -128, -35,
+    -115, -107, -127, -44, -128, -54, -76, -128, -92, -128, -80, -128, -128, -117, -87, -94,
+    -38, -44, 1, -128, -103, 45, -128, 18, -103, -128, -126, -128, -50, -69, -8, -91,
+    -52, -64, -31, -84, -50, 12, -28, -128, -80, -66, -128, -106, -60, -8, -65, -91,
+    -128, -101, -48, 23, -16, -49, -62, -115, -3, -55, -59, -72, -84, -128, -113, -89,
+    33, -106, 27, -82, -21, -41, -128, -2, 26, -62, -81, -77, -63, -128, -113, -128,
+    -114, -79, -128, -39, -52, -128, -128, 26, 93, -52, -31, 13, -128, -118, -128, -35,
+    -128, -128, -128, -35, -128, 7, -70, -128, -117, -128, -105, -128, -128, -114, -63, -98,
+    -44, -41, 9, -88, -81, 45, -128, -3, -97, -128, -128, -105, -83, -61, -46, -97,
+    -51, -77, -36, -60, -58, -6, -39, -128, -63, -53, -128, -105, -75, -32, -53, -109,
+    -128, -105, -49, 28, -16, -44, -87, -123, -18, -55, -67, -68, -61, -128, -104, -128,
+    78, -111, 45, -78, -41, -39, -126, 10, -23, -48, -66, -70, -84, -128, -98, -128,
+    -117, -103, -128, -40, -54, -128, -112, 47, 108, -64, -55, 11, -128, -110, -128, -55,
+    -105, -87, -116, -38, -128, -83, -66, -128, -60, -128, -77, -128, -128, -111, -78, -107,
+    -53, -60, -22, -123, -87, 44, -128, 21, -120, -128, -113, -128, -51, -96, -46, -81,
+    -28, -63, -31, -72, -30, -7, -28, -128, -82, -62, -128, -103, -75, -16, -67, -79,
+    -128, -100, -47, 24, -4, -53, -32, -116, -16, -48, -52, -81, -82, -128, -128, -64,
+    27, -101, 38, -78, -50, -67, -128, -11, 0, -60, -84, -77, -72, -128, -68, -128,
+    -100, -62, -128, -48, -60, -128, -86, -24, 86, -114, -31, 0, -99, -95, -128, -22,
+    -95, -90, -128, -25, -128, 25, -66, -128, -117, -128, -102, -128, -108, -125, -63, -98,
+    -44, -21, -94, -49, -94, 54, -128, -9, -110, -128, -88, -102, -128, -47, -78, -64,
+    -64, -80, -22, -43, -94, -29, -30, -128, -66, -71, -113, -106, -77, -25, -67, -101,
+    -128, -110, -77, 24, -27, -49, -77, -121, -32, -57, -53, -66, -64, -128, -109, -113,
+    65, -107, 49, -58, -1, -24, -128, -3, -60, -80, -83, -86, -64, -128, -128, -128,
+    -112, -67, -128, -32, -50, -128, -128, -18, 67, -128, -34, 2, -128, -111, -87, -57,
+    -45, -45, -123, -8, -128, -68, -110, -128, -108, -76, -98, -128, -88, -112, -58, -108,
+    -67, -61, -2, -53, -62, 36, -128, -31, -118, -128, -128, -128, -128, -91, -74, -91,
+    -35, -78, -36, -58, -45, 11, -40, -128, -112, -47, -123, -102, -55, 1, -46, -80,
+    -128, -92, -44, 16, -46, -49, -22, -108, -53, -47, -28, -60, -102, -128, -128, -34,
+    45, -96, 8, -46, -44, -71, -103, -8, -32, -68, -79, -64, -24, -128, -128, -128,
+    -78, -58, -128, -41, -48, -128, -101, -27, 51, -101, -30, 14, -128, -54, -128, -43,
+    -41, -98, -128, 12, -128, 11, -29, -128, -117, -124, -87, -128, -108, -118, -44, -100,
+    -53, -33, -45, -76, -76, 52, -128, -35, -49, -128, -78, -104, -128, -71, -52, -66,
+    -59, -70, -25, -62, -74, 15, -32, -128, -35, -69, -96, -111, -27, -35, -59, -65,
+    -128, -109, -69, 23, -58, -54, -91, -117, -55, -51, -79, -43, -76, -128, -128, -128,
+    57, -104, 73, -33, -40, -45, -114, -26, -36, -62, -88, -75, -11, -128, -128, -128,
+    -95, -96, -118, -45, -59, -128, -97, 20, 106, -81, -76, 7, -128, -68, -116, -51,
+    -90, -69, -101, -58, -128, -82, -93, -128, -72, -91, -101, -128, -127, -106, -97, -110,
+    -61, -65, -42, -108, -96, 39, -107, 22, -127, -128, -106, -128, -79, -98, -30, -91,
+    -18, -49, -37, -63, -30, -37, -30, -128, -98, -76, -128, -108, -70, -4, -73, -64,
+    -128, -114, -56, 25, -8, -58, -22, -114, 0, -49, -25, -100, -72, -128, -121, -42,
+    44, -89, 38, -75, -27, -79, -123, -1, 4, -83, -97, -83, -55, -128, -114, -128,
+    -87, -59, -109, -44, -70, -128, -66, -43, 66, -128, -60, 5, -128, -70, -128, -46,
+    -32, -98, -127, -3, -126, -27, 12, -128, -89, -68, -100, -128, -85, -120, -54, -86,
+    -56, -34, -98, -64, -79, 57, -128, -19, -24, -128, -2, -35, -128, -76, -69, -75,
+    -70, -41, -39, -52, -60, -13, -40, -128, 10, -85, -101, -112, -45, -21, -76, -63,
+    -128, -89, -79, 23, -53, -48, -104, -108, -48, -53, -87, -69, -33, -54, -128, -128,
+    41, -101, 127, -39, -24, -48, -117, -29, -43, -75, -87, -84, -17, -128, -128, -128,
+    -47, -51, -128, -56, -56, -128, -65, -52, 67, -128, -35, -2, -87, -16, -100, -27,
+    -67, -71, -121, -25, -122, 36, -89, -128, -128, -89, -92, -128, -82, -126, -62, -114,
+    -46, -20, -128, -69, -113, 54, -128, -5, -82, -108, -81, -128, -128, -52, -49, -35,
+    -51, -73, -13, -52, -116, -44, -18, -128, -79, -97, -53, -110, -62, -3, -62, -82,
+    -128, -117, -90, 23, -34, -60, -85, -120, -23, -52, -41, -66, -80, -128, -108, -90,
+    90, -96, 14, -40, 12, -31, -115, -4, -51, -96, -108, -95, -39, -128, -128, -128,
+    -77, -102, -122, -45, -62, -105, -124, 12, 99, -100, -72, 5, -128, -34, 0, -51,
+    -91, -58, -114, -67, -128, -88, -128, -128, -113, -70, -92, -128, -116, -125, -52, -107,
+    -55, -63, -63, -113, -101, 29, -128, 27, -127, -121, -128, -128, -117, -86, -13, -92,
+    -28, -54, -48, -69, -33, -38, -36, -128, -128, -78, -118, -107, -76, 21, -54, -90,
+    -128, -89, -46, 20, -8, -39, -20, -114, 10, -49, -1, -96, -92, -128, -108, -14,
+    61, -98, -25, -74, -3, -75, -121, 11, 11, -87, -85, -79, -51, -128, -128, -128,
+    -90, -53, -122, -43, -62, -128, -62, -21, 94, -91, -73, 6, -128, -104, -128, -50,
+    -86, -127, -106, -30, -128, -55, 31, -128, -62, -123, -107, -128, -111, -117, -63, -111,
+    -77, -47, -30, -71, -80, 58, -91, 6, -41, -128, -18, 19, -127, -92, -73, -95,
+    -43, -48, -36, -40, -44, -48, -34, -128, 21, -83, -119, -104, -63, -46, -88, -55,
+    -128, -107, -77, 31, -18, -44, -104, -115, -31, -52, -96, -99, -9, -61, -128, -128,
+    77, -96, 127, -58, -40, -59, -114, -26, -52, -69, -89, -86, -61, -125, -90, -128,
+    -79, -52, -87, -54, -72, -128, -23, -62, 100, -128, -70, -11, -67, -76, -128, -28,
+    -64, -63, -112, -29, -89, -37, -7, -128, -77, -91, -85, -128, -68, -121, -101, -94,
+    -60, -24, -128, -35, -107, 65, -115, 17, -69, -111, 25, -39, -128, -70, -115, -60,
+    -53, -45, -20, -23, -95, -88, -21, -128, -9, -107, -88, -111, -93, -24, -89, -70,
+    -128, -119, -102, 30, -15, -62, -94, -118, -33, -55, -65, -93, -22, -58, -121, -117,
+    45, -98, 127, -46, -4, -41, -128, -20, -99, -102, -106, -105, -65, -119, -114, -128,
+    -91, -79, -124, -52, -59, -128, -64, -20, 98, -128, -40, -9, -108, -77, -55, -22,
+    -76, -16, -123, -33, -128, 5, -128, -128, -110, -97, -100, -128, -89, -128, -69, -102,
+    -49, -27, -128, -65, -105, 46, -128, 3, -128, -127, -118, -128, -128, -51, -84, -49,
+    -43, -81, -16, -45, -96, -47, -18, -128, -128, -78, -112, -108, -91, -11, -66, -77,
+    -128, -126, -79, 19, -18, -56, 2, -121, -30, -55, 10, -74, -113, -128, -116, 6,
+    30, -102, -39, -53, 15, -40, -128, -4, -53, -109, -100, -95, -52, -128, -125, -128,
+    -105, -98, -128, -38, -53, -128, -128, 45, 104, -59, -85, 15, -128, -71, -107, -66,
+    -94, -100, -116, -63, -128, -80, -118, -128, -79, -114, -83, -128, -128, -101, -70, -88,
+    -39, -82, -37, -120, -84, 27, -128, 21, -112, -128, -128, -128, -44, -111, -6, -105,
+    -17, -36, -57, -76, 7, -16, -49, -128, -101, -63, -128, -117, -66, 11, -51, -96,
+    -128, -106, -30, 32, -5, -59, -25, -125, 18, -45, -31, -85, -71, -128, -126, -52,
+    64, -105, 27, -91, -55, -101, -105, 15, 25, -55, -76, -68, -61, -128, -128, -107,
+    -108, -67, -128, -52, -63, -128, -91, -6, 100, -128, -50, -2, -111, -102, -128, -29,
+    -103, -121, -120, -42, -128, 15, -49, -128, -111, -107, -87, -128, -124, -123, -76, -98,
+    -39, -33, -128, -77, -112, 57, -128, 17, -59, -128, -39, -71, -111, -60, -62, -66,
+    -58, -42, -28, -59, -83, -33, -30, -128, -23, -93, -128, -107, -94, 11, -64, -110,
+    -128, -113, -76, 28, -10, -52, -112, -121, -5, -56, -76, -71, -38, -116, -128, -128,
+    66, -106, 89, -78, -4, -34, -124, 6, -39, -72, -91, -92, -85, -128, -128, -128,
+    -98, -100, -113, -54, -64, -94, -82, 19, 112, -83, -60, 4, -105, -69, -24, -35,
+    -98, -58, -103, -62, -128, -70, -128, -128, -113, -101, -102, -128, -128, -127, -85, -118,
+    -59, -50, -85, -112, -123, 41, -108, 32, -123, -128, -121, -128, -77, -77, -33, -77,
+    -33, -53, -29, -67, -69, -39, -16, -128, -125, -93, -128, -99, -82, 0, -67, -73,
+    -128, -107, -66, 19, -4, -44, -34, -109, -1, -54, -9, -100, -87, -128, -123, -23,
+    40, -90, -14, -78, 17, -49, -128, 11, 0, -103, -102, -92, -63, -128, -102, -128,
+    -122, -76, -128, -36, -48, -128, -128, 27, 79, -58, -40, 20, -128, -108, -128, -53,
+    -88, -126, -113, -29, -128, -50, -79, -128, -117, -128, -101, -128, -128, -114, -60, -120,
+    -64, -66, 34, -92, -81, 38, -128, -13, -64, -128, -128, -128, -62, -93, -23, -109,
+    -39, -62, -42, -75, -36, 25, -38, -128, -62, -57, -128, -97, -43, -15, -50, -91,
+    -128, -95, -38, 20, -33, -40, -80, -107, -22, -50, -68, -66, -68, -128, -128, -120,
+    74, -94, 51, -74, -40, -59, -96, 7, 7, -51, -76, -63, -47, -128, -128, -128,
+    -95, -91, -72, -57, -73, -79, -76, -29, 99, -128, -73, -2, -127, -57, -55, -39,
+    -58, -63, -128, -51, -101, -49, -99, -128, -128, -16, -120, -128, -78, -107, -116, -50,
+    -12, -42, -128, -80, -125, 44, -125, 16, -52, -113, -47, -128, -122, -77, -45, -66,
+    -52, -11, -38, -65, -79, -40, -29, -128, -62, -107, -112, -128, -79, 36, -63, -63,
+    -128, -128, -80, 41, -30, -77, -87, -128, -7, -53, -26, -99, -46, -127, -127, -59,
+    14, -104, 54, -65, 0, -62, -128, 29, -3, -103, -105, -95, -36, -128, -128, -128,
+    -72, -63, -128, -33, -48, -128, -128, -21, 83, -128, -76, -1, -128, -58, -128, -67,
+    -71, -67, -115, -40, -128, -75, -95, -128, -78, -86, -68, -128, -88, -116, -31, -115,
+    -74, -73, -50, -63, -62, 32, -128, 4, -119, -128, -103, -128, -128, -105, -60, -99,
+    -13, -64, -49, -44, -11, -49, -50, -128, -94, -59, -86, -109, -77, 7, -51, -97,
+    -128, -95, -42, 25, -11, -46, -24, -123, -12, -43, -32, -78, -71, -128, -115, -57,
+    91, -104, 38, -57, -55, -99, -105, -12, -48, -60, -78, -70, -52, -128, -128, -119,
+    -128, -112, -128, -38, -51, -128, -128, 44, 84, -67, -44, 22, -128, -84, -128, -59,
+    -92, -117, -126, -37, -128, -42, -46, -128, -72, -106, -91, -128, -128, -118, -39, -107,
+    -36, -60, -31, -113, -83, 42, -128, -6, -104, -128, -108, -92, -36, -90, 1, -71,
+    -45, -66, -36, -87, -21, 45, -42, -128, -58, -47, -128, -104, -42, 11, -69, -96,
+    -128, -89, -41, 23, -31, -45, -52, -118, -7, -47, -74, -64, -76, -128, -120, -102,
+    30, -103, 69, -83, -27, -62, -127, -6, 45, -47, -77, -66, -39, -128, -128, -128,
+    -100, -103, -128, -40, -51, -128, -128, 46, 83, -17, -21, 25, -93, -48, -128, -20,
+    -118, -105, -128, -35, -128, -69, -86, -128, -100, -128, -49, -128, -128, -113, -116, -98,
+    -43, -38, 85, -118, -98, 45, -128, 8, -111, -128, -128, -128, -69, -60, -7, -114,
+    -59, -90, -26, -76, -61, 17, -27, -128, -91, -53, -128, -101, -46, -24, -58, -117,
+    -128, -94, -39, 19, -23, -51, -71, -109, -8, -57, -69, -53, -94, -128, -103, -104,
+    64, -106, 5, -76, -27, -24, -128, -7, 4, -52, -72, -67, -67, -128, -128, -128,
+    -96, -62, -128, -24, -28, -128, -128, 20, 55, -39, -11, 26, -128, -89, -128, -54,
+    -108, -128, -126, -8, -128, -51, -53, -128, -114, -128, -66, -128, -128, -114, -39, -128,
+    -78, -62, 127, -85, -54, 39, -128, -30, -71, -128, -128, -117, -128, -89, -25, -123,
+    -33, -106, -32, -68, -34, 38, -41, -128, -57, -28, -127, -92, -28, -38, -41, -104,
+    -128, -90, -25, 21, -36, -35, -90, -114, -38, -48, -96, -43, -83, -128, -115, -128,
+    118, -104, 39, -57, -77, -54, -95, -15, -19, -19, -63, -48, -52, -128, -128, -128,
+    -91, -67, -128, -23, -35, -128, -128, 10, 60, -63, -24, 20, -128, -70, -54, -54,
+    -59, -49, -128, -7, -128, -124, -128, -128, -99, -128, -42, -128, -128, -108, -63, -108,
+    -65, -64, 127, -72, -55, 29, -128, -25, -128, -128, -128, -128, -128, -98, -44, -118,
+    -31, -110, -35, -61, -28, 21, -39, -128, -128, -28, -127, -101, -26, -33, -38, -100,
+    -128, -86, -19, 18, -41, -51, -8, -113, -46, -46, -36, -43, -127, -128, -128, -41,
+    89, -106, -42, -46, -70, -70, -92, -18, -31, -46, -64, -49, -32, -128, -128, -128,
+    -111, -66, -128, -32, -45, -128, -128, -53, 46, -128, -8, 9, -128, -89, -128, -43,
+    -74, -107, -128, 16, -128, 22, -25, -128, -128, -128, -96, -128, -84, -122, -40, -115,
+    -60, -37, -19, 6, -54, 49, -128, -57, -69, -126, -91, -81, -128, -66, -98, -74,
+    -62, -99, -29, -32, -81, 15, -46, -124, -30, -36, -94, -98, -52, -36, -49, -118,
+    -128, -83, -58, 17, -61, -41, -116, -115, -71, -50, -85, -36, -57, -128, -80, -128,
+    38, -102, 80, -33, -45, -35, -128, -6, -85, -45, -65, -60, -28, -128, -128, -128,
+    -128, -76, -128, -22, -45, -128, -128, -31, 51, -128, -23, 7, -128, -122, -104, -65,
+    -30, -31, -128, 10, -128, -72, -113, -128, -106, -90, -108, -128, -72, -103, -57, -101,
+    -61, -69, 41, -4, -35, 28, -128, -65, -128, -128, -128, -128, -128, -98, -90, -96,
+    -38, -96, -44, -46, -31, 38, -54, -128, -124, -14, -128, -102, -40, -8, -41, -97,
+    -128, -77, -29, 13, -70, -52, -8, -107, -75, -44, -22, -47, -106, -128, -127, -38,
+    15, -94, 7, -37, -61, -79, -115, -3, -42, -56, -62, -47, 0, -128, -128, -128,
+    -87, -54, -128, -35, -48, -128, -123, -23, 50, -99, -37, 18, -128, -75, -128, -59,
+    -43, -128, -128, 10, -128, -42, 3, -128, -113, -121, -84, -128, -114, -123, -20, -106,
+    -66, -48, 14, -76, -66, 50, -128, -33, 0, -128, -65, -68, -128, -90, -46, -91,
+    -58, -61, -37, -65, -48, 26, -40, -128, 6, -66, -108, -105, -21, -32, -56, -65,
+    -128, -90, -56, 25, -57, -38, -121, -113, -57, -49, -106, -51, -51, -99, -128, -128,
+    73, -106, 118, -38, -53, -55, -100, -27, -27, -46, -78, -67, -13, -128, -128, -128,
+    -97, -74, -128, -38, -48, -128, -128, 15, 96, -84, -45, 8, -128, -100, -104, -50,
+    -111, -79, -124, -54, -128, -65, -117, -128, -99, -119, -99, -128, -128, -122, -31, -109,
+    -50, -55, 12, -89, -84, 36, -128, 6, -128, -128, -128, -128, -107, -80, -28, -86,
+    -29, -91, -33, -62, -38, -16, -36, -128, -126, -51, -128, -105, -66, -3, -62, -89,
+    -128, -105, -44, 29, -11, -42, -15, -128, -8, -48, -26, -88, -93, -128, -123, -50,
+    102, -108, -7, -76, -18, -64, -98, 3, -2, -69, -77, -72, -67, -128, -115, -128,
+    -94, -78, -127, -32, -52, -128, -110, -32, 64, -128, -54, 3, -128, -72, -128, -62,
+    -46, -81, -128, -14, -120, -79, -2, -128, -59, -22, -77, -128, -85, -120, -38, -101,
+    -66, -58, -16, -61, -59, 48, -128, -19, -70, -128, -28, -44, -128, -94, -57, -94,
+    -44, -62, -37, -59, -23, 8, -49, -128, -16, -54, -99, -109, -53, 25, -71, -76,
+    -128, -91, -53, 24, -42, -45, -67, -117, -37, -46, -86, -66, -54, -84, -127, -107,
+    42, -105, 127, -47, -45, -75, -119, -36, -20, -51, -83, -69, -20, -128, -128, -128,
+    -86, -57, -128, -40, -54, -128, -96, -21, 65, -94, -48, 13, -128, -73, -128, -47,
+    -38, -93, -128, 0, -128, -40, -19, -128, -92, -118, -87, -128, -112, -118, -43, -87,
+    -53, -39, -28, -79, -77, 51, -128, -22, -50, -128, -64, -85, -128, -82, -55, -80,
+    -59, -60, -32, -59, -54, 3, -35, -128, -27, -73, -114, -114, -29, -38, -69, -54,
+    -128, -109, -67, 28, -50, -52, -79, -120, -50, -51, -78, -61, -62, -119, -128, -125,
+    59, -108, 98, -41, -39, -54, -105, -29, -31, -67, -86, -77, -17, -128, -128, -128,
+    -94, -85, -128, -41, -48, -128, -128, 6, 97, -105, -40, 3, -128, -70, 30, -40,
+    -105, -32, -121, -62, -128, -79, -128, -128, -128, -117, -84, -128, -118, -119, -71, -108,
+    -46, -57, -11, -71, -98, 27, -128, 11, -128, -128, -128, -128, -118, -77, -36, -88,
+    -22, -93, -31, -57, -58, -30, -30, -128, -128, -55, -121, -104, -80, 16, -45, -111,
+    -128, -108, -40, 24, -8, -52, 7, -125, -1, -49, 16, -82, -120, -128, -108, 15,
+    84, -102, -89, -74, -5, -64, -110, 23, -16, -85, -82, -72, -66, -128, -128, -128,
+    -114, -44, -128, -17, -41, -128, -128, -55, 54, -128, -43, 9, -128, -128, -128, -81,
+    -64, -128, -128, 12, -128, -109, 11, -128, -107, -128, -82, -128, -72, -106, -38, -107,
+    -85, -77, 100, 8, -27, 40, -128, -44, 5, -128, -71, -45, -128, -122, -115, -128,
+    -34, -68, -55, -28, -20, -2, -61, -128, 24, -35, -100, -101, -55, -32, -38, -100,
+    -128, -74, -33, 31, -49, -39, -128, -118, -75, -42, -112, -62, -13, -100, -117, -128,
+    73, -105, 127, -35, -114, -88, -112, -6, -94, -18, -53, -46, -40, -128, -128, -128,
+    -109, -57, -92, -47, -65, -106, -72, -44, 91, -128, -58, -1, -123, -125, -128, -47,
+    -70, -106, -113, -20, -128, -52, -31, -128, -128, -96, -128, -128, -74, -116, -82, -95,
+    -65, -47, -66, -43, -96, 51, -117, -4, -2, -128, -37, -92, -128, -88, -99, -90,
+    -49, -29, -38, -41, -81, -42, -29, -128, -3, -97, -119, -106, -78, -26, -60, -56,
+    -128, -112, -79, 32, -32, -48, -128, -114, -49, -54, -68, -97, -16, -86, -128, -128,
+    41, -94, 116, -51, -30, -53, -123, 13, -64, -84, -93, -87, -49, -125, -107, -128,
+    -95, -85, -93, -49, -65, -98, -98, 2, 95, -127, -52, 2, -128, -83, -22, -43,
+    -73, -56, -128, -47, -128, -73, -126, -128, -125, -49, -108, -128, -110, -121, -64, -79,
+    -33, -44, -67, -108, -107, 40, -128, 14, -104, -128, -123, -128, -119, -72, -31, -73,
+    -49, -53, -35, -76, -64, -15, -28, -128, -114, -83, -128, -114, -69, 22, -58, -69,
+    -128, -104, -60, 28, -24, -52, -37, -120, -14, -52, -16, -91, -91, -128, -128, -21,
+    53, -106, -6, -67, 1, -55, -106, 9, 11, -92, -91, -85, -45, -128, -125, -128,
+    -108, -94, -128, -39, -60, -111, -128, 51, 108, -92, -74, 9, -128, -85, -55, -64,
+    -111, -103, -119, -78, -128, -87, -128, -128, -105, -77, -84, -128, -128, -99, -81, -81,
+    -21, -78, -48, -128, -95, 26, -128, 32, -113, -128, -128, -128, -52, -100, 10, -99,
+    -24, -38, -58, -90, -5, -12, -49, -128, -118, -65, -128, -116, -80, 52, -41, -123,
+    -128, -90, -24, 32, 0, -61, -31, -123, 34, -45, -25, -88, -78, -128, -128, -29,
+    91, -105, -7, -103, -42, -91, -85, 32, 44, -54, -71, -67, -82, -128, -128, -75,
+    -112, -88, -128, -47, -64, -128, -128, 44, 106, -50, -66, 19, -128, -73, -128, -44,
+    -113, -128, -128, -63, -128, -45, -23, -128, -72, -128, -50, -128, -128, -128, -27, -87,
+    -19, -43, -110, -123, -113, 52, -128, 37, -52, -128, -52, -37, -29, -76, 5, -74,
+    -67, -42, -42, -82, -32, -1, -42, -128, -7, -83, -128, -109, -62, 13, -73, -128,
+    -128, -84, -52, 32, -2, -38, -107, -128, 28, -51, -105, -71, -32, -109, -128, -128,
+    90, -121, 111, -104, 1, -42, -111, -1, 21, -49, -72, -81, -88, -128, -128, -78,
+    -90, -89, -122, -52, -60, -101, -80, 12, 110, -81, -74, 6, -120, -60, -97, -56,
+    -94, -84, -90, -59, -128, -71, -85, -128, -98, -118, -88, -128, -128, -122, -74, -128,
+    -64, -62, -128, -105, -119, 44, -105, 35, -85, -127, -81, -128, -83, -104, -36, -56,
+    -19, -43, -30, -61, -57, -49, -18, -128, -78, -99, -128, -97, -78, -6, -69, -80,
+    -128, -96, -68, 20, 1, -49, -62, -110, 3, -47, -37, -101, -60, -128, -122, -70,
+    52, -82, 35, -77, -6, -67, -128, 9, -13, -90, -105, -92, -67, -128, -114, -128,
+    -92, -66, -128, -39, -52, -128, -128, -30, 59, -112, -40, 12, -128, -56, -128, -49,
+    -49, -94, -127, -4, -128, -24, -64, -128, -128, -128, -81, -128, -100, -116, -59, -103,
+    -54, -48, -58, -51, -80, 43, -128, -26, -43, -128, -88, -128, -128, -84, -60, -79,
+    -53, -60, -38, -54, -66, 1, -39, -128, -48, -69, -104, -106, -44, -20, -46, -97,
+    -128, -89, -57, 20, -50, -50, -100, -111, -44, -50, -65, -50, -64, -128, -117, -128,
+    51, -99, 56, -43, -38, -54, -120, -1, -47, -62, -80, -70, -23, -128, -128, -128,
+    -61, -68, -52, -54, -77, -91, -55, -60, 89, -128, -79, -3, -110, -37, -89, -46,
+    -48, -56, -126, -36, -50, -75, -61, -128, -126, -47, -112, -128, -56, -91, -128, -43,
+    -15, -35, -124, -62, -109, 49, -100, 12, -38, -90, -34, -128, -128, -86, -70, -58,
+    -50, -22, -37, -44, -84, -73, -28, -128, -39, -108, -72, -128, -69, -2, -70, -53,
+    -128, -119, -88, 44, -36, -91, -97, -126, -25, -50, -36, -108, -30, -102, -118, -89,
+    36, -99, 79, -42, -32, -67, -124, 15, -47, -103, -101, -95, -35, -109, -128, -128,
+    -75, -64, -128, -42, -59, -128, -103, -13, 92, -86, -57, 4, -128, -63, -93, -48,
+    -84, -55, -116, -38, -128, -55, -109, -128, -99, -128, -83, -128, -108, -115, -60, -106,
+    -51, -46, -78, -67, -86, 40, -119, 8, -128, -128, -128, -128, -128, -84, -65, -62,
+    -33, -82, -33, -40, -58, -56, -31, -128, -120, -69, -106, -107, -69, -36, -62, -94,
+    -128, -91, -60, 23, -15, -55, -22, -119, -22, -47, -17, -84, -84, -128, -110, -52,
+    80, -99, -5, -56, -26, -62, -118, -2, -56, -84, -81, -80, -61, -128, -119, -128,
+    -128, -122, -128, -28, -57, -128, -128, 23, 59, -74, -27, 26, -128, -95, -128, -62,
+    -68, -102, -128, 1, -128, -38, -49, -128, -94, -128, -112, -128, -128, -105, -54, -80,
+    -30, -57, 23, -71, -48, 36, -128, -48, -99, -128, -128, -128, -51, -86, -37, -84,
+    -64, -77, -51, -73, -21, 68, -57, -122, -67, -19, -128, -108, -30, -21, -53, -102,
+    -128, -62, -29, 16, -67, -47, -56, -109, -53, -48, -64, -46, -82, -128, -99, -116,
+    -23, -103, 59, -57, -61, -60, -128, -1, 16, -38, -52, -49, -8, -128, -128, -128,
+    -108, -108, -128, -37, -51, -128, -128, 47, 101, -29, -36, 20, -116, -79, -128, -40,
+    -128, -109, -128, -53, -128, -82, -78, -128, -81, -128, -64, -128, -128, -122, -60, -103,
+    -41, -48, 51, -107, -88, 41, -128, 19, -128, -128, -128, -128, -56, -74, -19, -97,
+    -44, -95, -33, -66, -37, -3, -36, -128, -96, -43, -128, -101, -68, -19, -64, -121,
+    -128, -85, -35, 26, -3, -39, -49, -124, 0, -51, -59, -76, -81, -128, -90, -102,
+    68, -113, 14, -86, -29, -44, -128, 0, 1, -49, -63, -67, -86, -128, -99, -128,
+    -87, -103, -128, -32, -45, -128, -128, 24, 80, -22, -38, 25, -128, -62, -128, -60,
+    -128, -128, -128, -24, -128, -60, -9, -128, -100, -128, -77, -128, -128, -118, -38, -116,
+    -60, -55, 70, -100, -67, 44, -128, 1, -55, -103, -128, -85, -112, -91, -36, -94,
+    -37, -84, -39, -57, -35, -4, -39, -116, -27, -46, -128, -100, -57, -54, -56, -96,
+    -128, -79, -40, 28, -16, -35, -114, -124, -29, -47, -95, -73, -49, -128, -67, -128,
+    55, -109, 73, -61, -76, -57, -128, -6, -24, -29, -62, -62, -67, -128, -91, -128,
+    -111, -89, -128, -33, -39, -128, -128, 11, 84, -75, -29, 11, -128, -95, -58, -48,
+    -100, -65, -116, -25, -128, -68, -128, -128, -119, -128, -86, -128, -125, -114, -73, -126,
+    -74, -64, 54, -64, -74, 32, -128, -13, -128, -128, -128, -128, -106, -89, -64, -105,
+    -20, -92, -31, -52, -51, -5, -31, -128, -128, -43, -128, -95, -68, -29, -41, -94,
+    -128, -104, -36, 18, -22, -45, -32, -114, -38, -49, -22, -65, -105, -128, -104, -58,
+    47, -96, -34, -59, -50, -64, -128, 8, -38, -61, -77, -63, -54, -128, -122, -128,
+    -124, -83, -128, -45, -64, -115, -114, 0, 95, -92, -25, 5, -125, -128, -128, -38,
+    -128, -128, -128, -17, -128, 11, -58, -128, -128, -128, -116, -128, -121, -120, -67, -86,
+    -35, -31, -71, -65, -93, 51, -128, -2, -29, -128, -108, -128, -103, -58, -94, -70,
+    -66, -57, -38, -51, -97, -20, -32, -128, -32, -74, -128, -104, -99, -37, -39, -112,
+    -128, -86, -64, 28, -21, -42, -128, -119, -44, -56, -70, -72, -40, -128, -100, -128,
+    30, -110, 49, -65, -43, -26, -128, 31, -62, -56, -65, -78, -89, -128, -67, -128,
+    -110, -87, -128, -31, -51, -128, -128, -20, 59, -128, -35, 8, -128, -87, -45, -70,
+    -52, -64, -128, -5, -128, -48, -119, -128, -128, -91, -111, -128, -82, -116, -21, -98,
+    -49, -65, -33, -48, -57, 28, -128, -39, -95, -128, -128, -128, -128, -94, -62, -75,
+    -41, -74, -50, -60, -40, 21, -50, -128, -114, -41, -117, -106, -52, -3, -32, -94,
+    -128, -71, -36, 17, -55, -42, -44, -114, -55, -44, -22, -58, -97, -128, -113, -63,
+    24, -101, -9, -43, -50, -77, -127, 13, -23, -59, -65, -57, -11, -128, -128, -128,
+    -121, -90, -128, -31, -48, -120, -128, -5, 57, -109, -30, 19, -128, -99, -128, -65,
+    -49, -113, -128, 12, -128, -84, -17, -128, -116, -116, -85, -128, -116, -121, -42, -110,
+    -71, -63, 42, -72, -64, 43, -128, -33, -4, -128, -80, -128, -115, -102, -60, -102,
+    -52, -57, -41, -70, -42, 47, -40, -128, -13, -55, -128, -97, -35, -18, -45, -74,
+    -128, -76, -42, 18, -57, -34, -117, -104, -66, -48, -95, -51, -61, -107, -128, -128,
+    10, -100, 93, -43, -64, -60, -128, -13, -18, -41, -73, -59, -12, -128, -128, -128,
+    -101, -113, -128, -35, -44, -128, -128, 37, 93, -47, -49, 18, -128, -51, -93, -47,
+    -118, -78, -120, -56, -128, -77, -126, -128, -87, -128, -77, -128, -128, -112, -75, -109,
+    -53, -67, 50, -99, -81, 29, -128, 8, -128, -124, -128, -128, -72, -88, -12, -111,
+    -22, -85, -39, -65, -21, -6, -40, -128, -128, -40, -128, -105, -63, -6, -56, -105,
+    -128, -105, -29, 23, -10, -48, -14, -122, 2, -49, -24, -76, -99, -128, -84, -50,
+    54, -103, -19, -79, -37, -72, -128, 6, 10, -57, -73, -63, -58, -128, -128, -128,
+    -103, -93, -128, -31, -51, -128, -128, -53, 47, -128, -29, 8, -128, -55, -128, -57,
+    -60, -115, -128, -1, -128, -71, -16, -128, -128, -55, -69, -128, -73, -127, -38, -83,
+    -49, -53, 4, -27, -66, 44, -128, -31, 13, -118, -39, -100, -128, -82, -66, -107,
+    -67, -54, -48, -57, -55, 26, -56, -113, 11, -55, -86, -109, -61, 37, -36, -119,
+    -128, -73, -44, 27, -57, -35, -128, -120, -48, -49, -104, -47, -35, -80, -88, -128,
+    19, -116, 112, -41, -50, -55, -128, 2, -40, -34, -65, -58, -19, -128, -128, -128,
+    -119, -80, -128, -39, -50, -128, -121, -24, 61, -125, -28, 11, -128, -87, -128, -43,
+    -42, -88, -128, 10, -128, -32, -38, -128, -117, -120, -81, -128, -103, -123, -58, -99,
+    -59, -44, -35, -47, -79, 48, -128, -33, -41, -128, -63, -128, -127, -79, -77, -86,
+    -62, -60, -31, -58, -70, 25, -35, -128, -32, -64, -128, -103, -46, -18, -52, -84,
+    -128, -100, -59, 19, -55, -45, -102, -111, -61, -53, -78, -43, -67, -121, -126, -128,
+    8, -104, 78, -42, -35, -45, -128, -12, -44, -60, -82, -70, -16, -128, -128, -128,
+    -83, -82, -128, -43, -55, -128, -115, 13, 112, -77, -71, 1, -128, -66, -74, -41,
+    -106, -51, -106, -63, -128, -66, -128, -127, -81, -128, -79, -128, -124, -119, -68, -117,
+    -68, -58, -60, -89, -93, 34, -114, 28, -128, -128, -128, -128, -107, -85, -52, -93,
+    -17, -72, -37, -46, -38, -66, -31, -128, -128, -71, -126, -104, -90, -16, -63, -94,
+    -128, -109, -52, 21, 9, -47, 4, -119, 3, -51, -1, -92, -91, -128, -108, -16,
+    77, -99, -20, -75, -17, -73, -123, 0, -37, -86, -86, -83, -78, -128, -99, -128,
+    -127, -81, -128, -28, -52, -128, -128, -43, 72, -128, -41, 2, -128, -128, -128, -60,
+    -82, -118, -123, 2, -128, -81, -5, -128, -120, -124, -94, -128, -71, -120, -59, -111,
+    -90, -65, 31, -8, -53, 44, -128, -26, -1, -128, -45, -83, -128, -99, -124, -127,
+    -45, -52, -50, -31, -48, -12, -50, -128, 11, -54, -120, -95, -87, -21, -40, -99,
+    -128, -78, -47, 22, -37, -27, -128, -108, -69, -51, -93, -68, -18, -86, -97, -128,
+    8, -101, 127, -43, -76, -64, -128, 2, -89, -40, -64, -61, -48, -128, -122, -128,
+    -120, -61, -128, -46, -63, -128, -77, -54, 78, -128, -36, -4, -114, -117, -128, -29,
+    -61, -87, -128, -3, -128, 7, -30, -128, -124, -107, -110, -128, -72, -126, -69, -88,
+    -54, -27, -107, -13, -88, 56, -128, -25, -51, -128, -28, -81, -128, -59, -115, -75,
+    -71, -55, -29, -34, -97, -22, -34, -128, -18, -79, -115, -107, -79, -23, -62, -87,
+    -128, -110, -82, 25, -44, -47, -115, -116, -59, -57, -69, -63, -37, -100, -119, -128,
+    19, -105, 105, -45, -12, -31, -128, -2, -84, -80, -85, -85, -42, -128, -128, -128,
+    -126, -78, -128, -46, -65, -128, -102, -10, 87, -116, -22, 1, -105, -110, -80, -15,
+    -60, -31, -128, -12, -128, -16, -128, -128, -117, -128, -88, -128, -112, -125, -83, -74,
+    -32, -21, -90, -48, -97, 47, -128, -16, -128, -128, -123, -128, -98, -45, -90, -68,
+    -75, -82, -25, -51, -96, -5, -27, -128, -128, -64, -128, -108, -71, -22, -57, -103,
+    -128, -103, -66, 16, -40, -54, -25, -113, -48, -59, -16, -51, -107, -128, -128, -26,
+    17, -110, -20, -55, 9, -21, -128, -1, -54, -93, -78, -82, -46, -128, -128, -128,
+    -101, -88, -128, -32, -39, -128, -128, 33, 91, -71, -67, 9, -128, -73, -99, -65,
+    -84, -76, -107, -38, -128, -45, -128, -126, -79, -128, -67, -128, -128, -117, -29, -128,
+    -80, -83, -43, -96, -66, 26, -128, 2, -128, -128, -128, -128, -90, -108, -40, -103,
+    -4, -65, -48, -62, -2, -15, -45, -128, -128, -50, -128, -99, -72, -10, -41, -102,
+    -128, -101, -28, 14, -6, -40, 1, -116, -8, -45, -19, -60, -103, -128, -118, -34,
+    61, -98, -13, -72, -57, -99, -118, -5, -18, -53, -77, -65, -54, -128, -128, -128,
+    -96, -88, -128, -46, -46, -57, -128, 43, 79, -9, -50, 29, -128, -51, -128, -55,
+    -67, -128, -128, -8, -128, -30, -37, -128, -122, -128, -46, -128, -128, -128, -19, -108,
+    -48, -51, -77, -128, -107, 47, -128, 9, 14, -128, -85, -128, -66, -96, -15, -70,
+    -53, -34, -36, -89, -52, 25, -25, -128, -18, -93, -128, -104, -33, -42, -44, -80,
+    -128, -99, -52, 25, -26, -39, -128, -119, -24, -50, -98, -44, -67, -128, -128, -128,
+    43, -112, 60, -64, -45, -52, -128, -8, 1, -46, -85, -77, -40, -128, -128, -128,
+    -78, -94, -126, -51, -51, -91, -105, 3, 108, -106, -70, 0, -128, -49, -66, -55,
+    -109, -90, -103, -55, -128, -45, -104, -128, -123, -121, -73, -128, -114, -126, -57, -128,
+    -66, -62, -128, -100, -114, 40, -128, 37, -72, -111, -88, -128, -128, -97, -53, -65,
+    -12, -40, -33, -57, -62, -61, -22, -128, -84, -99, -117, -101, -103, 5, -48, -92,
+    -128, -109, -63, 25, 11, -46, -81, -122, 2, -47, -33, -90, -64, -128, -99, -81,
+    47, -96, 9, -71, -26, -74, -128, 17, -36, -77, -101, -90, -78, -128, -107, -128,
+    -123, -75, -128, -18, -36, -128, -128, 14, 38, -72, 7, 29, -128, -93, -128, -70,
+    -73, -98, -128, 9, -128, -58, -79, -128, -107, -128, -56, -128, -128, -101, -37, -104,
+    -21, -56, 77, -47, -40, 35, -128, -57, -128, -128, -128, -128, -107, -93, -29, -60,
+    -53, -128, -33, -71, -33, 80, -52, -128, -98, 4, -128, -100, -8, -18, -38, -128,
+    -128, -45, -13, 17, -66, -58, -44, -116, -52, -38, -78, -19, -114, -128, -115, -112,
+    79, -106, -5, -52, -77, -55, -100, -4, -9, -14, -43, -34, -29, -128, -128, -128,
+    -57, -77, -59, -55, -87, -94, -60, -36, 94, -128, -87, 0, -121, -21, -95, -44,
+    -60, -66, -126, -52, -78, -68, -71, -128, -114, -38, -112, -128, -79, -86, -128, -33,
+    1, -33, -128, -94, -113, 48, -87, 24, -56, -91, -45, -128, -128, -78, -38, -55,
+    -57, -18, -44, -57, -71, -71, -34, -128, -49, -107, -81, -128, -67, 10, -74, -67,
+    -128, -105, -83, 42, -31, -94, -82, -122, -2, -50, -32, -111, -34, -114, -118, -74,
+    48, -99, 74, -56, -24, -64, -116, 16, -16, -101, -95, -95, -44, -105, -128, -120,
+    -73, -84, -128, -35, -56, -128, -111, -12, 77, -128, -55, 2, -128, -44, -128, -55,
+    -83, -62, -123, -35, -128, -40, -67, -128, -60, -80, -76, -128, -103, -121, -31, -114,
+    -59, -51, -65, -76, -61, 42, -128, -4, -128, -120, -101, -103, -128, -79, -47, -71,
+    -34, -90, -36, -50, -27, -26, -47, -128, -98, -46, -92, -106, -69, 4, -70, -103,
+    -128, -78, -51, 16, -21, -44, -9, -117, -16, -46, -39, -70, -88, -128, -96, -56,
+    65, -103, 39, -55, -31, -71, -128, -28, -28, -63, -75, -72, -46, -128, -128, -128,
+    -127, -106, -128, -29, -35, -128, -128, 25, 67, -30, -21, 25, -128, -83, -83, -57,
+    -103, -113, -128, -7, -128, -10, -124, -128, -128, -128, -91, -128, -128, -112, -45, -119,
+    -57, -69, 36, -57, -59, 25, -128, -37, -101, -128, -128, -128, -70, -92, -52, -99,
+    -32, -87, -47, -57, -40, 30, -46, -121, -117, -26, -128, -97, -52, -49, -22, -123,
+    -128, -86, -21, 15, -40, -39, -70, -116, -44, -48, -39, -39, -96, -128, -74, -124,
+    21, -101, -29, -59, -73, -66, -128, 26, -31, -35, -55, -48, -39, -128, -128, -128,
+    -115, -103, -128, -30, -32, -128, -128, 26, 73, 3, -5, 29, -128, -52, -115, -26,
+    -128, -128, -128, -20, -128, -15, -121, -119, -128, -128, -34, -128, -128, -128, -49, -113,
+    -48, -46, 71, -41, -78, 31, -128, -16, -109, -123, -128, -128, -76, -62, -51, -117,
+    -53, -112, -39, -44, -66, 10, -43, -108, -110, -27, -128, -94, -64, -57, -21, -128,
+    -128, -86, -20, 19, -20, -29, -105, -126, -24, -55, -63, -25, -88, -128, -39, -128,
+    61, -121, -41, -70, -48, -29, -128, 25, -66, -26, -43, -50, -79, -128, -128, -128,
+    -109, -97, -128, -27, -40, -128, -128, 34, 77, 3, -41, 31, -128, -84, -128, -68,
+    -128, -128, -123, -22, -128, -62, -40, -128, -128, -128, -76, -128, -128, -120, -22, -127,
+    -73, -74, 92, -83, -60, 32, -128, -8, -16, -128, -128, -119, -71, -105, -37, -126,
+    -34, -70, -59, -56, -19, 7, -51, -128, -27, -42, -128, -92, -56, -61, -30, -124,
+    -128, -66, -20, 23, -18, -20, -128, -117, -28, -48, -96, -63, -38, -128, -71, -128,
+    69, -107, 64, -70, -89, -67, -128, 18, -32, -14, -46, -49, -70, -128, -113, -128,
+    -90, -65, -128, -17, -43, -128, -128, 6, 64, -25, -30, 20, -128, -76, -112, -54,
+    -88, -66, -128, -5, -128, -63, -128, -128, -93, -128, -49, -128, -128, -117, -2, -90,
+    -50, -52, 78, -38, -27, 24, -128, -34, -128, -128, -128, -128, -128, -80, -73, -105,
+    -47, -128, -54, -32, -14, -7, -61, -128, -128, -5, -118, -106, -43, -79, -34, -128,
+    -127, -58, -14, 17, -35, -36, 9, -126, -50, -46, -22, -38, -118, -128, -85, -73,
+    96, -125, -50, -46, -77, -67, -121, -13, -77, -36, -27, -43, -51, -128, -128, -128,
+    -125, -63, -128, -45, -53, -128, -128, -6, 85, -81, -26, 7, -128, -124, -128, -28,
+    -126, -128, -125, -17, -128, 76, -63, -128, -128, -128, -105, -128, -128, -119, -69, -107,
+    -47, -36, -95, -42, -93, 50, -128, -14, -21, -128, -96, -98, -101, -55, -85, -86,
+    -62, -51, -38, -46, -96, -18, -38, -128, -17, -75, -128, -101, -93, -36, -33, -128,
+    -128, -107, -63, 25, -23, -42, -128, -119, -29, -58, -85, -49, -28, -128, -95, -128,
+    64, -106, 70, -72, -37, -26, -128, 34, -75, -48, -69, -75, -89, -128, -128, -128,
+    -97, -74, -128, -26, -36, -128, -128, -7, 76, -107, -46, 8, -128, -85, -128, -67,
+    -87, -62, -109, -31, -128, -86, -104, -128, -82, -128, -81, -128, -107, -111, -45, -128,
+    -84, -78, 50, -48, -52, 30, -128, -17, -128, -128, -128, -128, -128, -109, -60, -103,
+    -6, -99, -37, -44, -17, -14, -44, -128, -121, -31, -113, -96, -61, -13, -51, -97,
+    -128, -93, -31, 19, -21, -44, -9, -117, -30, -42, -31, -72, -93, -128, -105, -57,
+    79, -93, 6, -57, -61, -90, -113, -8, -40, -52, -74, -57, -47, -128, -128, -128,
+    -104, -100, -128, -51, -54, -123, -128, -15, 84, -128, -30, 0, -94, -50, -128, -23,
+    -123, -128, -128, -49, -128, 3, -58, -128, -128, -64, -60, -128, -119, -128, -79, -102,
+    -39, -38, -101, -72, -123, 53, -128, 19, -6, -120, -29, -100, -128, -50, -35, -95,
+    -64, -37, -30, -73, -94, -6, -36, -128, -2, -91, -109, -104, -106, 73, -41, -128,
+    -128, -108, -61, 28, -12, -39, -128, -123, 12, -58, -100, -55, -32, -98, -87, -128,
+    51, -113, 80, -82, 4, -25, -128, 24, -19, -50, -88, -82, -82, -128, -128, -128,
+    -123, -45, -128, -34, -45, -128, -128, 0, 92, -81, -33, 4, -128, -128, -18, -39,
+    -98, -60, -122, -39, -128, -43, -128, -128, -128, -128, -91, -128, -121, -110, -66, -104,
+    -49, -60, 4, -25, -77, 25, -128, -15, -128, -128, -128, -128, -90, -80, -76, -103,
+    -30, -95, -42, -40, -57, -27, -41, -128, -128, -43, -128, -102, -75, -26, -29, -128,
+    -128, -105, -32, 23, -19, -52, -12, -123, -24, -50, 3, -63, -103, -128, -128, -32,
+    115, -105, -72, -74, -32, -62, -82, 34, -64, -69, -62, -61, -78, -128, -128, -105,
+    -115, -65, -128, -34, -54, -128, -128, -44, 67, -128, -42, 2, -128, -108, -128, -52,
+    -65, -121, -128, -5, -128, -48, 0, -128, -108, -89, -75, -128, -86, -126, -40, -94,
+    -61, -50, -38, -26, -68, 51, -128, -21, -9, -128, -19, -46, -128, -84, -92, -102,
+    -61, -51, -42, -46, -53, 0, -50, -128, 20, -64, -111, -105, -73, 9, -51, -109,
+    -128, -88, -56, 27, -40, -37, -128, -119, -47, -51, -106, -55, -24, -70, -121, -128,
+    46, -112, 127, -51, -48, -55, -128, -9, -64, -42, -71, -68, -46, -128, -128, -128,
+    -93, -78, -128, -49, -60, -128, -102, -63, 76, -128, -41, -10, -102, -55, -128, -23,
+    -63, -72, -128, -17, -89, -20, -62, -128, -128, -55, -67, -128, -59, -125, -105, -89,
+    -56, -34, -120, -25, -104, 53, -128, -2, -32, -114, -5, -128, -128, -58, -101, -93,
+    -61, -39, -29, -42, -102, -38, -33, -128, -25, -93, -80, -110, -101, 34, -47, -111,
+    -128, -115, -76, 24, -31, -53, -128, -116, -33, -58, -67, -56, -42, -93, -101, -118,
+    16, -106, 78, -46, -11, -37, -128, 4, -81, -77, -96, -87, -50, -128, -128, -128,
+    -105, -74, -128, -41, -46, -116, -128, -15, 97, -128, -40, -4, -128, -90, 63, -42,
+    -99, -38, -128, -61, -128, -74, -128, -128, -128, -105, -81, -128, -96, -128, -43, -105,
+    -45, -61, -53, -41, -101, 24, -128, 9, -128, -128, -128, -128, -128, -78, -57, -91,
+    -26, -80, -39, -52, -65, -35, -36, -128, -128, -62, -115, -104, -97, 37, -28, -128,
+    -128, -105, -37, 26, -7, -42, -22, -128, -4, -49, 15, -77, -107, -128, -113, 2,
+    90, -110, -91, -76, 1, -66, -107, 41, -38, -82, -77, -71, -72, -128, -128, -119,
+    -127, -62, -128, -29, -45, -128, -128, -35, 77, -128, -36, 7, -128, -128, -128, -53,
+    -108, -128, -123, -8, -128, -67, -1, -128, -123, -128, -71, -128, -102, -118, -66, -115,
+    -79, -62, 43, -4, -63, 48, -128, -17, 6, -128, -56, -50, -128, -96, -114, -127,
+    -44, -60, -44, -29, -55, -18, -48, -128, 28, -55, -124, -94, -86, -26, -39, -127,
+    -128, -88, -45, 29, -24, -34, -128, -118, -50, -51, -117, -61, -4, -95, -97, -128,
+    61, -106, 127, -57, -78, -55, -128, 11, -99, -27, -61, -60, -79, -128, -128, -128,
+    -124, -64, -128, -48, -71, -128, -76, -63, 96, -128, -43, -13, -87, -128, -128, -21,
+    -80, -73, -128, -15, -128, -12, -49, -128, -126, -123, -101, -128, -60, -122, -101, -77,
+    -49, -24, -128, 10, -95, 56, -128, -7, -64, -126, -19, -100, -128, -55, -128, -80,
+    -71, -51, -33, -17, -108, -61, -34, -128, -28, -85, -114, -108, -112, -20, -59, -111,
+    -128, -106, -85, 26, -27, -51, -118, -117, -53, -59, -55, -74, -24, -106, -105, -128,
+    11, -107, 93, -51, -11, -27, -128, 12, -120, -87, -80, -90, -72, -128, -124, -128,
+    -128, -82, -128, -46, -59, -128, -110, 10, 94, -123, -35, 2, -128, -128, -128, -38,
+    -73, -79, -117, -24, -128, 0, -101, -128, -112, -107, -109, -128, -124, -117, -81, -104,
+    -43, -47, -120, -61, -97, 46, -128, -13, -108, -128, -96, -128, -49, -73, -72, -65,
+    -52, -55, -29, -65, -72, 12, -31, -128, -84, -68, -128, -101, -77, 4, -55, -102,
+    -128, -106, -60, 17, -32, -53, -54, -109, -31, -53, -41, -59, -78, -128, -128, -63,
+    16, -95, 34, -75, -7, -44, -123, 13, -21, -77, -87, -79, -54, -128, -128, -128,
+    -110, -75, -128, -35, -39, -108, -128, 33, 102, -96, -57, 5, -128, -95, -14, -60,
+    -121, -98, -105, -68, -128, -78, -128, -123, -128, -128, -59, -128, -128, -105, -80, -124,
+    -58, -89, -11, -84, -91, 21, -128, 22, -114, -128, -128, -128, -81, -107, -27, -119,
+    -2, -56, -50, -69, -22, -26, -43, -128, -128, -59, -128, -100, -94, 37, -18, -128,
+    -128, -102, -16, 25, 9, -51, -46, -120, 22, -45, -20, -70, -87, -128, -126, -42,
+    115, -99, -50, -96, -54, -92, -87, 42, -14, -46, -73, -60, -97, -128, -128, -72,
+    -107, -76, -128, -47, -53, -116, -128, 45, 103, -14, -34, 22, -84, -78, -128, -22,
+    -128, -128, -128, -57, -128, -22, -69, -122, -128, -128, -41, -128, -128, -128, -68, -100,
+    -28, -35, -25, -108, -122, 50, -128, 34, -38, -128, -120, -109, -48, -58, -10, -99,
+    -65, -62, -34, -72, -73, -12, -31, -128, -30, -81, -128, -101, -75, -14, -47, -128,
+    -128, -96, -47, 31, 5, -38, -128, -126, 21, -57, -103, -58, -41, -128, -107, -128,
+    121, -120, 48, -102, -12, -17, -117, 23, -18, -41, -66, -76, -117, -128, -127, -107,
+    -62, -67, -128, -52, -67, -118, -80, -4, 112, -62, -73, 3, -95, -51, -118, -38,
+    -113, -90, -112, -58, -128, -56, -80, -128, -104, -128, -77, -128, -127, -119, -78, -99,
+    -46, -36, -110, -97, -113, 48, -79, 42, -93, -112, -94, -128, -128, -77, -55, -65,
+    -38, -57, -33, -43, -72, -88, -22, -128, -76, -100, -109, -110, -87, -38, -69, -91,
+    -128, -101, -75, 31, 8, -55, -71, -123, 1, -52, -38, -102, -50, -128, -106, -97,
+    93, -103, 31, -69, -15, -50, -127, 4, -56, -89, -89, -95, -91, -126, -76, -128,
+    -115, -99, -128, -42, -42, -104, -128, 9, 64, -99, -28, 18, -128, -56, -54, -56,
+    -58, -80, -114, -17, -128, -32, -117, -128, -128, -107, -92, -128, -126, -107, -87, -122,
+    -47, -66, -46, -81, -96, 35, -128, -24, -75, -128, -128, -128, -92, -97, -21, -67,
+    -31, -60, -29, -80, -63, 38, -28, -128, -97, -61, -128, -101, -38, 12, -41, -91,
+    -128, -102, -45, 16, -49, -61, -71, -107, -29, -46, -42, -50, -98, -128, -121, -72,
+    18, -84, -6, -59, -32, -63, -125, 18, 12, -64, -95, -66, -15, -128, -128, -128,
+    -69, -80, -89, -53, -70, -121, -55, -28, 89, -116, -71, 5, -125, -38, -126, -46,
+    -65, -74, -123, -40, -123, -38, -56, -128, -110, -63, -121, -128, -89, -101, -105, -66,
+    -21, -37, -116, -90, -107, 49, -85, 9, -70, -96, -60, -113, -128, -80, -40, -50,
+    -47, -37, -33, -57, -72, -47, -28, -128, -52, -96, -94, -127, -58, -9, -77, -49,
+    -128, -120, -84, 38, -33, -78, -74, -126, -17, -50, -39, -101, -48, -127, -114, -89,
+    39, -98, 71, -52, -21, -62, -126, 6, -13, -96, -101, -93, -32, -128, -128, -128,
+    -73, -37, -128, -16, -26, -128, -128, -85, 26, -128, -16, 1, -128, -55, -60, -71,
+    -49, -61, -128, 9, -128, -83, -126, -128, -128, -128, -49, -128, -40, -113, -31, -128,
+    -89, -78, 76, 34, -31, 24, -128, -57, -72, -128, -128, -128, -128, -107, -100, -118,
+    -18, -108, -46, -25, -47, -7, -58, -128, -100, -24, -31, -96, -55, 7, -6, -128,
+    -128, -68, -20, 17, -55, -41, -86, -115, -65, -40, -48, -32, -86, -128, -90, -110,
+    112, -99, -13, -19, -87, -87, -100, 8, -111, -30, -58, -39, -24, -128, -128, -128,
+    -111, -58, -128, -21, -33, -128, -128, -55, 62, -128, -41, -2, -128, -96, -128, -69,
+    -65, -59, -118, -6, -128, -56, -104, -128, -109, -128, -61, -128, -61, -116, -28, -128,
+    -87, -80, -25, 33, -37, 28, -128, -40, -122, -128, -126, -128, -128, -111, -122, -100,
+    -13, -94, -46, -15, -31, -26, -57, -128, -98, -26, -89, -94, -81, -12, -28, -128,
+    -128, -79, -30, 16, -32, -40, -49, -119, -54, -41, -38, -45, -72, -128, -87, -95,
+    60, -99, 21, -42, -75, -93, -128, 5, -114, -41, -61, -50, -46, -128, -128, -128,
+    -127, -59, -128, -26, -37, -128, -128, -54, 60, -128, -16, -4, -128, -113, -128, -58,
+    -80, -70, -123, -5, -128, -14, -100, -128, -125, -128, -63, -128, -71, -122, -33, -128,
+    -69, -63, -70, 40, -51, 36, -128, -43, -125, -128, -118, -128, -128, -89, -120, -73,
+    -31, -106, -34, -22, -62, -6, -52, -128, -89, -25, -100, -89, -88, 9, -29, -128,
+    -128, -70, -38, 12, -36, -41, -69, -116, -51, -43, -52, -34, -74, -128, -88, -107,
+    59, -98, 17, -49, -48, -63, -128, 13, -108, -41, -61, -53, -58, -128, -128, -128,
+    -119, -79, -128, -35, -38, -128, -128, -4, 58, -101, -1, 12, -128, -90, -128, -37,
+    -114, -128, -116, -12, -128, 40, -93, -121, -128, -128, -91, -128, -127, -126, -48, -128,
+    -76, -51, -4, -41, -72, 41, -128, -37, -87, -128, -128, -128, -128, -63, -55, -94,
+    -45, -97, -30, -56, -77, 26, -40, -128, -76, -39, -123, -83, -67, -9, -32, -128,
+    -128, -81, -41, 5, -38, -27, -106, -102, -35, -53, -69, -34, -81, -128, -85, -128,
+    67, -91, 14, -62, -28, -32, -128, 13, -44, -40, -69, -58, -56, -128, -128, -128,
+    -94, -89, -128, -16, -39, -128, -128, -8, 71, -91, -29, 11, -128, -75, -73, -75,
+    -128, -88, -128, -28, -128, -107, -128, -117, -128, -128, -52, -128, -111, -121, -9, -128,
+    -69, -77, 75, -21, -35, 20, -128, -15, -128, -122, -128, -128, -128, -103, -78, -106,
+    -19, -123, -57, -29, -18, -23, -60, -110, -128, -8, -103, -90, -83, -26, -18, -128,
+    -128, -31, -5, 15, -14, -23, -49, -120, -35, -39, -32, -60, -89, -128, -50, -106,
+    85, -109, -47, -56, -85, -81, -128, 19, -79, -23, -31, -39, -78, -128, -128, -128,
+    -128, -77, -128, -43, -45, -128, -128, -19, 73, -123, -2, 3, -104, -101, -128, -28,
+    -126, -128, -114, -14, -128, 74, -73, -115, -128, -128, -81, -128, -119, -126, -72, -128,
+    -59, -36, -121, -12, -91, 52, -128, -24, -81, -128, -99, -116, -126, -55, -92, -56,
+    -52, -90, -19, -39, -110, -4, -32, -128, -49, -55, -127, -84, -96, -11, -38, -128,
+    -128, -84, -61, 9, -26, -41, -128, -108, -33, -53, -78, -34, -58, -128, -73, -128,
+    45, -91, 34, -66, -17, -17, -128, 24, -85, -49, -76, -71, -84, -128, -128, -128,
+    -102, -52, -128, -10, -31, -128, -128, -10, 66, -115, -38, 8, -128, -102, -61, -76,
+    -82, -54, -128, -26, -128, -128, -128, -123, -98, -128, -31, -128, -110, -121, 5, -128,
+    -86, -91, 113, -13, -25, 14, -128, -24, -128, -128, -128, -128, -128, -116, -75, -128,
+    -12, -121, -60, -35, 12, -8, -66, -128, -128, -4, -110, -91, -63, -7, -17, -128,
+    -116, -48, 7, 14, -20, -23, 6, -118, -34, -39, -23, -48, -110, -128, -113, -39,
+    127, -111, -51, -58, -81, -100, -84, -1, -74, -26, -35, -34, -63, -128, -128, -105,
+    -127, -76, -128, -37, -53, -128, -128, -7, 68, -117, -30, 12, -128, -105, -128, -47,
+    -99, -128, -128, -17, -128, 19, -32, -128, -128, -128, -91, -128, -127, -123, -39, -103,
+    -43, -49, -60, -48, -76, 47, -128, -23, -18, -128, -74, -63, -105, -71, -53, -90,
+    -65, -55, -46, -61, -58, 22, -52, -128, 1, -57, -128, -102, -68, 5, -41, -128,
+    -128, -80, -47, 23, -39, -35, -128, -116, -26, -52, -104, -45, -31, -127, -104, -128,
+    58, -108, 106, -71, -38, -42, -128, 15, -32, -33, -62, -63, -59, -128, -128, -128,
+    -128, -62, -128, -31, -40, -128, -128, -34, 81, -128, -27, -9, -128, -128, 21, -54,
+    -60, -13, -119, -11, -128, -62, -128, -128, -128, -127, -92, -128, -62, -116, -57, -121,
+    -75, -71, -37, 7, -64, 25, -128, -31, -128, -128, -128, -128, -128, -94, -128, -92,
+    -17, -88, -37, -32, -64, -20, -38, -128, -128, -41, -126, -95, -94, -3, -19, -114,
+    -128, -99, -36, 14, -30, -47, -7, -114, -62, -47, 16, -56, -116, -128, -128, 3,
+    37, -96, -74, -48, -46, -78, -121, 25, -92, -74, -74, -61, -49, -128, -128, -128,
+    -74, -55, -128, -21, -43, -128, -128, 17, 78, -53, -60, 20, -128, -74, -128, -76,
+    -128, -128, -122, -45, -128, -110, -20, -128, -82, -128, -34, -128, -128, -118, -6, -125,
+    -72, -77, 92, -87, -50, 36, -128, 14, -37, -128, -125, -40, -128, -112, -22, -128,
+    -27, -79, -59, -55, 11, -21, -62, -128, -9, -42, -111, -97, -60, -16, -43, -128,
+    -128, -53, -16, 29, 0, -24, -115, -123, 3, -42, -117, -70, -28, -128, -102, -128,
+    127, -115, 102, -78, -90, -82, -88, -9, -35, -4, -43, -50, -97, -128, -117, -98,
+    -102, -59, -128, -46, -60, -128, -99, -59, 74, -128, -36, -10, -98, -81, -128, -20,
+    -54, -66, -126, -14, -111, -23, -60, -128, -120, -63, -71, -128, -68, -128, -91, -100,
+    -67, -32, -92, -20, -96, 55, -128, -11, -59, -128, -18, -110, -128, -56, -102, -98,
+    -64, -54, -26, -41, -95, -28, -33, -128, -34, -85, -92, -104, -87, 22, -56, -107,
+    -128, -110, -75, 19, -36, -47, -107, -109, -39, -58, -67, -54, -51, -108, -125, -104,
+    43, -103, 83, -47, -1, -31, -128, -10, -82, -80, -93, -85, -48, -128, -128, -128,
+    -122, -52, -128, -33, -56, -128, -128, -62, 71, -128, -25, -10, -128, -124, 19, -39,
+    -31, 20, -128, -7, -128, -60, -128, -128, -128, -111, -96, -128, -45, -128, -33, -90,
+    -55, -44, -67, 28, -63, 28, -128, -42, -128, -128, -128, -128, -128, -68, -128, -80,
+    -53, -105, -40, -22, -75, -23, -44, -128, -128, -40, -106, -103, -76, -12, -36, -118,
+    -128, -82, -47, 12, -50, -41, 19, -116, -70, -50, 29, -54, -123, -128, -128, 26,
+    44, -108, -73, -37, -3, -55, -113, 10, -100, -96, -64, -65, -27, -128, -128, -128,
+    -74, -38, -128, -21, -37, -128, -128, 35, 77, -14, -57, 23, -128, -99, -128, -74,
+    -122, -128, -118, -25, -128, -89, -25, -125, -82, -128, -36, -128, -128, -114, -8, -128,
+    -86, -76, 116, -112, -46, 38, -128, 7, -31, -128, -128, -62, -128, -113, -31, -128,
+    -22, -77, -55, -61, 9, -14, -53, -128, -16, -46, -128, -96, -49, -52, -37, -118,
+    -121, -70, -17, 27, -2, -27, -103, -119, -14, -44, -115, -59, -44, -128, -128, -128,
+    127, -113, 88, -71, -111, -83, -71, -21, -41, -3, -48, -51, -95, -128, -79, -96,
+    -78, -61, -120, -51, -68, -128, -69, -18, 105, -105, -68, 1, -80, -74, -128, -30,
+    -103, -107, -111, -52, -128, -62, -23, -128, -85, -111, -84, -128, -117, -122, -90, -99,
+    -59, -35, -64, -84, -109, 57, -110, 31, -59, -128, -32, -46, -128, -71, -57, -92,
+    -50, -48, -30, -46, -69, -66, -27, -128, -16, -99, -110, -107, -82, -14, -82, -81,
+    -128, -110, -80, 32, -3, -49, -103, -117, -4, -56, -76, -100, -24, -97, -122, -128,
+    91, -102, 113, -70, -7, -41, -116, -11, -47, -83, -94, -95, -82, -128, -97, -119,
+    -128, -53, -128, -38, -49, -124, -128, -37, 81, -128, -38, -3, -128, -128, -123, -51,
+    -42, -73, -127, 5, -128, -22, -100, -128, -128, -128, -84, -128, -79, -116, -64, -96,
+    -54, -58, -121, 4, -79, 41, -128, -30, -53, -128, -78, -128, -106, -94, -128, -78,
+    -46, -46, -39, -38, -75, -9, -39, -128, -60, -68, -128, -104, -84, -13, -28, -114,
+    -128, -107, -55, 23, -39, -55, -93, -118, -63, -50, -48, -44, -58, -128, -128, -99,
+    19, -104, 43, -52, -49, -64, -124, 22, -97, -64, -78, -70, -49, -128, -128, -128,
+    -128, -92, -128, -21, -32, -128, -128, -36, 55, -128, -5, 10, -128, -102, -91, -54,
+    -62, -40, -128, 1, -128, -87, -128, -128, -128, -128, -52, -128, -89, -116, -63, -109,
+    -54, -70, 41, 40, -52, 26, -128, -54, -128, -128, -128, -128, -115, -96, -104, -101,
+    -39, -110, -37, -33, -52, 34, -52, -117, -124, -8, -128, -94, -61, 6, -24, -128,
+    -128, -77, -18, 15, -54, -47, -53, -119, -63, -44, -38, -26, -99, -128, -83, -76,
+    9, -105, -22, -48, -54, -64, -128, 21, -78, -40, -54, -41, -29, -128, -128, -128,
+    -79, -102, -128, -41, -45, -128, -128, 16, 83, -19, -33, 26, -58, -9, -128, -25,
+    -121, -128, -128, -22, -128, -65, 10, -128, -73, -128, -1, -128, -128, -125, -95, -114,
+    -56, -32, 19, -90, -101, 58, -128, 21, -55, -98, -61, -71, -111, -73, -44, -92,
+    -55, -84, -17, -51, -70, -17, -23, -121, -6, -68, -128, -98, -57, -50, -69, -127,
+    -128, -95, -57, 24, -8, -48, -128, -120, -15, -54, -120, -46, -49, -110, -65, -128,
+    48, -112, 87, -62, -44, -24, -128, -26, -57, -39, -78, -76, -79, -128, -128, -128,
+    -86, -87, -128, -49, -62, -127, -99, -8, 102, -66, -67, 8, -116, -44, -128, -39,
+    -96, -82, -110, -43, -128, -45, -79, -128, -103, -128, -73, -128, -121, -119, -87, -108,
+    -52, -45, -118, -66, -105, 44, -99, 21, -95, -103, -84, -128, -104, -84, -67, -69,
+    -38, -55, -36, -38, -67, -64, -28, -128, -76, -87, -124, -105, -81, -39, -64, -105,
+    -128, -96, -68, 23, -7, -53, -75, -117, -12, -51, -39, -84, -52, -128, -87, -104,
+    41, -96, 37, -65, -19, -54, -128, 9, -62, -83, -86, -87, -69, -128, -128, -128,
+    -121, -86, -128, -39, -35, -128, -128, 2, 69, -106, -27, 12, -128, -80, -128, -61,
+    -94, -117, -92, -17, -128, 4, -96, -128, -128, -128, -87, -128, -122, -99, -105, -128,
+    -72, -76, -61, -51, -87, 38, -128, -22, -56, -128, -123, -128, -104, -107, -55, -71,
+    -10, -61, -27, -61, -68, 12, -29, -128, -64, -58, -128, -89, -68, 2, -31, -121,
+    -128, -99, -44, 13, -31, -60, -110, -103, -26, -44, -64, -47, -69, -128, -100, -128,
+    35, -72, 22, -64, -62, -68, -128, 29, -35, -45, -93, -63, -52, -128, -128, -128,
+    -63, -85, -58, -49, -80, -114, -70, -36, 92, -128, -86, -3, -128, -30, -58, -50,
+    -49, -34, -128, -39, -67, -68, -100, -128, -103, -45, -113, -128, -63, -91, -121, -41,
+    -16, -42, -128, -80, -91, 40, -99, 10, -103, -90, -76, -128, -128, -83, -62, -61,
+    -46, -32, -48, -48, -54, -68, -39, -128, -95, -89, -83, -128, -73, -4, -67, -62,
+    -128, -103, -73, 35, -33, -85, -34, -123, -20, -49, -3, -102, -62, -128, -110, -30,
+    20, -101, 34, -45, -38, -80, -128, 8, -32, -100, -88, -89, -31, -114, -128, -128,
+    -48, -41, -111, -47, -74, -100, -101, -101, 62, -128, -50, -13, -119, -19, 6, -27,
+    -31, -20, -128, -9, -36, -25, -128, -128, -128, -104, -82, -128, -19, -114, -98, -66,
+    -41, -22, -128, 3, -89, 40, -128, -17, -75, -99, -87, -128, -128, -55, -119, -70,
+    -67, -61, -44, -16, -112, -86, -39, -128, -108, -92, -25, -120, -83, -18, -35, -115,
+    -128, -81, -78, 20, -48, -63, -83, -112, -51, -54, -3, -65, -68, -128, -96, -62,
+    63, -103, -14, -18, -15, -43, -128, 15, -128, -104, -77, -85, -33, -128, -128, -128,
+    -81, -20, -103, -33, -66, -78, -128, -105, 66, -128, -63, -15, -128, -87, 99, -57,
+    -7, 7, -128, -3, -44, -97, -128, -128, -128, -128, -87, -128, 2, -100, -89, -65,
+    -52, -60, -101, 50, -61, 20, -128, -32, -87, -128, -128, -128, -128, -100, -128, -95,
+    -39, -57, -65, -2, -74, -88, -52, -128, -128, -72, -51, -117, -84, -26, -8, -123,
+    -91, -72, -49, 22, -50, -65, -45, -112, -70, -46, 31, -69, -74, -128, -128, -17,
+    73, -99, -54, -19, -58, -88, -96, 39, -128, -95, -61, -66, -32, -128, -128, -99,
+    -88, -59, -101, -36, -67, -64, -128, -86, 60, -128, -58, -4, -128, -68, -19, -62,
+    -26, -60, -128, 6, -63, -86, -101, -128, -128, -106, -88, -128, -22, -100, -99, -60,
+    -45, -57, -84, 10, -69, 33, -128, -27, 10, -119, -71, -128, -128, -100, -128, -95,
+    -53, -29, -63, -24, -74, -50, -51, -128, -48, -80, -68, -119, -79, -13, -16, -109,
+    -128, -71, -54, 28, -56, -62, -128, -112, -69, -48, -36, -66, -35, -128, -106, -121,
+    17, -102, 43, -22, -75, -77, -128, 33, -115, -69, -66, -67, -24, -128, -128, -128,
+    -75, -53, -113, -38, -57, -125, -128, -80, 67, -128, -36, -17, -128, -72, 17, -38,
+    -56, -19, -128, -13, -40, -49, -128, -128, -128, -66, -92, -128, -21, -111, -90, -86,
+    -61, -45, -57, 0, -73, 34, -128, -22, -103, -124, -126, -128, -128, -67, -123, -97,
+    -40, -72, -41, -26, -91, -60, -41, -128, -128, -67, -47, -112, -100, 13, -24, -108,
+    -128, -97, -57, 21, -38, -56, -59, -116, -53, -52, 3, -66, -87, -128, -104, -34,
+    57, -102, -36, -28, -38, -62, -126, 19, -107, -85, -78, -73, -44, -128, -128, -128,
+    -88, -42, -128, -18, -55, -124, -128, -67, 52, -128, -43, -15, -128, -99, -22, -70,
+    -51, -48, -120, 7, -66, -86, -128, -128, -128, -99, -65, -117, -24, -61, -128, -79,
+    -60, -81, 9, 12, -29, 23, -128, -37, -64, -128, -128, -128, -128, -109, -128, -127,
+    -19, -57, -64, -26, -44, -47, -64, -128, -104, -38, -56, -114, -101, 19, 10, -128,
+    -40, -60, -20, 18, -45, -85, -78, -99, -59, -42, -21, -44, -70, -128, -117, -62,
+    66, -89, -16, -29, -128, -104, -105, 32, -127, -34, -51, -44, -60, -128, -128, -128,
+    -116, -70, -128, -27, -56, -128, -128, -55, 61, -128, -33, -17, -128, -106, -128, -61,
+    -76, -56, -95, 5, -110, 2, -98, -128, -112, -85, -88, -128, -37, -49, -128, -110,
+    -56, -71, -90, 19, -39, 40, -128, -41, -111, -127, -83, -128, -128, -99, -128, -76,
+    -12, -65, -37, -23, -65, -39, -51, -128, -68, -33, -81, -107, -115, 23, -24, -128,
+    -90, -75, -45, 10, -42, -105, -75, -91, -52, -42, -42, -43, -58, -128, -89, -84,
+    2, -65, 43, -39, -127, -87, -128, 23, -117, -39, -74, -56, -69, -128, -128, -128,
+    -110, -80, -128, -18, -27, -128, -128, -88, 55, -128, -24, -6, -128, -74, -65, -64,
+    -104, -77, -110, 8, -128, -71, -128, -128, -128, -128, -46, -128, -21, -77, -128, -127,
+    -89, -92, 43, 88, -41, 22, -128, -42, -34, -85, -128, -128, -128, -122, -128, -128,
+    5, -72, -50, 9, -74, -60, -54, -63, -68, -30, -54, -96, -127, -8, 19, -128,
+    -76, -87, -21, 21, -29, -71, -128, -113, -68, -42, -47, -38, -35, -128, -20, -128,
+    7, -84, -1, -28, -128, -97, -128, 61, -128, -18, -58, -40, -74, -128, -128, -128,
+    -91, -53, -128, -36, -20, -128, -128, -65, 49, -128, 13, 0, -70, -57, -128, -43,
+    -113, -119, -114, -5, -128, 4, -85, -128, -128, -128, -27, -128, -87, -128, -68, -128,
+    -81, -53, -45, 20, -93, 47, -128, -24, -21, -128, -101, -128, -128, -81, -100, -69,
+    -24, -101, -8, -33, -124, -11, -25, -128, -36, -60, -63, -79, -92, 23, -12, -128,
+    -128, -92, -52, 17, -24, -44, -128, -117, -39, -45, -98, -23, -59, -128, -67, -128,
+    95, -91, 8, -45, -44, -34, -128, 28, -119, -31, -87, -62, -80, -128, -128, -128,
+    -69, -11, -128, -38, -52, -128, -128, -118, 71, -128, -31, -31, -89, -71, -9, -14,
+    -40, 39, -121, -11, -43, -37, -128, -125, -128, -128, -37, -128, -5, -128, -84, -117,
+    -85, -32, -125, 72, -75, 38, -128, -20, -128, -128, -113, -128, -128, -55, -128, -89,
+    -38, -110, -24, 14, -115, -107, -34, -128, -128, -66, -24, -98, -117, -5, -31, -128,
+    -128, -98, -68, 9, -22, -53, -11, -113, -56, -54, 21, -45, -105, -128, -107, 13,
+    102, -102, -70, -22, -3, -45, -115, -1, -128, -103, -81, -80, -68, -128, -128, -101,
+    -76, -10, -128, -20, -36, -128, -128, -104, 36, -128, -24, -10, -128, -82, -64, -55,
+    -36, -51, -128, 17, -121, -47, -128, -128, -128, -128, -40, -128, -24, -128, 17, -125,
+    -94, -59, -16, 61, -33, 27, -128, -54, -78, -128, -128, -128, -128, -85, -128, -115,
+    -41, -105, -52, -5, -63, -40, -61, -128, -105, -39, -29, -94, -77, -16, -3, -128,
+    -126, -61, -32, 12, -47, -21, -81, -117, -75, -46, -37, -24, -81, -128, -103, -105,
+    125, -114, -15, -16, -59, -70, -99, 1, -128, -45, -48, -49, -39, -128, -128, -128,
+    -72, -45, -128, -37, -43, -128, -96, -64, 49, -128, -11, -3, -93, -60, -128, -17,
+    -79, -101, -124, 10, -128, 31, 8, -128, -98, -128, -59, -128, -82, -128, -51, -128,
+    -99, -22, -10, -18, -65, 64, -128, -34, -74, -127, -30, -20, -128, -44, -102, -100,
+    -60, -102, -12, -28, -95, -19, -34, -128, -6, -58, -56, -91, -70, -24, -65, -107,
+    -128, -104, -76, 11, -39, -31, -118, -108, -57, -58, -106, -34, -56, -107, -91, -128,
+    83, -102, 113, -29, -24, -17, -128, -47, -107, -53, -85, -77, -49, -128, -128, -128,
+    -109, -70, -128, -41, -48, -128, -101, -20, 92, -128, -23, -15, -111, -120, -7, -35,
+    -90, -8, -91, -35, -128, -49, -128, -107, -123, -84, -98, -128, -78, -127, -81, -128,
+    -101, -57, -53, -40, -89, 38, -128, -4, -128, -128, -128, -128, -128, -73, -100, -82,
+    -13, -101, -16, -42, -86, -38, -18, -128, -128, -60, -119, -79, -105, 12, -47, -99,
+    -128, -96, -57, 0, -11, -37, 7, -94, -37, -51, 14, -75, -125, -128, -128, 27,
+    55, -76, -71, -57, 2, -50, -122, 2, -67, -97, -99, -79, -67, -128, -107, -128,
+    -72, -67, -128, -16, -32, -128, -128, -36, 63, -128, -55, -5, -128, -54, -128, -76,
+    -88, -67, -96, -23, -128, -98, -77, -96, -64, -115, -30, -128, -73, -128, -3, -128,
+    -128, -93, 30, -19, -25, 29, -128, -13, -128, -128, -109, -120, -128, -117, -95, -128,
+    7, -104, -49, -23, 5, -43, -59, -128, -93, -26, -65, -77, -93, 8, -36, -128,
+    -111, -50, -20, 0, -6, -12, -31, -101, -30, -40, -53, -54, -79, -128, -78, -84,
+    95, -90, 38, -45, -78, -102, -128, -33, -98, -29, -63, -50, -62, -128, -128, -128,
+    -106, -32, -128, -22, -43, -128, -128, -89, 63, -128, -30, -22, -128, -128, -128, -53,
+    -96, -87, -101, -11, -89, -56, 2, -128, -68, -52, -71, -128, -34, -103, -101, -128,
+    -108, -64, 25, 47, -33, 55, -128, -31, -94, -128, -16, 20, -128, -90, -128, -120,
+    -20, -97, -27, -6, -52, -47, -54, -128, 5, -31, -55, -88, -113, 32, -56, -128,
+    -128, -83, -54, 17, -23, -48, -103, -105, -50, -46, -102, -62, -20, -90, -101, -128,
+    94, -86, 127, -43, -77, -67, -120, -23, -128, -33, -74, -60, -85, -128, -128, -128,
+    -91, -48, -126, -41, -52, -121, -116, -50, 91, -128, -49, -12, -128, -117, -122, -52,
+    -106, -100, -103, -23, -126, -30, -85, -128, -128, -128, -97, -128, -61, -99, -116, -117,
+    -72, -58, -76, -22, -85, 45, -128, 3, -34, -128, -81, -128, -128, -93, -128, -87,
+    -18, -47, -35, -26, -88, -77, -31, -128, -42, -84, -85, -103, -118, -12, -31, -105,
+    -128, -109, -66, 29, -8, -63, -128, -116, -39, -49, -51, -83, -31, -128, -108, -128,
+    69, -90, 48, -50, -74, -68, -128, 29, -113, -64, -88, -80, -92, -128, -90, -128,
+    -87, -54, -128, -33, -29, -100, -128, -60, 40, -128, -14, -5, -128, -74, -46, -61,
+    -69, -113, -128, 5, -119, 12, -125, -128, -128, -74, -80, -128, -50, -112, -55, -126,
+    -72, -70, -31, -20, -68, 33, -128, -41, 9, -128, -120, -128, -128, -89, -85, -101,
+    -24, -53, -40, -57, -82, 6, -45, -128, -54, -63, -54, -103, -85, 45, 8, -125,
+    -128, -106, -39, 23, -45, -49, -128, -119, -48, -47, -64, -30, -69, -128, -106, -128,
+    74, -100, 4, -36, -80, -75, -116, 34, -72, -32, -81, -56, -39, -128, -128, -128,
+    -91, -52, -128, -41, -55, -128, -87, -69, 73, -128, -50, -9, -128, -78, -128, -33,
+    -42, -55, -116, 3, -109, -15, -47, -128, -103, -118, -71, -128, -53, -123, -77, -113,
+    -86, -40, -111, -3, -76, 52, -128, -20, -70, -128, -20, -107, -128, -75, -128, -89,
+    -47, -58, -30, -19, -83, -54, -34, -128, -40, -80, -82, -102, -86, -28, -56, -91,
+    -128, -110, -77, 16, -34, -48, -89, -110, -60, -55, -56, -54, -50, -120, -113, -111,
+    29, -97, 85, -31, -33, -52, -128, -19, -123, -79, -91, -84, -41, -128, -128, -128,
+    -96, -48, -128, -31, -37, -128, -122, -80, 66, -128, -45, -9, -128, -85, -128, -46,
+    -44, -33, -95, 9, -113, -55, -75, -128, -103, -128, -64, -128, -36, -108, -108, -128,
+    -120, -68, -22, 37, -57, 41, -128, -35, -94, -128, -62, -128, -128, -105, -128, -114,
+    -9, -76, -27, -1, -70, -61, -33, -128, -70, -58, -72, -91, -88, -39, -43, -94,
+    -128, -116, -61, 12, -32, -54, -70, -104, -74, -49, -41, -53, -60, -128, -98, -97,
+    30, -80, 55, -22, -71, -78, -128, -13, -128, -69, -94, -70, -39, -128, -128, -128,
+    -93, -43, -128, -40, -29, -128, -128, -85, 39, -128, -2, -5, -128, -71, -128, -44,
+    -64, -87, -101, 23, -128, 76, -88, -128, -128, -128, -94, -128, -41, -106, -100, -128,
+    -87, -51, -104, 31, -75, 47, -128, -59, -41, -120, -91, -128, -128, -82, -128, -54,
+    -20, -82, -11, -23, -127, -18, -25, -128, -52, -63, -51, -90, -78, -17, -21, -118,
+    -128, -116, -72, 11, -54, -64, -128, -106, -73, -47, -61, -27, -66, -128, -82, -128,
+    45, -73, 22, -20, -59, -49, -128, 21, -128, -58, -101, -69, -34, -128, -128, -128,
+    -72, -88, -107, -33, -61, -108, -128, -63, 34, -128, -40, 8, -128, -2, -46, -50,
+    13, -9, -128, 37, -66, -60, -94, -128, -128, -96, -74, -98, -42, -63, -128, -36,
+    -23, -45, -25, -29, -55, 37, -128, -55, -65, -95, -93, -128, -128, -91, -99, -79,
+    -54, -52, -41, -44, -72, -3, -42, -105, -87, -54, -65, -128, -31, -27, -34, -75,
+    -128, -96, -55, 22, -89, -109, -63, -105, -83, -48, -26, -34, -93, -128, -100, -57,
+    -42, -93, 15, 0, -106, -77, -128, -4, -74, -68, -80, -62, 26, -128, -128, -128,
+    -102, -46, -128, -37, -36, -128, -101, -102, 34, -128, 6, -12, -101, -68, -128, -13,
+    -35, -37, -122, 32, -120, 77, -51, -128, -119, -99, -73, -128, -31, -113, -112, -128,
+    -83, -25, -83, 57, -62, 58, -128, -72, -120, -124, -35, -88, -128, -46, -128, -73,
+    -52, -106, -1, -13, -124, -7, -32, -128, -53, -44, -47, -97, -73, -5, -53, -119,
+    -128, -128, -81, 8, -67, -65, -88, -107, -81, -56, -67, -10, -80, -128, -87, -117,
+    21, -88, 66, -14, -27, -26, -128, -25, -128, -68, -98, -73, -18, -128, -128, -128,
+    -101, -49, -128, -51, -61, -128, -106, -86, 75, -128, -18, -28, -83, -88, -128, -8,
+    -87, -65, -123, -17, -83, 76, -110, -128, -128, -59, -80, -128, -33, -100, -128, -89,
+    -34, -20, -128, 23, -104, 58, -128, -15, -78, -124, -26, -128, -128, -35, -128, -61,
+    -58, -55, -16, -25, -128, -62, -32, -128, -50, -85, -56, -112, -128, 54, -33, -128,
+    -128, -122, -86, 23, -29, -84, -128, -115, -28, -58, -50, -42, -46, -128, -95, -104,
+    44, -96, 39, -50, -18, -24, -128, 31, -128, -77, -95, -89, -88, -128, -128, -128,
+    -88, -35, -128, -55, -59, -128, -71, -96, 78, -128, -25, -21, -55, -75, -128, 3,
+    -66, -48, -126, -9, -108, 75, -97, -128, -128, -125, -78, -128, -38, -128, -106, -99,
+    -54, -6, -128, 31, -111, 60, -128, -16, -92, -118, -27, -128, -128, -29, -128, -57,
+    -67, -68, -11, -9, -128, -79, -22, -128, -64, -97, -55, -107, -114, -9, -50, -127,
+    -128, -128, -101, 21, -29, -62, -113, -121, -47, -62, -39, -46, -53, -128, -96, -107,
+    52, -104, 35, -37, 17, -10, -128, 10, -128, -101, -100, -99, -68, -128, -128, -128,
+    -116, -32, -128, -48, -68, -128, -70, -94, 79, -128, -32, -28, -108, -124, -128, -7,
+    -36, -2, -120, 3, -74, 59, -128, -128, -128, -90, -104, -128, -17, -99, -128, -79,
+    -46, -18, -128, 50, -86, 53, -128, -36, -128, -128, -47, -128, -128, -42, -128, -59,
+    -61, -67, -20, -5, -128, -72, -31, -128, -104, -76, -78, -114, -114, -8, -50, -119,
+    -128, -127, -93, 16, -45, -84, -47, -109, -65, -59, -4, -47, -71, -128, -125, -33,
+    20, -92, 20, -33, -10, -32, -128, 10, -128, -107, -94, -91, -56, -128, -128, -128,
+    -110, -29, -128, -41, -48, -128, -128, -122, 54, -128, -1, -33, -110, -107, -128, -7,
+    -77, -63, -127, 8, -72, 89, -128, -128, -128, -89, -73, -128, 3, -100, -128, -100,
+    -58, -30, -128, 88, -79, 50, -128, -46, -60, -128, -47, -128, -128, -37, -128, -94,
+    -53, -66, -23, -3, -128, -60, -43, -128, -54, -67, -29, -106, -128, 46, -4, -128,
+    -128, -123, -73, 19, -41, -75, -128, -113, -57, -59, -50, -18, -45, -128, -82, -128,
+    51, -97, 24, -33, -44, -29, -128, 41, -128, -61, -83, -74, -82, -128, -128, -128,
+    -103, -67, -128, -48, -68, -128, -86, -93, 59, -128, -15, -18, -75, -48, -128, -3,
+    -62, -39, -108, 1, -126, 74, -89, -121, -128, -115, -75, -128, -34, -121, -128, -128,
+    -71, -16, -128, 50, -89, 56, -128, -35, -116, -95, -20, -128, -128, -32, -128, -59,
+    -71, -83, -19, -6, -128, -54, -34, -107, -69, -71, -62, -90, -111, 2, -49, -128,
+    -128, -74, -87, -7, -48, -53, -105, -86, -51, -60, -41, -29, -60, -128, -63, -105,
+    3, -78, 41, -33, 15, -5, -128, 4, -128, -91, -86, -85, -53, -128, -128, -128,
+    -101, -73, -128, -47, -74, -128, -118, -80, 29, -128, 20, -7, -72, -23, -128, 13,
+    -77, -98, -122, 12, -128, 127, -76, -106, -128, -118, -82, -128, -63, -128, -122, -128,
+    -62, 2, -128, 26, -87, 60, -128, -56, -68, -100, -42, -119, -128, 5, -100, -73,
+    -112, -95, -26, -31, -128, 2, -44, -103, -41, -61, -57, -83, -87, 15, -37, -128,
+    -128, -35, -77, -20, -74, -31, -128, -68, -47, -67, -77, 0, -62, -128, -49, -128,
+    25, -79, 48, -36, 37, 37, -128, 6, -114, -70, -66, -73, -43, -128, -128, -128,
+    -128, -71, -128, -39, -65, -128, -128, -94, 34, -128, 64, -19, -45, -107, -128, 46,
+    -97, -56, -128, 14, -128, 127, -128, -90, -128, -128, -79, -128, -45, -128, -128, -112,
+    -51, 6, -103, 122, -80, 49, -128, -84, -128, -128, -114, -128, -128, 37, -128, -116,
+    -126, -127, -24, -9, -128, 19, -53, -102, -117, -24, -85, -79, -125, 42, -7, -128,
+    -128, -54, -56, -21, -79, -30, -128, -74, -62, -75, -41, 28, -89, -128, -41, -119,
+    10, -93, -37, -49, 53, 60, -128, 43, -128, -66, -44, -57, -69, -128, -128, -128,
+    -127, -33, -128, -25, -21, -128, -128, -91, 32, -128, 3, -8, -128, -103, -128, -33,
+    -44, -61, -122, 22, -128, 33, -105, -128, -128, -126, -54, -128, -41, -113, -83, -128,
+    -91, -60, -17, 82, -47, 40, -128, -76, -99, -128, -91, -128, -128, -75, -128, -114,
+    -33, -101, -23, -16, -87, 9, -50, -128, -69, -26, -64, -91, -77, 20, -18, -128,
+    -128, -118, -44, 11, -59, -53, -98, -112, -69, -51, -67, 0, -76, -128, -98, -123,
+    65, -94, 37, -31, -54, -55, -120, 5, -128, -39, -77, -50, -33, -128, -128, -128,
+    -128, -48, -128, -35, -55, -128, -128, -90, 56, -128, -8, -24, -126, -121, -128, -2,
+    -54, -26, -114, 17, -86, 39, -118, -128, -128, -77, -96, -128, -17, -67, -128, -84,
+    -67, -36, -25, 61, -60, 50, -128, -60, -120, -128, -63, -128, -128, -45, -128, -128,
+    -50, -70, -22, -10, -119, -36, -41, -128, -76, -45, -69, -110, -113, 15, -31, -128,
+    -128, -128, -67, 12, -60, -98, -88, -93, -71, -62, -36, -26, -65, -128, -104, -75,
+    4, -80, 45, -30, -69, -37, -128, 13, -128, -69, -86, -68, -54, -128, -128, -128,
+    -104, -55, -128, -29, -38, -128, -128, -104, 33, -128, 4, -14, -128, -73, -128, -19,
+    -82, -93, -124, 21, -123, 49, -91, -128, -128, -116, -71, -128, -18, -87, -128, -110,
+    -78, -47, 10, 71, -52, 44, -128, -65, -33, -111, -71, -128, -128, -54, -128, -128,
+    -46, -75, -32, -11, -116, -24, -52, -105, -28, -40, -30, -102, -110, 24, -4, -128,
+    -128, -110, -51, 15, -59, -70, -128, -104, -67, -57, -78, -12, -40, -128, -53, -128,
+    34, -90, 56, -24, -88, -41, -128, 28, -128, -32, -71, -54, -55, -128, -128, -128,
+    -113, -19, -128, -37, -56, -128, -128, -103, 50, -128, -7, -23, -127, -118, -80, -10,
+    -35, -5, -114, 11, -85, 42, -128, -128, -128, -88, -109, -128, -8, -78, -128, -92,
+    -57, -34, -72, 70, -64, 42, -128, -66, -128, -128, -120, -128, -128, -47, -128, -97,
+    -50, -88, -25, -8, -126, -43, -40, -128, -128, -49, -54, -109, -93, 6, -26, -128,
+    -128, -117, -68, 10, -67, -91, -53, -96, -71, -57, -1, -32, -88, -128, -122, -33,
+    58, -78, -20, -26, -40, -38, -102, 24, -128, -88, -83, -68, -43, -128, -128, -128,
+    -108, -45, -128, -27, -59, -127, -128, -95, 35, -128, -38, -14, -128, -79, -90, -39,
+    -26, -68, -118, 25, -69, 17, -128, -128, -128, -83, -95, -128, 1, -39, -128, -54,
+    -47, -68, -33, 53, -41, 30, -128, -69, -15, -128, -85, -128, -128, -85, -128, -128,
+    -41, -21, -64, -20, -79, -35, -67, -128, -51, -51, -44, -127, -96, 23, 11, -128,
+    -53, -103, -39, 19, -77, -111, -128, -92, -65, -53, -38, -21, -37, -128, -99, -118,
+    14, -78, 46, -23, -128, -85, -124, 50, -128, -40, -65, -49, -33, -128, -128, -128,
+    -108, -49, -128, -31, -42, -128, -128, -128, 26, -128, 21, -32, -128, -90, -128, -15,
+    -109, -128, -128, 21, -57, 111, -97, -128, -128, -48, -65, -128, 14, -80, -128, -97,
+    -58, -42, -66, 90, -58, 50, -128, -62, 39, -113, -28, -128, -128, -33, -128, -128,
+    -58, -50, -36, -17, -128, -27, -63, -107, 23, -51, 2, -106, -128, 98, 29, -128,
+    -128, -100, -50, 18, -54, -77, -128, -104, -53, -59, -106, 6, -11, -120, -44, -128,
+    42, -95, 73, -32, -101, -30, -128, 60, -128, -7, -65, -52, -92, -128, -128, -128,
+    -128, -17, -128, -51, -50, -128, -101, -101, 62, -128, 13, -27, -67, -128, -128, 16,
+    -74, -76, -128, 14, -128, 127, -97, -128, -128, -128, -85, -128, -38, -128, -104, -116,
+    -56, 0, -128, 72, -97, 66, -128, -51, -94, -128, -25, -101, -128, -5, -128, -58,
+    -81, -84, -3, -10, -128, -38, -29, -128, -46, -76, -68, -97, -126, 12, -34, -128,
+    -128, -128, -97, 12, -43, -58, -128, -114, -60, -65, -64, -6, -56, -128, -106, -128,
+    58, -103, 47, -42, 17, 13, -128, 15, -128, -79, -92, -89, -80, -128, -128, -128,
+    -93, -33, -128, -57, -63, -128, -45, -107, 75, -128, -17, -37, -62, -95, -128, 13,
+    -61, -34, -124, -2, -32, 122, -88, -128, -128, -43, -84, -128, -14, -128, -119, -105,
+    -62, 2, -128, 33, -105, 68, -128, -22, -114, -128, 18, -102, -128, -9, -128, -55,
+    -72, -67, -3, -12, -128, -76, -24, -128, -56, -96, -43, -106, -128, 30, -54, -128,
+    -128, -128, -111, 13, -30, -63, -100, -113, -49, -65, -41, -35, -61, -127, -108, -79,
+    37, -101, 54, -35, 26, -3, -128, -7, -128, -103, -108, -105, -73, -128, -128, -128,
+    -108, -26, -103, -54, -61, -128, -55, -112, 94, -128, -30, -46, -67, -128, -128, 0,
+    -55, 0, -107, -4, -3, 58, -128, -123, -128, -69, -72, -128, 4, -123, -128, -118,
+    -82, -19, -128, 58, -106, 61, -128, -8, -118, -128, 7, -128, -128, -39, -128, -63,
+    -46, -57, -7, 4, -128, -108, -18, -128, -85, -103, -61, -99, -128, 21, -40, -128,
+    -128, -128, -104, 12, -12, -66, -83, -109, -59, -61, -15, -48, -62, -128, -125, -38,
+    24, -92, 20, -35, 5, -26, -128, 7, -128, -111, -112, -105, -91, -128, -128, -128,
+    -114, -29, -128, -52, -53, -128, -97, -73, 79, -128, -6, -16, -47, -100, -128, 16,
+    -71, -34, -120, -5, -128, 92, -128, -117, -128, -128, -67, -128, -70, -128, -100, -124,
+    -66, -5, -128, 45, -106, 56, -128, -28, -128, -128, -82, -128, -128, -20, -128, -66,
+    -70, -100, -6, -5, -128, -61, -20, -128, -116, -77, -91, -93, -105, -33, -48, -128,
+    -128, -127, -90, 7, -30, -51, -70, -110, -50, -64, -24, -26, -85, -128, -103, -76,
+    66, -99, -14, -46, 35, 6, -128, 5, -128, -102, -91, -92, -76, -128, -128, -128,
+    -122, -39, -128, -36, -52, -128, -128, -22, 46, -91, 21, 10, -89, -96, -128, -1,
+    -82, -115, -128, 29, -128, 86, -69, -128, -128, -128, -34, -128, -128, -102, -128, -106,
+    -38, -8, -61, -2, -75, 59, -128, -50, -86, -128, -110, -125, -128, -29, -108, -74,
+    -91, -109, -16, -37, -126, 17, -35, -128, -45, -43, -124, -95, -59, -51, -33, -128,
+    -128, -74, -57, 3, -57, -67, -128, -95, -58, -60, -100, 15, -78, -128, -108, -128,
+    75, -99, 32, -47, -43, 14, -128, -4, -122, -37, -57, -62, -76, -128, -128, -128,
+    -73, -73, -128, -54, -77, -128, -79, -86, 84, -128, -34, -28, -59, -35, -128, 14,
+    -78, -37, -128, -12, -39, 43, -76, -128, -126, -74, -37, -128, -37, -114, -128, -42,
+    -23, 7, -128, -1, -106, 65, -128, 8, -92, -83, 23, -128, -128, -9, -128, -76,
+    -89, -51, -21, -17, -128, -91, -34, -118, -45, -96, -45, -125, -128, 31, -49, -128,
+    -128, -116, -95, 24, -21, -78, -120, -121, -30, -66, -51, -39, -49, -104, -72, -92,
+    3, -121, 54, -38, -8, -7, -128, -3, -128, -86, -86, -100, -87, -128, -128, -128,
+    -120, -22, -128, -7, -50, -128, -128, -128, 45, -128, -49, -47, -128, -121, -128, -65,
+    -14, 13, -128, 18, 2, -20, -49, -128, -30, -20, -7, -117, 58, -120, -10, -95,
+    -72, -60, -128, 127, 18, 41, -128, -66, -128, -128, 37, -13, -128, -85, -128, -81,
+    -43, -111, -54, 44, -21, -74, -101, -128, -54, 4, -6, -107, -128, 69, -34, -128,
+    -68, -42, -40, 11, -40, -49, -18, -128, -72, -38, -53, -8, -40, -128, -72, -66,
+    43, -122, 120, -19, -76, -100, -128, -31, -128, -28, -34, -48, -61, -128, -128, -128,
+    -128, 8, -128, -9, -54, -128, -128, -128, 54, -128, -38, -58, -128, -128, -128, -54,
+    -20, 8, -128, 16, -2, 3, -53, -127, -40, -11, -24, -128, 67, -128, -4, -104,
+    -78, -53, -128, 127, 12, 48, -128, -70, -128, -128, 53, 15, -128, -73, -128, -81,
+    -54, -114, -49, 53, -43, -77, -98, -128, -42, 0, -24, -98, -128, 78, -36, -128,
+    -84, -45, -49, 9, -37, -41, -28, -125, -78, -41, -59, -10, -26, -125, -103, -71,
+    69, -121, 127, -29, -49, -81, -128, -24, -128, -36, -34, -52, -84, -128, -128, -126,
+    -128, -4, -128, -11, -54, -128, -128, -128, 61, -128, -44, -61, -128, -128, -128, -53,
+    -19, 25, -128, 15, 19, -22, -58, -117, -39, -23, 0, -128, 74, -128, -4, -107,
+    -83, -54, -128, 127, 3, 47, -128, -57, -128, -128, 70, -15, -128, -78, -128, -78,
+    -50, -109, -48, 60, -49, -95, -94, -128, -47, -10, -22, -96, -128, 79, -32, -128,
+    -82, -41, -50, 8, -26, -38, -33, -126, -78, -41, -53, -10, -26, -117, -90, -62,
+    45, -123, 125, -26, -47, -83, -128, -22, -128, -41, -37, -57, -89, -128, -128, -128,
+    -128, -10, -128, -11, -58, -128, -128, -128, 67, -128, -39, -64, -128, -128, -128, -49,
+    -33, 25, -128, 7, 17, -27, -66, -111, -45, -11, -9, -128, 77, -128, -18, -105,
+    -82, -53, -128, 127, 2, 47, -128, -55, -128, -128, 67, -18, -128, -71, -128, -87,
+    -53, -110, -49, 62, -53, -95, -96, -128, -50, -5, -29, -94, -128, 91, -31, -128,
+    -87, -37, -48, 7, -24, -35, -38, -123, -75, -43, -50, -15, -22, -120, -85, -60,
+    38, -122, 123, -33, -40, -77, -128, -14, -128, -41, -33, -55, -100, -128, -128, -128,
+    -128, -10, -128, -10, -55, -128, -128, -128, 66, -128, -36, -63, -128, -128, -128, -44,
+    -37, 24, -128, 11, 11, -21, -58, -104, -35, -27, 3, -128, 70, -128, -5, -109,
+    -88, -48, -128, 127, 4, 49, -128, -53, -128, -128, 66, -12, -128, -65, -128, -89,
+    -54, -119, -46, 62, -53, -97, -94, -128, -52, -4, -25, -93, -128, 81, -33, -128,
+    -87, -40, -49, 6, -20, -30, -32, -125, -77, -44, -54, -10, -30, -124, -81, -62,
+    43, -127, 120, -30, -41, -72, -128, -26, -128, -39, -33, -57, -102, -128, -128, -128,
+    -128, -20, -128, -9, -50, -128, -128, -128, 57, -128, -51, -50, -128, -128, -128, -63,
+    -10, 19, -128, 19, -24, -18, -73, -122, -46, -48, -15, -110, 63, -128, 13, -111,
+    -89, -67, -128, 127, 10, 37, -128, -67, -128, -128, 38, -47, -128, -91, -128, -86,
+    -42, -102, -58, 53, -29, -78, -97, -128, -65, -4, -37, -96, -128, 57, -26, -128,
+    -61, -42, -40, 5, -35, -32, -22, -124, -82, -40, -39, -9, -36, -128, -82, -60,
+    23, -120, 108, -25, -57, -98, -128, -18, -128, -39, -34, -50, -66, -128, -128, -128,
+    -128, -18, -128, -9, -50, -128, -128, -128, 47, -128, -40, -49, -128, -128, -128, -61,
+    -16, -10, -128, 27, -22, 32, -41, -128, -36, -11, -25, -103, 47, -128, 26, -100,
+    -76, -55, -128, 127, 18, 45, -128, -74, -128, -128, 44, 4, -128, -72, -128, -79,
+    -54, -104, -54, 32, -26, -49, -101, -128, -41, 2, -34, -103, -128, 71, -31, -128,
+    -71, -48, -42, 7, -42, -35, -25, -127, -79, -41, -63, 2, -43, -126, -95, -77,
+    36, -128, 127, -26, -65, -89, -128, -34, -128, -24, -33, -50, -63, -128, -128, -128,
+    -128, -18, -128, -6, -44, -128, -128, -128, 47, -128, -41, -39, -128, -128, -128, -72,
+    -21, -6, -128, 26, -77, -20, -43, -128, -39, -90, -10, -115, 35, -117, -16, -124,
+    -84, -69, -128, 127, 15, 41, -128, -72, -128, -128, 19, -20, -128, -103, -128, -71,
+    -34, -115, -50, 46, -28, -62, -92, -128, -45, 6, -41, -94, -128, 38, -31, -128,
+    -72, -34, -37, 5, -40, -48, -35, -119, -82, -35, -64, -5, -34, -128, -77, -97,
+    38, -108, 119, -23, -85, -98, -128, -21, -128, -23, -35, -44, -67, -128, -128, -128,
+    -128, -17, -128, -13, -53, -128, -128, -128, 60, -128, -39, -51, -128, -128, -128, -48,
+    -43, -13, -128, 17, -31, -2, -56, -124, -76, -76, -4, -128, 57, -126, -36, -94,
+    -71, -51, -128, 127, -5, 46, -128, -55, -128, -128, 51, -32, -128, -73, -128, -88,
+    -55, -96, -52, 56, -62, -94, -92, -128, -28, -15, -23, -101, -128, 60, -19, -128,
+    -76, -48, -48, 13, -28, -45, -85, -128, -75, -44, -65, -8, -12, -119, -64, -117,
+    35, -125, 121, -28, -67, -75, -128, -2, -128, -30, -32, -54, -96, -128, -128, -128,
+    -128, -17, -128, -13, -61, -128, -128, -128, 62, -128, -36, -61, -128, -128, -128, -39,
+    -31, 13, -128, 10, 28, -11, -73, -115, -57, 16, -25, -128, 68, -128, -15, -92,
+    -83, -48, -128, 127, 1, 46, -128, -57, -128, -128, 53, -33, -128, -55, -128, -109,
+    -65, -100, -54, 43, -51, -77, -97, -128, -54, -10, -30, -99, -128, 94, -28, -128,
+    -90, -47, -47, 6, -31, -28, -39, -120, -73, -49, -48, -13, -33, -126, -95, -54,
+    38, -127, 118, -32, -35, -69, -128, -20, -128, -42, -34, -56, -87, -128, -128, -128,
+    -128, -13, -128, -12, -57, -128, -128, -128, 66, -128, -36, -58, -128, -128, -128, -35,
+    -34, 18, -128, 7, -4, -24, -67, -115, -46, -20, -14, -128, 60, -128, -15, -94,
+    -84, -45, -128, 127, -2, 47, -128, -55, -128, -128, 52, -21, -128, -57, -128, -110,
+    -64, -110, -50, 53, -53, -85, -94, -128, -54, -8, -35, -97, -128, 78, -35, -128,
+    -101, -53, -48, 9, -27, -28, -36, -124, -74, -49, -51, -14, -30, -128, -90, -62,
+    45, -128, 121, -33, -30, -66, -128, -22, -128, -45, -33, -57, -91, -128, -128, -128,
+    -128, -16, -128, -11, -58, -128, -128, -128, 62, -128, -42, -55, -128, -128, -128, -53,
+    -30, 10, -128, 10, 4, -26, -67, -124, -55, -17, -23, -128, 62, -128, -8, -94,
+    -75, -53, -128, 127, 3, 44, -128, -57, -128, -128, 40, -36, -128, -72, -128, -90,
+    -56, -104, -55, 47, -44, -82, -96, -128, -54, -8, -31, -100, -128, 75, -29, -128,
+    -82, -40, -45, 10, -31, -35, -37, -124, -76, -43, -48, -18, -30, -128, -89, -65,
+    41, -125, 114, -30, -50, -81, -128, -15, -128, -40, -32, -54, -84, -128, -128, -128,
+    -128, -29, -128, -14, -50, -128, -128, -128, 43, -128, -30, -52, -128, -128, -128, -46,
+    -35, -16, -128, 18, -2, 38, -62, -127, -89, -14, -16, -128, 70, -128, -5, -100,
+    -73, -49, -128, 127, -2, 44, -128, -68, -128, -128, 55, -28, -128, -60, -128, -88,
+    -60, -98, -53, 43, -61, -69, -98, -119, -32, -10, -1, -102, -128, 92, -16, -128,
+    -98, -50, -47, 9, -40, -34, -85, -128, -70, -45, -64, 3, -25, -122, -52, -111,
+    28, -127, 117, -24, -49, -73, -128, -6, -128, -28, -35, -52, -72, -128, -128, -128,
+    -128, 0, -128, -10, -60, -128, -128, -128, 62, -128, -26, -70, -128, -128, -128, -23,
+    -48, 18, -128, 10, 23, 10, -53, -85, -26, -3, 10, -128, 70, -128, -26, -109,
+    -96, -35, -128, 127, 8, 55, -128, -54, -128, -128, 83, 24, -128, -37, -128, -113,
+    -70, -125, -44, 62, -61, -98, -99, -128, -43, -1, -13, -90, -128, 99, -35, -128,
+    -90, -38, -51, -1, -19, -25, -36, -115, -69, -51, -66, 2, -29, -115, -85, -64,
+    66, -128, 127, -34, -28, -51, -128, -39, -128, -35, -28, -58, -118, -128, -128, -128,
+    -128, -6, -128, -10, -49, -128, -128, -128, 62, -128, -38, -64, -128, -128, -128, -41,
+    -22, 38, -128, 13, 26, -27, -77, -118, -46, -22, 9, -128, 83, -128, -21, -100,
+    -87, -53, -128, 127, 1, 45, -128, -58, -128, -128, 67, -34, -128, -70, -128, -100,
+    -49, -111, -46, 67, -56, -100, -94, -128, -59, -7, -15, -98, -128, 88, -26, -128,
+    -83, -60, -48, 11, -24, -39, -35, -128, -78, -44, -47, -5, -29, -128, -81, -54,
+    41, -128, 112, -26, -45, -80, -128, -18, -128, -41, -38, -56, -93, -128, -128, -128,
+    -128, -10, -128, -10, -51, -128, -128, -128, 59, -128, -44, -56, -128, -128, -128, -53,
+    -18, 24, -128, 17, -12, -16, -65, -123, -42, -45, -2, -128, 72, -128, -9, -103,
+    -79, -57, -128, 127, 6, 43, -128, -65, -128, -128, 60, -21, -128, -80, -128, -83,
+    -49, -109, -51, 64, -45, -90, -97, -128, -52, -3, -27, -98, -128, 71, -29, -128,
+    -76, -46, -46, 9, -31, -40, -34, -128, -79, -41, -49, -5, -25, -128, -78, -69,
+    33, -124, 121, -27, -52, -86, -128, -16, -128, -38, -33, -52, -83, -128, -128, -128,
+    -128, 1, -128, -10, -50, -128, -128, -128, 64, -128, -45, -63, -128, -128, -128, -56,
+    -19, 31, -128, 17, 1, -9, -74, -118, -44, -49, 1, -128, 82, -127, -23, -109,
+    -79, -59, -128, 127, 5, 44, -128, -62, -128, -128, 65, -28, -128, -86, -128, -70,
+    -40, -108, -48, 71, -53, -105, -94, -128, -55, -6, -26, -97, -128, 74, -25, -128,
+    -61, -48, -49, 9, -24, -49, -32, -128, -81, -39, -45, -6, -23, -128, -85, -61,
+    37, -119, 114, -27, -59, -91, -128, -9, -128, -39, -37, -55, -97, -128, -128, -128,
+    -128, -14, -128, -6, -47, -128, -128, -128, 55, -128, -28, -45, -128, -128, -128, -52,
+    -38, 11, -128, 20, -98, -7, -47, -118, -15, -100, 10, -128, 28, -124, -17, -110,
+    -69, -50, -128, 127, 14, 47, -128, -67, -128, -128, 21, 1, -128, -77, -128, -68,
+    -50, -128, -41, 55, -38, -69, -94, -128, -62, 18, -43, -95, -128, 47, -40, -128,
+    -92, -36, -39, 6, -31, -48, -11, -127, -76, -38, -63, 4, -44, -128, -72, -77,
+    52, -122, 110, -31, -64, -77, -128, -30, -128, -24, -26, -46, -91, -128, -128, -128,
+    -128, -70, -128, -2, -36, -128, -128, -83, 41, -128, -12, -25, -128, -128, -128, -65,
+    -44, -44, -128, 43, -128, -3, -53, -128, -56, -93, 5, -57, -21, -112, -26, -86,
+    -58, -67, -104, 114, 19, 38, -128, -75, -128, -128, -28, -86, -128, -83, -128, -103,
+    -52, -104, -54, -2, -16, 16, -97, -128, -46, 24, -91, -104, -128, 60, -5, -128,
+    -73, -45, -9, 8, -48, -47, -57, -125, -83, -41, -84, 29, -69, -128, -78, -105,
+    -19, -128, 85, -34, -122, -88, -128, -19, -128, 16, -20, -30, -64, -128, -128, -128,
+    -108, -41, -128, -13, -58, -128, -128, -111, 52, -128, -45, -28, -128, -110, -128, -58,
+    -1, 10, -128, 37, -29, -74, -24, -128, -18, -70, 10, -64, -5, -108, -48, -41,
+    -37, -39, -128, 83, -2, 49, -128, -47, -128, -128, 15, -71, -128, -81, -128, -75,
+    -66, -97, -46, 7, -28, -42, -80, -128, -46, -14, -55, -124, -108, 23, -43, -128,
+    -95, -56, -44, 23, -47, -70, -18, -128, -85, -42, -67, -9, -66, -111, -112, -57,
+    12, -128, 104, -13, -100, -84, -128, -51, -128, -31, -39, -56, -48, -128, -128, -128,
+    -41, -101, -41, -26, -80, -78, -128, 7, 110, -92, -128, 3, -128, -15, -77, -117,
+    -66, -106, -120, -60, -96, -128, -70, -128, -57, -91, -59, -38, -82, -126, 52, -77,
+    -78, -108, -128, -127, -38, 13, -104, 53, -28, -101, -62, -128, -128, -128, -53, -127,
+    -10, 13, -118, -44, 85, -108, -86, -128, -58, -86, -94, -122, -102, -15, -34, -97,
+    23, -21, -17, 26, 17, -11, -42, -121, 10, -37, -21, -117, -19, -128, -94, -84,
+    53, -120, 87, -63, -106, -128, -128, -6, -40, -45, -39, -68, -58, -94, -66, -128,
+    -50, -95, -14, -32, -88, -76, -126, -7, 111, -128, -128, -5, -128, -41, -95, -110,
+    -65, -111, -116, -58, -51, -128, -54, -128, -72, -45, -87, -65, -64, -128, 45, -81,
+    -81, -97, -128, -121, -48, 21, -101, 50, -6, -105, -29, -119, -128, -128, -65, -117,
+    -21, 21, -112, -46, 59, -107, -80, -128, -35, -99, -93, -118, -113, -2, -40, -86,
+    -4, -22, -34, 23, 11, -7, -64, -114, 2, -41, -27, -124, -7, -120, -107, -94,
+    43, -114, 112, -62, -83, -128, -128, -4, -41, -58, -49, -76, -58, -64, -54, -128,
+    -51, -96, -16, -33, -87, -75, -126, -6, 111, -128, -128, -5, -128, -40, -96, -109,
+    -66, -112, -115, -58, -54, -128, -54, -128, -72, -45, -87, -67, -66, -128, 45, -82,
+    -81, -97, -128, -123, -49, 21, -101, 50, -7, -105, -29, -119, -128, -128, -63, -118,
+    -21, 21, -112, -47, 59, -105, -79, -128, -35, -99, -94, -118, -112, -1, -40, -85,
+    -7, -23, -34, 23, 11, -7, -64, -113, 3, -41, -28, -123, -8, -119, -107, -93,
+    43, -114, 112, -63, -82, -128, -128, -4, -39, -58, -49, -77, -58, -66, -56, -128,
+    -51, -97, -16, -33, -87, -74, -126, -6, 111, -128, -128, -5, -128, -39, -95, -109,
+    -67, -112, -115, -58, -54, -128, -54, -128, -73, -45, -87, -67, -65, -128, 44, -82,
+    -81, -97, -128, -123, -50, 21, -100, 50, -5, -103, -28, -119, -128, -128, -63, -118,
+    -21, 22, -112, -47, 58, -105, -79, -128, -34, -99, -94, -118, -113, -1, -40, -85,
+    -7, -24, -34, 23, 11, -7, -66, -113, 3, -41, -28, -124, -7, -118, -106, -95,
+    41, -114, 112, -63, -82, -128, -128, -3, -39, -58, -50, -77, -58, -65, -56, -128,
+    -52, -96, -17, -33, -87, -77, -126, -5, 111, -127, -128, -5, -128, -41, -97, -109,
+    -66, -111, -115, -59, -57, -128, -54, -128, -70, -46, -87, -67, -66, -128, 45, -82,
+    -81, -97, -128, -122, -49, 21, -99, 50, -9, -105, -29, -118, -128, -128, -63, -117,
+    -21, 21, -112, -46, 59, -105, -79, -128, -36, -99, -95, -118, -112, -2, -41, -85,
+    -7, -24, -34, 23, 11, -7, -63, -113, 3, -41, -27, -124, -8, -120, -107, -93,
+    43, -114, 112, -63, -81, -128, -128, -4, -39, -58, -49, -77, -58, -65, -56, -128,
+    -51, -95, -16, -32, -90, -78, -125, -7, 111, -128, -128, -5, -128, -39, -99, -108,
+    -65, -109, -114, -58, -54, -128, -54, -127, -70, -47, -86, -66, -65, -128, 39, -81,
+    -80, -96, -128, -120, -48, 21, -99, 50, -10, -104, -28, -118, -128, -128, -65, -117,
+    -23, 20, -112, -45, 58, -107, -80, -128, -36, -98, -94, -118, -112, -3, -41, -89,
+    -4, -19, -34, 21, 10, -8, -62, -111, 3, -41, -27, -123, -7, -120, -106, -92,
+    43, -112, 112, -62, -82, -128, -128, -4, -42, -59, -48, -76, -58, -65, -56, -128,
+    -49, -96, -16, -32, -88, -77, -128, -6, 111, -128, -128, -6, -128, -39, -96, -108,
+    -68, -111, -113, -59, -52, -128, -56, -124, -71, -47, -85, -68, -65, -128, 40, -84,
+    -83, -97, -128, -122, -48, 21, -102, 51, -9, -104, -30, -120, -128, -128, -65, -120,
+    -21, 20, -112, -45, 59, -109, -80, -128, -36, -98, -92, -117, -115, -1, -39, -89,
+    -2, -21, -33, 21, 13, -7, -64, -111, 4, -41, -27, -124, -8, -122, -105, -93,
+    45, -113, 110, -63, -83, -128, -128, -4, -42, -57, -48, -76, -61, -64, -52, -128,
+    -53, -93, -14, -32, -88, -82, -123, -5, 113, -127, -128, -5, -128, -47, -107, -109,
+    -65, -110, -116, -58, -57, -128, -51, -128, -64, -48, -87, -64, -67, -128, 47, -80,
+    -81, -96, -128, -122, -48, 22, -98, 51, -14, -109, -27, -111, -128, -128, -66, -117,
+    -22, 20, -112, -45, 61, -107, -80, -128, -35, -98, -98, -118, -112, -5, -43, -84,
+    -4, -24, -34, 23, 12, -7, -58, -114, 3, -41, -28, -125, -7, -119, -111, -91,
+    46, -115, 116, -63, -81, -128, -128, -7, -41, -59, -48, -77, -60, -61, -50, -128,
+    -50, -95, -17, -32, -89, -79, -125, -6, 110, -128, -128, -5, -128, -38, -99, -108,
+    -63, -109, -113, -58, -54, -128, -54, -126, -69, -45, -86, -65, -66, -128, 41, -84,
+    -83, -97, -128, -122, -48, 21, -99, 49, -11, -106, -29, -117, -128, -128, -63, -118,
+    -22, 19, -112, -46, 60, -106, -80, -128, -37, -98, -94, -117, -110, -3, -42, -87,
+    -6, -19, -33, 20, 10, -7, -60, -110, 3, -41, -27, -123, -9, -121, -108, -90,
+    45, -111, 112, -62, -81, -128, -128, -6, -39, -59, -49, -76, -56, -67, -59, -128,
+    -51, -96, -16, -33, -87, -75, -126, -6, 111, -128, -128, -5, -128, -40, -96, -109,
+    -66, -112, -115, -58, -54, -128, -54, -128, -72, -45, -87, -67, -66, -128, 45, -82,
+    -81, -97, -128, -123, -49, 21, -101, 50, -7, -105, -29, -119, -128, -128, -63, -118,
+    -21, 21, -112, -47, 59, -105, -79, -128, -35, -99, -94, -118, -112, -1, -40, -85,
+    -7, -23, -34, 23, 11, -7, -64, -113, 3, -41, -28, -123, -8, -119, -107, -93,
+    43, -114, 112, -63, -82, -128, -128, -4, -39, -58, -49, -77, -58, -66, -56, -128,
+    -54, -93, -18, -33, -87, -75, -127, -4, 111, -127, -128, -5, -128, -48, -87, -109,
+    -66, -110, -114, -59, -62, -128, -62, -128, -74, -48, -90, -70, -68, -128, 45, -83,
+    -80, -97, -128, -122, -50, 20, -100, 48, -13, -112, -39, -126, -128, -128, -62, -115,
+    -21, 18, -111, -48, 57, -102, -79, -128, -42, -97, -99, -117, -110, -2, -40, -86,
+    -10, -23, -33, 22, 10, -8, -59, -113, 3, -41, -24, -124, -12, -128, -112, -87,
+    48, -113, 104, -64, -79, -128, -128, -2, -37, -59, -49, -76, -58, -65, -55, -128,
+    -51, -95, -20, -32, -86, -71, -128, -6, 111, -128, -128, -5, -128, -42, -76, -109,
+    -68, -109, -114, -59, -58, -128, -67, -127, -80, -49, -88, -72, -65, -128, 42, -84,
+    -81, -98, -128, -120, -50, 19, -102, 49, -10, -107, -42, -128, -128, -128, -63, -117,
+    -19, 18, -111, -47, 56, -105, -79, -128, -44, -98, -94, -117, -113, 0, -37, -88,
+    -7, -23, -32, 22, 11, -8, -63, -113, 4, -40, -23, -123, -12, -128, -107, -88,
+    47, -112, 98, -63, -82, -128, -128, 1, -39, -58, -49, -75, -59, -66, -57, -128,
+    -56, -99, -19, -33, -86, -72, -128, -1, 113, -126, -128, -4, -128, -44, -92, -109,
+    -68, -113, -114, -60, -65, -128, -58, -128, -73, -46, -87, -67, -69, -128, 41, -83,
+    -81, -99, -128, -124, -51, 20, -102, 51, -7, -108, -32, -123, -128, -128, -61, -119,
+    -19, 23, -112, -49, 60, -102, -79, -128, -37, -98, -101, -117, -113, 1, -39, -86,
+    -8, -26, -32, 23, 12, -8, -64, -113, 5, -41, -27, -123, -8, -123, -108, -92,
+    40, -113, 109, -66, -82, -128, -128, 0, -34, -57, -50, -76, -59, -68, -58, -128,
+    -53, -95, -16, -33, -87, -74, -126, -8, 110, -128, -128, -5, -128, -42, -100, -109,
+    -65, -114, -115, -57, -54, -128, -51, -128, -74, -44, -89, -67, -64, -128, 42, -82,
+    -82, -97, -128, -120, -49, 21, -101, 48, 0, -105, -26, -115, -128, -128, -65, -119,
+    -22, 23, -112, -46, 58, -104, -80, -128, -29, -99, -95, -118, -112, -2, -40, -85,
+    -7, -24, -34, 23, 10, -7, -70, -113, 2, -41, -30, -123, -4, -114, -107, -100,
+    42, -113, 117, -62, -83, -128, -128, -3, -40, -57, -50, -76, -57, -66, -58, -128,
+    -51, -94, -15, -33, -88, -77, -126, -6, 112, -128, -128, -6, -128, -43, -93, -108,
+    -66, -109, -117, -58, -53, -128, -58, -128, -72, -46, -86, -67, -65, -128, 45, -79,
+    -79, -96, -128, -122, -49, 21, -102, 50, -12, -107, -32, -123, -128, -128, -65, -116,
+    -22, 20, -112, -46, 58, -107, -80, -128, -39, -98, -94, -119, -114, -1, -40, -87,
+    -4, -23, -34, 23, 12, -8, -60, -114, 3, -41, -25, -123, -10, -125, -109, -89,
+    45, -115, 107, -63, -82, -128, -128, -3, -41, -58, -48, -77, -60, -65, -53, -128,
+    -56, -97, -15, -33, -88, -73, -128, -4, 111, -128, -128, -4, -128, -45, -91, -109,
+    -64, -110, -115, -58, -59, -128, -57, -128, -73, -43, -90, -65, -67, -128, 40, -80,
+    -79, -98, -128, -123, -50, 20, -101, 48, -8, -109, -32, -123, -128, -128, -62, -118,
+    -22, 22, -112, -49, 59, -100, -79, -128, -37, -98, -100, -118, -110, 0, -40, -84,
+    -10, -24, -33, 23, 9, -9, -62, -113, 2, -41, -26, -124, -9, -121, -111, -90,
+    40, -113, 110, -64, -81, -128, -128, -2, -34, -59, -50, -76, -56, -67, -58, -128,
+    -54, -95, -19, -32, -86, -76, -128, -3, 113, -128, -128, -5, -128, -45, -88, -110,
+    -68, -109, -114, -61, -61, -128, -64, -126, -71, -49, -85, -66, -68, -128, 44, -84,
+    -81, -99, -128, -122, -49, 20, -104, 51, -14, -110, -36, -127, -128, -128, -64, -117,
+    -18, 20, -112, -47, 61, -106, -79, -128, -43, -97, -98, -118, -114, 1, -38, -89,
+    -2, -24, -31, 23, 14, -8, -58, -114, 6, -40, -24, -123, -11, -128, -109, -85,
+    46, -113, 103, -65, -83, -128, -128, -1, -39, -57, -49, -76, -61, -66, -55, -128,
+    -52, -95, -19, -32, -88, -80, -127, -6, 111, -128, -128, -5, -128, -41, -99, -109,
+    -67, -110, -113, -58, -56, -128, -55, -125, -70, -48, -86, -67, -65, -128, 39, -84,
+    -82, -97, -128, -119, -47, 21, -102, 50, -11, -105, -30, -118, -128, -128, -66, -118,
+    -21, 19, -112, -45, 59, -107, -80, -128, -37, -97, -94, -117, -114, -2, -40, -90,
+    -4, -20, -33, 21, 11, -8, -63, -111, 3, -41, -27, -123, -8, -122, -106, -92,
+    44, -112, 111, -63, -83, -128, -128, -4, -42, -57, -48, -76, -60, -65, -55, -128,
+    -43, -87, -23, -31, -86, -91, -128, -2, 117, -119, -128, -8, -128, -41, -99, -107,
+    -74, -101, -113, -61, -65, -128, -67, -114, -57, -75, -70, -63, -72, -128, 43, -86,
+    -84, -96, -128, -121, -45, 21, -101, 58, -38, -110, -43, -127, -128, -128, -73, -116,
+    -16, 9, -110, -39, 62, -124, -79, -128, -55, -95, -92, -117, -120, -12, -40, -97,
+    14, -20, -31, 21, 23, -9, -42, -114, 7, -40, -20, -122, -16, -128, -106, -76,
+    62, -115, 92, -64, -88, -128, -128, -9, -58, -57, -46, -77, -75, -65, -34, -128,
+    -64, -91, -59, -33, -93, -95, -128, -6, 103, -106, -128, 5, -128, -37, -94, -100,
+    -52, -94, -128, -58, -116, -128, -70, -128, -71, -70, -86, -93, -84, -117, 18, -40,
+    -31, -80, -128, -105, -54, 21, -101, 35, -44, -115, -62, -128, -121, -127, -43, -94,
+    -46, 0, -107, -50, 49, -80, -82, -128, -57, -83, -108, -128, -80, -5, -49, -104,
+    -54, -21, -32, 31, -11, -31, -43, -122, 4, -40, -23, -115, -20, -128, -112, -77,
+    52, -121, 92, -66, -67, -128, -121, 5, -21, -62, -39, -71, -46, -95, -110, -106,
+    -31, -78, -13, -25, -90, -81, -128, -38, 90, -128, -128, -9, -128, -24, -5, -117,
+    -42, -65, -128, -48, 8, -128, -108, -128, -96, -21, -77, -61, -33, -107, 21, -33,
+    -35, -90, -128, -92, -31, 13, -128, 31, -43, -105, -87, -128, -128, -128, -69, -97,
+    -29, -4, -115, -42, 53, -103, -90, -128, -86, -76, -51, -128, -99, 18, -24, -108,
+    9, -8, -22, 33, -11, -38, -31, -126, -8, -34, 0, -114, -36, -128, -107, -41,
+    68, -125, 45, -45, -107, -128, -115, 9, -50, -54, -32, -63, -46, -91, -96, -126,
+    -47, -83, -1, -28, -98, -84, -128, -34, 95, -128, -128, -12, -128, -51, -36, -113,
+    -46, -74, -128, -46, 9, -128, -86, -128, -92, -8, -97, -67, -33, -119, 36, -46,
+    -48, -84, -128, -94, -34, 18, -128, 31, -34, -112, -62, -128, -128, -127, -79, -95,
+    -40, -1, -115, -42, 47, -98, -88, -128, -69, -82, -70, -128, -106, 14, -32, -103,
+    -6, 7, -30, 24, -12, -21, -40, -113, -15, -37, -6, -120, -27, -128, -115, -52,
+    51, -119, 71, -48, -85, -128, -124, 4, -49, -62, -33, -69, -47, -67, -71, -128,
+    -47, -83, -1, -28, -98, -84, -128, -34, 95, -128, -128, -12, -128, -51, -36, -113,
+    -46, -74, -128, -46, 9, -128, -86, -128, -92, -8, -97, -67, -33, -119, 36, -46,
+    -48, -84, -128, -94, -34, 18, -128, 31, -34, -112, -62, -128, -128, -127, -79, -95,
+    -40, -1, -115, -42, 47, -98, -88, -128, -69, -82, -70, -128, -106, 14, -32, -103,
+    -6, 7, -30, 24, -12, -21, -40, -113, -15, -37, -6, -120, -27, -128, -115, -52,
+    51, -119, 71, -48, -85, -128, -124, 4, -49, -62, -33, -69, -47, -67, -71, -128,
+    -47, -83, -1, -28, -98, -84, -128, -34, 95, -128, -128, -12, -128, -51, -36, -113,
+    -46, -74, -128, -46, 9, -128, -86, -128, -92, -8, -97, -67, -33, -119, 36, -46,
+    -48, -84, -128, -94, -34, 18, -128, 31, -34, -112, -62, -128, -128, -127, -79, -95,
+    -40, -1, -115, -42, 47, -98, -88, -128, -69, -82, -70, -128, -106, 14, -32, -103,
+    -6, 7, -30, 24, -12, -21, -40, -113, -15, -37, -6, -120, -27, -128, -115, -52,
+    51, -119, 71, -48, -85, -128, -124, 4, -49, -62, -33, -69, -47, -67, -71, -128,
+    -47, -83, -1, -28, -98, -84, -128, -34, 95, -128, -128, -12, -128, -51, -36, -113,
+    -46, -74, -128, -46, 9, -128, -86, -128, -92, -8, -97, -67, -33, -119, 36, -46,
+    -48, -84, -128, -94, -34, 18, -128, 31, -34, -112, -62, -128, -128, -127, -79, -95,
+    -40, -1, -115, -42, 47, -98, -88, -128, -69, -82, -70, -128, -106, 14, -32, -103,
+    -6, 7, -30, 24, -12, -21, -40, -113, -15, -37, -6, -120, -27, -128, -115, -52,
+    51, -119, 71, -48, -85, -128, -124, 4, -49, -62, -33, -69, -47, -67, -71, -128,
+    -47, -83, -1, -28, -98, -84, -128, -34, 95, -128, -128, -12, -128, -51, -36, -113,
+    -46, -74, -128, -46, 9, -128, -86, -128, -92, -8, -97, -67, -33, -119, 36, -46,
+    -48, -84, -128, -94, -34, 18, -128, 31, -34, -112, -62, -128, -128, -127, -79, -95,
+    -40, -1, -115, -42, 47, -98, -88, -128, -69, -82, -70, -128, -106, 14, -32, -103,
+    -6, 7, -30, 24, -12, -21, -40, -113, -15, -37, -6, -120, -27, -128, -115, -52,
+    51, -119, 71, -48, -85, -128, -124, 4, -49, -62, -33, -69, -47, -67, -71, -128,
+    -47, -83, -1, -28, -98, -84, -128, -34, 95, -128, -128, -12, -128, -51, -36, -113,
+    -46, -74, -128, -46, 9, -128, -86, -128, -92, -8, -97, -67, -33, -119, 36, -46,
+    -48, -84, -128, -94, -34, 18, -128, 31, -34, -112, -62, -128, -128, -127, -79, -95,
+    -40, -1, -115, -42, 47, -98, -88, -128, -69, -82, -70, -128, -106, 14, -32, -103,
+    -6, 7, -30, 24, -12, -21, -40, -113, -15, -37, -6, -120, -27, -128, -115, -52,
+    51, -119, 71, -48, -85, -128, -124, 4, -49, -62, -33, -69, -47, -67, -71, -128,
+    -47, -83, -1, -28, -98, -84, -128, -34, 95, -128, -128, -12, -128, -51, -36, -113,
+    -46, -74, -128, -46, 9, -128, -86, -128, -92, -8, -97, -67, -33, -119, 36, -46,
+    -48, -84, -128, -94, -34, 18, -128, 31, -34, -112, -62, -128, -128, -127, -79, -95,
+    -40, -1, -115, -42, 47, -98, -88, -128, -69, -82, -70, -128, -106, 14, -32, -103,
+    -6, 7, -30, 24, -12, -21, -40, -113, -15, -37, -6, -120, -27, -128, -115, -52,
+    51, -119, 71, -48, -85, -128, -124, 4, -49, -62, -33, -69, -47, -67, -71, -128,
+    -47, -83, -1, -28, -98, -84, -128, -34, 95, -128, -128, -12, -128, -51, -36, -113,
+    -46, -74, -128, -46, 9, -128, -86, -128, -92, -8, -97, -67, -33, -119, 36, -46,
+    -48, -84, -128, -94, -34, 18, -128, 31, -34, -112, -62, -128, -128, -127, -79, -95,
+    -40, -1, -115, -42, 47, -98, -88, -128, -69, -82, -70, -128, -106, 14, -32, -103,
+    -6, 7, -30, 24, -12, -21, -40, -113, -15, -37, -6, -120, -27, -128, -115, -52,
+    51, -119, 71, -48, -85, -128, -124, 4, -49, -62, -33, -69, -47, -67, -71, -128,
+    -47, -83, -1, -28, -98, -84, -128, -34, 95, -128, -128, -12, -128, -51, -36, -113,
+    -46, -74, -128, -46, 9, -128, -86, -128, -92, -8, -97, -67, -33, -119, 36, -46,
+    -48, -84, -128, -94, -34, 18, -128, 31, -34, -112, -62, -128, -128, -127, -79, -95,
+    -40, -1, -115, -42, 47, -98, -88, -128, -69, -82, -70, -128, -106, 14, -32, -103,
+    -6, 7, -30, 24, -12, -21, -40, -113, -15, -37, -6, -120, -27, -128, -115, -52,
+    51, -119, 71, -48, -85, -128, -124, 4, -49, -62, -33, -69, -47, -67, -71, -128,
+    -47, -83, -1, -28, -98, -84, -128, -34, 95, -128, -128, -12, -128, -51, -36, -113,
+    -46, -74, -128, -46, 9, -128, -86, -128, -92, -8, -97, -67, -33, -119, 36, -46,
+    -48, -84, -128, -94, -34, 18, -128, 31, -34, -112, -62, -128, -128, -127, -79, -95,
+    -40, -1, -115, -42, 47, -98, -88, -128, -69, -82, -70, -128, -106, 14, -32, -103,
+    -6, 7, -30, 24, -12, -21, -40, -113, -15, -37, -6, -120, -27, -128, -115, -52,
+    51, -119, 71, -48, -85, -128, -124, 4, -49, -62, -33, -69, -47, -67, -71, -128,
+    -47, -83, -1, -28, -98, -84, -128, -34, 95, -128, -128, -12, -128, -51, -36, -113,
+    -46, -74, -128, -46, 9, -128, -86, -128, -92, -8, -97, -67, -33, -119, 36, -46,
+    -48, -84, -128, -94, -34, 18, -128, 31, -34, -112, -62, -128, -128, -127, -79, -95,
+    -40, -1, -115, -42, 47, -98, -88, -128, -69, -82, -70, -128, -106, 14, -32, -103,
+    -6, 7, -30, 24, -12, -21, -40, -113, -15, -37, -6, -120, -27, -128, -115, -52,
+    51, -119, 71, -48, -85, -128, -124, 4, -49, -62, -33, -69, -47, -67, -71, -128,
+    -47, -83, -1, -28, -98, -84, -128, -34, 95, -128, -128, -12, -128, -51, -36, -113,
+    -46, -74, -128, -46, 9, -128, -86, -128, -92, -8, -97, -67, -33, -119, 36, -46,
+    -48, -84, -128, -94, -34, 18, -128, 31, -34, -112, -62, -128, -128, -127, -79, -95,
+    -40, -1, -115, -42, 47, -98, -88, -128, -69, -82, -70, -128, -106, 14, -32, -103,
+    -6, 7, -30, 24, -12, -21, -40, -113, -15, -37, -6, -120, -27, -128, -115, -52,
+    51, -119, 71, -48, -85, -128, -124, 4, -49, -62, -33, -69, -47, -67, -71, -128,
+    -47, -83, -1, -28, -98, -84, -128, -34, 95, -128, -128, -12, -128, -51, -36, -113,
+    -46, -74, -128, -46, 9, -128, -86, -128, -92, -8, -97, -67, -33, -119, 36, -46,
+    -48, -84, -128, -94, -34, 18, -128, 31, -34, -112, -62, -128, -128, -127, -79, -95,
+    -40, -1, -115, -42, 47, -98, -88, -128, -69, -82, -70, -128, -106, 14, -32, -103,
+    -6, 7, -30, 24, -12, -21, -40, -113, -15, -37, -6, -120, -27, -128, -115, -52,
+    51, -119, 71, -48, -85, -128, -124, 4, -49, -62, -33, -69, -47, -67, -71, -128,
+    -47, -83, -1, -28, -98, -84, -128, -34, 95, -128, -128, -12, -128, -51, -36, -113,
+    -46, -74, -128, -46, 9, -128, -86, -128, -92, -8, -97, -67, -33, -119, 36, -46,
+    -48, -84, -128, -94, -34, 18, -128, 31, -34, -112, -62, -128, -128, -127, -79, -95,
+    -40, -1, -115, -42, 47, -98, -88, -128, -69, -82, -70, -128, -106, 14, -32, -103,
+    -6, 7, -30, 24, -12, -21, -40, -113, -15, -37, -6, -120, -27, -128, -115, -52,
+    51, -119, 71, -48, -85, -128, -124, 4, -49, -62, -33, -69, -47, -67, -71, -128,
+    -47, -83, -1, -28, -98, -84, -128, -34, 95, -128, -128, -12, -128, -51, -36, -113,
+    -46, -74, -128, -46, 9, -128, -86, -128, -92, -8, -97, -67, -33, -119, 36, -46,
+    -48, -84, -128, -94, -34, 18, -128, 31, -34, -112, -62, -128, -128, -127, -79, -95,
+    -40, -1, -115, -42, 47, -98, -88, -128, -69, -82, -70, -128, -106, 14, -32, -103,
+    -6, 7, -30, 24, -12, -21, -40, -113, -15, -37, -6, -120, -27, -128, -115, -52,
+    51, -119, 71, -48, -85, -128, -124, 4, -49, -62, -33, -69, -47, -67, -71, -128,
+    -47, -83, -1, -28, -98, -84, -128, -34, 95, -128, -128, -12, -128, -51, -36, -113,
+    -46, -74, -128, -46, 9, -128, -86, -128, -92, -8, -97, -67, -33, -119, 36, -46,
+    -48, -84, -128, -94, -34, 18, -128, 31, -34, -112, -62, -128, -128, -127, -79, -95,
+    -40, -1, -115, -42, 47, -98, -88, -128, -69, -82, -70, -128, -106, 14, -32, -103,
+    -6, 7, -30, 24, -12, -21, -40, -113, -15, -37, -6, -120, -27, -128, -115, -52,
+    51, -119, 71, -48, -85, -128, -124, 4, -49, -62, -33, -69, -47, -67, -71, -128,
+    -47, -83, -1, -28, -98, -84, -128, -34, 95, -128, -128, -12, -128, -51, -36, -113,
+    -46, -74, -128, -46, 9, -128, -86, -128, -92, -8, -97, -67, -33, -119, 36, -46,
+    -48, -84, -128, -94, -34, 18, -128, 31, -34, -112, -62, -128, -128, -127, -79, -95,
+    -40, -1, -115, -42, 47, -98, -88, -128, -69, -82, -70, -128, -106, 14, -32, -103,
+    -6, 7, -30, 24, -12, -21, -40, -113, -15, -37, -6, -120, -27, -128, -115, -52,
+    51, -119, 71, -48, -85, -128, -124, 4, -49, -62, -33, -69, -47, -67, -71, -128,
+    -45, -83, -2, -27, -98, -93, -128, -35, 97, -128, -128, -14, -128, -51, -41, -114,
+    -52, -72, -128, -49, 15, -128, -88, -128, -88, -5, -92, -69, -30, -119, 35, -49,
+    -50, -86, -128, -92, -31, 18, -128, 34, -42, -109, -62, -128, -128, -127, -82, -96,
+    -37, -3, -115, -40, 49, -104, -89, -128, -72, -80, -66, -127, -113, 19, -31, -109,
+    0, 9, -28, 23, -7, -21, -37, -114, -12, -37, -5, -121, -27, -128, -111, -49,
+    54, -119, 68, -49, -88, -128, -126, 3, -53, -60, -32, -68, -54, -62, -66, -128,
+    -53, -87, -48, -29, -97, -103, -128, -42, 86, -128, -127, 1, -128, -34, -92, -104,
+    -50, -89, -128, -44, -51, -128, -52, -128, -95, -40, -98, -115, -48, -105, -3, -16,
+    -12, -71, -121, -74, -41, 24, -128, 19, -24, -91, -61, -127, -128, -121, -61, -86,
+    -57, -12, -107, -41, 31, -78, -87, -119, -39, -72, -71, -128, -78, 3, -45, -108,
+    -63, -6, -34, 37, -30, -43, -70, -125, -17, -38, -31, -118, -9, -128, -95, -102,
+    48, -124, 101, -48, -85, -123, -128, 12, -37, -57, -30, -64, -37, -82, -118, -128,
+};
+
+alignas(4) const int8_t bn5_dw_filter[864] = {
+    8, -30, 19, 37, -4, 14, 27, -9, 13, -15, -13, 11, 2, -86, -2, 4,
+    71, -6, 19, -10, 9, 5, 13, -18, -23, -6, 24, 17, -8, 1, 21, -18,
+    12, -4, -78, -4, -28, -21, -11, 35, -31, -10, -15, -51, 1, 50, 28, -9,
+    6, -6, 3, 21, 34, 6, 13, -40, -5, 11, 27, -51, -78, 1, -7, -8,
+    13, 14, 28, 81, -19, -97, 8, -8, 11, 11, -45, -8, 1, -11, 12, -12,
+    6, 17, -13, -45, 27, -21, 62, 7, -25, -7, -9, -69, 7, -8, 9, -127,
+    1, -93, 28, 105, 20, 97, 55, 41, -82, -83, -3, -57, -2, -3, 3, 0,
+    9, -25, 19, 47, 32, -45, -114, -7, -33, 44, 127, 27, 64, -127, 9, 91,
+    64, 12, -21, -26, -91, 12, 13, -26, -17, 95, -14, -63, 66, -42, 58, 2,
+    78, -40, 0, -34, 127, -47, -25, 16, 24, -41, -95, -127, -127, -60, 11, -47,
+    5, -59, -36, 48, -94, -127, -127, -26, 3, -8, 48, -127, 17, 48, -31, 41,
+    -14, -26, 32, 23, 127, 38, 9, -19, -72, 1, -127, 96, -127, 46, 12, -45,
+    1, 41, 12, 36, -23, 23, 24, -17, 18, -16, -20, 8, -7, 34, -25, -3,
+    -29, 29, 3, -30, 8, 9, -13, 4, -29, -22, -1, 7, -11, -51, -3, 7,
+    13, -12, -116, 1, -29, -48, -23, -7, 0, 71, 19, -127, 0, -56, 17, -4,
+    -19, -5, -14, -11, 23, 14, 3, 56, 3, 57, 24, -52, -41, 8, -7, -1,
+    11, -1, 1, -7, 31, 8, 5, -19, -5, 1, -4, -1, -23, -62, -25, -28,
+    -16, 23, -4, 34, 14, -18, -20, 2, -19, 18, -43, -20, -55, -8, 6, 71,
+    6, -76, 28, -48, 25, 44, -127, -60, -59, -49, 10, 85, 7, -4, -10, -6,
+    127, -23, 19, 9, 11, -54, 40, -11, 30, 57, 18, 44, -127, 107, 11, 127,
+    -14, -66, -23, -38, 19, 24, 55, 127, -21, -127, -15, -71, -5, 127, -16, 14,
+    93, -13, -53, 127, -24, 21, 64, 22, 17, 39, 4, 35, -39, -26, -32, -21,
+    18, -84, 116, 60, 106, -100, -43, -27, -49, -7, -110, 26, -3, 127, -23, 16,
+    1, -27, -71, 82, 17, -79, 9, -32, -17, 0, 43, 86, 110, 27, 20, -79,
+    127, -18, -127, -127, 127, 127, -74, 127, 127, -127, 127, -127, 127, 127, 127, -127,
+    -115, -94, -127, 105, 127, -127, 127, 127, 127, 127, -8, 127, 18, 29, -127, -88,
+    -127, -127, -31, -127, 127, 127, 127, -99, 127, -45, -108, -17, -127, -1, -127, 127,
+    63, -127, -127, -99, -85, 127, -127, 127, 127, -15, -127, 68, 57, -127, -127, 127,
+    127, -127, -127, -127, -71, -27, 104, 127, 127, -127, 127, 98, 127, 125, 127, 127,
+    127, -127, 127, 43, -65, 127, 127, 127, -46, -99, 75, -127, 26, -127, 127, -65,
+    -7, 127, 36, -31, 1, 6, -121, -80, -66, -33, -30, 72, 3, -20, 10, -6,
+    -35, 127, 47, -127, -13, -49, -34, -17, 18, 56, -17, 14, -124, -119, 17, -44,
+    -22, -48, -79, -5, 32, 27, 20, -25, 16, 88, 127, -41, -1, -97, -32, 17,
+    -127, 61, -33, -2, -19, 7, 64, -25, 21, 114, 7, -63, 53, -35, -22, -34,
+    11, -62, 21, -2, -127, 80, 30, -44, -80, 2, 5, 8, -114, 23, -41, 47,
+    -25, -36, 18, -127, -43, -65, 8, -35, -3, 127, -37, 33, -92, 26, 16, -61,
+    0, -17, 17, 9, -19, -1, 28, -8, 18, 2, -24, 2, 7, 39, -35, -2,
+    13, -11, -1, 11, 9, 9, -26, 8, 2, -10, -12, 1, -16, 22, 11, 29,
+    2, 35, -127, -12, -18, -17, -19, 31, -7, -19, -6, -54, 4, 32, 11, -6,
+    17, -12, 46, 11, -16, -16, 19, 69, -1, -51, 30, 4, 55, 9, 32, -7,
+    -1, 8, 25, -5, 51, 36, 8, -26, -4, -1, -18, -3, 3, 13, -37, -10,
+    -33, 4, -32, -3, -19, -25, -24, -7, 24, -12, 5, -7, 7, -4, -24, 69,
+    0, 34, 22, 18, 18, -25, -39, 25, -47, -36, -88, -34, 36, -38, -20, -9,
+    -44, -4, 51, 20, 18, -43, 11, -22, 119, 34, -90, -10, 99, 91, 27, -39,
+    55, 114, -49, -17, -35, 12, 18, -39, 2, -62, -28, -50, 55, 18, 19, 35,
+    -17, 115, 124, -5, -2, -95, -36, -9, 4, -127, -91, 82, 72, -34, 114, -40,
+    24, -94, -31, -4, 124, 58, 37, -42, 16, 5, 5, 1, 12, 15, -36, 16,
+    -30, -38, -21, -2, -41, 32, 13, -40, 127, -24, 52, 18, 90, 30, 9, -109,
+    -2, 24, 12, -5, 17, 4, 32, -20, 26, -15, -31, 17, 21, -52, -4, -5,
+    -9, 17, 77, -33, 4, 8, 4, -28, -2, -21, -16, 1, 4, 6, 9, -26,
+    -5, 21, -60, -4, -15, -32, -27, 0, -3, 4, 25, -4, 2, -45, 21, 1,
+    -70, 31, 46, -5, -23, -13, 1, -21, 8, -36, 38, 38, 36, 19, 24, 13,
+    8, 38, -1, -6, -2, -23, -18, -15, 3, 20, 3, 3, -21, -95, 13, -21,
+    6, 11, -7, 0, -18, 4, 40, -17, 22, 3, 33, -11, 23, -5, -19, -56,
+};
+
+const int32_t bn5_dw_bias[96] = {
+    -11538, -936, 12704, 415, -8494, -6511, 46946, 4415,
+    18213, 55588, 27001, 7768, -13379, -10278, -2885, 9834,
+    11, -1500, -406, 1196, -5118, 19966, -362, 7679,
+    -8039, -13494, -2256, 780, 12424, -156, 3148, -2104,
+    1315, 4488, 14995, 12877, 5340, -20983, -4492, 855,
+    -4941, -1642, 584, 6405, 10, 299, -72, -8691,
+    -2039, -1337, 756, -256, -1265, -508, 1969, 1146,
+    -11444, 2379, 8062, 856, 328, 28071, 646, 6061,
+    -13204, 20297, 76, -5785, -262, 15665, -305, 83,
+    -2708, 7216, -1036, 283, 624, -2641, -275, -14848,
+    -8253, 5940, -5009, -1552, 526, 148, -1012, 14322,
+    -59, -344, 439, 10, 1075, 1561, -3226, 22323,
+};
+
+const int32_t bn5_dw_input_offset = -128;
+
+const int32_t bn5_dw_output_offset = -128;
+
+const int32_t bn5_dw_output_multiplier[96] = {
+    1357819264, 2063224832, 1563453312, 1691585152, 1403596416, 1888716544, 1996247040, 1976820608,
+    1286908032, 1798745856, 1899918080, 1907482880, 1504499456, 1766173440, 1650989824, 1142927744,
+    1959646336, 1123600640, 1792563456, 1252432896, 1474313600, 1485566336, 1086487040, 2142157952,
+    1757417600, 1870777344, 1215339520, 1920407296, 1390123136, 1328939776, 1430372480, 2053355520,
+    1406576256, 1222020352, 2065108992, 1117178880, 1257626880, 1283895296, 1530953984, 1134094720,
+    1187545728, 1835607168, 2005936896, 1739556736, 1282625280, 1677765632, 1775229696, 2119056384,
+    1326533888, 1249056256, 1424990848, 2140637312, 1091508608, 1104788480, 2108970496, 1566152704,
+    1276849792, 1865463296, 1260484480, 1462477824, 1368005888, 1701160960, 1658374912, 1093974656,
+    1646069888, 1126726528, 1867966336, 1496681984, 1793303296, 1399466112, 2140528768, 1480618112,
+    2124238080, 1677288448, 1098553216, 1743901440, 1197468032, 2140720640, 2111273472, 1589215744,
+    1725386368, 1601740160, 1532683520, 1242471296, 1736454144, 1551742592, 1564285696, 1337897344,
+    1836381184, 1553991040, 1181952128, 1505729408, 1534634368, 1204528512, 1543223680, 1635502848,
+};
+
+const int32_t bn5_dw_output_shift[96] = {
+    -5, -7, -6, -5, -6, -7, -8, -7,
+    -6, -8, -7, -6, -6, -6, -7, -5,
+    -7, -6, -7, -5, -7, -7, -6, -7,
+    -7, -7, -6, -7, -7, -6, -6, -7,
+    -6, -6, -8, -6, -6, -4, -5, -5,
+    -6, -7, -7, -7, -5, -7, -6, -7,
+    -7, -6, -6, -6, -6, -6, -6, -7,
+    -6, -7, -6, -6, -7, -6, -6, -5,
+    -6, -7, -6, -5, -7, -7, -7, -5,
+    -6, -4, -6, -6, -6, -7, -6, -6,
+    -6, -6, -7, -5, -7, -6, -7, -6,
+    -7, -6, -6, -5, -7, -4, -6, -8,
+};
+
+alignas(4) const int8_t bn5_pr_ifmap[38400] = {
+    -122, -81, -52, -128, -125, -128, 40, -50, 127, 51, 59, -128, -128, -128, -128, 2,
+    -128, -128, -128, -128, -106, -20, -76, -83, -54, -128, -128, -28, -58, -128, -128, -128,
+    -128, -128, -89, -68, 14, -128, -128, -128, -91, -128, -83, -101, -128, -126, -128, -128,
+    -128, -70, -128, -128, -128, -128, -128, -121, -128, -128, -128, -87, -116, -46, -31, 11,
+    49, -128, -128, -128, -128, 3, -7, -124, -32, -128, -21, -96, -128, -128, -93, -128,
+    -67, -75, 3, -128, -128, -126, -128, 18, -122, -128, -1, -128, -128, -124, -86, -65,
+    -128, -108, -57, -128, -128, -128, 38, -111, 43, 53, 59, 16, -128, -128, -128, -6,
+    -128, -128, -128, -127, -70, -20, -39, -82, -51, -89, -128, -13, -99, -128, -128, -128,
+    -128, -128, -115, -87, 5, -86, -128, -128, -96, -128, -123, -113, -128, -126, -128, -128,
+    -128, -92, -128, -83, -128, -128, -97, -121, -94, -128, -125, -87, -125, -81, -4, 12,
+    58, -128, -104, -128, -44, -23, -56, -128, -128, -128, -128, -100, -118, -128, -128, -128,
+    -128, -80, -107, -128, -128, -126, -128, -22, -125, -128, 38, -125, -83, -128, -45, -60,
+    -128, -112, -39, -128, -128, -128, 35, -108, 41, 54, 59, 7, -128, -128, -128, -8,
+    -128, -128, -128, -127, -68, -20, -38, -82, -55, -74, -128, -22, -109, -128, -128, -128,
+    -128, -128, -72, -88, 7, -78, -128, -128, -105, -128, -126, -125, -128, -126, -128, -128,
+    -128, -91, -128, -93, -128, -128, -100, -121, -93, -128, -125, -86, -122, -84, 0, 12,
+    52, -128, -127, -128, -48, -20, -51, -128, -128, -128, -125, -104, -119, -128, -128, -128,
+    -128, -79, -119, -128, -128, -126, -128, -25, -120, -128, 36, -128, -88, -128, -40, -62,
+    -128, -112, -39, -128, -128, -128, 34, -108, 41, 54, 59, 7, -128, -128, -128, -8,
+    -128, -128, -128, -127, -68, -20, -38, -82, -54, -75, -128, -23, -108, -128, -128, -128,
+    -128, -128, -72, -88, 8, -77, -128, -128, -104, -128, -125, -125, -128, -126, -128, -128,
+    -128, -92, -128, -92, -128, -128, -99, -121, -93, -128, -126, -86, -122, -83, -1, 12,
+    52, -128, -128, -128, -48, -20, -51, -128, -128, -128, -126, -104, -119, -128, -128, -128,
+    -128, -79, -117, -128, -128, -126, -128, -25, -119, -128, 37, -128, -88, -128, -40, -62,
+    -128, -112, -39, -128, -128, -128, 34, -108, 41, 54, 59, 7, -128, -128, -128, -8,
+    -128, -128, -128, -127, -68, -20, -38, -82, -54, -75, -128, -23, -108, -128, -128, -128,
+    -128, -128, -72, -88, 8, -77, -128, -128, -104, -128, -125, -125, -128, -126, -128, -128,
+    -128, -91, -128, -92, -128, -128, -99, -121, -93, -128, -126, -86, -122, -83, -1, 12,
+    52, -128, -128, -128, -48, -20, -51, -128, -128, -128, -126, -104, -119, -128, -128, -128,
+    -128, -79, -117, -128, -128, -126, -128, -25, -119, -128, 37, -128, -88, -128, -40, -62,
+    -128, -112, -39, -128, -128, -128, 34, -108, 41, 54, 59, 7, -128, -128, -128, -8,
+    -128, -128, -128, -127, -68, -20, -38, -82, -54, -75, -128, -23, -108, -128, -128, -128,
+    -128, -128, -72, -88, 8, -77, -128, -128, -104, -128, -125, -125, -128, -126, -128, -128,
+    -128, -91, -128, -92, -128, -128, -99, -121, -93, -128, -126, -86, -122, -83, -1, 12,
+    52, -128, -128, -128, -48, -20, -51, -128, -128, -128, -126, -104, -119, -128, -128, -128,
+    -128, -79, -117, -128, -128, -126, -128, -25, -119, -128, 37, -128, -88, -128, -40, -62,
+    -128, -112, -39, -128, -128, -128, 34, -108, 41, 54, 59, 7, -128, -128, -128, -8,
+    -128, -128, -128, -127, -68, -20, -38, -82, -54, -75, -128, -23, -108, -128, -128, -128,
+    -128, -128, -72, -88, 8, -77, -128, -128, -104, -128, -125, -125, -128, -126, -128, -128,
+    -128, -91, -128, -92, -128, -128, -99, -121, -93, -128, -126, -86, -122, -83, -1, 12,
+    52, -128, -128, -128, -48, -20, -51, -128, -128, -128, -126, -104, -119, -128, -128, -128,
+    -128, -79, -117, -128, -128, -126, -128, -25, -119, -128, 37, -128, -88, -128, -40, -62,
+    -128, -112, -38, -128, -128, -128, 36, -107, 41, 54, 59, 6, -128, -128, -128, -8,
+    -128, -128, -128, -128, -69, -20, -38, -82, -54, -74, -128, -22, -110, -127, -128, -128,
+    -128, -128, -72, -88, 8, -78, -128, -127, -103, -128, -124, -125, -128, -126, -128, -128,
+    -128, -91, -128, -92, -128, -128, -101, -121, -93, -128, -126, -86, -122, -83, -2, 13,
+    53, -128, -128, -128, -47, -19, -50, -128, -128, -128, -126, -104, -120, -128, -128, -128,
+    -128, -78, -117, -128, -128, -126, -128, -25, -119, -128, 36, -128, -89, -128, -40, -62,
+    -128, -113, -43, -128, -128, -128, 37, -110, 41, 54, 59, 9, -128, -128, -128, -4,
+    -128, -128, -128, -124, -65, -20, -37, -81, -57, -70, -128, -17, -109, -127, -128, -128,
+    -128, -128, -72, -88, 9, -83, -128, -125, -99, -128, -124, -125, -128, -126, -128, -128,
+    -128, -91, -128, -92, -128, -128, -97, -121, -91, -128, -128, -87, -122, -89, -4, 9,
+    60, -128, -128, -128, -49, -20, -52, -128, -128, -128, -126, -103, -120, -128, -128, -128,
+    -128, -77, -117, -128, -128, -126, -128, -26, -118, -128, 37, -128, -88, -128, -45, -62,
+    -128, -112, -39, -128, -128, -128, 39, -107, 41, 54, 59, 5, -128, -128, -128, -4,
+    -128, -128, -128, -125, -67, -20, -36, -82, -58, -73, -128, -17, -110, -128, -128, -128,
+    -128, -128, -72, -87, 8, -82, -128, -128, -98, -128, -124, -125, -128, -126, -128, -128,
+    -128, -94, -128, -90, -128, -128, -100, -121, -89, -128, -126, -88, -123, -87, -5, 10,
+    59, -128, -128, -128, -49, -20, -55, -128, -128, -128, -127, -102, -119, -128, -128, -128,
+    -128, -76, -117, -128, -128, -126, -128, -25, -124, -128, 37, -128, -89, -128, -45, -62,
+    -128, -111, -38, -128, -128, -128, 39, -109, 41, 54, 59, 7, -128, -128, -128, -4,
+    -128, -128, -128, -128, -67, -20, -37, -83, -57, -66, -128, -18, -107, -128, -128, -128,
+    -128, -128, -72, -87, 7, -86, -128, -128, -99, -128, -124, -125, -128, -126, -128, -128,
+    -128, -91, -128, -92, -128, -128, -98, -121, -88, -128, -128, -88, -122, -96, -1, 9,
+    61, -128, -128, -128, -45, -20, -52, -128, -128, -128, -126, -102, -120, -128, -128, -128,
+    -128, -76, -118, -128, -128, -126, -128, -24, -125, -128, 37, -128, -91, -128, -49, -62,
+    -128, -108, -40, -128, -128, -128, 39, -106, 39, 54, 59, 7, -128, -128, -128, -6,
+    -128, -128, -128, -126, -66, -20, -35, -81, -52, -71, -128, -17, -110, -128, -128, -128,
+    -128, -128, -72, -86, 7, -83, -128, -128, -101, -128, -128, -125, -128, -126, -128, -128,
+    -128, -89, -128, -93, -128, -128, -99, -121, -90, -128, -125, -88, -122, -93, -3, 13,
+    64, -128, -127, -128, -43, -20, -53, -128, -128, -128, -126, -102, -121, -128, -128, -128,
+    -128, -76, -119, -128, -128, -126, -128, -26, -128, -128, 36, -128, -93, -128, -47, -62,
+    -128, -110, -34, -128, -128, -128, 39, -111, 46, 54, 59, 7, -128, -128, -128, -6,
+    -128, -128, -128, -128, -70, -20, -39, -79, -59, -72, -128, -21, -106, -128, -128, -128,
+    -128, -128, -72, -84, 8, -95, -128, -126, -98, -128, -121, -124, -128, -126, -128, -128,
+    -128, -94, -128, -91, -128, -128, -101, -121, -88, -128, -128, -91, -122, -91, -9, 5,
+    58, -128, -127, -128, -46, -19, -55, -128, -128, -128, -126, -104, -119, -128, -128, -128,
+    -128, -77, -121, -128, -128, -126, -128, -21, -128, -128, 31, -128, -91, -128, -54, -62,
+    -128, -112, -34, -128, -128, -128, 38, -107, 39, 54, 59, 7, -128, -128, -128, -6,
+    -128, -128, -128, -127, -72, -20, -36, -77, -44, -77, -128, -17, -119, -128, -128, -128,
+    -128, -128, -72, -82, 17, -92, -128, -128, -98, -128, -127, -125, -128, -126, -128, -128,
+    -128, -78, -128, -92, -128, -128, -105, -121, -91, -128, -128, -95, -121, -85, -33, 12,
+    53, -128, -122, -128, -36, -23, -59, -128, -128, -128, -126, -103, -117, -128, -128, -128,
+    -128, -78, -122, -128, -128, -126, -128, -20, -121, -128, 21, -128, -94, -128, -47, -65,
+    -128, -114, -32, -128, -128, -128, 37, -107, 36, 54, 59, 5, -128, -128, -128, -7,
+    -128, -128, -128, -128, -70, -20, -42, -76, -38, -75, -128, -17, -122, -128, -128, -128,
+    -128, -128, -72, -80, 21, -94, -128, -127, -96, -128, -125, -124, -128, -126, -128, -128,
+    -128, -87, -128, -93, -128, -128, -107, -121, -90, -128, -112, -95, -122, -80, -53, 10,
+    44, -128, -122, -128, -41, -28, -51, -128, -128, -128, -124, -103, -119, -128, -128, -128,
+    -128, -80, -123, -128, -128, -126, -128, -15, -103, -128, 19, -128, -85, -128, -49, -65,
+    -128, -110, -37, -128, -128, -128, 36, -106, 43, 54, 59, 4, -128, -128, -128, -6,
+    -128, -128, -128, -124, -68, -20, -36, -78, -36, -73, -128, -17, -116, -128, -128, -128,
+    -128, -128, -72, -80, 18, -92, -128, -125, -96, -128, -126, -124, -128, -126, -128, -128,
+    -128, -96, -128, -91, -128, -128, -100, -121, -88, -128, -128, -94, -122, -78, -45, 13,
+    47, -128, -128, -128, -50, -28, -42, -128, -128, -128, -127, -104, -121, -127, -128, -128,
+    -128, -77, -120, -128, -128, -126, -128, -18, -111, -128, 25, -128, -81, -128, -47, -61,
+    -128, -107, -35, -128, -128, -128, 36, -111, 41, 54, 59, 8, -128, -128, -128, -5,
+    -128, -128, -128, -128, -68, -20, -39, -78, -56, -67, -128, -15, -111, -128, -128, -128,
+    -128, -128, -72, -87, 19, -96, -128, -128, -102, -128, -125, -125, -128, -126, -128, -128,
+    -128, -83, -128, -95, -128, -128, -100, -121, -91, -128, -128, -94, -122, -97, -26, 9,
+    52, -128, -128, -128, -47, -24, -51, -128, -128, -128, -126, -104, -119, -128, -128, -128,
+    -128, -76, -122, -128, -128, -126, -128, -23, -122, -128, 25, -128, -88, -128, -47, -66,
+    -128, -108, -39, -128, -128, -128, 38, -111, 36, 54, 59, 4, -128, -128, -128, -7,
+    -128, -128, -128, -119, -66, -20, -35, -77, -47, -85, -128, -16, -116, -128, -128, -128,
+    -128, -128, -72, -85, 21, -88, -128, -128, -102, -128, -128, -125, -128, -126, -128, -128,
+    -128, -83, -128, -89, -128, -128, -102, -121, -93, -128, -122, -97, -125, -73, -38, 11,
+    54, -128, -122, -128, -57, -26, -54, -128, -128, -128, -126, -102, -112, -128, -128, -128,
+    -128, -76, -121, -128, -128, -126, -128, -18, -115, -128, 23, -128, -76, -128, -42, -64,
+    -128, -102, -55, -128, -128, -128, 39, -101, 57, 52, 55, 31, -128, -128, -128, -18,
+    -128, -128, -128, -128, -73, -20, -44, -72, -36, -109, -128, -24, -99, -128, -128, -128,
+    -128, -128, -85, -81, 17, -90, -128, -128, -121, -128, -128, -125, -128, -126, -128, -128,
+    -128, -106, -128, -97, -128, -128, -106, -123, -100, -128, -128, -96, -108, -67, -35, 7,
+    53, -128, -128, -128, -21, -38, -38, -128, -128, -128, -126, -99, -117, -128, -128, -128,
+    -128, -71, -127, -128, -128, -126, -128, -29, -112, -128, 21, -126, -99, -128, -26, -70,
+    -128, -128, -12, -128, -128, -128, 41, -39, 109, 45, 48, -128, -128, -86, -128, -28,
+    -128, -128, -128, 117, -128, -20, -13, -66, -81, -128, -128, -55, -74, -102, -128, -128,
+    -128, -128, -80, -94, -3, -68, -128, 14, -106, -128, -128, -113, -128, -126, -128, -128,
+    -57, -128, -128, -58, -128, -128, -128, -122, -115, -128, -128, -109, -104, -49, -46, 18,
+    -103, -128, -128, -128, 74, -54, -80, -128, -7, -128, -128, -87, 8, -128, -128, -128,
+    -73, -65, -128, 8, -128, -126, -119, 50, -97, -128, 20, -128, -48, -22, -128, -66,
+    -128, -68, 65, -128, -98, -128, 43, -42, 1, 52, -54, -128, -128, -124, -100, 11,
+    -128, -128, -127, -128, -80, -60, -128, -54, -128, -98, -128, -23, -16, -128, -128, -128,
+    -79, 31, -83, -128, -35, -128, -128, -128, -62, -104, -80, -128, -128, -128, -128, -128,
+    -128, -128, 9, -128, -74, -128, -128, -121, -123, -128, -128, -82, -128, -128, -103, -55,
+    53, -128, -128, -128, -128, -55, -128, -128, -41, -128, -2, -94, -128, -128, -99, -128,
+    -63, -60, 4, -128, -128, -80, -128, 12, -128, -117, -128, -128, -128, -43, -128, -64,
+    -128, -118, 53, -128, -128, -128, 44, -98, -72, 53, -79, -43, -128, -128, -103, 10,
+    -122, -128, -127, -109, -38, -58, -128, -52, -128, -31, -128, 3, -81, -128, -128, -123,
+    -118, 45, -81, -128, -48, -128, -128, -119, -83, -113, -128, -128, -128, -120, -106, -128,
+    -101, -128, 84, -120, -67, -128, -120, -121, -95, -117, -128, -61, -128, -128, -118, -64,
+    104, -128, -90, -95, -128, -128, -128, -128, -128, -128, -123, -85, -118, -128, -128, -128,
+    -128, -68, -90, -128, -128, -117, -128, -28, -128, -115, -109, -128, -128, -44, -106, -64,
+    -128, -120, 59, -128, -128, -128, 45, -91, -71, 54, -74, -50, -128, -128, -92, 10,
+    -119, -128, -128, -116, -28, -54, -128, -49, -128, -11, -128, -4, -85, -128, -128, -107,
+    -117, 39, -72, -128, -50, -128, -128, -117, -83, -114, -128, -128, -128, -123, -113, -128,
+    -113, -128, 91, -120, -68, -128, -120, -121, -98, -118, -128, -63, -128, -128, -124, -65,
+    94, -128, -122, -98, -128, -128, -128, -128, -128, -128, -124, -88, -120, -128, -128, -128,
+    -128, -63, -96, -128, -128, -116, -128, -25, -128, -109, -105, -128, -128, -55, -97, -62,
+    -128, -119, 61, -128, -128, -128, 45, -92, -71, 54, -72, -50, -128, -128, -97, 10,
+    -119, -128, -128, -116, -26, -55, -128, -49, -128, -8, -128, -5, -86, -128, -128, -110,
+    -116, 40, -72, -128, -51, -128, -128, -113, -84, -114, -128, -128, -128, -124, -114, -128,
+    -111, -128, 86, -125, -68, -128, -120, -121, -99, -118, -128, -63, -128, -128, -122, -65,
+    93, -128, -121, -99, -128, -128, -128, -128, -128, -128, -128, -88, -121, -128, -128, -128,
+    -128, -63, -94, -128, -128, -114, -128, -27, -128, -109, -106, -128, -128, -48, -96, -62,
+    -128, -119, 61, -128, -128, -128, 45, -92, -71, 54, -73, -50, -128, -128, -98, 10,
+    -118, -128, -128, -115, -26, -55, -128, -49, -128, -8, -128, -5, -86, -128, -128, -111,
+    -115, 40, -72, -128, -51, -128, -128, -113, -83, -114, -128, -128, -128, -123, -114, -128,
+    -111, -128, 86, -125, -68, -128, -120, -121, -99, -118, -128, -63, -128, -128, -121, -65,
+    93, -128, -121, -99, -128, -128, -128, -128, -128, -128, -128, -88, -121, -128, -128, -128,
+    -128, -63, -94, -128, -128, -114, -128, -27, -128, -109, -106, -128, -128, -49, -96, -62,
+    -128, -119, 61, -128, -128, -128, 45, -92, -70, 54, -74, -51, -128, -128, -98, 10,
+    -118, -128, -128, -116, -26, -54, -128, -50, -128, -8, -128, -5, -86, -128, -128, -111,
+    -115, 41, -72, -128, -51, -128, -128, -112, -83, -114, -128, -128, -128, -123, -114, -128,
+    -112, -128, 87, -125, -68, -128, -120, -121, -99, -118, -128, -62, -128, -128, -121, -65,
+    93, -128, -121, -99, -128, -128, -128, -128, -128, -128, -128, -88, -121, -128, -128, -128,
+    -128, -63, -93, -128, -128, -114, -128, -27, -128, -109, -106, -128, -128, -49, -96, -62,
+    -128, -119, 61, -128, -128, -128, 45, -92, -71, 54, -74, -50, -128, -128, -99, 10,
+    -118, -128, -128, -116, -26, -54, -128, -50, -128, -9, -128, -5, -86, -128, -128, -111,
+    -116, 40, -72, -128, -51, -128, -128, -112, -83, -114, -128, -128, -128, -123, -114, -128,
+    -111, -128, 86, -125, -68, -128, -120, -121, -99, -119, -128, -61, -128, -128, -121, -65,
+    93, -128, -121, -99, -128, -128, -128, -128, -128, -128, -128, -88, -121, -128, -128, -128,
+    -128, -64, -93, -128, -128, -114, -128, -27, -128, -108, -106, -128, -128, -49, -96, -62,
+    -128, -121, 60, -128, -128, -128, 45, -92, -70, 54, -73, -51, -128, -128, -98, 10,
+    -119, -128, -128, -118, -25, -55, -128, -50, -128, -8, -128, -5, -87, -128, -128, -111,
+    -115, 40, -72, -128, -51, -128, -128, -112, -83, -114, -128, -128, -128, -124, -115, -128,
+    -111, -128, 88, -125, -68, -128, -120, -121, -99, -118, -128, -61, -128, -128, -122, -65,
+    94, -128, -121, -99, -128, -128, -128, -128, -128, -128, -128, -88, -122, -128, -128, -128,
+    -128, -64, -93, -128, -128, -114, -128, -27, -128, -108, -107, -128, -128, -51, -97, -62,
+    -128, -116, 65, -128, -128, -128, 44, -92, -71, 54, -73, -48, -128, -128, -97, 9,
+    -116, -128, -128, -114, -26, -55, -128, -53, -128, -11, -128, -5, -87, -128, -128, -114,
+    -118, 44, -72, -128, -49, -128, -128, -110, -82, -113, -128, -128, -128, -128, -114, -128,
+    -108, -128, 88, -125, -65, -128, -117, -121, -97, -115, -128, -61, -128, -128, -124, -64,
+    93, -128, -122, -102, -128, -128, -128, -128, -128, -128, -128, -89, -126, -128, -128, -128,
+    -128, -63, -93, -128, -128, -113, -128, -26, -128, -109, -107, -128, -128, -31, -102, -62,
+    -128, -124, 66, -128, -128, -128, 44, -93, -75, 54, -84, -54, -128, -128, -105, 4,
+    -107, -128, -128, -116, -29, -53, -128, -57, -128, -18, -128, -7, -92, -128, -128, -118,
+    -108, 66, -72, -128, -43, -128, -128, -123, -77, -112, -128, -128, -128, -128, -106, -128,
+    -99, -128, 96, -128, -63, -125, -128, -126, -96, -110, -128, -66, -128, -128, -121, -64,
+    99, -128, -116, -106, -128, -128, -128, -128, -128, -128, -128, -91, -113, -128, -128, -128,
+    -128, -63, -87, -128, -128, -105, -128, -28, -128, -104, -104, -128, -128, -71, -90, -62,
+    -128, -111, 57, -128, -128, -128, 44, -93, -76, 54, -104, -45, -128, -128, -109, 0,
+    -108, -128, -128, -128, -21, -57, -128, -48, -128, -17, -128, -4, -84, -128, -128, -117,
+    -98, 106, -72, -128, -46, -128, -128, -113, -83, -128, -125, -128, -128, -122, -103, -128,
+    -102, -128, 118, -121, -65, -128, -118, -123, -94, -126, -128, -69, -128, -128, -128, -64,
+    109, -128, -122, -97, -128, -128, -128, -128, -128, -128, -127, -90, -128, -128, -128, -128,
+    -128, -57, -84, -128, -128, -98, -128, -19, -128, -100, -104, -128, -128, -58, -88, -62,
+    -128, -94, 62, -128, -128, -128, 44, -87, -51, 54, -107, -55, -128, -128, -122, 0,
+    -120, -128, -128, -115, -34, -56, -128, -47, -128, -20, -128, -3, -105, -128, -128, -113,
+    -111, 102, -72, -128, -47, -128, -128, -88, -69, -119, -128, -128, -128, -126, -94, -128,
+    -98, -128, 127, -126, -64, -128, -115, -107, -80, -128, -128, -67, -128, -128, -128, -64,
+    118, -128, -116, -106, -128, -128, -128, -128, -128, -128, -128, -90, -115, -128, -128, -128,
+    -128, -68, -72, -128, -128, -115, -128, -14, -128, -115, -106, -127, -128, -56, -74, -62,
+    -128, -115, 64, -128, -128, -128, 44, -105, -103, 54, -111, -37, -128, -128, -106, -3,
+    -110, -128, -128, -128, -34, -56, -128, -53, -128, -35, -128, -10, -89, -128, -128, -122,
+    -85, 114, -72, -128, -48, -128, -128, -128, -81, -113, -128, -128, -128, -113, -92, -128,
+    -107, -128, 127, -128, -59, -128, -122, -121, -90, -128, -128, -73, -128, -128, -123, -62,
+    107, -128, -118, -107, -128, -128, -128, -128, -128, -128, -118, -90, -116, -128, -128, -128,
+    -128, -56, -87, -128, -128, -97, -128, -17, -128, -115, -95, -128, -128, -78, -72, -63,
+    -128, -128, 54, -128, -118, -128, 44, -100, -45, 54, -108, -54, -128, -128, -128, -3,
+    -128, -124, -128, -105, -59, -66, -128, -43, -128, -61, -128, -22, -110, -128, -128, -106,
+    -109, 48, -108, -128, -86, -128, -128, -90, -80, -113, -128, -128, -128, -80, -118, -128,
+    -122, -128, 85, -107, -66, -128, -119, -124, -69, -128, -128, -64, -128, -128, -56, -64,
+    82, -128, -128, -116, -128, -128, -128, -128, -128, -128, -128, -100, -103, -128, -128, -128,
+    -128, -60, -51, -128, -128, -128, -128, -21, -128, -128, -95, -106, -128, -87, -56, -65,
+    -128, -128, 46, -128, -128, -128, 44, -78, -67, 54, -67, -71, -128, -128, -128, -12,
+    -128, -128, -128, -118, -78, -9, -128, -46, -128, -60, -128, -24, -115, -128, -128, -116,
+    -128, -56, -115, -128, -108, -128, -128, -128, -117, -111, -126, -128, -128, -108, -128, -128,
+    -119, -128, 18, -107, -61, -128, -128, -122, -95, -128, -125, -61, -122, -128, -50, -64,
+    40, -128, -127, -105, -128, -128, -128, -128, -128, -128, -119, -101, -128, -128, -128, -128,
+    -128, -71, -79, -128, -128, -128, -128, -24, -128, -115, -110, -118, -128, -76, -68, -65,
+    -128, -119, 52, -128, -128, -128, 45, -89, -67, 54, -67, -73, -128, -128, -128, 5,
+    -121, -128, -128, -89, -63, -34, -128, -57, -128, -37, -128, -16, -115, -128, -128, -109,
+    -128, -66, -128, -128, -88, -128, -128, -89, -112, -114, -118, -128, -128, -128, -120, -128,
+    -112, -128, 18, -128, -62, -128, -110, -114, -93, -128, -128, -64, -126, -128, -59, -65,
+    43, -128, -128, -108, -128, -128, -128, -128, -128, -128, -128, -91, -128, -128, -128, -128,
+    -128, -65, -90, -128, -128, -114, -128, -46, -128, -122, -113, -128, -128, -27, -93, -66,
+    -128, -124, 73, -128, -128, -128, 44, -117, -85, 54, -76, -30, -128, -128, -122, 11,
+    -95, -128, -128, -128, -53, -63, -128, -49, -128, -27, -128, -30, -94, -128, -128, -108,
+    -115, -27, -114, -128, -85, -128, -128, -128, -82, -114, -128, -128, -128, -115, -107, -128,
+    -122, -128, 39, -128, -72, -128, -107, -121, -83, -128, -128, -56, -128, -128, -75, -64,
+    59, -128, -127, -115, -128, -128, -128, -128, -128, -128, -128, -91, -107, -128, -128, -128,
+    -128, -62, -93, -128, -128, -104, -128, -26, -128, -128, -100, -128, -128, -81, -102, -65,
+    -128, -128, 43, -128, -128, -128, 44, -76, -61, 54, -67, -79, -128, -128, -128, 2,
+    -128, -122, -128, -117, -73, -28, -128, -52, -128, -70, -128, -26, -128, -128, -128, -114,
+    -128, -73, -97, -128, -99, -128, -128, -100, -86, -115, -128, -128, -128, -118, -128, -128,
+    -121, -128, 4, -116, -55, -128, -125, -124, -81, -128, -115, -59, -128, -128, -26, -64,
+    61, -128, -128, -115, -128, -128, -128, -128, -128, -128, -121, -99, -112, -128, -128, -128,
+    -128, -66, -83, -128, -128, -128, -128, -44, -128, -126, -100, -99, -128, -71, -81, -68,
+    -128, -128, 33, -128, -128, -128, 44, -97, -69, 53, -64, -37, -128, -128, -128, 1,
+    -128, -128, -128, -128, -65, -36, -128, -38, -128, -70, -109, -27, -89, -128, -128, -125,
+    -128, -61, -128, -128, -88, -128, -128, -99, -118, -114, -128, -128, -128, -128, -127, -128,
+    -94, -128, -3, -128, -65, -128, -113, -127, -105, -128, -128, -69, -121, -128, -62, -61,
+    47, -128, -128, -108, -128, -128, -128, -128, -128, -128, -120, -96, -124, -128, -128, -128,
+    -128, -67, -100, -128, -128, -110, -128, -41, -128, -124, -111, -128, -127, -38, -87, -58,
+    -128, -128, 62, -128, -128, -128, 43, -27, -7, 48, -20, -128, -128, -128, -128, -2,
+    -115, -128, -128, 127, -108, -42, -128, -71, -128, -87, -91, -74, -57, -128, -128, -98,
+    -114, -34, -116, -128, -82, -128, -128, 36, -97, -128, -128, -120, -128, -114, -128, -128,
+    -25, -128, -16, -66, -66, -128, -128, -104, -105, -128, -128, -91, -128, -128, -90, -58,
+    -92, -128, -128, -77, -100, -128, -128, -128, 18, -128, -128, -114, 32, -128, -107, -128,
+    -78, -65, -104, -54, -128, -120, -128, 70, -128, -128, -76, -128, -98, -77, -128, -69,
+    -128, -33, 34, -28, -123, -128, 47, -81, -40, 54, 91, -128, -128, -128, -128, -128,
+    -128, -82, -115, -128, -55, -128, -128, -50, -128, -65, -52, -104, -119, -125, -116, -128,
+    -128, -110, -79, -128, -125, -128, -128, -128, -29, -128, -81, -89, -128, -128, -76, -128,
+    -128, -108, -60, -128, 127, -114, -128, -121, -74, -68, -128, -128, -113, -128, -128, -26,
+    -128, -128, -128, -128, -128, -94, -128, -99, -73, -128, -35, -29, -94, -128, -97, -128,
+    -80, -102, -39, -128, -128, 11, -128, 89, -94, -114, -128, -113, -117, -82, -128, -63,
+    -128, -117, 64, -6, -102, -128, 46, -90, -61, 53, 113, -58, -128, -128, -128, -128,
+    -128, -97, -121, -105, -31, -128, -128, -32, -128, 11, -60, -97, -128, -126, -114, -78,
+    -128, -125, -98, -128, -128, -128, -128, -128, -128, -128, -125, -101, -128, -90, -62, -53,
+    -128, -125, -74, -128, 127, -101, -128, -121, -110, -39, -128, -128, -107, -128, -128, -60,
+    -128, -128, -89, -98, -128, -128, -128, -128, -119, -128, -100, 14, -124, -128, -128, -128,
+    -128, -126, -128, -128, -128, -128, -128, 40, -68, -106, -128, -104, -112, -37, -128, -68,
+    -128, -120, 92, -11, -104, -128, 52, -89, -66, 54, 118, -72, -128, -128, -128, -128,
+    -128, -128, -117, -125, 1, -128, -128, -41, -128, 43, -77, -98, -128, -128, -114, -128,
+    -128, -124, -72, -128, -128, -128, -128, -128, -128, -128, -128, -102, -128, -106, -59, -62,
+    -120, -113, -84, -117, 127, -102, -122, -121, -128, -41, -128, -128, -111, -128, -128, -69,
+    -128, -128, -128, -128, -110, -128, -128, -128, -121, -128, -114, 9, -124, -128, -128, -128,
+    -128, -115, -128, -128, -128, -128, -128, 36, -51, -94, -128, -124, -120, -13, -128, -69,
+    -128, -118, 102, -11, -104, -128, 52, -89, -67, 54, 120, -75, -128, -128, -128, -128,
+    -128, -128, -119, -128, 7, -128, -128, -41, -128, 50, -76, -98, -128, -128, -112, -128,
+    -128, -128, -72, -128, -128, -128, -128, -128, -128, -128, -128, -87, -128, -108, -57, -65,
+    -121, -117, -84, -109, 127, -102, -128, -121, -128, -41, -128, -128, -114, -128, -128, -71,
+    -128, -128, -128, -128, -104, -128, -128, -128, -120, -128, -127, 8, -123, -128, -128, -128,
+    -128, -112, -128, -128, -128, -128, -128, 37, -46, -93, -128, -123, -121, -11, -128, -65,
+    -128, -117, 102, -10, -104, -128, 52, -89, -66, 54, 120, -74, -128, -128, -128, -128,
+    -128, -128, -120, -128, 6, -128, -128, -42, -128, 50, -79, -98, -128, -128, -108, -128,
+    -128, -127, -72, -128, -128, -128, -128, -128, -128, -128, -128, -88, -128, -107, -60, -65,
+    -120, -121, -85, -112, 127, -99, -126, -121, -128, -41, -128, -128, -114, -128, -128, -69,
+    -128, -128, -128, -128, -103, -128, -128, -128, -118, -128, -128, 9, -125, -128, -126, -128,
+    -128, -109, -128, -128, -128, -128, -128, 39, -50, -93, -128, -123, -120, -15, -128, -66,
+    -128, -115, 100, -10, -105, -128, 51, -90, -68, 54, 118, -78, -128, -128, -128, -128,
+    -128, -128, -122, -126, 6, -128, -128, -43, -128, 51, -79, -98, -128, -128, -111, -128,
+    -128, -123, -72, -128, -128, -128, -128, -124, -128, -128, -128, -94, -128, -108, -62, -67,
+    -119, -123, -84, -110, 127, -100, -126, -121, -128, -40, -128, -128, -115, -128, -128, -73,
+    -128, -128, -128, -128, -108, -128, -128, -128, -123, -128, -128, 9, -125, -128, -125, -128,
+    -128, -112, -128, -128, -128, -128, -128, 40, -59, -95, -128, -124, -121, -14, -128, -65,
+    -128, -118, 91, -13, -107, -128, 50, -87, -66, 54, 110, -74, -128, -128, -128, -128,
+    -124, -128, -128, -128, 6, -128, -128, -41, -128, 54, -94, -98, -128, -128, -115, -128,
+    -128, -110, -72, -128, -128, -128, -128, -128, -128, -128, -128, -96, -128, -122, -71, -66,
+    -108, -111, -77, -115, 127, -95, -128, -121, -128, -41, -128, -128, -120, -128, -128, -74,
+    -128, -128, -128, -123, -104, -128, -128, -127, -120, -128, -126, 10, -123, -128, -123, -128,
+    -128, -113, -128, -128, -128, -128, -128, 37, -71, -93, -128, -124, -128, -18, -128, -64,
+    -128, -114, 74, -15, -105, -128, 52, -89, -70, 54, 94, -75, -128, -128, -128, -128,
+    -121, -128, -128, -128, 4, -128, -128, -47, -128, 53, -124, -98, -128, -128, -121, -128,
+    -125, -80, -72, -128, -128, -128, -128, -128, -128, -128, -128, -90, -128, -112, -80, -66,
+    -113, -128, -59, -109, 127, -89, -127, -121, -128, -41, -128, -128, -125, -128, -128, -38,
+    -128, -128, -128, -128, -102, -128, -128, -128, -116, -128, -128, 12, -126, -128, -128, -128,
+    -128, -107, -128, -128, -128, -118, -128, 33, -109, -91, -128, -123, -128, -64, -128, -65,
+    -128, -111, 56, -8, -102, -128, 42, -90, -72, 54, 71, -68, -128, -128, -128, -128,
+    -115, -128, -128, -127, 1, -128, -128, -45, -128, 56, -128, -98, -128, -128, -128, -128,
+    -128, -81, -72, -128, -128, -128, -128, -128, -128, -128, -128, -95, -128, -127, -82, -66,
+    -96, -128, -41, -114, 127, -101, -121, -121, -128, -53, -128, -128, -126, -128, -128, -31,
+    -128, -128, -128, -124, -102, -128, -128, -128, -121, -128, -128, 10, -118, -128, -128, -128,
+    -128, -109, -128, -128, -128, -128, -128, 27, -123, -108, -128, -127, -128, -66, -128, -72,
+    -128, -128, 47, 1, -102, -128, 48, -80, -78, 54, 22, -74, -128, -128, -119, -128,
+    -100, -99, -128, -128, -1, -128, -128, -38, -128, 11, -128, -99, -128, -128, -92, -128,
+    -128, -99, -112, -128, -128, -128, -128, -128, -128, -119, -128, -95, -128, -128, -92, -72,
+    -105, -128, -34, -114, 127, -128, -128, -128, -128, -84, -128, -128, -115, -128, -128, -31,
+    -128, -128, -128, -122, -110, -128, -128, -122, -111, -128, -121, 11, -83, -128, -128, -128,
+    -128, -90, -128, -128, -128, -126, -128, 35, -128, -104, -128, -128, -128, -52, -128, -63,
+    -128, -44, 44, 30, -98, -128, 46, -89, -38, 54, 20, -66, -128, -128, -128, -128,
+    -128, -128, -128, -128, 6, -128, -128, -28, -128, -3, -102, -98, -128, -109, -27, -111,
+    -128, -128, -128, -128, -128, -128, -128, 19, -128, -128, -103, -94, -128, -79, -103, -59,
+    -128, -128, -75, -128, 127, -128, -107, -98, -128, -128, -128, -119, -91, -128, -128, -31,
+    -128, -128, -128, -101, -128, -128, -128, -128, -128, -65, -112, 35, -128, -128, -75, -128,
+    -128, -98, -128, -128, -128, -122, -117, 43, -128, -84, -128, -105, -88, -56, -128, -66,
+    -128, -43, 44, 46, -88, -128, 45, -88, -100, 54, 39, -98, -128, -128, -128, -128,
+    -128, -102, -128, -77, -42, -128, -128, -50, -128, -47, -128, -98, -128, -101, -93, -106,
+    -128, -128, -128, -128, -128, -128, -128, -45, -128, -128, -108, -128, -128, -104, -114, -47,
+    -119, -128, -111, -88, 127, -128, -76, -94, -109, -128, -128, -104, -80, -128, -128, -31,
+    -128, -128, -128, -100, -128, -128, -128, -103, -128, -128, -128, 72, -124, -128, -128, -128,
+    -128, -105, -94, -128, -128, -128, -127, 22, -128, -128, -128, -128, -86, -57, -128, -79,
+    -128, -128, 45, 40, -105, -128, 40, -91, -3, 54, 31, -4, -88, -128, -128, -128,
+    -114, -90, -128, -128, -18, -128, -128, -33, -127, -97, -128, -100, -128, -117, 28, -128,
+    -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -86, -116, -54,
+    -128, -128, -83, -128, 127, -128, -128, -128, -128, -128, -128, -112, -94, -128, -128, -31,
+    -128, -128, -86, -128, -128, -128, -128, -128, -62, -45, -92, 66, -50, -128, -128, -128,
+    -128, -84, -128, -128, -128, -59, -128, 67, -128, -99, -128, -64, -121, -48, -128, -51,
+    -128, -128, 49, -49, -49, -128, 44, -128, -120, 51, 67, -82, -128, -128, 3, -128,
+    -128, -128, -128, -70, -121, -128, -128, -54, -128, -128, -128, -103, -128, -127, -107, -78,
+    -128, -128, -128, -128, -128, -128, -128, 19, -128, -128, -128, -128, -128, 12, -95, -101,
+    -128, -128, -84, -71, 127, -86, -100, -128, -128, -128, -128, -106, -88, -128, -128, -31,
+    -128, -128, -128, -62, -125, -128, -78, -128, -128, -128, -77, 119, -128, -128, -128, -128,
+    -128, -88, -128, -128, -128, -128, -128, 24, -128, -95, -128, -128, -128, -46, -128, -59,
+    -128, -128, 52, -128, -60, -121, 42, -61, -57, 48, 13, -97, -128, -128, -39, -73,
+    -123, -128, -128, -107, -122, -128, -128, -75, -128, -128, -104, -103, -128, -122, -128, -123,
+    -79, -77, -128, -128, -116, -128, -128, -128, -30, -128, -111, -87, -128, -42, -79, -128,
+    -123, -128, -52, -34, 59, -110, -128, -57, -128, -128, -128, -107, -64, -128, -128, -21,
+    -128, -128, -128, -128, -128, -128, -128, -102, -128, -128, -128, 14, -128, -128, -128, -128,
+    -128, -123, -86, -61, -128, -128, -128, 1, -128, -99, -128, -128, -64, -48, -128, -64,
+    -128, -98, 55, -117, -62, -128, 53, -84, -67, 53, 56, -84, -128, -128, -128, -84,
+    -128, -128, -111, -33, -128, -128, -128, -77, -128, -114, -78, -102, -128, -126, -128, -123,
+    -122, -66, -128, -128, -122, -128, -128, -105, -50, -128, -62, -90, -127, -128, -78, -128,
+    -107, -128, -54, -108, 77, -105, -92, -108, -65, -118, -128, -115, -68, -128, -128, -55,
+    -128, -128, -128, -128, -128, -128, -128, -128, -120, -128, -128, 1, -128, -128, -128, -128,
+    -128, -113, -120, -81, -128, -128, -128, 32, -58, -128, -128, -128, -13, -73, -128, -64,
+    -128, -128, 56, -90, -79, -128, 30, -128, -65, 50, 101, 24, -128, -128, -128, -128,
+    -76, -128, -118, -128, -113, -128, -128, -47, -128, -107, -70, -104, -128, -128, -82, -113,
+    -128, -95, -128, -128, -128, -128, -128, -128, -113, -128, -128, -122, -103, -110, -66, -111,
+    -128, -113, -69, -128, 107, -71, -128, -121, -92, -44, -128, -115, -78, -128, -128, -56,
+    -128, -128, -40, -125, -122, -128, -128, -128, -95, -128, -111, 8, -55, -128, -128, -128,
+    -128, -112, -128, -128, -128, -43, -128, 36, -44, -57, -128, -54, -117, -7, -128, -61,
+    -128, -128, 55, -128, -44, -117, 52, -42, -64, 52, 53, -115, -128, -128, -19, -62,
+    -128, -128, -128, -128, -128, -128, -128, -60, -128, -128, -67, -105, -128, -118, -128, -120,
+    -120, -75, -128, -128, -96, -128, -128, 3, -75, -128, -116, -125, -117, -85, -81, -128,
+    -113, -128, -35, -77, 68, -103, -100, -125, -128, -100, -100, -98, -67, -128, -128, -52,
+    -128, -128, -128, -97, -128, -128, -128, -128, -128, -128, -103, 33, -128, -128, -121, -128,
+    -128, -122, -128, -128, -128, -128, -128, 34, -48, -128, -128, -128, -114, -56, -128, -64,
+    -128, -128, 45, -110, -76, -115, 45, -113, -73, 53, 49, -46, -128, -128, -117, -103,
+    -128, -114, -128, -128, -128, -128, -128, -75, -128, -128, -66, -105, -128, -128, -128, -128,
+    -121, -68, -128, -128, -111, -128, -128, -128, 6, -127, -118, -89, -127, -128, -53, -128,
+    -98, -128, -28, -128, 82, -97, -118, -103, -60, -85, -128, -98, -57, -128, -128, -49,
+    -128, -128, -63, -128, -128, -128, -128, -123, -107, -128, -128, -11, -90, -128, -85, -128,
+    -128, -117, -81, -128, -128, -96, -128, 26, -44, -128, -128, -97, -116, -58, -128, -75,
+    -128, -128, 30, -99, -82, -91, 39, -51, -59, 54, 122, -128, -128, -128, -47, -107,
+    -128, -128, -128, 127, -98, -128, -128, -73, -128, -116, -71, -113, -86, -111, -128, -128,
+    -99, -86, -107, -128, -105, -96, -128, -62, -46, -128, -128, -97, -128, -82, -70, -114,
+    -46, -128, -77, -68, 65, -64, -128, -103, -88, -128, -128, -113, -92, -128, -128, -44,
+    -128, -128, -127, -99, -75, -128, -128, -123, -76, -128, -125, -33, -18, -128, -99, -128,
+    -128, -102, -128, 52, -128, -90, -128, 78, -69, -128, -128, -107, -55, -77, -128, -83,
+    -128, -106, 52, -27, -128, -128, -37, -82, 0, 53, 48, -128, -107, -128, -128, -128,
+    -128, -61, -121, -58, -107, -128, -82, -68, -128, -128, -128, -123, -11, -128, -92, -128,
+    -128, -128, -72, -128, -128, -128, -128, -128, -46, -128, -84, -99, -128, -128, -128, -92,
+    -128, -122, -97, -128, -128, -117, -128, -121, -60, -107, -128, -128, -96, -128, -128, -68,
+    -128, -96, -128, -128, -128, -75, -111, -99, -68, -128, -38, -128, -95, -119, -122, -128,
+    -128, -127, -3, -128, -128, 36, -128, 62, -67, -128, -128, -69, -111, -23, -128, -66,
+    -128, -128, 23, -8, -128, -128, -67, -102, -34, 51, 19, -26, -53, -128, -128, -128,
+    -128, -99, -128, -69, -90, -128, -43, -73, -120, -128, -119, -123, -44, -125, -99, -128,
+    -128, -128, -72, -128, -128, -128, -90, -128, -128, -128, -128, -92, -128, -126, -128, -88,
+    -128, -113, -128, -128, -128, -128, -128, -121, -98, -100, -128, -128, -95, -128, -126, 20,
+    -128, -79, -106, -128, -128, -128, -55, -128, -128, -128, -105, -128, -119, -117, -128, -128,
+    -128, -126, -120, -119, -128, -128, -128, -31, -71, -128, -128, -113, -65, -126, -98, -64,
+    -128, -128, -8, -2, -128, -128, -95, -108, -48, 53, 12, -22, -58, -128, -128, -128,
+    -128, -128, -123, -86, -56, -128, -63, -76, -97, -87, -117, -123, -34, -128, -88, -128,
+    -128, -128, -72, -102, -128, -128, -60, -128, -128, -128, -128, -111, -128, -128, -128, -105,
+    -128, -111, -128, -128, -128, -128, -128, -121, -128, -101, -128, -128, -100, -128, -124, 4,
+    -128, -66, -128, -128, -128, -128, -62, -128, -124, -128, -106, -128, -122, -113, -128, -106,
+    -128, -106, -128, -128, -128, -128, -128, -10, -77, -123, -128, -116, -74, -128, -66, -74,
+    -128, -128, 1, -3, -128, -128, -93, -105, -53, 54, 14, -29, -59, -128, -123, -128,
+    -126, -128, -128, -103, -51, -117, -86, -76, -94, -65, -127, -123, -39, -128, -98, -128,
+    -128, -128, -72, -90, -128, -128, -64, -128, -128, -128, -128, -92, -128, -128, -128, -104,
+    -127, -110, -128, -128, -128, -128, -128, -121, -128, -101, -128, -128, -107, -128, -124, 8,
+    -128, -66, -128, -128, -121, -128, -61, -128, -127, -128, -121, -128, -123, -118, -128, -87,
+    -128, -106, -128, -128, -128, -128, -128, -11, -74, -122, -128, -124, -86, -128, -59, -80,
+    -128, -128, -8, -8, -128, -128, -91, -103, -52, 54, 3, -27, -46, -128, -128, -128,
+    -128, -128, -128, -128, -50, -121, -87, -75, -108, -68, -128, -123, -42, -128, -108, -128,
+    -128, -128, -72, -92, -128, -128, -67, -128, -128, -128, -128, -93, -128, -128, -128, -106,
+    -120, -116, -117, -128, -128, -128, -128, -121, -128, -101, -128, -128, -115, -128, -103, 13,
+    -128, -65, -128, -128, -104, -128, -65, -128, -116, -128, -128, -128, -128, -122, -128, -95,
+    -128, -99, -128, -128, -128, -124, -128, -19, -90, -121, -128, -118, -99, -128, -60, -83,
+    -128, -128, -18, -10, -128, -128, -97, -112, -54, 54, -19, -27, -27, -128, -128, -128,
+    -128, -128, -128, -107, -53, -128, -63, -79, -101, -67, -128, -123, -32, -128, -115, -128,
+    -128, -123, -72, -113, -128, -128, -75, -104, -128, -128, -128, -91, -128, -128, -128, -107,
+    -108, -128, -98, -128, -128, -128, -128, -121, -127, -101, -128, -128, -122, -128, -88, 43,
+    -128, -65, -127, -128, -112, -128, -72, -128, -128, -128, -128, -128, -122, -104, -128, -122,
+    -128, -98, -111, -128, -128, -128, -128, -27, -126, -121, -128, -128, -99, -128, -53, -79,
+    -128, -128, -62, -1, -128, -128, -88, -89, -73, 54, -71, -32, -10, -128, -128, -128,
+    -108, -105, -128, -128, -59, -128, -58, -80, -128, -98, -128, -123, -42, -128, -86, -128,
+    -128, -120, -101, -124, -128, -128, -112, -128, -128, -128, -128, -97, -128, -128, -128, -111,
+    -114, -128, -74, -128, -128, -128, -128, -127, -126, -128, -127, -128, -124, -128, -61, 54,
+    -128, -64, -128, -128, -128, -128, -112, -128, -128, -109, -128, -128, -95, -92, -128, -128,
+    -128, -82, -118, -128, -128, -128, -128, -18, -128, -125, -128, -128, -79, -128, -53, -68,
+    -128, -128, 1, 33, -125, -128, -76, -112, -33, 54, -101, -18, -18, -101, -128, -128,
+    -125, -128, -128, -128, -70, -128, -108, -65, -128, -104, -128, -123, 9, -125, -47, -128,
+    -128, -128, -128, -128, -128, -128, -128, -22, -128, -128, -119, -99, -128, -128, -128, -112,
+    -128, -128, -84, -128, -128, -128, -116, -124, -128, -128, -128, -128, -107, -128, -35, -50,
+    -128, -54, -128, -128, -128, -128, -69, -128, -128, -29, -121, -128, -128, -115, -128, -76,
+    -128, -78, -128, -128, -128, -118, -121, 10, -128, -116, -128, -108, -48, -30, -106, -65,
+    -128, -118, -6, 43, -124, -128, -44, -109, -34, 54, -104, -22, -44, -128, -128, -128,
+    -128, -128, -127, -128, -69, -128, -77, -63, -110, -128, -128, -123, 12, -112, -32, -125,
+    -128, -128, -128, -128, -128, -128, -128, -67, -128, -128, -128, -128, -128, -128, -128, -103,
+    -127, -128, -111, -128, -128, -128, -104, -104, -128, -128, -128, -128, -94, -128, -58, -31,
+    -128, -76, -128, -128, -128, -128, -84, -128, -128, -55, -128, -128, -75, -128, -128, -128,
+    -128, -72, -107, -128, -128, -128, -128, -8, -128, -128, -128, -109, -72, -73, -117, -71,
+    -128, -128, 24, -8, -108, -128, -12, -75, 8, 53, -66, -9, 12, -128, -102, -128,
+    -128, -93, -126, -128, -96, -128, -128, -55, -124, -128, -128, -123, -30, -118, -42, -128,
+    -128, -128, -128, -128, -128, -128, -128, 8, -128, -122, -128, -128, -128, -128, -128, -99,
+    -128, -128, -122, -128, -128, -128, -128, -119, -128, -128, -128, -128, -75, -128, -117, -31,
+    -128, -70, -117, -128, -116, -128, -48, -128, -24, 15, -96, -128, -100, -128, -128, -112,
+    -128, -90, -128, -128, -97, -39, -128, 44, -128, -39, -128, -97, -128, -73, -128, -71,
+    -128, -23, 17, -128, -41, -128, 27, -106, -99, 51, 16, -64, -128, -115, -128, -128,
+    -128, -128, -128, -128, -105, -128, -128, -79, -128, -128, -128, -123, -99, -117, -120, -65,
+    -116, -128, -128, -128, -16, -128, -128, 127, -128, -128, -114, -128, -128, -60, -128, -114,
+    -128, -128, -128, -128, -128, -93, -116, -73, -128, -128, -128, -128, -56, -128, -82, -31,
+    -128, -113, -128, -119, -90, -128, -18, -128, -128, -128, -118, -116, -128, -128, -94, -128,
+    -128, -110, -128, -128, 3, -128, -128, -45, -128, -69, -128, -128, -107, -73, -128, -76,
+    -128, -128, 17, -128, -27, -128, 34, -118, -49, 54, -5, -32, -128, -128, -128, -102,
+    -128, -59, -128, -98, -124, -128, -75, -76, -128, -128, -124, -122, -126, -101, -128, -128,
+    -80, -128, -128, -128, 50, -128, -128, -125, -128, -128, -19, -128, -128, -128, -120, -104,
+    -128, -127, -128, -128, -128, -122, -57, -122, -103, -110, -128, -128, -72, -128, -114, -27,
+    -128, -120, -128, -128, -124, -128, -79, -128, -128, -128, -128, -128, -91, -128, -128, -128,
+    -128, -128, -8, -128, -38, -128, -81, -30, -116, -128, -100, -128, -45, -73, -128, -72,
+    -128, -128, 17, -128, -48, -128, 37, -82, -66, 54, 34, 6, -128, -128, -128, -128,
+    -128, -113, -128, -128, -77, -128, 15, -77, -97, -128, -64, -124, -128, -91, -62, -128,
+    -55, -128, -128, -128, 14, -128, -128, -128, -128, -87, -128, -128, -122, -128, -120, -93,
+    -128, -55, -128, -116, -128, -128, -128, -128, -127, -32, -128, -128, -91, -128, -62, -46,
+    -128, -128, -29, -128, -128, -108, -17, -128, -128, -128, -118, -111, -98, -128, -128, -128,
+    -118, -113, -110, -128, -46, -38, -128, -106, -55, -48, -128, -60, -45, -73, -128, -74,
+    -128, -128, 17, -128, -14, -128, 34, -128, -11, 47, 46, -41, -128, -113, -128, -112,
+    -110, -128, -128, -90, -128, -128, -101, -68, -128, -128, -43, -122, -73, -128, -128, -128,
+    -95, -128, -128, -128, -25, -128, -128, -111, -128, -128, -128, -128, -127, -70, -128, -112,
+    -115, -35, -128, -113, -128, -128, -55, -26, -128, -128, -128, -128, -72, -128, -109, -37,
+    -128, -128, -128, -128, -128, -105, -128, -128, -128, -128, -70, -128, -128, -128, 85, -128,
+    -128, -95, -128, -53, -55, -128, -128, -27, -107, -128, -128, -128, -108, -73, -128, -62,
+    -128, -128, 17, -101, -50, -128, 42, -77, -38, 27, 45, -111, -128, -128, -128, -128,
+    -128, -128, -128, -106, -128, -128, -69, -73, -128, -128, -108, -123, -128, -127, -60, -128,
+    -128, -128, -128, -128, -128, -128, -128, -128, -69, -128, -85, -89, -127, -88, -128, -115,
+    -94, -90, -128, 52, -114, -128, -128, -66, -78, -126, -128, -128, -38, -77, -128, -59,
+    -128, -128, -77, -128, -109, -128, -128, -128, -128, -128, -128, -96, -91, -128, -112, -128,
+    -123, -102, -92, -125, -128, -80, -128, 19, -88, -128, -128, -52, -128, -73, -128, -63,
+    -128, -128, 34, -39, -71, -128, 12, -116, -59, 38, 47, -73, -128, -128, -128, -128,
+    -128, -128, -102, 127, -128, -128, -70, -68, -125, -128, -128, -123, -60, -113, -128, -128,
+    -128, -128, -128, -128, -128, -128, -128, -128, -127, -128, 13, -128, -111, -128, -128, -123,
+    -128, -110, -128, -46, -128, -128, -81, -122, -64, -128, -99, -128, -60, -128, -128, 55,
+    -128, -128, -128, -128, -128, -128, -88, -128, -128, -128, -123, -128, -128, -128, -128, -128,
+    -128, -100, -119, -33, -128, -128, -124, -21, -26, -128, -128, -116, -15, -42, -128, -67,
+    -128, -128, -31, -21, -122, -128, 11, -81, 16, 43, -20, 11, -128, -128, -128, -128,
+    -33, -80, -128, -128, -128, -128, -2, -63, -110, -128, -128, -122, -76, -128, -66, -111,
+    -117, -128, -128, -107, -128, -128, -121, -128, -127, -128, -128, -128, -128, -128, -128, -101,
+    -128, -128, -128, -128, -128, -128, -128, -121, -27, -62, -93, -128, -70, -128, -128, -1,
+    -128, -86, -11, -128, -128, -128, -128, -128, 71, -128, -128, -128, 22, -56, -128, -128,
+    -128, -128, -100, -128, -128, -85, -128, -26, -20, -96, -128, -65, -89, -128, -47, -63,
+    -128, -128, 32, -30, -65, -66, 8, -109, -93, 42, 43, -91, -128, -128, -25, -128,
+    -128, -128, -108, -72, -128, -128, -128, -74, -128, -128, -112, -123, -43, -117, -128, -128,
+    -128, -128, -128, -128, -128, -128, -128, 127, -128, -128, -81, -128, -128, -113, -128, -118,
+    -108, -115, -110, -100, -111, -88, -107, -114, -128, -128, -41, -128, -64, -128, -128, -1,
+    -128, -103, -128, -128, -47, -128, -79, -128, -128, -128, -61, -128, -128, -56, -128, -128,
+    -128, -128, -128, -128, -128, -128, -111, 18, -37, -100, -128, -128, -128, -40, -128, -59,
+    -128, -128, 28, -30, -89, -73, 26, -82, -22, 43, 45, -63, -128, -128, -128, -128,
+    -81, -94, -120, -31, -128, -128, -63, -70, -128, -128, -128, -123, -76, -128, -108, -128,
+    -128, -128, -128, -128, -128, -128, -128, -128, -84, -128, -83, -95, -128, -128, -128, -108,
+    -128, -105, -128, -128, -128, -89, -128, -113, -30, -109, -112, -128, -102, -128, -128, -22,
+    -128, -101, -69, -128, -128, -128, -128, -128, -128, -128, -128, -128, -125, -123, -128, -128,
+    -128, -128, -56, -63, -128, -86, -128, -21, -51, -128, -128, -105, -105, -73, -128, -73,
+    -128, -128, 18, -51, -106, -115, 28, -53, 30, 52, 67, -128, -128, -128, -128, -128,
+    -128, -128, -128, 127, -126, -128, -84, -68, -128, -82, -110, -123, -10, -104, -49, -128,
+    -128, -126, -116, -128, -128, 12, -128, -74, -128, -128, -128, -91, -128, -72, -128, -91,
+    -51, -128, -128, -128, -128, -128, -128, -125, -91, -128, -128, -128, -123, -128, -128, -59,
+    -128, -71, -126, -128, -36, -128, -88, -128, 70, -128, -85, -128, -3, -110, -128, -128,
+    -49, -108, -128, -47, -128, -108, -116, 68, -51, -128, -128, -107, -100, -73, -128, -75,
+    -121, -91, 4, -104, -128, -116, -22, -51, 13, 53, 52, -128, -38, -128, -111, -128,
+    -128, -89, -128, -112, -108, -128, -128, -68, -128, -128, -128, -123, -63, -128, -111, -128,
+    -120, -121, -72, -62, -79, -128, -103, -128, -128, -97, -122, -128, -128, -128, -128, -86,
+    -128, -98, -128, -128, -128, -128, -128, -121, -123, -112, -128, -128, -116, -128, -128, 16,
+    -128, -57, -128, -128, -128, -58, -71, -128, -13, -128, -5, -128, -121, -128, -127, -128,
+    -97, -123, -25, -128, -128, 28, -128, 28, -111, -128, -128, -83, -128, -128, -128, -73,
+    -107, -128, 35, -127, -128, -128, -48, -100, -89, 52, 35, -60, -55, -128, -107, -128,
+    -128, -128, -126, -109, -77, -112, -128, -68, -128, -100, -128, -123, -88, -128, -128, -128,
+    -122, -128, -72, -72, -79, -128, -65, -128, -128, -128, -110, -124, -128, -128, -128, -105,
+    -112, -116, -125, -128, -128, -121, -128, -121, -128, -112, -128, -128, -128, -128, -128, -37,
+    -128, -51, -128, -128, -115, -118, -128, -128, -128, -128, -109, -128, -128, -128, -126, -128,
+    -128, -112, -128, -128, -128, -128, -128, -1, -128, -128, -127, -128, -128, -128, -101, -70,
+    -119, -128, 41, -128, -128, -111, -45, -96, -91, 54, 13, -57, -14, -128, -128, -128,
+    -124, -126, -127, -104, -78, -96, -105, -69, -128, -99, -128, -123, -94, -128, -117, -128,
+    -118, -125, -72, -62, -79, -128, -37, -128, -125, -128, -128, -103, -128, -128, -128, -112,
+    -114, -128, -99, -122, -119, -119, -128, -121, -109, -118, -117, -128, -128, -128, -98, -18,
+    -128, -53, -116, -128, -128, -128, -128, -128, -128, -128, -128, -119, -110, -108, -128, -128,
+    -128, -104, -102, -128, -128, -109, -128, -17, -128, -128, -115, -128, -128, -128, -58, -80,
+    -123, -116, 9, -119, -128, -85, -45, -84, -84, 54, -39, -55, -18, -128, -115, -128,
+    -113, -128, -128, -128, -79, -112, -107, -69, -128, -89, -128, -123, -71, -128, -105, -126,
+    -125, -101, -72, -55, -83, -128, -41, -128, -128, -128, -128, -96, -128, -128, -128, -108,
+    -112, -128, -69, -119, -109, -128, -128, -121, -128, -128, -128, -122, -128, -128, -87, -3,
+    -128, -50, -128, -116, -128, -128, -128, -124, -128, -128, -116, -114, -111, -89, -128, -114,
+    -128, -98, -127, -127, -128, -128, -124, -3, -128, -128, -108, -121, -121, -128, -42, -75,
+    -114, -61, 14, -103, -123, -80, -42, -88, -79, 54, -85, -56, -14, -128, -90, -128,
+    -128, -128, -128, -128, -88, -128, -128, -68, -128, -108, -128, -123, -80, -128, -78, -113,
+    -128, -113, -126, -75, -100, -128, -128, -68, -128, -128, -126, -124, -128, -128, -128, -97,
+    -117, -128, -41, -128, -93, -128, -128, -121, -128, -128, -128, -100, -117, -128, -85, -38,
+    -128, -46, -128, -117, -128, -128, -128, -128, -114, -96, -128, -101, -113, -124, -128, -109,
+    -128, -93, -128, -128, -128, -125, -110, 19, -128, -128, -107, -128, -111, -89, -44, -96,
+    -128, -81, 28, -84, -123, -128, -12, -93, -58, 54, -103, -61, -30, -128, -128, -128,
+    -128, -116, -123, -128, -86, -128, -128, -71, -128, -128, -128, -123, -72, -114, -62, -126,
+    -128, -128, -128, -128, -126, -128, -128, -21, -128, -128, -128, -127, -128, -128, -110, -106,
+    -121, -128, -55, -128, -88, -128, -124, -121, -128, -128, -128, -90, -97, -128, -63, -73,
+    -128, -47, -128, -104, -128, -128, -128, -128, -128, -69, -128, -67, -91, -128, -128, -128,
+    -128, -87, -111, -128, -112, -128, -128, 9, -128, -128, -102, -105, -99, 18, -80, -79,
+    -128, -114, 89, -126, -119, -128, 20, -61, -36, 54, -68, -43, 11, -128, -128, -128,
+    -123, -52, -125, -128, -128, -128, -128, -52, -128, -128, -128, -123, -113, -105, -65, -94,
+    -128, -128, -128, -128, -116, -128, -128, -20, -128, -93, -128, -111, -128, -128, -78, -108,
+    -128, -128, -104, -128, -117, -128, -128, -128, -128, -128, -128, -102, -81, -128, -98, -88,
+    -128, -38, -117, -84, -128, -124, -86, -128, -38, -8, -121, 1, -81, -128, -128, -77,
+    -128, -89, -128, -128, -70, -80, -128, 39, -128, -73, -97, -106, -128, -15, -128, -80,
+    -128, -38, 52, -128, -38, -128, 53, -112, -115, 54, 24, -62, -128, -128, -128, -128,
+    -128, -128, -128, -128, -128, -128, -128, -69, -128, -128, -119, -123, -118, -118, -90, -38,
+    -83, -128, -128, -128, 9, -128, -128, 127, -128, -122, -126, -128, -128, -96, -73, -128,
+    -128, -128, -128, -128, -128, -128, -116, -88, -128, -128, -128, -90, -63, -128, -98, -39,
+    -128, -70, -128, -23, -119, -107, -32, -128, -128, -118, -91, 42, -128, -128, -6, -111,
+    -128, -97, -128, -128, 13, -128, -128, -22, -128, -71, -75, -128, -92, -86, -128, -68,
+    -128, -89, 32, -128, -32, -128, 75, -94, -101, 54, 34, -70, -128, -128, -128, -128,
+    -128, -67, -126, -124, -128, -128, -92, -70, -128, -128, -58, -122, -128, -128, -128, -128,
+    -63, -128, -128, -128, 87, -128, -128, -96, -128, -128, -96, -128, -128, -115, -81, -122,
+    -128, -128, -128, -118, -128, -70, -87, -118, -128, -126, -128, -108, -65, -128, -82, -31,
+    -128, -62, -128, -128, -128, -121, -105, -128, -128, -128, -128, 32, -99, -128, -128, -128,
+    -128, -116, -15, -128, 13, -128, -95, -48, -128, -128, -32, -128, -28, -73, -128, -63,
+    -128, -128, 22, -128, -40, -128, 59, -124, -105, 51, 62, 15, -128, -128, -128, -128,
+    -128, -128, -128, -128, -98, -128, -52, -72, -123, -128, -74, -125, -109, -128, -16, -121,
+    -38, -128, -128, -128, 24, -128, -128, -128, -128, -127, -128, -128, -128, -127, -76, -119,
+    -128, -88, -128, -128, -128, -126, -128, -98, -128, -60, -128, -123, -85, -128, -61, -29,
+    -128, -105, -84, -58, -128, -98, -58, -100, -109, -128, -91, -43, -128, -128, -128, -128,
+    -106, -128, -128, -65, 38, -102, -128, -77, -119, -46, -86, -93, -58, -73, -128, -74,
+    -128, -105, 17, -128, -15, -128, 46, -50, -7, 42, 41, -128, -128, -128, -128, -128,
+    -127, -68, -128, -16, -128, -128, -99, -71, -128, -128, -89, -122, -128, -120, -69, -128,
+    -100, -128, -128, -128, -128, -128, -128, -98, -91, -128, -128, -128, -128, -79, -103, -128,
+    -119, -65, -128, -33, -128, -128, -114, -110, -128, -128, -128, -128, -104, -78, -128, -39,
+    -128, -80, -128, -128, -128, -77, -128, -128, -128, -128, -128, -128, -83, -128, -128, -128,
+    -127, -126, -128, -38, -74, -128, -128, 32, -84, -128, -128, -100, -128, -73, -128, -57,
+    -128, -128, 17, -7, -60, -128, 44, -128, 9, 49, 9, 5, -128, -128, -61, -128,
+    -128, -128, -128, -103, -128, -128, -128, -68, -128, -128, -54, -121, -55, -128, -98, -128,
+    -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -98, -128, -128, -104, -117, -128,
+    -113, -92, -128, -128, -84, -128, -128, -128, -128, -128, -128, -128, -128, -120, -128, -46,
+    -128, -120, -71, -128, -124, -94, -55, -128, -126, -128, -49, -128, -128, -128, -128, -128,
+    -121, -111, -128, -94, -128, -115, -122, -6, -71, -82, -128, 33, -128, -73, -128, -69,
+    -128, -128, 17, -62, -91, -128, 50, -27, -4, 54, -19, -72, -128, -128, -80, -90,
+    -128, -128, -128, -128, -128, -128, -128, -68, -128, -128, -15, -106, -128, -128, -128, -128,
+    -128, -117, -128, -128, -128, -128, -128, -128, -76, -67, -72, -128, -128, -116, -128, -128,
+    -111, -69, -107, -81, -128, -106, -108, -85, -128, -121, -106, -128, -109, -128, -128, 19,
+    -128, -114, -128, -128, -80, -87, -128, -111, -120, -128, -128, -128, -128, -128, -128, -128,
+    -128, -109, -76, -128, -99, -128, -111, -3, -96, -126, -125, -128, -128, -73, -128, -82,
+    -128, -128, 17, -62, -75, -128, 40, -128, -51, 49, -1, -23, -128, -128, -111, -115,
+    -128, -128, -128, -86, -128, -128, -83, -69, -128, -128, 17, -117, -44, -124, -128, -128,
+    -128, -92, -128, -128, -128, -128, -128, -96, 32, -76, -128, -128, -128, -128, -122, -128,
+    -110, -128, -45, -128, -128, -79, -124, -71, -67, -114, -128, -128, -102, -128, -128, -39,
+    -128, -128, -100, -128, -113, -124, -128, -128, -128, -128, -128, -128, -52, -128, -128, -128,
+    -128, -90, -128, -128, -128, -117, -128, 27, -102, -117, -128, -33, -108, -73, -128, -62,
+    -128, -128, 17, -128, -71, -128, 45, -93, -24, 22, -9, -62, -128, -128, -118, -127,
+    -128, -128, -128, -66, -128, -128, -128, -69, -128, -128, -95, -120, -128, -128, -128, -128,
+    -128, -99, -128, -128, -66, -128, -128, -128, -128, -128, -99, -102, -124, -118, -128, -128,
+    -124, -128, -51, -55, -128, -116, -128, -128, -128, -94, -103, -128, -109, -70, -128, -48,
+    -128, -115, -128, -128, -110, -128, -59, -128, -128, -128, -119, -128, -128, -128, -128, -128,
+    -128, -90, -128, -98, -128, -112, -128, -18, -80, -81, -128, -128, -128, -73, -128, -67,
+    -128, -128, 30, -128, -77, -128, 29, -85, -70, 14, 23, -128, -128, -128, -128, -90,
+    -115, -128, -106, 127, -128, -90, -92, -68, -128, -128, -128, -113, -84, -128, -128, -128,
+    -128, -121, -128, -128, -45, -128, -128, -128, -128, -115, 16, -128, -52, -124, -128, -128,
+    -128, -99, -93, -36, -128, -111, -62, -128, -51, -128, -65, -128, -128, -128, -120, -82,
+    -128, -128, -128, -128, -128, -128, -124, -128, -128, -128, -128, -128, -128, -128, -128, -128,
+    -128, -85, -46, -60, -128, -128, -116, -55, -104, -128, -65, -128, -95, -71, -128, -72,
+    -128, -128, 7, -128, -122, -128, 33, -84, -56, 34, -2, -11, -128, -128, -128, -128,
+    -15, -58, -128, -128, -128, -116, -79, -68, -103, -117, -128, -119, -76, -128, -58, -112,
+    -128, -124, -128, -54, -98, -128, -128, -128, -101, -128, -128, -128, -116, -128, -128, -103,
+    -128, -128, -118, -128, -128, -83, -128, -121, -1, -74, -57, -128, -128, -128, -128, -25,
+    -128, -96, 26, -128, -128, -128, -128, -128, -21, -128, -127, -101, -4, -28, -128, -128,
+    -128, -128, -81, -128, -128, -108, -128, 17, -128, -128, -111, -102, -76, -74, -128, -62,
+    -128, -128, 41, -100, -91, -101, 5, -98, -44, 44, 41, -67, -128, -128, -101, -128,
+    -128, -128, -109, -122, -128, -128, -107, -69, -128, -114, -128, -123, -54, -128, -90, -128,
+    -128, -128, -128, -89, -114, -128, -128, 87, -128, -128, -114, -128, -95, -128, -128, -114,
+    -126, -122, -128, -113, -128, -128, -120, -121, -128, -128, -45, -128, -126, -128, -128, -81,
+    -128, -81, -128, -103, -75, -127, -96, -128, -128, -128, -60, -128, -128, -95, -128, -128,
+    -128, -128, -128, -128, -128, -128, -120, 4, -127, -120, -128, -76, -128, -70, -128, -64,
+    -128, -128, 41, -113, -99, -99, 19, -85, -55, 38, 26, -75, -128, -128, -128, -128,
+    -128, -107, -128, -63, -128, -128, -128, -68, -128, -128, -96, -123, -80, -128, -69, -128,
+    -128, -128, -128, -83, -102, -128, -128, -128, -105, -124, -106, -125, -126, -128, -128, -114,
+    -111, -120, -128, -128, -128, -128, -128, -121, -65, -128, -82, -124, -117, -128, -128, -27,
+    -128, -79, -97, -128, -128, -128, -107, -116, -128, -128, -128, -128, -128, -128, -125, -128,
+    -128, -128, -96, -128, -128, -111, -121, -5, -125, -128, -128, -128, -103, -73, -128, -52,
+    -128, -128, -25, -124, -117, -128, 17, -24, -18, 49, 43, -128, -128, -128, -116, -128,
+    -128, -128, -127, 127, -128, -128, -109, -68, -128, -70, -83, -123, -36, -104, -125, -128,
+    -118, -97, -120, -86, -86, -44, -128, -58, -128, -128, -128, -114, -128, -83, -128, -108,
+    -35, -128, -124, -107, -128, -128, -128, -121, -118, -128, -128, -123, -116, -128, -128, 18,
+    -128, -56, -128, -119, -90, -128, -113, -128, 42, -128, -84, -128, -11, -128, -125, -128,
+    -116, -106, -128, -36, -91, -104, -125, 68, -124, -128, -112, -128, -42, -73, -128, -71,
+    -128, -82, -26, -123, -128, -128, -11, -47, -26, 52, 6, -128, -27, -128, -128, -128,
+    -128, -87, -128, -128, -102, -121, -98, -72, -128, -128, -128, -123, -61, -128, -128, -128,
+    -127, -100, -72, -59, -81, -128, -53, -128, -99, -84, -128, -94, -128, -128, -128, -97,
+    -128, -128, -88, -128, -128, -125, -128, -121, -92, -123, -128, -128, -128, -128, -78, 38,
+    -128, -46, -128, -128, -128, -61, -128, -125, -42, -128, -13, -127, -96, -87, -128, -128,
+    -121, -102, 17, -128, -128, 29, -128, 21, -128, -128, -116, -128, -128, -128, -99, -86,
+    -109, -100, -10, -109, -126, -82, -57, -89, -73, 53, -64, -57, -13, -128, -90, -128,
+    -115, -128, -128, -128, -81, -128, -117, -72, -128, -123, -128, -123, -56, -128, -90, -123,
+    -128, -121, -98, -81, -97, -128, -77, -101, -128, -128, -128, -128, -128, -128, -128, -101,
+    -115, -128, -42, -128, -118, -128, -128, -121, -128, -128, -128, -112, -128, -128, -87, -15,
+    -128, -47, -128, -123, -128, -128, -128, -128, -128, -105, -100, -117, -122, -95, -128, -128,
+    -128, -99, -128, -124, -128, -128, -127, 19, -128, -128, -111, -127, -125, -128, -48, -70,
+    -124, -103, 8, -83, -128, -79, -22, -84, -50, 54, -103, -47, 7, -128, -126, -128,
+    -107, -114, -128, -128, -89, -128, -128, -68, -128, -123, -128, -123, -74, -128, -44, -122,
+    -128, -128, -119, -119, -128, -128, -128, -66, -128, -118, -128, -128, -128, -128, -127, -104,
+    -121, -128, -46, -128, -103, -128, -128, -121, -127, -128, -128, -102, -128, -128, -82, -74,
+    -128, -53, -128, -119, -128, -128, -128, -128, -112, -57, -128, -86, -85, -123, -128, -128,
+    -128, -76, -112, -128, -123, -128, -122, 38, -128, -128, -98, -110, -117, -48, -51, -71,
+    -128, -18, 107, -126, -117, -111, -4, -86, -58, 54, -60, -59, -32, -128, -128, -128,
+    -128, -128, -127, -128, -97, -128, -128, -64, -128, -128, -128, -123, -62, -122, -31, -92,
+    -128, -128, -128, -128, -128, -128, -128, 47, -128, -128, -128, -128, -128, -128, -77, -98,
+    -128, -128, -120, -128, -114, -128, -119, -121, -128, -128, -128, -107, -93, -128, -53, -104,
+    -128, -38, -128, -80, -128, -125, -103, -128, -123, -25, -125, -13, -93, -128, -103, -128,
+    -128, -79, -124, -128, -101, -128, -115, -1, -128, -128, -75, -128, -106, 7, -128, -93,
+    -128, -26, 76, -128, -77, -126, 36, -118, -82, 54, 24, -37, -68, -128, -128, -128,
+    -128, -128, -128, -128, -128, -128, -128, -66, -128, -128, -128, -123, -51, -128, -59, -51,
+    -128, -128, -128, -128, -94, -128, -128, 64, -128, -128, -128, -104, -128, -104, -61, -87,
+    -128, -128, -128, -128, -128, -115, -128, -124, -128, -128, -128, -102, -52, -128, -29, -74,
+    -128, -54, -128, -61, -128, -117, -65, -128, -110, -53, -128, 63, -119, -128, -128, -128,
+    -128, -101, -128, -128, -50, -126, -98, -14, -128, -73, -70, -128, -116, -42, -128, -99,
+    -128, -128, 53, -128, -32, -128, 60, -69, -119, 54, 63, -99, -128, -128, -128, -128,
+    -128, -43, -127, -128, -128, -128, -128, -68, -128, -128, -120, -123, -128, -128, -122, -110,
+    -75, -128, -128, -128, -4, -128, -128, -15, -128, -128, -128, -128, -128, -122, -95, -124,
+    -128, -128, -128, -91, -128, -67, -120, -128, -128, -128, -128, -88, -63, -128, -103, -51,
+    -128, -54, -128, -72, -128, -108, -94, -127, -128, -128, -128, 53, -112, -128, -128, -128,
+    -128, -128, -128, -128, 2, -128, -77, -16, -116, -128, -53, -128, -71, -81, -128, -67,
+    -128, -128, 29, -128, -42, -128, 66, -112, -61, 51, 38, 18, -128, -128, -128, -128,
+    -128, -128, -128, -128, -128, -128, -128, -66, -128, -128, -82, -123, -86, -121, -30, -120,
+    -29, -128, -128, -128, 7, -128, -128, -128, -128, -128, -128, -128, -128, -120, -81, -128,
+    -128, -128, -128, -128, -128, -117, -128, -108, -128, -81, -128, -104, -79, -128, -71, -34,
+    -128, -81, -114, -62, -128, -89, -18, -111, -118, -128, -87, -25, -128, -128, -128, -114,
+    -96, -127, -128, -118, 26, -125, -112, -75, -64, -44, -86, -102, -78, -73, -128, -80,
+    -128, -128, 17, -128, -15, -128, 49, -87, -51, 48, 47, -122, -128, -128, -128, -128,
+    -128, -115, -128, -27, -128, -128, -93, -71, -128, -128, -72, -123, -128, -111, -117, -128,
+    -114, -128, -128, -128, -66, -128, -128, -26, -128, -128, -128, -128, -128, -107, -89, -128,
+    -119, -58, -128, -107, -128, -91, -76, -102, -128, -127, -128, -128, -82, -128, -114, -31,
+    -128, -83, -128, -128, -116, -82, -128, -128, -128, -128, -128, -128, -101, -128, -128, -128,
+    -71, -115, -128, -78, -41, -128, -120, -18, -83, -128, -101, -128, -128, -73, -128, -71,
+    -128, -128, 17, -71, -60, -128, 42, -121, 7, 54, 27, -16, -128, -128, -78, -128,
+    -128, -128, -128, -119, -128, -128, -128, -68, -128, -128, -82, -119, -105, -128, -83, -128,
+    -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -105, -128, -128, -95, -85, -124,
+    -128, -98, -128, -128, -128, -128, -128, -117, -128, -113, -128, -128, -116, -128, -128, -31,
+    -128, -108, -64, -128, -125, -105, -104, -128, -126, -128, -66, -128, -128, -128, -128, -128,
+    -128, -95, -128, -128, -128, -92, -128, 25, -26, -58, -128, 13, -122, -73, -128, -62,
+    -128, -128, 17, -103, -84, -128, 46, -98, -5, 52, -25, -45, -128, -128, -128, -74,
+    -128, -128, -122, -128, -128, -128, -126, -68, -128, -128, -77, -89, -107, -128, -128, -128,
+    -128, -128, -128, -128, -116, -128, -128, -128, -76, -128, -103, -128, -128, -112, -113, -128,
+    -106, -63, -116, -128, -128, -128, -51, -113, -128, -128, -128, -128, -99, -128, -128, -32,
+    -128, -128, -128, -128, -91, -79, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128,
+    -128, -87, -81, -128, -93, -128, -118, -30, -51, -128, -91, -128, -128, -73, -128, -62,
+    -128, -128, 17, -115, -61, -128, 38, -108, -55, 45, -1, -98, -128, -128, -128, -128,
+    -128, -54, -124, 2, -128, -128, -106, -68, -128, -128, -77, -111, -128, -128, -128, -124,
+    -128, -115, -128, -128, -106, -128, -128, -104, 4, -128, -128, -128, -128, -128, -128, -128,
+    -128, -128, -67, -62, -128, -112, -128, -106, -79, -67, -128, -128, -111, -122, -128, -25,
+    -128, -115, -61, -128, -102, -96, -123, -128, -128, -128, -128, -128, -46, -128, -128, -128,
+    -128, -88, -128, -109, -128, -47, -128, 12, -64, -105, -128, -28, -90, -73, -128, -62,
+    -128, -128, 17, -128, -57, -128, 46, -96, -49, 49, 13, -25, -128, -128, -128, -121,
+    -115, -128, -128, -128, -128, -128, -128, -68, -128, -128, -128, -122, -117, -128, -128, -128,
+    -121, -94, -128, -128, -39, -128, -128, -128, -128, -128, -69, -110, -127, -104, -128, -128,
+    -124, -61, -87, -128, -128, -97, -95, -122, -128, -128, -128, -128, -126, -128, -128, -34,
+    -128, -110, -128, -120, -128, -120, -120, -128, -105, -128, -46, -114, -128, -128, -128, -128,
+    -107, -89, -128, -101, -119, -128, -114, -42, -28, -122, -113, -128, -102, -73, -128, -62,
+    -128, -128, 18, -125, -81, -128, 35, -60, -59, 54, 28, -101, -128, -128, -128, -126,
+    -123, -94, -125, -128, -128, -128, -56, -68, -128, -128, -128, -119, -127, -127, -125, -128,
+    -128, -128, -128, -128, -117, -128, -128, -128, 18, -119, -67, -107, -108, -115, -128, -128,
+    -113, -106, -128, -107, -90, -128, -102, -107, -18, -128, -31, -128, -128, -128, -128, -61,
+    -128, -128, -108, -128, -124, -128, -128, -128, -128, -128, -128, -112, -74, -128, -124, -128,
+    -128, -99, -39, -128, -128, -128, -128, 29, -74, -128, -128, -56, -128, -73, -128, -62,
+    -128, -128, 21, -66, -88, -128, 31, -128, -23, 53, 26, -20, -128, -128, -128, -128,
+    -128, -128, -124, -58, -118, -128, -116, -68, -128, -128, -128, -120, -36, -116, -98, -125,
+    -128, -128, -128, -128, -128, -128, -128, -121, -128, -128, -128, -121, -127, -128, -116, -101,
+    -128, -128, -128, -128, -95, -128, -128, -117, -75, -106, -128, -128, -128, -128, -128, -40,
+    -128, -92, -52, -118, -128, -128, -111, -128, -128, -128, -97, -128, -91, -128, -128, -128,
+    -128, -124, -128, -105, -128, -108, -128, -36, -84, -122, -128, -79, -128, -73, -128, -62,
+    -128, -128, 21, -53, -76, -128, 27, -124, -39, 30, 41, -50, -128, -128, -120, -128,
+    -89, -128, -128, -36, -128, -128, -121, -68, -128, -128, -119, -122, -94, -120, -80, -127,
+    -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -125, -94, -128, -96,
+    -120, -128, -128, -80, -71, -105, -128, -128, -128, -96, -108, -127, -128, -128, -128, -40,
+    -128, -87, -128, -128, -120, -128, -128, -128, -128, -128, -103, -128, -122, -128, -103, -128,
+    -128, -124, -128, -76, -128, -128, -128, 22, -106, -71, -128, -128, -128, -73, -128, -64,
+    -128, -128, 25, -85, -80, -128, 26, -45, -52, -21, 65, -128, -128, -128, -128, -128,
+    -83, -128, -111, 8, -128, -92, -128, -68, -121, -128, -110, -120, -89, -128, -128, -128,
+    -128, -128, -128, -128, -128, -128, -128, -128, -128, -110, 14, -128, -128, -109, -128, -128,
+    -128, -94, -128, -64, -55, -117, -62, -121, -125, -128, -38, -120, -128, -128, -128, -59,
+    -128, -128, -128, -128, -116, -128, -105, -128, -128, -128, -128, -128, -128, -128, -128, -128,
+    -128, -99, -114, -128, -128, -128, -122, 20, -114, -128, -128, -128, -128, -66, -128, -66,
+    -128, -120, 18, -128, -108, -128, 14, -105, -53, 12, 22, -12, -128, -128, -128, -128,
+    -77, -60, -128, -128, -128, -128, -122, -68, -123, -128, -122, -121, -76, -128, -55, -127,
+    -124, -128, -128, -68, -94, -128, -128, -128, -128, -128, -128, -128, -96, -128, -94, -106,
+    -128, -123, -128, -128, -128, -125, -128, -121, -46, -82, -58, -128, -128, -128, -118, -24,
+    -128, -82, 14, -128, -128, -128, -94, -128, -55, -128, -128, -99, -34, -68, -115, -128,
+    -128, -128, -59, -128, -120, -127, -126, -20, -128, -128, -99, -128, -120, -104, -95, -71,
+    -128, -112, 6, -128, -96, -128, -12, -83, -62, 39, 29, -66, -128, -128, -128, -128,
+    -128, -128, -110, -128, -128, -128, -84, -68, -118, -109, -114, -123, -78, -128, -128, -128,
+    -121, -128, -128, -81, -55, -128, -128, 54, -128, -128, -126, -128, -128, -128, -114, -103,
+    -123, -128, -128, -94, -128, -126, -128, -121, -128, -124, -60, -128, -98, -128, -108, -2,
+    -128, -74, -128, -85, -72, -118, -95, -128, -128, -128, -77, -128, -128, -106, -128, -119,
+    -128, -128, -128, -128, -116, -128, -128, -31, -128, -114, -124, -114, -128, -66, -128, -66,
+    -128, -128, 47, -128, -100, -128, 2, -105, -78, 42, 37, -70, -128, -128, -128, -128,
+    -128, -117, -128, -94, -128, -128, -106, -68, -128, -108, -103, -123, -89, -128, -93, -128,
+    -128, -128, -125, -110, -55, -128, -128, -90, -108, -118, -119, -92, -97, -128, -128, -124,
+    -94, -98, -128, -128, -128, -122, -128, -121, -63, -128, -82, -119, -113, -128, -110, -25,
+    -128, -75, -125, -128, -115, -123, -126, -104, -128, -128, -128, -118, -128, -128, -128, -128,
+    -128, -128, -89, -128, -126, -128, -115, -27, -128, -128, -119, -128, -115, -73, -128, -59,
+    -128, -128, -37, -128, -128, -112, 10, -14, -13, 53, 64, -128, -128, -128, -118, -128,
+    -123, -128, -125, 127, -128, -128, -83, -68, -128, -56, -115, -123, -53, -103, -69, -128,
+    -128, -122, -126, -94, -79, -8, -128, -91, -128, -128, -128, -112, -125, -87, -128, -107,
+    -46, -128, -128, -91, -108, -128, -128, -121, -107, -128, -110, -123, -128, -128, -127, -22,
+    -128, -59, -124, -116, -85, -121, -128, -128, 7, -128, -93, -118, -13, -102, -128, -128,
+    -128, -101, -128, -12, -89, -74, -124, 73, -128, -128, -108, -120, -52, -73, -128, -63,
+    -98, -7, 38, -128, -104, -127, 23, -22, 28, 48, -54, -128, -33, -80, -128, -128,
+    -128, -59, -128, -128, -119, -128, -128, -70, -128, -128, -128, -123, -93, -118, -73, -128,
+    -128, -128, -114, -98, -102, -108, -128, -128, -126, -94, -123, -118, -128, -128, -128, -84,
+    -128, -128, -88, -128, -128, -128, -128, -121, -117, -128, -128, -120, -96, -128, -79, -89,
+    -128, -40, -128, -128, -128, -75, -128, -128, 15, -75, -27, -52, -65, -128, -107, -128,
+    -87, -83, -5, -128, -128, 23, -114, 60, -128, -123, -102, -128, -123, -29, -128, -84,
+    -128, -56, 78, -128, -85, -118, 33, -109, -61, 54, -19, -38, -51, -128, -128, -128,
+    -128, -119, -128, -128, -128, -128, -128, -52, -128, -128, -128, -123, -73, -109, -22, -61,
+    -128, -128, -128, -128, -97, -128, -128, 103, -128, -128, -128, -128, -128, -128, -33, -84,
+    -128, -128, -128, -128, -128, -128, -128, -121, -128, -128, -128, -102, -67, -128, -15, -86,
+    -128, -55, -128, -39, -128, -118, -41, -120, -128, -42, -113, 50, -101, -128, -113, -128,
+    -128, -91, -122, -128, -67, -128, -128, -14, -128, -58, -82, -105, -99, -20, -128, -70,
+    -128, -108, 60, -128, -46, -128, 48, -89, -106, 51, 56, -44, -128, -128, -128, -128,
+    -128, -128, -128, -128, -128, -128, -111, -67, -128, -128, -113, -122, -128, -121, -128, -106,
+    -97, -128, -128, -128, 5, -128, -128, 42, -128, -111, -128, -121, -128, -110, -52, -92,
+    -128, -128, -128, -111, -128, -128, -99, -121, -128, -128, -128, -98, -35, -128, -17, -57,
+    -128, -56, -128, -65, -128, -104, 2, -128, -123, -128, -128, 85, -128, -128, -126, -128,
+    -128, -84, -128, -128, -11, -128, -115, -81, -118, -128, -47, -128, -98, -61, -128, -70,
+    -128, -53, 32, -128, -28, -128, 74, -86, -95, 47, 79, -101, -128, -128, -128, -128,
+    -128, -128, -128, -126, -128, -128, -128, -69, -128, -128, -85, -124, -128, -116, -128, -128,
+    -78, -128, -128, -128, 22, -128, -128, -25, -128, -112, -128, -128, -124, -89, -86, -111,
+    -128, -111, -128, -128, -128, -100, -128, -123, -128, -128, -128, -112, -48, -128, -75, -35,
+    -128, -80, -128, -79, -128, -101, -75, -128, -128, -128, -86, 11, -128, -128, -103, -128,
+    -128, -100, -128, -128, 20, -123, -105, -17, -90, -100, -56, -128, -76, -77, -128, -87,
+    -128, -128, 17, -128, -28, -128, 59, -128, -46, 53, 18, 1, -128, -128, -128, -128,
+    -128, -128, -128, -115, -126, -128, -128, -69, -128, -128, -101, -122, -92, -127, -128, -128,
+    -58, -128, -128, -128, 12, -128, -128, -128, -128, -128, -98, -128, -127, -117, -99, -128,
+    -128, -87, -128, -128, -128, -128, -87, -125, -128, -118, -128, -128, -112, -128, -128, -31,
+    -128, -97, -128, -128, -128, -89, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128,
+    -94, -105, -112, -69, 34, -128, -86, -17, -86, -103, -66, -128, -75, -73, -128, -82,
+    -128, -128, 17, -128, -53, -128, 47, -79, -10, 48, 8, -107, -128, -128, -128, -128,
+    -59, -51, -128, -56, -128, -128, -4, -68, -128, -128, -69, -123, -128, -128, -118, -128,
+    -128, -128, -128, -128, -70, -128, -128, -128, -114, -128, -128, -128, -126, -128, -128, -127,
+    -118, -64, -128, 2, -128, -128, -128, -109, -87, -83, -128, -128, -128, -128, -97, -30,
+    -128, -125, -101, -128, -105, -94, -128, -128, -128, -128, -128, -128, -36, -128, -106, -128,
+    -128, -110, -76, -87, -65, -64, -102, -48, -47, -128, -97, -18, -128, -73, -128, -94,
+    -128, -128, 17, -125, -77, -128, 45, -82, -36, 39, 6, -18, -128, -128, -64, -128,
+    -128, -128, -128, -128, -128, -128, -128, -68, -128, -128, -59, -123, -83, -128, -126, -128,
+    -128, -128, -128, -128, -96, -128, -128, -128, -128, -128, -94, -128, -84, -122, -128, -128,
+    -113, -35, -128, -128, -128, -128, -100, -94, -128, -127, -128, -128, -114, -128, -128, -32,
+    -128, -128, -128, -128, -128, -84, -128, -128, -126, -128, -5, -128, -128, -128, -116, -96,
+    -128, -95, -128, -128, -100, -128, -100, -4, -6, -92, -91, -128, -102, -73, -128, -62,
+    -128, -128, 17, -86, -64, -128, 39, -128, -11, 31, -10, -107, -128, -128, -128, -128,
+    -112, -55, -125, 11, -128, -128, -57, -69, -128, -128, -49, -123, -109, -128, -128, -128,
+    -128, -118, -128, -128, -128, -128, -128, -128, 55, -128, -128, -117, -123, -124, -128, -128,
+    -128, -128, -76, -128, -128, -128, -128, -80, -46, -83, -128, -128, -105, -101, -128, -39,
+    -128, -128, -67, -128, -115, -106, -128, -128, -128, -128, -128, -128, 14, -128, -57, -128,
+    -128, -89, -50, -110, -128, -93, -122, 21, -44, -128, -128, -23, -128, -73, -128, -64,
+    -128, -128, 17, -128, -67, -128, 45, -81, -62, 39, 23, -13, -128, -128, -96, -128,
+    -128, -128, -127, -128, -128, -128, -128, -68, -128, -128, -128, -121, -81, -128, -128, -128,
+    -128, -112, -128, -128, -88, -128, -128, -128, -128, -128, -76, -124, -96, -100, -128, -128,
+    -128, -54, -86, -91, -128, -96, -128, -117, -128, -90, -128, -128, -115, -128, -128, -39,
+    -128, -113, -128, -128, -111, -116, -74, -128, -108, -128, 8, -128, -128, -128, -128, -87,
+    -122, -97, -128, -105, -128, -128, -102, -43, -37, -49, -128, -128, -128, -73, -128, -66,
+    -128, -128, 18, -115, -81, -128, 35, -94, -34, 52, 4, -100, -128, -128, -128, -90,
+    -107, -128, -114, -128, -128, -123, -68, -68, -128, -128, -98, -115, -79, -125, -128, -105,
+    -128, -124, -128, -128, -125, -128, -128, -128, 20, -128, -62, -125, -125, -114, -128, -128,
+    -122, -111, -95, -128, -106, -112, -42, -91, -6, -128, -128, -123, -122, -128, -128, -55,
+    -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -70, -128, -42, -128,
+    -128, -94, -9, -128, -128, -128, -128, 24, -112, -128, -128, -112, -128, -73, -128, -59,
+    -128, -128, 20, -64, -76, -128, 27, -128, -22, 48, 33, -26, -128, -128, -128, -128,
+    -128, -78, -128, 9, -128, -128, -76, -68, -128, -128, -128, -118, -41, -119, -76, -116,
+    -121, -128, -128, -128, -128, -128, -128, -122, -128, -128, -128, -128, -127, -128, -128, -115,
+    -128, -128, -124, -112, -113, -112, -128, -120, -56, -52, -128, -116, -128, -128, -128, -14,
+    -128, -84, 4, -113, -107, -128, -122, -128, -128, -128, -108, -128, -28, -121, -128, -128,
+    -128, -128, -128, -115, -128, -66, -128, -20, -128, -118, -128, -78, -128, -73, -128, -62,
+    -128, -128, 21, -41, -73, -128, 32, -58, -64, 34, 68, -82, -128, -128, -56, -128,
+    -97, -128, -127, -128, -128, -128, -128, -68, -128, -128, -89, -123, -103, -128, -118, -128,
+    -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -60, -128, -105, -88, -128, -128,
+    -123, -57, -128, -89, -79, -77, -126, -121, -128, -128, -76, -128, -127, -128, -128, -81,
+    -128, -90, -128, -128, -108, -128, -128, -128, -91, -128, -50, -128, -128, -128, -128, -128,
+    -87, -100, -128, -128, -128, -124, -113, 23, -91, -67, -128, -118, -109, -73, -128, -62,
+    -128, -126, 26, -102, -97, -128, 30, -80, -19, 49, 21, -70, -128, -128, -128, -115,
+    -128, -100, -111, -128, -128, -128, -128, -68, -128, -128, -115, -123, -62, -128, -128, -128,
+    -128, -128, -128, -128, -109, -128, -128, -123, -55, -128, -93, -112, -128, -108, -128, -128,
+    -128, -95, -128, -128, -128, -104, -68, -119, -21, -124, -89, -128, -120, -128, -128, -47,
+    -128, -120, -124, -128, -120, -128, -128, -128, -115, -128, -128, -128, -95, -128, -128, -128,
+    -128, -110, 0, -128, -128, -128, -124, -21, -128, -128, -128, -128, -115, -73, -128, -62,
+    -128, -128, 9, -128, -104, -128, 15, -128, -71, 53, 16, -34, -128, -128, -128, -128,
+    -128, -85, -122, -68, -128, -128, -93, -68, -128, -124, -90, -123, -50, -116, -73, -125,
+    -128, -128, -128, -128, -89, -128, -128, -84, -128, -127, -128, -126, -128, -128, -128, -103,
+    -128, -128, -122, -128, -128, -105, -128, -122, -71, -111, -93, -128, -106, -128, -116, 13,
+    -128, -88, -46, -112, -127, -128, -128, -123, -128, -128, -83, -128, -63, -110, -128, -128,
+    -128, -128, -128, -128, -117, -97, -128, -3, -128, -128, -122, -128, -128, -73, -128, -62,
+    -128, -128, 12, -128, -96, -128, 12, -128, -63, 33, 28, -38, -128, -128, -128, -128,
+    -111, -128, -128, 27, -128, -128, -110, -68, -128, -128, -128, -123, -87, -124, -100, -128,
+    -128, -128, -128, -128, -83, -128, -128, -128, -128, -128, -128, -92, -128, -109, -128, -96,
+    -128, -128, -128, -106, -128, -126, -128, -122, -128, -83, -110, -128, -122, -123, -101, -4,
+    -128, -78, -128, -128, -128, -118, -56, -128, -128, -128, -96, -128, -128, -127, -128, -128,
+    -128, -128, -128, -56, -117, -124, -128, -32, -120, -74, -128, -114, -98, -73, -128, -58,
+    -128, -128, 28, -124, -100, -128, 23, -23, -39, -31, 30, -128, -128, -128, -128, -128,
+    -78, -128, -109, -95, -128, -80, -117, -68, -111, -128, -96, -123, -95, -111, -104, -128,
+    -128, -128, -128, -83, -88, -128, -128, -128, -128, -119, -7, -128, -128, -114, -128, -128,
+    -128, -66, -128, -70, -128, -128, -62, -121, -128, -128, -40, -128, -128, -128, -65, -85,
+    -128, -127, -128, -128, -128, -120, -81, -128, -65, -128, -128, -128, -128, -128, -104, -128,
+    -128, -99, -105, -125, -117, -128, -128, -26, -128, -128, -128, -111, -102, -77, -128, -65,
+    -128, -113, 13, -127, -111, -128, 29, -106, -77, -7, 6, -24, -128, -128, -128, -128,
+    -128, -77, -127, -128, -128, -121, -128, -68, -128, -128, -121, -123, -75, -118, -100, -119,
+    -128, -123, -128, -64, -98, -128, -110, -128, -73, -121, -128, -128, -128, -128, -128, -115,
+    -126, -128, -112, -128, -128, -106, -128, -122, -55, -94, -44, -128, -128, -128, -128, -31,
+    -128, -83, -14, -128, -128, -123, -128, -128, -108, -128, -128, -109, -53, -102, -128, -128,
+    -128, -126, -71, -128, -125, -109, -128, 17, -128, -128, -105, -128, -128, -52, -122, -71,
+    -128, -128, 29, -121, -88, -128, 35, -98, -71, 26, 9, -67, -128, -128, -123, -128,
+    -128, -128, -121, -128, -128, -128, -127, -68, -128, -128, -128, -123, -66, -128, -128, -119,
+    -125, -111, -128, -91, -104, -128, -128, 13, -128, -128, -128, -128, -124, -128, -128, -108,
+    -124, -128, -98, -115, -118, -128, -128, -124, -114, -128, -71, -128, -118, -128, -128, -35,
+    -128, -71, -128, -107, -95, -123, -128, -128, -124, -128, -94, -128, -128, -128, -120, -128,
+    -128, -128, -128, -128, -128, -128, -128, 1, -128, -115, -125, -122, -128, -77, -128, -62,
+    -128, -128, 71, -122, -90, -128, 21, -89, -41, 38, 13, -72, -128, -128, -128, -128,
+    -128, -107, -128, -120, -128, -128, -128, -68, -128, -128, -128, -123, -71, -128, -127, -128,
+    -128, -119, -122, -121, -107, -128, -128, -68, -77, -128, -91, -124, -128, -128, -128, -128,
+    -95, -128, -94, -128, -128, -124, -128, -120, -71, -128, -97, -106, -128, -128, -128, -51,
+    -128, -78, -128, -128, -110, -128, -128, -127, -128, -128, -128, -128, -128, -128, -128, -128,
+    -128, -128, -96, -128, -128, -128, -125, 14, -128, -128, -125, -128, -128, -73, -128, -62,
+    -128, -128, -46, -128, -128, -114, 30, -27, -22, 50, 53, -128, -128, -128, -128, -128,
+    -120, -128, -126, 127, -126, -119, -87, -68, -128, -79, -128, -123, -26, -128, -128, -128,
+    -115, -102, -128, -108, -82, -17, -128, -92, -119, -128, -128, -115, -128, -89, -128, -118,
+    -54, -128, -112, -108, -128, -113, -128, -116, -87, -128, -94, -120, -128, -128, -115, 23,
+    -128, -60, -106, -120, -57, -128, -128, -128, -18, -128, -106, -128, -3, -104, -128, -128,
+    -112, -93, -115, -42, -93, -77, -115, 49, -128, -128, -110, -126, -66, -73, -128, -62,
+    -117, -9, 20, -128, -53, -128, 61, -40, -44, 34, 50, -128, -128, -128, -128, -128,
+    -128, -44, -128, -128, -128, -128, -128, -68, -128, -128, -103, -123, -114, -128, -95, -117,
+    -107, -128, -128, -128, -35, -128, -128, -128, -128, -115, -123, -125, -127, -128, -128, -49,
+    -128, -128, -128, -128, -128, -118, -128, -121, -128, -69, -128, -124, -24, -67, -128, -31,
+    -128, -63, -128, -128, -128, -49, -43, -128, -48, -116, -37, 9, -115, -128, -128, -128,
+    -59, -109, -102, -128, -87, 127, -94, -4, -37, -54, -117, -128, -105, -73, -128, -76,
+    -128, -128, 19, -128, -19, -128, 60, -128, -82, 41, 18, -5, -128, -128, -128, -128,
+    -128, -128, -128, -126, -128, -128, -128, -69, -128, -128, -72, -123, -65, -108, -128, -128,
+    -57, -128, -128, -128, 44, -128, -128, 1, -128, -128, -128, -128, -107, -99, -69, -128,
+    -128, -113, -128, -128, -128, -128, -65, -121, -128, -114, -128, -127, -42, -119, -128, -28,
+    -128, -91, -128, -77, -128, -80, -12, -128, -128, -128, -66, -75, -128, -128, -128, -108,
+    -108, -108, -128, -70, 0, -128, -80, -39, 9, -101, -82, -128, -72, -73, -128, -90,
+    -128, -128, 17, -128, -40, -128, 50, -99, -27, 44, 23, -59, -128, -128, -128, -128,
+    -128, -128, -128, -107, -128, -128, -128, -71, -128, -128, -17, -120, -109, -128, -128, -128,
+    -128, -128, -128, -128, -59, -128, -128, -128, -128, -128, -128, -128, -93, -112, -128, -128,
+    -120, -16, -128, -49, -128, -128, -128, -123, -128, -88, -128, -128, -71, -128, -128, -39,
+    -128, -111, -128, -128, -128, -99, -128, -128, -115, -128, -128, -128, -128, -128, -128, -128,
+    -128, -87, -119, -62, -37, -99, -119, 3, 9, -101, -118, -43, -93, -73, -128, -64,
+    -128, -128, 17, -128, -71, -128, 42, -76, -2, 22, -10, -87, -128, -128, -128, -83,
+    -128, -80, -128, -82, -128, -128, -98, -69, -128, -128, -91, -100, -111, -128, -128, -128,
+    -128, -117, -128, -128, -71, -128, -128, -128, -110, -128, -124, -115, -105, -100, -117, -128,
+    -128, -77, -95, -128, -128, -128, -114, -124, -128, -86, -86, -128, -117, -45, -128, -35,
+    -128, -128, -128, -128, -125, -101, -128, -128, -128, -128, -121, -128, -91, -128, -128, -128,
+    -128, -88, -126, -128, -51, -128, -114, -15, 3, -128, -99, -128, -125, -73, -128, -44,
+    -128, -128, 17, -116, -74, -128, 45, -128, -17, 35, -16, -11, -128, -128, -126, -113,
+    -110, -128, -128, -83, -128, -128, -128, -68, -128, -128, -45, -115, -38, -125, -128, -128,
+    -128, -109, -128, -128, -106, -128, -128, -128, -128, -128, -113, -128, -126, -128, -123, -128,
+    -99, -68, -83, -128, -128, -128, -100, -99, -128, -118, -128, -128, -126, -128, -128, -43,
+    -128, -128, -127, -128, -128, -107, -128, -128, -128, -128, -91, -128, -128, -128, -108, -128,
+    -128, -83, -128, -116, -128, -128, -113, -27, -23, -106, -116, -88, -96, -73, -128, -72,
+    -128, -128, 17, -95, -80, -128, 40, -121, -46, 28, 5, -63, -128, -128, -128, -128,
+    -49, -127, -124, -67, -128, -128, -128, -68, -128, -128, -80, -123, -105, -128, -128, -127,
+    -128, -92, -128, -128, -128, -128, -128, -128, 19, -118, -128, -128, -121, -128, -128, -128,
+    -128, -128, -75, -49, -128, -105, -128, -104, -55, -67, -71, -128, -104, -128, -128, -42,
+    -128, -128, -56, -128, -98, -126, -128, -128, -128, -128, -128, -128, -21, -128, -128, -128,
+    -128, -110, -61, -106, -128, -41, -104, 21, -89, -119, -128, -128, -128, -73, -128, -92,
+    -128, -111, 17, -92, -73, -124, 38, -29, -48, 3, 7, -94, -128, -128, -55, -128,
+    -128, -128, -127, -128, -128, -128, -128, -68, -128, -128, -121, -123, -80, -128, -128, -128,
+    -128, -128, -128, -128, -128, -128, -128, -127, -128, -92, -39, -128, -128, -128, -128, -128,
+    -117, -126, -92, -91, -123, -66, -85, -106, -128, -128, -78, -128, -108, -128, -128, -31,
+    -128, -128, -128, -128, -96, -128, -128, -128, -116, -128, -36, -128, -128, -128, -128, -128,
+    -128, -102, -128, -128, -128, -128, -100, 0, -109, -128, -128, -128, -128, -73, -128, -62,
+    -128, -126, 17, -63, -82, -128, 34, -128, -42, 17, 27, -45, -128, -128, -128, -128,
+    -126, -60, -118, 31, -128, -128, -91, -68, -128, -128, -90, -123, -41, -124, -92, -119,
+    -128, -128, -128, -128, -128, -128, -128, -128, -76, -113, -128, -106, -128, -128, -128, -117,
+    -128, -119, -128, -128, -114, -126, -128, -127, -28, -107, -128, -128, -124, -108, -128, -37,
+    -128, -94, 18, -128, -128, -128, -128, -128, -128, -128, -128, -128, -7, -119, -118, -128,
+    -128, -117, -37, -119, -128, -53, -128, -33, -104, -128, -128, -78, -106, -73, -128, -64,
+    -128, -128, 17, -46, -77, -115, 34, -26, -17, 24, 29, -58, -128, -128, 14, -128,
+    -128, -128, -125, -128, -128, -128, -128, -68, -128, -128, -93, -123, -96, -128, -104, -128,
+    -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -44, -128, -128, -79, -128, -125,
+    -127, -108, -128, -83, -84, -128, -128, -120, -128, -128, -64, -128, -120, -128, -128, -40,
+    -128, -89, -128, -126, -106, -128, -128, -128, -27, -128, 23, -128, -128, -128, -128, -73,
+    -112, -128, -128, -128, -128, -128, -106, 44, -112, -52, -128, -124, -128, -73, -128, -64,
+    -128, -107, 23, -85, -91, -128, 28, -128, -74, 38, 14, -95, -128, -128, -128, -120,
+    -128, -78, -113, -122, -128, -128, -107, -68, -128, -128, -94, -123, -64, -121, -128, -128,
+    -125, -128, -128, -128, -111, -128, -128, -44, -1, -108, -75, -128, -128, -121, -83, -128,
+    -128, -118, -127, -128, -86, -112, -44, -118, 25, -128, -119, -128, -122, -84, -128, -23,
+    -128, -123, -128, -128, -113, -128, -128, -128, -128, -128, -128, -128, -60, -95, -128, -128,
+    -128, -127, 17, -128, -128, -128, -120, -27, -128, -128, -128, -128, -119, -73, -128, -65,
+    -128, -128, 3, -117, -90, -128, 19, -128, -46, 39, 24, -17, -128, -128, -128, -128,
+    -128, -85, -128, 64, -128, -128, -84, -68, -128, -128, -128, -123, -67, -106, -19, -128,
+    -118, -128, -128, -128, -103, -128, -128, -128, -128, -119, -128, -128, -128, -128, -56, -92,
+    -128, -128, -128, -115, -128, -128, -128, -128, -72, -90, -106, -128, -126, -118, -128, -30,
+    -128, -69, -32, -113, -128, -128, -85, -115, -128, -128, -69, -128, -44, -57, -128, -128,
+    -128, -128, -128, -88, -119, -88, -128, -7, -105, -128, -128, -128, -113, -73, -128, -62,
+    -128, -128, 33, -118, -98, -128, 25, -17, -21, 13, 35, -89, -128, -128, -56, -128,
+    -101, -128, -118, -128, -128, -126, -128, -68, -128, -128, -122, -123, -128, -128, -128, -128,
+    -111, -128, -128, -109, -78, -128, -128, -128, -128, -128, -41, -128, -128, -110, -128, -128,
+    -126, -61, -128, -65, -128, -128, -123, -118, -128, -128, -49, -128, -127, -128, -121, 0,
+    -128, -92, -128, -128, -92, -123, -61, -128, -26, -128, -25, -128, -128, -128, -103, -61,
+    -128, -110, -128, -128, -90, -127, -128, -15, -118, -59, -128, -105, -128, -73, -128, -62,
+    -128, -100, 3, -128, -106, -128, 29, -123, -98, 43, 12, -77, -128, -128, -128, -93,
+    -128, -128, -104, -128, -128, -128, -128, -68, -128, -128, -128, -123, -82, -128, -128, -121,
+    -113, -125, -128, -128, -67, -128, -128, -41, 26, -128, -119, -128, -114, -102, -85, -128,
+    -128, -125, -104, -128, -116, -109, -63, -120, -6, -98, -119, -128, -128, -128, -128, -15,
+    -128, -115, -125, -128, -90, -128, -128, -128, -128, -128, -128, -128, -102, -128, -128, -128,
+    -128, -126, -8, -128, -111, -128, -124, -14, -128, -128, -128, -128, -122, -78, -128, -62,
+    -128, -128, 46, -128, -91, -128, 26, -119, -39, 50, 41, -31, -128, -128, -128, -128,
+    -91, -55, -128, -57, -128, -128, -102, -68, -128, -128, -128, -123, -94, -128, -60, -95,
+    -109, -105, -128, -128, -86, -128, -128, -128, -124, -128, -128, -128, -128, -128, -67, -97,
+    -128, -128, -112, -128, -125, -91, -128, -121, -59, -93, -81, -121, -128, -128, -128, -61,
+    -128, -89, -64, -120, -104, -128, -128, -124, -128, -128, -105, -128, -31, -80, -128, -128,
+    -128, -128, -128, -108, -128, -84, -128, 12, -112, -128, -128, -128, -128, -44, -128, -62,
+    -128, -128, 0, -127, -89, -125, 29, -128, -55, 27, 34, -54, -128, -128, -41, -128,
+    -122, -128, -126, -33, -128, -128, -128, -68, -128, -128, -128, -123, -92, -128, -128, -128,
+    -108, -98, -128, -128, -86, -128, -128, -128, -128, -128, -128, -107, -125, -110, -128, -94,
+    -128, -128, -120, -92, -128, -113, -128, -121, -128, -75, -107, -125, -128, -110, -128, -1,
+    -128, -81, -128, -128, -116, -104, -95, -128, -128, -128, -56, -128, -128, -127, -128, -124,
+    -128, -128, -128, -123, -128, -101, -128, -16, -95, -43, -128, -117, -128, -77, -128, -61,
+    -128, -128, 31, -128, -98, -128, 17, -47, -87, -11, 38, -105, -128, -128, -128, -86,
+    -66, -128, -102, -107, -128, -104, -128, -68, -128, -128, -92, -123, -94, -128, -128, -128,
+    -122, -128, -108, -67, -61, -128, -128, -128, -109, -123, -12, -128, 37, -121, -128, -128,
+    -125, -84, -116, -82, -94, -121, -36, -121, -128, -128, -42, -128, -128, -128, -128, -65,
+    -128, -121, -128, -128, -128, -120, -128, -128, -115, -128, -128, -128, -128, -128, -128, -128,
+    -128, -112, -99, -128, -110, -128, -128, 4, -128, -128, -128, -128, -98, -74, -128, -62,
+    -128, -128, 14, -128, -112, -128, 15, -95, -54, 2, 16, -40, -128, -128, -128, -128,
+    -123, -68, -128, -128, -128, -128, -124, -68, -128, -128, -128, -123, -73, -117, -71, -110,
+    -121, -128, -128, -51, -89, -128, -128, -128, -106, -117, -128, -119, -75, -128, -120, -99,
+    -117, -128, -128, -128, -118, -128, -128, -122, -62, -83, -49, -122, -128, -128, -118, -29,
+    -128, -92, -7, -122, -128, -128, -128, -125, -105, -128, -128, -107, -49, -105, -128, -128,
+    -128, -128, -78, -128, -128, -73, -128, -22, -120, -126, -110, -103, -128, -68, -102, -66,
+    -128, -126, 24, -128, -83, -128, 12, -92, -66, 21, 4, -73, -128, -128, -128, -128,
+    -128, -128, -116, -128, -128, -128, -121, -68, -126, -128, -128, -123, -86, -128, -94, -128,
+    -128, -128, -128, -92, -86, -128, -128, 25, -128, -128, -122, -128, -74, -122, -128, -110,
+    -127, -128, -128, -116, -117, -128, -116, -120, -113, -128, -102, -123, -120, -128, -78, -55,
+    -128, -83, -128, -96, -89, -128, -93, -128, -89, -128, -107, -92, -128, -114, -111, -128,
+    -128, -128, -128, -128, -113, -128, -128, -22, -128, -102, -98, -128, -128, -74, -128, -67,
+    -128, -121, 61, -128, -79, -128, 18, -88, -83, 35, 21, -90, -128, -128, -128, -128,
+    -128, -80, -128, -89, -128, -128, -70, -68, -128, -118, -128, -123, -111, -128, -64, -128,
+    -128, -128, -128, -128, -90, -128, -128, -55, -123, -128, -82, -125, -57, -128, -128, -128,
+    -100, -128, -128, -128, -109, -128, -128, -110, -69, -128, -104, -93, -128, -128, -77, -50,
+    -128, -96, -128, -101, -117, -127, -128, -103, -128, -128, -128, -84, -128, -128, -72, -128,
+    -128, -128, -87, -128, -90, -119, -128, -29, -128, -128, -105, -128, -128, -73, -128, -58,
+    -128, -128, -46, -123, -128, -127, 21, -38, 4, 53, 44, -128, -128, -128, -120, -128,
+    -128, -128, -126, 127, -97, -128, -128, -68, -128, -71, -128, -123, -38, -108, -62, -128,
+    -125, -110, -128, -128, -107, 1, -128, -114, -128, -128, -128, -126, -125, -79, -113, -109,
+    -50, -128, -128, -113, -105, -128, -128, -120, -109, -128, -119, -120, -128, -128, -128, -55,
+    -128, -70, -95, -119, -85, -128, -111, -128, -5, -128, -68, -112, -7, -93, -128, -128,
+    -128, -97, -128, 11, -85, -90, -128, 88, -128, -128, -109, -117, -58, -73, -128, -62,
+    -128, -128, 17, -111, -101, -128, 43, -91, 9, 29, 36, -128, -128, -46, -128, -128,
+    -128, -75, -125, -51, -128, -128, -95, -68, -128, -128, -80, -123, -50, -128, -115, -128,
+    -128, -128, -128, -128, -105, -128, -128, -128, -128, -128, -128, -90, -125, -128, -128, -63,
+    -128, -111, -128, -128, -128, -128, -128, -121, -128, -83, -128, -128, -117, -105, -128, -32,
+    -128, -108, -128, -128, -128, -35, -104, -106, -61, -128, -41, -128, -104, -128, -91, -128,
+    -85, -123, -86, -123, -128, 98, -126, 25, -98, -72, -128, -128, -128, -73, -128, -64,
+    -128, -128, 17, -72, -71, -128, 43, -72, -11, 14, 14, -45, -128, -128, -39, -128,
+    -69, -128, -127, -128, -128, -128, -128, -68, -128, -128, -33, -123, -49, -128, -128, -128,
+    -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -114, -91, -96, -54, -128, -117,
+    -128, -38, -108, -128, -128, -92, -112, -124, -128, -128, -115, -128, -128, -128, -128, -46,
+    -128, -115, -128, -128, -121, -89, -128, -128, -119, -128, -47, -128, -128, -128, -95, -68,
+    -128, -108, -128, -116, -128, -128, -111, 5, -24, -98, -128, -108, -128, -73, -128, -75,
+    -128, -128, 17, -52, -71, -128, 42, -121, -36, 14, 16, -64, -128, -128, -128, -128,
+    -118, -128, -128, -95, -128, -128, -85, -68, -128, -128, -81, -121, -58, -128, -128, -125,
+    -128, -115, -128, -128, -128, -128, -128, -128, -1, -128, -128, -88, -91, -104, -128, -128,
+    -127, -114, -95, -117, -128, -102, -126, -128, -83, -107, -61, -128, -128, -128, -128, -24,
+    -128, -114, -86, -128, -83, -117, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128,
+    -128, -112, -35, -128, -128, -128, -103, 0, -22, -104, -128, -114, -128, -73, -128, -65,
+    -128, -128, 17, -36, -74, -126, 43, -81, -41, 1, 34, -82, -128, -128, -118, -128,
+    -90, -87, -117, -111, -128, -128, -104, -68, -128, -128, -116, -118, -76, -128, -113, -116,
+    -128, -123, -128, -128, -128, -128, -128, -128, -52, -128, -123, -95, -105, -119, -128, -128,
+    -128, -127, -102, -128, -76, -84, -124, -101, -92, -121, -32, -124, -128, -126, -128, -45,
+    -128, -115, -128, -128, -91, -128, -128, -128, -119, -128, -128, -128, -75, -128, -128, -128,
+    -128, -108, -128, -128, -128, -128, -125, 13, -35, -128, -128, -116, -128, -73, -128, -62,
+    -128, -128, 17, -54, -79, -112, 39, -108, -84, 13, 32, -64, -128, -113, -41, -128,
+    -128, -128, -113, -96, -128, -128, -128, -68, -128, -128, -108, -120, -43, -121, -128, -128,
+    -128, -128, -128, -128, -128, -128, -128, -128, -119, -128, -102, -96, -12, -128, -128, -128,
+    -125, -86, -102, -128, -69, -84, -107, -102, -128, -128, -110, -128, -128, -128, -128, -23,
+    -128, -109, -128, -124, -106, -128, -128, -128, -128, -128, -69, -128, -128, -128, -128, -128,
+    -100, -110, -128, -123, -128, -128, -112, -20, -37, -124, -128, -128, -109, -73, -128, -62,
+    -128, -128, 17, -72, -89, -111, 31, -122, -24, 7, 35, -31, -128, -128, -128, -128,
+    -52, -110, -125, -98, -128, -128, -127, -68, -128, -128, -128, -123, -50, -128, -99, -121,
+    -128, -128, -128, -128, -128, -128, -128, -128, -87, -128, -128, -93, -128, -117, -128, -107,
+    -128, -128, -110, -128, -105, -101, -128, -123, -76, -88, -69, -128, -128, -96, -128, -26,
+    -128, -91, -34, -128, -128, -128, -121, -128, -128, -126, -128, -128, -37, -128, -122, -128,
+    -128, -123, -101, -128, -128, -37, -128, 13, -128, -109, -128, -98, -128, -73, -100, -62,
+    -128, -116, 17, -103, -73, -115, 34, -36, -36, -21, 9, -99, -128, -128, -47, -128,
+    -128, -128, -128, -128, -128, -128, -128, -68, -128, -128, -128, -123, -75, -111, -87, -128,
+    -121, -128, -128, -106, -108, -128, -128, -73, -128, -128, -45, -128, -116, -126, -128, -128,
+    -106, -114, -118, -100, -91, -128, -105, -121, -128, -128, -26, -128, -128, -94, -128, -49,
+    -128, -105, -128, -117, -80, -128, -101, -128, -69, -128, -56, -128, -128, -128, -121, -128,
+    -98, -120, -128, -128, -124, -128, -117, 7, -128, -128, -128, -128, -128, -73, -128, -62,
+    -128, -128, 17, -128, -92, -128, 30, -128, -70, 10, 18, -52, -128, -128, -128, -128,
+    -128, -55, -113, 57, -128, -128, -121, -68, -128, -128, -115, -123, -49, -125, -128, -128,
+    -127, -115, -128, -128, -74, -128, -128, -64, -81, -128, -128, -128, -128, -128, -99, -106,
+    -128, -128, -118, -128, -128, -90, -127, -123, -56, -120, -128, -128, -128, -78, -128, 17,
+    -128, -83, 0, -128, -115, -128, -128, -128, -128, -128, -128, -128, -41, -124, -128, -128,
+    -128, -120, -34, -122, -118, -61, -121, -23, -128, -128, -109, -128, -125, -73, -128, -59,
+    -128, -124, 21, -128, -92, -124, 37, -22, -50, 15, 37, -57, -128, -128, -64, -128,
+    -112, -128, -128, -128, -128, -128, -128, -68, -128, -128, -128, -123, -113, -128, -75, -118,
+    -128, -128, -128, -107, -74, -128, -128, -128, -128, -128, -51, -128, -128, -83, -128, -127,
+    -128, -97, -128, -98, -128, -97, -128, -123, -128, -116, -17, -128, -128, -128, -128, -33,
+    -128, -82, -128, -111, -128, -128, -91, -123, -31, -128, -2, -128, -128, -128, -128, -67,
+    -128, -128, -128, -128, -85, -128, -125, -1, -128, -56, -128, -107, -114, -73, -128, -63,
+    -128, -128, 32, -128, -90, -128, 17, -128, -55, 40, 24, -77, -128, -128, -128, -109,
+    -128, -75, -128, -117, -128, -128, -128, -68, -128, -128, -126, -123, -44, -126, -128, -128,
+    -110, -120, -128, -128, -73, -128, -128, -45, -16, -128, -124, -128, -128, -128, -96, -128,
+    -116, -109, -128, -128, -128, -124, -55, -119, 4, -128, -128, -128, -128, -86, -128, -57,
+    -128, -112, -128, -128, -98, -128, -128, -128, -128, -128, -128, -128, -26, -109, -128, -128,
+    -128, -126, -8, -128, -128, -128, -116, 2, -97, -128, -128, -128, -128, -73, -128, -67,
+    -128, -128, 7, -128, -85, -128, 33, -125, -58, 33, 31, -41, -128, -128, -128, -128,
+    -128, -107, -128, 69, -128, -128, -106, -68, -128, -128, -108, -123, -75, -126, -89, -128,
+    -123, -113, -128, -128, -93, -128, -128, -128, -128, -128, -128, -128, -127, -128, -128, -83,
+    -128, -128, -128, -92, -128, -127, -128, -118, -121, -103, -96, -128, -128, -92, -128, 15,
+    -128, -69, -47, -111, -128, -121, -62, -128, -128, -128, -62, -128, -101, -103, -128, -128,
+    -128, -128, -128, -97, -128, -69, -128, -33, -75, -128, -113, -117, -112, -73, -128, -62,
+    -128, -128, 38, -116, -103, -126, 21, -33, -58, 3, 26, -82, -128, -128, -40, -128,
+    -76, -128, -116, -128, -128, -110, -128, -68, -128, -128, -128, -123, -106, -122, -128, -128,
+    -128, -128, -128, -64, -107, -128, -128, -128, -128, -122, -3, -114, -118, -105, -128, -128,
+    -121, -103, -123, -109, -128, -128, -96, -111, -128, -128, -35, -128, -128, -128, -128, -62,
+    -128, -96, -128, -128, -128, -118, -128, -128, -67, -128, -46, -128, -128, -128, -128, -66,
+    -128, -104, -128, -128, -106, -128, -128, 13, -109, -94, -128, -128, -128, -75, -128, -62,
+    -128, -102, 13, -87, -114, -91, 9, -121, -55, 37, 14, -73, -128, -128, -128, -128,
+    -128, -128, -119, -81, -128, -122, -127, -68, -128, -128, -128, -123, -59, -128, -116, -110,
+    -128, -121, -128, -96, -128, -128, -128, -89, 0, -128, -127, -128, -127, -121, -128, -128,
+    -127, -128, -112, -128, -107, -128, -100, -122, 13, -127, -128, -128, -128, -128, -128, -62,
+    -128, -100, -86, -128, -112, -128, -128, -128, -128, -128, -128, -128, -104, -94, -128, -128,
+    -128, -119, -14, -128, -128, -128, -128, -4, -126, -128, -128, -95, -128, -41, -128, -62,
+    -128, -128, 6, -81, -110, -116, 2, -128, -52, 46, 27, -37, -128, -128, -128, -128,
+    -80, -33, -128, -65, -128, -128, -78, -68, -128, -128, -128, -123, -62, -128, -75, -128,
+    -128, -125, -128, -126, -128, -128, -128, -128, -128, -128, -128, -128, -126, -128, -128, -103,
+    -109, -128, -126, -128, -128, -128, -128, -121, -44, -103, -103, -128, -128, -128, -128, -47,
+    -128, -80, -75, -128, -120, -128, -111, -128, -128, -128, -108, -128, 0, -26, -117, -128,
+    -128, -128, -128, -128, -128, -104, -128, 5, -119, -128, -128, -118, -128, -128, -119, -62,
+    -128, -128, 42, -91, -105, -108, 9, -114, -69, 16, 48, -56, -128, -128, -50, -128,
+    -128, -128, -107, -76, -128, -128, -128, -68, -128, -128, -128, -123, -83, -128, -128, -128,
+    -128, -128, -128, -90, -117, -128, -128, -121, -128, -128, -122, -124, -77, -90, -128, -102,
+    -128, -90, -128, -88, -128, -128, -128, -121, -128, -101, -82, -128, -128, -128, -128, -57,
+    -128, -65, -128, -128, -117, -120, -84, -128, -128, -128, -20, -128, -128, -105, -125, -73,
+    -128, -111, -128, -94, -128, -72, -128, -11, -83, -35, -128, -128, -128, -48, -128, -62,
+    -128, -128, 33, -97, -101, -122, 19, -43, -60, -3, 19, -99, -128, -128, -128, -113,
+    -76, -128, -117, -123, -128, -112, -121, -68, -120, -128, -128, -123, -75, -128, -128, -115,
+    -128, -128, -97, -46, -109, -128, -128, -128, -99, -128, -32, -128, -128, -95, -128, -128,
+    -124, -124, -124, -108, -100, -128, -54, -121, -108, -128, -43, -128, -128, -128, -128, -42,
+    -128, -105, -128, -128, -119, -128, -128, -128, -113, -128, -128, -128, -128, -128, -128, -128,
+    -128, -111, -57, -128, -128, -128, -128, -7, -120, -128, -128, -117, -123, -70, -128, -62,
+    -128, -114, -6, -119, -121, -106, 35, -128, -56, 15, 8, -24, -128, -128, -128, -128,
+    -128, -61, -126, -128, -128, -128, -128, -68, -128, -128, -100, -123, -41, -114, -57, -126,
+    -128, -128, -128, -54, -100, -128, -128, -124, -99, -114, -128, -128, -128, -128, -128, -107,
+    -120, -128, -123, -128, -128, -116, -128, -120, -71, -69, -57, -128, -128, -128, -128, -26,
+    -128, -90, -15, -127, -125, -128, -128, -128, -110, -128, -128, -128, -9, -105, -128, -128,
+    -128, -128, -115, -128, -128, -52, -127, 6, -128, -96, -126, -127, -128, -89, -128, -64,
+    -128, -97, 28, -128, -82, -128, 36, -83, -70, 4, 24, -66, -128, -128, -120, -128,
+    -128, -128, -107, -128, -128, -128, -128, -68, -128, -128, -87, -123, -65, -128, -128, -122,
+    -128, -128, -128, -107, -53, -128, -128, 22, -128, -111, -128, -128, -128, -110, -128, -128,
+    -128, -99, -128, -128, -128, -101, -117, -116, -128, -96, -69, -128, -115, -128, -128, -101,
+    -128, -107, -128, -88, -104, -110, -76, -128, -84, -128, -83, -115, -128, -127, -128, -121,
+    -128, -119, -128, -128, -87, -128, -114, -26, -128, -16, -110, -128, -128, -69, -128, -65,
+    -128, -128, 50, -128, -46, -128, 29, -60, -61, 1, 52, -105, -128, -128, -128, -126,
+    -128, 2, -128, -128, -128, -128, -102, -68, -128, -128, -91, -123, -91, -128, -128, -128,
+    -114, -128, -128, -128, -45, -128, -128, -39, -32, -95, -57, -111, -128, -128, -128, -128,
+    -92, -69, -128, -128, -128, -110, -117, -121, -30, -128, -69, -91, -120, -71, -123, -103,
+    -128, -123, -128, -128, -107, -128, -128, -128, -128, -128, -128, -107, -73, -128, -128, -128,
+    -38, -128, -35, -128, -82, -122, -120, -15, -125, -128, -72, -128, -128, -73, -128, -65,
+    -128, -128, -36, -128, -121, -128, 39, -65, -6, 39, 43, -128, -128, -128, -128, -128,
+    -128, -128, -128, 127, -115, -98, -81, -68, -128, -128, -128, -123, 11, -117, -82, -128,
+    -128, -126, -128, -128, -64, -17, -128, -85, -128, -128, -128, -122, -126, -102, -107, -110,
+    -52, -128, -128, -128, -128, -128, -128, -125, -128, -128, -128, -114, -128, -102, -72, 48,
+    -128, -92, -43, -106, -87, -128, -59, -128, -79, -128, 0, -94, -56, -128, -124, -100,
+    -128, -83, -128, -29, -86, -81, -128, 28, -128, -128, -76, -76, -72, -73, -128, -62,
+    -128, -120, 17, -128, -99, -128, 35, -114, -18, 39, 42, -128, -128, -128, -128, -128,
+    -128, -128, -117, 62, -128, -128, -86, -68, -115, -128, -110, -123, -46, -128, -119, -128,
+    -121, -126, -128, -128, -46, -128, -128, -128, -128, -128, -128, -95, -125, -128, -78, -90,
+    -128, -81, -104, -128, -128, -121, -128, -121, -128, -116, -128, -128, -122, -92, -128, -60,
+    -128, -94, -128, -128, -128, -52, -67, -89, -128, -128, -32, -128, -104, -128, -128, -128,
+    -128, -128, -29, -90, -117, 5, -128, 5, -100, -121, -128, -128, -128, -73, -128, -62,
+    -128, -128, 17, -88, -90, -128, 44, -59, -26, -3, 36, -46, -128, -128, -90, -128,
+    -24, -128, -128, -128, -128, -128, -128, -68, -124, -128, -84, -123, -93, -122, -113, -126,
+    -123, -128, -128, -100, -126, -128, -128, -128, -128, -128, -128, -99, -128, -101, -128, -107,
+    -128, -73, -127, -36, -122, -128, -128, -124, -128, -128, -26, -128, -128, -128, -128, -39,
+    -128, -96, -128, -128, -128, -103, -128, -128, -63, -128, -73, -128, -128, -128, -128, -97,
+    -87, -127, -128, -98, -128, -128, -106, 28, -80, -89, -128, -46, -110, -73, -128, -62,
+    -128, -128, 17, -89, -86, -128, 44, -87, -53, -33, 16, -97, -128, -128, -128, -128,
+    -109, -128, -128, -87, -128, -128, -128, -68, -128, -128, -128, -123, -63, -112, -110, -128,
+    -128, -128, -128, -48, -121, -128, -128, -128, -125, -116, -104, -95, -128, -115, -128, -128,
+    -126, -128, -124, -128, -128, -119, -128, -108, -124, -128, -54, -128, -128, -128, -128, -21,
+    -128, -88, -128, -128, -111, -121, -103, -128, -128, -128, -128, -128, -128, -128, -95, -128,
+    -128, -117, -89, -128, -128, -128, -128, -4, -125, -112, -128, -128, -128, -73, -128, -62,
+    -128, -124, 17, -96, -87, -128, 42, -121, -54, -31, 8, -72, -128, -128, -128, -128,
+    -108, -110, -116, -82, -128, -128, -70, -68, -128, -128, -128, -123, -66, -128, -128, -128,
+    -128, -111, -128, -54, -121, -128, -128, -128, -128, -128, -103, -97, -128, -113, -128, -128,
+    -128, -128, -115, -128, -128, -124, -116, -87, -82, -128, -49, -128, -128, -128, -125, -11,
+    -128, -91, -123, -128, -128, -128, -122, -128, -128, -128, -128, -128, -95, -128, -77, -128,
+    -128, -113, -97, -98, -128, -119, -128, -2, -128, -128, -128, -116, -128, -73, -128, -62,
+    -128, -101, 17, -95, -99, -125, 24, -37, -27, -3, -9, -78, -128, -128, -128, -128,
+    -122, -116, -128, -128, -128, -121, -73, -68, -87, -128, -128, -123, -83, -116, -39, -123,
+    -126, -120, -128, -50, -125, -128, -128, -128, -128, -128, -85, -111, -128, -128, -128, -128,
+    -121, -128, -117, -121, -128, -128, -128, -116, -121, -128, -68, -128, -128, -128, -128, -25,
+    -128, -89, -128, -120, -109, -128, -105, -107, -68, -128, -89, -128, -128, -128, -128, -128,
+    -128, -128, -128, -128, -128, -128, -128, 11, -128, -128, -128, -120, -128, -73, -128, -62,
+    -128, -100, 17, -124, -100, -128, 26, -128, -62, 26, 8, -25, -128, -128, -128, -128,
+    -126, -108, -128, -128, -128, -128, -123, -68, -128, -128, -128, -123, -67, -128, -68, -128,
+    -115, -107, -128, -128, -94, -128, -128, -61, -128, -128, -128, -97, -124, -128, -64, -104,
+    -128, -128, -128, -128, -128, -128, -128, -121, -99, -103, -76, -128, -128, -128, -128, -60,
+    -128, -76, -35, -128, -113, -128, -102, -128, -128, -128, -128, -128, -60, -128, -109, -128,
+    -128, -128, -122, -128, -121, -35, -122, 0, -128, -82, -128, -128, -113, -73, -128, -62,
+    -128, -96, 17, -128, -76, -128, 13, -51, -78, 19, 7, -90, -128, -128, -115, -128,
+    -128, -128, -128, -128, -128, -125, -120, -68, -128, -128, -116, -123, -84, -124, -99, -128,
+    -128, -128, -128, -128, -75, -128, -128, -35, -128, -128, -68, -128, -107, -122, -109, -128,
+    -93, -128, -123, -69, -123, -128, -95, -121, -128, -128, -48, -128, -107, -128, -128, -19,
+    -128, -96, -128, -113, -128, -128, -121, -127, -128, -128, -95, -118, -128, -128, -128, -128,
+    -128, -128, -128, -128, -128, -128, -119, 1, -128, -128, -128, -128, -128, -73, -128, -62,
+    -128, -128, 18, -122, -95, -128, 33, -128, -42, 21, 30, -64, -128, -128, -128, -128,
+    -128, -80, -109, 45, -128, -128, -123, -68, -128, -128, -128, -123, -72, -124, -128, -128,
+    -128, -128, -128, -128, -110, -128, -128, -121, -111, -119, -128, -116, -126, -128, -128, -105,
+    -128, -127, -124, -128, -128, -128, -128, -123, -72, -123, -128, -128, -128, -71, -128, -70,
+    -128, -85, -17, -128, -128, -128, -118, -128, -128, -128, -128, -128, -74, -128, -124, -128,
+    -96, -106, -69, -110, -128, -28, -122, 1, -125, -128, -128, -96, -128, -73, -128, -62,
+    -128, -128, 35, -122, -99, -128, 18, -18, -59, 12, 20, -69, -128, -128, -84, -128,
+    -103, -128, -128, -128, -128, -128, -128, -68, -119, -128, -128, -123, -119, -128, -92, -128,
+    -119, -128, -128, -85, -94, -128, -128, -128, -128, -128, -14, -128, -59, -90, -128, -128,
+    -106, -90, -108, -115, -128, -128, -128, -113, -128, -128, -40, -128, -128, -128, -128, -29,
+    -128, -83, -128, -128, -128, -121, -128, -128, -84, -128, -27, -128, -128, -128, -76, -125,
+    -128, -128, -128, -128, -109, -128, -128, 3, -116, -107, -128, -128, -128, -73, -124, -62,
+    -128, -128, -23, -90, -117, -120, 16, -128, -51, 40, 4, -57, -128, -128, -128, -128,
+    -128, -89, -121, -128, -128, -128, -128, -68, -128, -128, -128, -123, -47, -122, -128, -128,
+    -128, -125, -128, -119, -118, -128, -128, -45, 16, -128, -128, -128, -124, -128, -128, -128,
+    -103, -128, -94, -128, -108, -128, -84, -116, -3, -125, -128, -128, -120, -128, -128, -53,
+    -128, -111, -95, -128, -109, -128, -128, -128, -128, -128, -128, -128, -13, -66, -122, -128,
+    -128, -116, -43, -128, -128, -125, -126, 23, -123, -128, -128, -85, -128, -73, -128, -62,
+    -128, -128, 36, -113, -93, -128, 25, -118, -69, 30, 40, -58, -128, -128, -128, -128,
+    -123, -104, -118, 35, -128, -128, -111, -68, -128, -128, -128, -123, -82, -128, -125, -126,
+    -128, -126, -128, -106, -95, -128, -128, -117, -128, -128, -128, -128, -128, -128, -128, -58,
+    -128, -128, -106, -108, -128, -104, -128, -105, -128, -101, -128, -128, -124, -117, -128, -61,
+    -128, -84, -79, -98, -128, -128, -123, -128, -128, -128, -66, -124, -123, -80, -81, -128,
+    -128, -128, -128, -110, -128, -66, -128, -12, -128, -122, -126, -128, -123, -73, -128, -62,
+    -128, -104, 34, -128, -109, -128, 12, -42, -67, 4, 25, -69, -128, -128, -96, -128,
+    -94, -128, -108, -128, -128, -128, -128, -68, -128, -128, -128, -123, -96, -128, -128, -128,
+    -128, -128, -128, -64, -70, -128, -128, -128, -128, -128, -1, -128, -128, -90, -128, -128,
+    -126, -120, -110, -122, -121, -112, -84, -119, -128, -128, -40, -128, -128, -128, -128, -59,
+    -128, -104, -128, -128, -128, -122, -123, -128, -90, -128, -72, -109, -128, -128, -128, -93,
+    -128, -112, -128, -128, -122, -128, -128, 0, -128, -110, -128, -128, -99, -66, -128, -62,
+    -128, -75, 22, -128, -113, -125, 1, -104, -58, 25, 25, -72, -128, -128, -128, -128,
+    -123, -107, -122, -117, -128, -127, -112, -68, -107, -128, -125, -123, -73, -116, -118, -125,
+    -128, -128, -128, -89, -89, -128, -89, -121, -37, -115, -103, -128, -128, -128, -128, -128,
+    -115, -128, -114, -128, -119, -128, -128, -122, 16, -128, -92, -128, -120, -102, -128, -19,
+    -128, -93, -57, -128, -128, -128, -128, -128, -128, -128, -128, -128, -93, -115, -128, -128,
+    -128, -121, -23, -128, -128, -127, -128, 6, -128, -128, -118, -105, -110, -106, -108, -62,
+    -128, -128, -13, -126, -122, -128, -9, -128, -81, 40, 18, -41, -128, -128, -128, -128,
+    -128, -66, -125, -38, -128, -128, -78, -68, -116, -128, -128, -123, -38, -120, -98, -128,
+    -128, -128, -128, -118, -89, -128, -98, -128, -128, -128, -128, -128, -128, -128, -128, -110,
+    -120, -128, -114, -128, -128, -122, -128, -121, -59, -116, -128, -128, -120, -128, -128, -27,
+    -128, -70, -85, -117, -128, -128, -91, -128, -128, -128, -96, -115, -16, -18, -128, -128,
+    -128, -128, -128, -84, -128, -110, -128, -18, -128, -128, -119, -128, -109, -56, -105, -62,
+    -128, -128, 36, -119, -113, -126, 7, -95, -57, 15, 37, -45, -128, -128, -58, -128,
+    -111, -128, -117, -84, -128, -128, -128, -68, -128, -128, -128, -123, -70, -128, -103, -128,
+    -128, -128, -128, -65, -96, -128, -128, -120, -128, -128, -128, -128, -128, -85, -128, -109,
+    -128, -128, -111, -47, -128, -122, -128, -121, -128, -122, -59, -128, -128, -128, -128, -50,
+    -128, -61, -128, -116, -128, -128, -113, -128, -113, -108, -23, -128, -128, -106, -128, -24,
+    -128, -109, -128, -95, -98, -66, -125, 14, -128, -37, -128, -121, -118, -73, -128, -65,
+    -128, -93, 29, -128, -102, -128, 13, -19, -60, -4, 4, -110, -128, -128, -128, -110,
+    -113, -128, -125, -128, -128, -105, -128, -68, -104, -128, -128, -123, -100, -127, -112, -125,
+    -128, -128, -101, -39, -79, -128, -128, -128, -128, -128, -22, -117, -128, -88, -128, -128,
+    -114, -128, -120, -128, -114, -128, -61, -121, -121, -128, -45, -128, -128, -128, -124, -67,
+    -128, -86, -128, -128, -128, -128, -112, -128, -51, -128, -128, -128, -128, -128, -98, -128,
+    -128, -117, -56, -128, -113, -128, -128, 2, -128, -128, -124, -128, -113, -69, -104, -68,
+    -128, -108, 1, -128, -114, -128, 31, -128, -92, 29, 26, -17, -128, -128, -128, -128,
+    -128, -77, -122, -87, -128, -128, -80, -68, -128, -128, -128, -123, -62, -106, -99, -112,
+    -100, -112, -128, -121, -75, -128, -128, -52, -107, -128, -128, -119, -74, -128, -42, -107,
+    -120, -128, -124, -128, -128, -128, -128, -121, -67, -95, -69, -128, -127, -128, -128, -7,
+    -128, -84, -11, -104, -118, -128, -128, -128, -128, -128, -128, -108, -30, -105, -128, -128,
+    -128, -128, -93, -128, -123, -40, -128, -14, -128, -128, -124, -128, -128, -92, -123, -54,
+    -128, -128, 27, -88, -107, -121, 12, -65, -47, 0, 12, -75, -128, -128, -33, -128,
+    -128, -128, -122, -128, -128, -128, -128, -68, -128, -128, -85, -123, -102, -128, -122, -128,
+    -128, -118, -128, -100, -112, -128, -128, -95, -128, -128, -128, -128, -126, -96, -128, -128,
+    -127, -120, -112, -78, -103, -128, -128, -121, -128, -98, -54, -128, -128, -128, -128, 2,
+    -128, -95, -128, -112, -90, -128, -128, -128, -58, -128, -44, -128, -128, -118, -128, -95,
+    -128, -128, -128, -128, -128, -128, -114, 10, -123, -30, -128, -84, -128, -69, -128, -64,
+    -128, -128, 41, -92, -76, -128, 53, -35, -40, -3, 30, -122, -128, -128, -128, -128,
+    -128, 6, -128, -128, -128, -124, -128, -68, -128, -128, -69, -123, -128, -128, -88, -128,
+    -128, -128, -128, -128, -102, -128, -128, 18, -56, -128, -55, -108, -128, -128, -103, -128,
+    -99, -128, -108, -128, -104, -128, -103, -121, -76, -128, -42, -128, -128, -108, -128, -47,
+    -128, -115, -128, -128, -82, -128, -117, -109, -111, -128, -128, -128, -80, -128, -128, -128,
+    -128, -128, -61, -128, -128, -128, -116, 17, -84, -128, -128, -124, -128, -73, -128, -68,
+    -128, -128, 26, -128, -103, -128, 47, -89, -50, 45, 88, -128, -128, -128, -97, -128,
+    -128, -128, -128, 127, -103, -106, -128, -68, -128, -128, -101, -123, -16, -116, -117, -128,
+    -114, -104, -128, -128, -71, -55, -128, -76, -128, -128, -128, -104, -122, -107, -67, -121,
+    -56, -128, -120, -128, -113, -101, -128, -121, -128, -128, -128, -128, -128, -128, -128, -84,
+    -128, -77, -75, -111, -47, -128, -128, -128, -99, -128, -43, -97, -56, -128, -128, -121,
+    -128, -89, -128, 6, -116, -75, -128, 43, -63, -128, -114, -128, -84, -73, -128, -62,
+    -128, -128, 17, -94, -81, -128, 22, -100, -5, 42, 56, -128, -128, -128, -128, -128,
+    -128, -128, -128, 33, -128, -128, -122, -68, -105, -128, -128, -123, -30, -128, -121, -128,
+    -125, -128, -128, -106, -114, -128, -128, -128, -128, -128, -128, -95, -127, -128, -128, -94,
+    -128, -80, -128, -128, -128, -113, -128, -121, -128, -128, -128, -128, -128, -115, -92, 54,
+    -128, -74, -128, -128, -128, -49, -94, -116, -128, -128, -21, -128, -128, -128, -97, -128,
+    -128, -128, -16, -98, -128, -45, -128, 8, -119, -117, -128, -97, -128, -73, -128, -65,
+    -128, -128, 17, -113, -93, -128, 11, -62, -49, -5, 4, -67, -128, -128, -128, -128,
+    -51, -128, -128, -128, -128, -128, -77, -68, -80, -128, -128, -123, -89, -128, -119, -128,
+    -128, -128, -128, -58, -112, -128, -128, -128, -128, -128, -128, -111, -128, -128, -128, -114,
+    -105, -128, -128, -45, -128, -128, -125, -115, -128, -128, -34, -128, -128, -128, -105, -26,
+    -128, -72, -128, -128, -128, -102, -128, -128, -84, -128, -116, -128, -128, -128, -128, -103,
+    -128, -125, -128, -128, -118, -128, -128, 3, -128, -115, -128, -128, -75, -73, -128, -60,
+    -128, -89, 17, -128, -93, -128, 35, -74, -68, -53, -7, -90, -128, -128, -128, -128,
+    -98, -128, -128, -128, -128, -128, -128, -68, -119, -128, -128, -123, -65, -128, -93, -128,
+    -128, -128, -128, -31, -94, -128, -128, -128, -128, -104, -126, -126, -128, -128, -128, -128,
+    -128, -128, -122, -128, -128, -128, -128, -106, -128, -128, -54, -128, -119, -128, -114, -16,
+    -128, -82, -128, -128, -128, -124, -120, -128, -123, -128, -128, -128, -128, -128, -128, -128,
+    -128, -108, -128, -128, -112, -107, -113, -8, -128, -106, -128, -120, -116, -73, -128, -62,
+    -128, -101, 17, -128, -82, -128, 35, -123, -70, -42, 5, -70, -128, -128, -128, -128,
+    -128, -89, -126, -118, -128, -128, -128, -68, -128, -128, -128, -123, -65, -127, -113, -124,
+    -128, -128, -128, -76, -81, -128, -128, -71, -128, -105, -107, -103, -128, -98, -92, -128,
+    -128, -128, -121, -128, -117, -128, -103, -121, -118, -128, -55, -128, -106, -96, -106, -72,
+    -128, -86, -128, -128, -128, -128, -101, -128, -128, -128, -128, -96, -91, -128, -128, -128,
+    -128, -100, -104, -128, -96, -119, -122, 18, -128, -128, -105, -128, -113, -73, -105, -62,
+    -128, -69, 17, -128, -92, -128, 25, -25, -62, -9, -20, -78, -128, -128, -128, -128,
+    -128, -126, -128, -128, -128, -125, -124, -68, -112, -128, -128, -123, -79, -121, -87, -128,
+    -128, -128, -128, -60, -88, -128, -128, -128, -128, -126, -89, -128, -128, -128, -123, -128,
+    -100, -128, -128, -110, -117, -128, -128, -128, -128, -128, -38, -128, -76, -128, -81, -2,
+    -128, -85, -128, -113, -128, -128, -71, -128, -114, -128, -101, -96, -128, -128, -128, -128,
+    -128, -119, -123, -128, -109, -128, -128, -15, -128, -128, -93, -122, -103, -73, -67, -62,
+    -128, -103, 17, -127, -103, -128, 34, -128, -69, 36, -4, -39, -128, -128, -128, -128,
+    -128, -82, -122, -128, -128, -128, -103, -68, -128, -128, -127, -123, -56, -128, -121, -128,
+    -128, -128, -128, -128, -104, -128, -128, -8, -128, -128, -128, -112, -128, -128, -128, -110,
+    -128, -128, -128, -128, -128, -128, -128, -123, -128, -128, -111, -128, -65, -107, -94, -39,
+    -128, -83, -47, -127, -128, -116, -117, -128, -124, -121, -128, -113, -70, -128, -128, -128,
+    -128, -110, -112, -128, -120, -37, -128, 0, -128, -119, -106, -128, -109, -73, -128, -62,
+    -128, -118, 17, -122, -85, -128, 20, -81, -52, 46, 1, -56, -128, -128, -116, -128,
+    -128, -128, -128, -128, -128, -128, -128, -68, -128, -128, -122, -123, -57, -128, -116, -128,
+    -126, -128, -128, -128, -106, -128, -128, -45, -128, -128, -73, -128, -128, -105, -128, -128,
+    -112, -128, -128, -87, -125, -128, -102, -120, -128, -128, -33, -128, -76, -128, -116, -16,
+    -128, -97, -128, -107, -128, -123, -91, -128, -128, -128, -95, -118, -128, -128, -128, -117,
+    -128, -128, -128, -128, -128, -128, -108, 0, -128, -124, -123, -107, -125, -73, -128, -62,
+    -128, -128, 21, -128, -84, -128, 30, -128, -80, 25, 32, -85, -128, -128, -128, -128,
+    -128, -110, -119, 84, -128, -128, -111, -68, -128, -128, -128, -123, -81, -128, -126, -128,
+    -128, -128, -128, -128, -97, -128, -128, -128, -105, -120, -128, -128, -128, -128, -128, -118,
+    -128, -118, -128, -125, -128, -128, -128, -117, -89, -128, -128, -128, -101, -85, -126, -26,
+    -128, -83, -59, -128, -128, -127, -114, -128, -128, -128, -128, -94, -116, -128, -128, -128,
+    -128, -117, -84, -82, -107, -55, -110, -24, -121, -128, -118, -128, -81, -73, -128, -62,
+    -128, -118, 14, -125, -93, -128, 5, -21, -36, 8, -3, -60, -128, -128, -128, -128,
+    -100, -128, -128, -128, -128, -128, -128, -68, -111, -128, -128, -123, -105, -128, -43, -128,
+    -128, -128, -128, -81, -108, -128, -128, -128, -128, -99, -6, -128, -128, -109, -128, -128,
+    -101, -128, -125, -128, -128, -128, -128, -117, -128, -128, -26, -126, -110, -124, -112, -28,
+    -128, -75, -128, -123, -128, -120, -121, -128, -29, -128, -45, -109, -128, -128, -128, -128,
+    -128, -128, -128, -128, -128, -128, -124, 16, -123, -122, -128, -99, -126, -73, -128, -62,
+    -128, -97, 3, -124, -119, -128, -4, -128, -69, 41, 7, -63, -128, -128, -128, -128,
+    -128, -108, -124, -103, -128, -128, -81, -68, -88, -98, -128, -123, -51, -101, -117, -128,
+    -128, -128, -128, -124, -98, -128, -128, -15, -80, -82, -128, -128, -128, -128, -119, -124,
+    -118, -128, -128, -128, -128, -128, -88, -117, -11, -128, -128, -128, -102, -128, -119, -13,
+    -128, -96, -89, -120, -105, -128, -111, -114, -128, -128, -128, -97, -59, -54, -128, -128,
+    -128, -125, -54, -128, -128, -122, -123, -24, -121, -128, -126, -128, -128, -73, -128, -62,
+    -128, -128, 32, -110, -95, -128, 6, -128, -57, 36, 39, -57, -128, -128, -128, -128,
+    -100, -104, -128, 40, -128, -128, -103, -68, -128, -128, -128, -123, -86, -118, -98, -121,
+    -128, -128, -128, -128, -120, -128, -128, -128, -128, -104, -128, -128, -128, -128, -128, -84,
+    -128, -128, -128, -121, -128, -128, -128, -122, -128, -128, -128, -128, -123, -128, -128, -74,
+    -128, -79, -92, -126, -128, -124, -121, -128, -128, -128, -66, -128, -102, -75, -128, -128,
+    -111, -128, -128, -81, -128, -70, -119, 6, -128, -128, -128, -118, -113, -73, -128, -62,
+    -128, -96, 13, -120, -100, -128, -2, -32, -64, 20, 1, -71, -128, -128, -67, -128,
+    -91, -128, -128, -128, -128, -125, -128, -68, -128, -128, -128, -123, -98, -128, -118, -123,
+    -110, -128, -128, -80, -115, -128, -128, -128, -128, -128, -9, -128, -119, -77, -128, -128,
+    -128, -128, -124, -102, -117, -128, -109, -126, -128, -128, -43, -119, -126, -128, -108, -60,
+    -128, -84, -128, -128, -128, -123, -120, -125, -56, -128, -69, -128, -128, -128, -123, -57,
+    -128, -128, -128, -128, -117, -128, -126, 10, -128, -101, -128, -128, -122, -73, -128, -62,
+    -128, -81, 45, -128, -103, -128, 3, -93, -54, 23, 3, -85, -128, -128, -128, -128,
+    -128, -85, -128, -124, -128, -119, -125, -68, -114, -128, -128, -123, -75, -118, -106, -128,
+    -121, -128, -128, -126, -93, -128, -128, -50, -88, -110, -60, -128, -128, -128, -118, -128,
+    -111, -128, -128, -128, -128, -128, -108, -121, 16, -128, -93, -115, -127, -66, -48, 9,
+    -128, -92, -80, -128, -128, -128, -123, -128, -128, -128, -128, -113, -106, -93, -128, -128,
+    -128, -128, -5, -128, -107, -128, -123, -36, -128, -128, -98, -128, -103, -69, -105, -62,
+    -128, -128, -5, -128, -124, -128, -21, -128, -67, 42, 6, -40, -128, -128, -128, -128,
+    -128, -57, -128, -72, -126, -128, -59, -68, -128, -128, -111, -123, -62, -104, -65, -128,
+    -128, -128, -128, -128, -88, -128, -128, -128, -128, -128, -128, -128, -128, -128, -53, -108,
+    -128, -128, -128, -128, -128, -128, -128, -121, -49, -124, -124, -128, -128, -77, -67, -62,
+    -128, -62, -65, -110, -128, -128, -110, -128, -128, -128, -86, -106, -5, 3, -128, -128,
+    -128, -128, -126, -128, -116, -106, -128, -25, -128, -128, -117, -109, -115, -93, -124, -62,
+    -128, -128, 51, -128, -105, -128, -4, -115, -81, 32, 50, -41, -128, -128, -101, -128,
+    -111, -128, -122, -36, -128, -128, -109, -68, -128, -128, -128, -123, -97, -128, -120, -128,
+    -110, -128, -128, -128, -66, -128, -128, -112, -128, -128, -128, -128, -59, -93, -59, -98,
+    -128, -97, -128, -53, -128, -128, -128, -121, -128, -111, -60, -126, -112, -128, -105, -53,
+    -128, -56, -128, -93, -128, -118, -101, -128, -128, -128, -24, -96, -128, -79, -122, -18,
+    -128, -116, -128, -94, -82, -77, -122, -24, -106, -48, -128, -128, -107, -68, -128, -74,
+    -128, -88, 28, -128, -92, -128, 10, -23, -80, 0, 9, -110, -128, -128, -128, -128,
+    -113, -128, -128, -128, -128, -128, -128, -68, -128, -128, -128, -123, -97, -128, -111, -128,
+    -125, -128, -128, -55, -73, -128, -128, -128, -128, -128, -17, -128, -124, -100, -128, -128,
+    -94, -128, -128, -75, -115, -128, -65, -121, -128, -128, -51, -128, -104, -128, -118, -30,
+    -128, -77, -128, -128, -128, -124, -124, -128, -45, -128, -128, -85, -128, -128, -128, -128,
+    -128, -111, -84, -115, -128, -128, -111, -4, -102, -128, -121, -128, -103, -75, -128, -91,
+    -128, -128, 29, -124, -105, -128, 32, -128, -73, 22, 43, -33, -128, -128, -128, -128,
+    -128, -65, -104, -59, -128, -128, -113, -68, -120, -128, -128, -123, -49, -106, -94, -128,
+    -128, -128, -128, -98, -96, -128, -128, -106, -121, -128, -128, -128, -66, -128, -128, -115,
+    -128, -128, -128, -128, -128, -128, -128, -121, -75, -127, -65, -128, -112, -128, -128, -64,
+    -128, -79, -26, -110, -124, -116, -123, -128, -128, -128, -128, -94, -58, -123, -128, -128,
+    -128, -107, -83, -128, -128, -36, -128, -11, -77, -128, -103, -116, -128, -64, -128, -72,
+    -128, -128, 1, -113, -109, -104, 15, -83, -59, 9, 22, -55, -128, -128, -68, -128,
+    -128, -128, -127, -128, -128, -128, -128, -68, -128, -128, -128, -123, -67, -128, -86, -113,
+    -128, -128, -128, -71, -99, -128, -128, -128, -128, -128, -128, -128, -128, -97, -128, -123,
+    -128, -128, -128, -108, -128, -125, -128, -121, -128, -88, -42, -128, -109, -128, -128, -10,
+    -128, -82, -128, -108, -105, -123, -113, -128, -103, -128, -32, -121, -128, -128, -125, -83,
+    -128, -128, -128, -128, -119, -128, -128, -4, -128, -54, -128, -110, -128, -75, -123, -51,
+    -128, -122, 58, -100, -87, -128, 13, -51, -66, 5, 34, -114, -128, -128, -128, -128,
+    -128, -56, -128, -73, -128, -128, -128, -68, -128, -128, -128, -123, -84, -128, -128, -128,
+    -128, -128, -128, -100, -105, -128, -128, 24, -120, -128, -36, -87, -128, -128, -128, -128,
+    -108, -107, -123, -127, -128, -112, -89, -121, -112, -128, -43, -125, -127, -128, -128, -37,
+    -128, -91, -128, -128, -114, -128, -98, -124, -128, -128, -128, -128, -128, -128, -128, -128,
+    -122, -128, -91, -128, -128, -128, -102, -18, -128, -128, -128, -128, -128, -77, -128, -62,
+    -128, -128, -41, -66, -117, -128, 18, -62, 17, 41, 58, -128, -128, -128, -93, -128,
+    -128, -128, -126, 127, -118, -114, -108, -68, -128, -88, -84, -123, 5, -100, -81, -128,
+    -128, -95, -128, -128, -128, -27, -128, -127, -128, -128, -128, -87, -128, -92, -128, -116,
+    -50, -128, -124, -128, -128, -111, -128, -121, -128, -128, -128, -126, -128, -128, -128, 16,
+    -128, -63, -60, -128, -56, -128, -128, -128, 24, -128, -72, -128, -14, -128, -128, -128,
+    -128, -110, -128, -41, -128, -80, -128, 86, -128, -128, -128, -77, -90, -53, -128, -62,
+    -128, -128, 17, -128, -85, -128, 52, -88, 5, 36, 10, -128, -128, -128, -128, -122,
+    -128, -128, -128, -128, -128, -128, -128, -68, -128, -128, -128, -123, -42, -128, -128, -128,
+    -113, -81, -128, -111, -59, -128, -128, -128, -128, -127, -126, -106, -127, -128, -128, -128,
+    -128, -128, -111, -128, -128, -128, -128, -122, -128, -127, -128, -128, -116, -128, -128, -50,
+    -128, -78, -128, -128, -128, -51, -98, -128, -69, -128, -2, -128, -119, -128, -128, -128,
+    -58, -121, -14, -128, -124, -91, -117, 28, -128, -89, -100, -128, -128, -73, -128, -63,
+    -128, -128, 17, -128, -86, -128, 54, -66, -58, -11, -1, -92, -128, -128, -128, -128,
+    -87, -128, -127, -122, -128, -128, -78, -68, -122, -128, -128, -123, -94, -122, -128, -128,
+    -124, -128, -128, -76, -80, -128, -128, -92, -128, -128, -128, -99, -119, -128, -128, -128,
+    -101, -128, -128, -28, -128, -128, -110, -122, -128, -128, -38, -128, -119, -128, -115, -42,
+    -128, -106, -128, -128, -128, -120, -128, -128, -128, -128, -128, -110, -106, -128, -128, -128,
+    -128, -114, -104, -128, -90, -128, -128, -9, -128, -128, -92, -127, -101, -73, -128, -64,
+    -128, -72, 17, -128, -86, -128, 45, -73, -64, -58, 20, -67, -128, -128, -128, -128,
+    -82, -128, -128, -128, -128, -119, -128, -68, -127, -128, -128, -123, -65, -128, -33, -122,
+    -120, -128, -128, -49, -88, -128, -128, -128, -128, -128, -128, -127, -98, -128, -128, -128,
+    -128, -128, -128, -128, -128, -111, -128, -121, -128, -128, -54, -128, -114, -122, -128, -67,
+    -128, -98, -128, -117, -127, -118, -128, -120, -85, -125, -128, -98, -128, -128, -128, -128,
+    -128, -109, -128, -128, -92, -73, -128, -6, -128, -78, -116, -119, -120, -73, -128, -62,
+    -128, -119, 17, -128, -53, -128, 44, -106, -76, -51, 36, -72, -128, -128, -128, -128,
+    -128, -47, -126, -128, -128, -128, -96, -68, -128, -128, -128, -123, -65, -128, -128, -103,
+    -93, -128, -128, -89, -56, -128, -128, -26, -121, -128, -122, -111, -54, -98, -128, -128,
+    -128, -128, -128, -128, -128, -79, -111, -122, -128, -128, -55, -119, -105, -51, -128, -36,
+    -128, -105, -128, -124, -98, -125, -128, -128, -128, -128, -128, -87, -68, -128, -128, -128,
+    -97, -108, -118, -128, -90, -128, -108, -17, -128, -128, -123, -128, -127, -73, -128, -62,
+    -128, -115, 17, -128, -60, -128, 51, -50, -65, -17, 12, -67, -128, -128, -97, -128,
+    -128, -128, -125, -128, -128, -90, -128, -68, -128, -128, -128, -123, -92, -124, -107, -128,
+    -121, -128, -128, -115, -47, -128, -128, -120, -128, -128, -82, -128, -7, -128, -128, -128,
+    -94, -123, -128, -128, -125, -94, -128, -117, -128, -128, -50, -125, -115, -83, -128, -50,
+    -128, -98, -128, -109, -110, -126, -105, -128, -111, -128, -64, -63, -128, -128, -128, -128,
+    -115, -120, -128, -128, -113, -128, -105, -27, -128, -128, -105, -128, -126, -73, -128, -62,
+    -128, -128, 17, -128, -82, -128, 50, -128, -85, 33, 29, -45, -128, -128, -128, -128,
+    -128, -57, -128, -128, -128, -128, -76, -68, -128, -128, -116, -123, -88, -128, -128, -128,
+    -105, -122, -128, -128, -39, -128, -128, -38, -110, -128, -128, -103, -99, -128, -97, -125,
+    -128, -96, -128, -128, -128, -81, -128, -119, -101, -83, -102, -128, -128, -68, -119, -72,
+    -128, -105, -38, -114, -88, -123, -128, -128, -128, -128, -128, -78, -57, -128, -74, -128,
+    -128, -114, -55, -128, -88, -41, -128, -22, -128, -128, -103, -128, -128, -73, -128, -62,
+    -128, -128, 17, -128, -75, -128, 48, -93, -44, 48, 21, -44, -128, -128, -128, -127,
+    -128, -128, -128, -128, -128, -128, -128, -68, -128, -128, -128, -123, -63, -128, -97, -128,
+    -122, -128, -128, -128, -55, -128, -128, -84, -128, -128, -59, -128, -125, -95, -117, -128,
+    -121, -98, -128, -88, -128, -107, -99, -121, -128, -128, -54, -128, -123, -128, -113, -59,
+    -128, -117, -128, -114, -124, -123, -113, -128, -128, -128, -59, -101, -128, -128, -128, -113,
+    -128, -128, -128, -122, -104, -128, -123, -3, -115, -110, -100, -128, -128, -73, -128, -62,
+    -128, -128, 18, -128, -78, -128, 49, -128, -53, 21, 19, -91, -128, -128, -128, -128,
+    -92, -103, -124, 101, -128, -128, -81, -68, -128, -128, -128, -123, -93, -122, -128, -124,
+    -127, -128, -128, -128, -85, -128, -128, -128, -44, -128, -128, -103, -113, -128, -128, -128,
+    -128, -128, -128, -90, -128, -128, -128, -121, -50, -128, -101, -119, -128, -83, -112, -23,
+    -128, -105, -73, -128, -128, -114, -128, -128, -128, -128, -128, -128, -73, -118, -128, -128,
+    -128, -109, -52, -73, -121, -87, -103, -32, -118, -128, -100, -109, -87, -73, -128, -62,
+    -128, -128, 23, -128, -79, -128, 46, -28, -57, 7, 18, -60, -128, -128, -128, -128,
+    -59, -128, -128, -128, -128, -111, -128, -68, -128, -128, -128, -123, -104, -128, -128, -128,
+    -128, -128, -128, -101, -84, -128, -128, -128, -128, -128, -14, -128, -59, -128, -128, -128,
+    -113, -128, -128, -128, -128, -128, -128, -123, -128, -128, -23, -122, -128, -128, -109, -78,
+    -128, -80, -128, -128, -128, -121, -95, -128, -56, -128, -30, -97, -128, -128, -128, -119,
+    -81, -113, -128, -128, -119, -128, -106, 14, -123, -109, -94, -128, -126, -73, -128, -62,
+    -128, -121, 23, -128, -91, -128, 45, -128, -54, 41, -1, -48, -128, -128, -128, -128,
+    -128, -128, -127, -128, -128, -117, -128, -68, -128, -95, -128, -123, -32, -128, -128, -128,
+    -114, -128, -128, -128, -64, -128, -128, -22, -112, -128, -128, -128, -125, -128, -128, -128,
+    -111, -128, -128, -128, -128, -128, -92, -122, -39, -128, -128, -121, -123, -128, -76, -36,
+    -128, -102, -105, -120, -99, -124, -119, -128, -128, -128, -128, -124, -103, -76, -128, -128,
+    -128, -100, -26, -128, -100, -128, -124, -36, -128, -128, -101, -128, -128, -73, -128, -62,
+    -128, -128, 22, -128, -90, -128, 45, -123, -56, 33, 10, -79, -128, -128, -128, -128,
+    -110, -65, -116, 73, -128, -128, -18, -68, -128, -128, -128, -123, -77, -127, -128, -128,
+    -128, -128, -128, -128, -62, -128, -128, -128, -128, -124, -128, -128, -126, -128, -128, -128,
+    -128, -128, -128, -128, -128, -128, -128, -116, -91, -122, -113, -128, -128, -112, -98, 26,
+    -128, -79, -89, -128, -128, -118, -127, -128, -128, -128, -101, -123, -57, -97, -128, -128,
+    -128, -109, -128, -103, -91, -91, -111, -35, -128, -128, -101, -128, -87, -73, -128, -62,
+    -128, -100, 19, -128, -85, -128, 39, -32, -47, 23, 37, -45, -128, -128, -29, -128,
+    -59, -128, -124, -128, -128, -94, -128, -68, -128, -128, -128, -123, -107, -128, -94, -112,
+    -128, -128, -128, -125, -74, -128, -128, -128, -128, -128, -56, -128, -116, -88, -128, -128,
+    -128, -116, -128, -128, -125, -103, -128, -121, -128, -116, -47, -128, -128, -128, -128, -93,
+    -128, -83, -128, -128, -126, -122, -101, -128, 3, -128, -18, -97, -128, -128, -112, -20,
+    -128, -116, -128, -128, -83, -128, -115, 31, -128, -30, -127, -101, -122, -74, -128, -62,
+    -128, -120, 40, -128, -72, -128, 48, -125, -102, 39, 29, -81, -128, -128, -128, -102,
+    -128, -125, -119, -73, -128, -82, -128, -68, -128, -128, -128, -123, -69, -128, -128, -128,
+    -126, -122, -128, -128, -35, -128, -128, 18, -20, -128, -73, -128, -126, -128, -80, -128,
+    -99, -102, -123, -128, -128, -111, -61, -121, 19, -128, -84, -120, -128, -79, -128, -94,
+    -128, -103, -128, -128, -104, -127, -128, -128, -128, -128, -128, -73, -114, -128, -128, -128,
+    -128, -119, 8, -128, -81, -128, -119, -20, -128, -128, -81, -128, -122, -68, -128, -62,
+    -128, -128, -6, -128, -109, -128, 43, -128, -50, 51, -1, -36, -128, -128, -128, -128,
+    -128, -58, -128, -47, -128, -128, -100, -68, -128, -128, -115, -123, -67, -116, -91, -128,
+    -125, -106, -128, -128, -84, -128, -128, -128, -92, -128, -128, -128, -127, -128, -128, -128,
+    -113, -128, -110, -108, -128, -128, -128, -121, -38, -122, -101, -122, -127, -109, -128, -5,
+    -128, -80, -28, -121, -128, -121, -128, -128, -128, -128, -77, -119, -16, -52, -128, -128,
+    -128, -128, -124, -83, -123, -83, -123, 12, -128, -128, -87, -90, -108, -73, -128, -62,
+    -128, -128, -12, -128, -108, -128, 33, -117, -72, 42, 13, -48, -128, -128, -68, -128,
+    -114, -128, -113, -8, -128, -128, -107, -69, -128, -115, -128, -123, -85, -128, -128, -128,
+    -128, -101, -128, -110, -101, -128, -128, -128, -128, -128, -128, -128, -118, -103, -128, -124,
+    -128, -128, -105, -55, -128, -128, -128, -121, -128, -128, -54, -121, -112, -128, -128, 0,
+    -128, -77, -128, -123, -128, -122, -128, -128, -128, -128, -45, -128, -128, -110, -128, -55,
+    -128, -110, -128, -72, -106, -91, -116, -9, -128, -66, -118, -121, -103, -73, -128, -67,
+    -128, -128, 29, -128, -94, -128, 41, -61, -67, -1, 7, -66, -128, -128, -110, -128,
+    -84, -128, -128, -128, -128, -97, -128, -68, -128, -128, -128, -123, -80, -128, -72, -109,
+    -128, -128, -128, -45, -107, -128, -128, -128, -128, -128, -35, -128, -128, -108, -128, -128,
+    -101, -128, -108, -96, -115, -128, -88, -121, -128, -128, -50, -119, -115, -128, -124, -81,
+    -128, -94, -128, -128, -128, -107, -127, -128, -88, -128, -128, -128, -128, -128, -128, -111,
+    -128, -109, -118, -122, -128, -128, -99, 31, -128, -113, -127, -116, -91, -73, -128, -84,
+    -128, -128, 21, -128, -107, -128, 35, -87, -60, -10, 21, -87, -128, -128, -128, -128,
+    -128, -85, -102, -90, -128, -128, -98, -68, -128, -128, -128, -123, -64, -110, -128, -116,
+    -128, -128, -128, -44, -98, -128, -128, -128, -97, -128, -128, -120, -128, -128, -128, -117,
+    -128, -126, -116, -128, -128, -128, -128, -121, -51, -128, -50, -128, -105, -128, -85, -104,
+    -128, -99, -63, -120, -128, -110, -128, -128, -103, -128, -128, -128, -84, -126, -128, -128,
+    -121, -89, -41, -128, -118, -41, -112, -20, -128, -128, -99, -128, -114, -73, -128, -92,
+    -128, -108, 13, -128, -104, -128, 39, -89, -69, 0, -6, -31, -128, -128, -127, -128,
+    -128, -128, -128, -128, -128, -128, -84, -68, -128, -128, -128, -123, -76, -128, -89, -110,
+    -128, -128, -128, -63, -93, -128, -128, -111, -128, -128, -128, -128, -128, -116, -128, -102,
+    -122, -128, -125, -128, -128, -127, -128, -121, -128, -106, -62, -128, -106, -128, -89, -24,
+    -128, -84, -103, -103, -93, -128, -128, -128, -87, -128, -36, -114, -113, -128, -128, -128,
+    -128, -128, -128, -128, -82, -128, -128, -1, -128, -89, -116, -120, -128, -73, -128, -73,
+    -128, -121, 70, -117, -88, -128, 8, -77, -71, 12, 13, -107, -128, -128, -128, -128,
+    -128, -84, -120, -21, -128, -128, -117, -68, -128, -128, -128, -123, -111, -128, -128, -128,
+    -125, -128, -128, -128, -90, -128, -128, 69, -89, -112, -49, -87, -28, -128, -93, -119,
+    -105, -128, -126, -128, -103, -128, -82, -121, -92, -128, -55, -123, -117, -109, -114, -53,
+    -128, -113, -128, -128, -112, -128, -128, -123, -128, -128, -128, -119, -128, -128, -128, -128,
+    -128, -128, -96, -128, -105, -108, -121, -17, -128, -128, -112, -106, -128, -60, -128, -63,
+    -128, -128, -58, -128, -128, -114, 24, -49, -22, 48, 51, -128, -128, -128, -118, -128,
+    -113, -128, -128, 127, -93, -114, -70, -68, -128, -95, -128, -123, -36, -90, -61, -128,
+    -113, -114, -128, -128, -83, 4, -128, -128, -114, -128, -128, -87, -118, -82, -102, -105,
+    -49, -128, -128, -127, -118, -128, -128, -121, -102, -128, -128, -126, -128, -128, -128, 18,
+    -128, -67, -53, -128, -91, -128, -128, -128, 19, -128, -84, -128, 7, -121, -128, -128,
+    -128, -123, -108, 12, -70, -90, -122, 64, -128, -128, -100, -128, -60, -128, -128, -64,
+    -128, -128, 17, -109, -97, -128, 33, -69, 20, 23, 20, -128, -128, -128, -120, -128,
+    -128, -128, -128, -128, -128, -118, -128, -68, -121, -128, -128, -123, -38, -128, -128, -128,
+    -128, -123, -128, -112, -105, -128, -128, -128, -128, -128, -128, -124, -127, -128, -128, -110,
+    -128, -128, -128, -128, -82, -128, -128, -123, -128, -117, -128, -124, -99, -95, -126, -15,
+    -128, -102, -128, -128, -128, -61, -101, -128, -27, -128, 20, -128, -123, -128, -128, -128,
+    -65, -120, -48, -128, -128, -59, -125, 40, -115, -49, -128, -107, -128, -73, -128, -63,
+    -128, -128, 17, -128, -90, -128, 33, -87, -102, -26, 8, -102, -128, -128, -128, -128,
+    -112, -128, -127, -9, -128, -128, -128, -70, -128, -128, -128, -123, -82, -120, -102, -128,
+    -128, -128, -128, -125, -69, -128, -128, -7, -128, -128, -128, -110, -128, -128, -128, -128,
+    -124, -128, -128, -47, -111, -106, -84, -120, -128, -128, -33, -128, -128, -119, -83, -28,
+    -128, -119, -128, -104, -128, -121, -128, -115, -128, -128, -128, -109, -121, -128, -128, -128,
+    -128, -118, -83, -104, -101, -128, -125, -19, -128, -128, -100, -128, -110, -73, -128, -65,
+    -128, -109, 17, -128, -92, -128, 42, -71, -28, -66, -9, -60, -128, -128, -128, -128,
+    -57, -128, -128, -128, -128, -122, -122, -70, -128, -128, -128, -123, -65, -128, -101, -104,
+    -128, -128, -128, -86, -94, -128, -128, -128, -128, -126, -126, -119, -128, -127, -128, -128,
+    -128, -128, -128, -128, -128, -128, -128, -121, -128, -128, -54, -128, -128, -90, -53, -56,
+    -128, -114, -126, -128, -128, -118, -127, -128, -53, -128, -128, -128, -128, -128, -128, -128,
+    -128, -91, -128, -128, -101, -84, -128, -18, -128, -98, -100, -102, -101, -73, -119, -62,
+    -128, -128, 17, -103, -79, -128, 42, -96, -60, -64, 3, -94, -128, -128, -128, -128,
+    -128, -52, -125, -127, -128, -120, -53, -68, -128, -128, -125, -123, -67, -128, -128, -128,
+    -128, -128, -128, -88, -118, -128, -128, -59, -103, -128, -124, -99, -109, -105, -128, -128,
+    -128, -127, -128, -128, -128, -128, -111, -105, -92, -128, -51, -128, -128, -40, -77, -10,
+    -128, -110, -128, -128, -111, -128, -128, -128, -128, -128, -128, -128, -44, -128, -117, -128,
+    -128, -111, -83, -128, -119, -128, -128, -21, -128, -128, -104, -109, -128, -73, -102, -62,
+    -128, -126, 17, -79, -70, -128, 36, -89, -49, -25, 5, -64, -128, -128, -93, -128,
+    -128, -128, -128, -128, -128, -113, -128, -68, -128, -128, -107, -123, -72, -128, -71, -128,
+    -118, -128, -128, -128, -128, -128, -128, -78, -128, -128, -94, -128, -128, -128, -122, -128,
+    -90, -128, -128, -128, -99, -128, -128, -119, -128, -128, -56, -128, -128, -51, -112, -7,
+    -128, -115, -128, -116, -128, -127, -128, -126, -128, -128, -32, -128, -128, -128, -128, -128,
+    -128, -112, -128, -119, -128, -128, -120, -4, -128, -128, -120, -124, -128, -73, -128, -62,
+    -128, -128, 17, -77, -101, -128, 39, -103, -17, 21, 14, -53, -128, -128, -128, -128,
+    -103, -67, -119, -128, -128, -128, -128, -68, -128, -128, -124, -123, -84, -128, -92, -128,
+    -128, -128, -128, -128, -128, -128, -128, -119, -64, -128, -128, -116, -128, -121, -127, -119,
+    -128, -121, -128, -128, -128, -128, -128, -121, -92, -114, -75, -128, -128, -71, -128, -34,
+    -128, -98, -48, -128, -92, -126, -128, -128, -127, -126, -128, -128, -46, -128, -128, -128,
+    -128, -106, -70, -128, -127, -37, -120, 14, -128, -128, -128, -114, -128, -73, -76, -62,
+    -128, -128, 17, -95, -88, -128, 36, -114, -61, 42, 14, -56, -128, -128, -82, -121,
+    -128, -128, -124, -128, -128, -127, -128, -68, -128, -128, -128, -123, -47, -128, -128, -112,
+    -128, -128, -128, -128, -115, -128, -128, -45, -128, -128, -60, -128, -128, -94, -128, -128,
+    -127, -128, -106, -106, -103, -104, -96, -122, -128, -128, -60, -128, -128, -123, -128, -43,
+    -128, -122, -128, -128, -58, -124, -128, -128, -128, -128, -55, -128, -128, -128, -128, -128,
+    -128, -128, -128, -128, -128, -128, -128, 1, -128, -102, -128, -128, -128, -73, -128, -62,
+    -128, -128, 17, -128, -86, -128, 43, -123, -60, 25, 18, -78, -128, -128, -128, -128,
+    -75, -102, -125, 63, -128, -128, -128, -68, -128, -128, -128, -123, -88, -128, -128, -128,
+    -111, -106, -128, -128, -87, -128, -128, -128, -57, -128, -128, -120, -128, -128, -128, -128,
+    -128, -128, -109, -103, -128, -77, -128, -121, -62, -93, -83, -128, -128, -128, -128, -1,
+    -128, -107, -95, -128, -109, -128, -127, -99, -128, -128, -128, -128, -67, -114, -128, -128,
+    -128, -116, -55, -87, -128, -79, -123, -38, -128, -128, -123, -128, -128, -73, -128, -65,
+    -128, -128, 17, -128, -76, -128, 45, -14, -37, -2, 2, -67, -128, -128, -128, -128,
+    -67, -128, -128, -128, -128, -104, -128, -68, -128, -128, -128, -123, -107, -114, -78, -128,
+    -128, -118, -128, -107, -91, -128, -128, -128, -128, -128, -24, -128, -128, -128, -128, -128,
+    -103, -128, -125, -128, -125, -95, -128, -124, -128, -128, -29, -125, -128, -128, -97, -42,
+    -128, -94, -128, -127, -128, -128, -117, -128, -29, -128, -27, -98, -128, -128, -96, -128,
+    -128, -113, -128, -128, -118, -128, -120, -12, -128, -90, -117, -123, -128, -73, -128, -69,
+    -128, -113, 17, -128, -88, -128, 49, -128, -75, 37, 23, -46, -128, -128, -128, -128,
+    -128, -120, -128, -128, -128, -115, -128, -68, -128, -125, -128, -123, -41, -127, -128, -128,
+    -128, -128, -128, -128, -98, -128, -128, -19, -13, -128, -128, -128, -128, -128, -128, -128,
+    -104, -120, -120, -128, -88, -97, -84, -111, -11, -128, -123, -128, -128, -128, -128, -98,
+    -128, -109, -98, -128, -87, -128, -128, -128, -128, -128, -128, -102, -87, -108, -69, -128,
+    -128, -95, -25, -128, -125, -128, -128, 5, -128, -128, -109, -128, -128, -73, -128, -57,
+    -128, -128, 17, -128, -88, -128, 39, -115, -67, 37, 35, -76, -128, -128, -128, -128,
+    -116, -70, -124, 106, -128, -128, -111, -68, -128, -128, -128, -123, -66, -128, -116, -107,
+    -124, -125, -128, -128, -91, -128, -128, -128, -128, -128, -128, -128, -128, -128, -125, -128,
+    -128, -128, -123, -127, -110, -73, -128, -120, -79, -105, -87, -126, -128, -120, -123, -39,
+    -128, -86, -91, -107, -128, -128, -128, -116, -128, -128, -99, -103, -78, -85, -128, -128,
+    -128, -111, -128, -86, -128, -92, -126, -26, -128, -128, -120, -128, -108, -73, -128, -63,
+    -128, -125, 17, -118, -90, -128, 42, -34, -33, 24, -11, -44, -128, -128, -124, -128,
+    -50, -128, -128, -128, -128, -116, -128, -67, -128, -128, -128, -123, -106, -128, -101, -121,
+    -97, -128, -128, -128, -94, -128, -128, -128, -128, -128, -45, -128, -128, -96, -128, -128,
+    -123, -128, -126, -128, -128, -128, -128, -121, -128, -111, -49, -128, -128, -128, -79, -17,
+    -128, -83, -128, -121, -128, -115, -128, -128, 7, -128, -16, -127, -128, -128, -128, -45,
+    -128, -122, -128, -128, -112, -128, -121, -27, -128, -50, -128, -91, -116, -73, -122, -65,
+    -128, -128, 21, -102, -88, -128, 25, -119, -53, 45, 12, -81, -128, -128, -128, -128,
+    -128, -120, -128, -98, -128, -112, -128, -68, -128, -128, -128, -123, -71, -128, -120, -128,
+    -117, -128, -128, -128, -104, -128, -128, 33, -40, -128, -85, -128, -128, -128, -94, -128,
+    -84, -128, -121, -128, -90, -128, -80, -121, 2, -128, -78, -123, -128, -89, -117, -28,
+    -128, -105, -128, -121, -68, -128, -128, -113, -128, -128, -128, -128, -103, -125, -107, -128,
+    -128, -116, -3, -128, -128, -128, -128, -9, -128, -128, -128, -120, -128, -74, -128, -60,
+    -128, -128, 33, -127, -110, -128, 26, -128, -74, 52, 17, -41, -128, -128, -128, -128,
+    -128, -55, -123, -89, -128, -128, -85, -68, -128, -128, -128, -123, -60, -128, -116, -128,
+    -128, -128, -128, -128, -94, -128, -128, -128, -128, -128, -128, -128, -125, -128, -102, -123,
+    -114, -128, -128, -106, -111, -91, -128, -121, -56, -109, -80, -127, -128, -89, -128, -36,
+    -128, -82, -39, -113, -111, -128, -100, -128, -128, -128, -86, -72, -30, -61, -128, -128,
+    -128, -113, -128, -128, -128, -95, -128, -19, -128, -128, -110, -128, -128, -68, -128, -62,
+    -128, -128, 35, -128, -104, -128, 26, -104, -60, 38, 44, -59, -128, -128, -119, -128,
+    -118, -128, -107, -25, -128, -128, -106, -70, -128, -128, -128, -123, -100, -128, -95, -107,
+    -128, -128, -128, -128, -73, -128, -128, -128, -128, -128, -128, -128, -106, -82, -76, -115,
+    -128, -116, -128, -63, -108, -128, -128, -121, -128, -114, -47, -118, -128, -128, -122, -81,
+    -128, -80, -128, -87, -128, -122, -97, -128, -128, -110, -56, -63, -128, -122, -128, -89,
+    -128, -109, -128, -128, -114, -71, -126, -18, -128, -68, -120, -128, -122, -74, -128, -60,
+    -128, -128, 24, -128, -70, -128, 35, -79, -66, -8, 8, -49, -128, -128, -128, -128,
+    -89, -128, -128, -128, -128, -128, -128, -68, -128, -128, -128, -123, -76, -128, -128, -73,
+    -76, -128, -128, -95, -50, -128, -128, -128, -128, -128, -74, -128, -71, -95, -95, -128,
+    -112, -121, -128, -92, -101, -119, -83, -121, -128, -128, -54, -104, -128, -128, -99, -27,
+    -128, -87, -128, -97, -128, -113, -122, -128, -71, -128, -128, -74, -128, -128, -110, -102,
+    -128, -127, -128, -128, -106, -128, -114, -36, -128, -110, -128, -128, -128, -73, -128, -80,
+    -128, -128, 18, -128, -83, -105, 42, -59, -93, -49, 25, -124, -128, -128, -128, -128,
+    -128, -99, -111, -26, -128, -128, -128, -69, -128, -128, -128, -123, -74, -118, -128, -128,
+    -93, -106, -128, -43, -73, -128, -128, -128, -22, -128, -117, -128, -69, -128, -128, -123,
+    -128, -128, -126, -88, -105, -92, -128, -121, -61, -128, -47, -126, -128, -110, -128, 44,
+    -128, -90, -76, -123, -123, -128, -128, -128, -128, -128, -128, -90, -122, -128, -128, -128,
+    -128, -90, -65, -128, -102, -34, -122, -30, -128, -128, -119, -128, -123, -74, -128, -84,
+    -128, -115, 16, -128, -88, -102, 39, -121, -36, -6, -2, 5, -128, -128, -100, -128,
+    -118, -128, -128, -128, -128, -128, -128, -68, -128, -128, -128, -123, -65, -128, -111, -128,
+    -121, -109, -128, -68, -68, -128, -128, -128, -128, -128, -128, -123, -69, -117, -121, -106,
+    -114, -128, -125, -128, -122, -98, -128, -121, -128, -42, -77, -128, -128, -128, -128, -27,
+    -128, -96, -82, -119, -101, -128, -127, -128, -34, -128, -38, -88, -64, -128, -114, -128,
+    -128, -128, -128, -128, -98, -128, -128, 11, -128, -38, -128, -100, -128, -71, -127, -76,
+    -128, -128, 62, -128, -61, -128, 26, -61, -97, 17, 77, -128, -128, -128, -128, -122,
+    -128, -96, -115, 37, -128, -128, -128, -68, -128, -128, -121, -123, -98, -128, -128, -128,
+    -128, -128, -128, -128, -33, -128, -128, 107, -128, -115, -36, -88, -128, -128, -128, -104,
+    -110, -35, -118, -108, -128, -84, -80, -121, -128, -128, -42, -110, -110, -128, -128, -118,
+    -128, -116, -128, -124, -80, -128, -77, -128, -128, -128, -128, -102, -128, -128, -128, -128,
+    -128, -120, -128, -128, -112, -107, -112, -29, -99, -128, -110, -128, -128, -58, -128, -63,
+    -128, -128, -49, -128, -128, -120, 28, -50, 8, 43, 44, -128, -128, -128, -128, -128,
+    -102, -128, -128, 127, -108, -108, -108, -68, -128, -104, -119, -123, -19, -107, -59, -128,
+    -128, -119, -128, -110, -87, -10, -87, -128, -128, -128, -128, -92, -127, -85, -128, -100,
+    -50, -128, -111, -128, -128, -128, -128, -121, -118, -128, -128, -118, -128, -128, -128, -23,
+    -128, -88, -6, -124, -95, -124, -128, -128, 60, -128, -79, -110, 5, -125, -128, -128,
+    -87, -123, -83, -27, -109, -86, -121, 71, -109, -128, -91, -56, -58, -128, -128, -63,
+    -128, -127, 17, -128, -88, -128, 43, -66, 7, 29, -2, -128, -128, -128, -128, -128,
+    -128, -128, -128, -128, -128, -128, -95, -68, -128, -128, -128, -123, -11, -128, -128, -128,
+    -128, -128, -128, -120, -81, -128, -128, -128, -128, -128, -128, -90, -128, -128, -128, -128,
+    -128, -128, -128, -128, -128, -127, -128, -121, -128, -128, -128, -122, -112, -110, -38, -10,
+    -128, -106, -128, -128, -128, -52, -121, -128, -36, -128, 4, -111, -119, -128, -128, -128,
+    -105, -118, -29, -128, -108, -59, -128, -13, -128, -76, -128, -128, -128, -73, -128, -62,
+    -128, -128, 17, -128, -68, -128, 37, -79, -53, -23, 15, -91, -128, -128, -125, -128,
+    -97, -128, -123, -58, -128, -128, -128, -69, -128, -128, -128, -123, -54, -128, -112, -110,
+    -128, -128, -128, -128, -116, -128, -128, -42, -128, -128, -125, -99, -128, -128, -128, -128,
+    -126, -128, -128, -100, -106, -109, -116, -119, -128, -128, -43, -118, -128, -47, -121, -54,
+    -128, -116, -128, -121, -111, -116, -128, -128, -128, -128, -128, -120, -128, -128, -128, -128,
+    -128, -115, -128, -128, -106, -128, -128, 22, -128, -110, -128, -123, -125, -73, -128, -62,
+    -128, -112, 17, -128, -58, -128, 42, -100, -76, -67, 23, -56, -128, -128, -128, -128,
+    -85, -128, -121, -128, -128, -128, -128, -61, -128, -128, -128, -123, -42, -126, -106, -128,
+    -128, -128, -128, -128, -106, -128, -128, -128, -128, -128, -126, -124, -128, -128, -128, -128,
+    -128, -120, -109, -128, -98, -103, -128, -104, -128, -128, -65, -116, -128, -36, -128, -44,
+    -128, -117, -126, -128, -128, -127, -128, -128, -123, -128, -128, -52, -128, -128, -87, -128,
+    -128, -88, -128, -128, -105, -61, -128, 3, -128, -101, -120, -128, -86, -73, -128, -62,
+    -128, -93, 17, -128, -68, -128, 42, -75, -41, -74, -18, -80, -128, -128, -128, -127,
+    -128, -62, -128, -128, -128, -128, -128, -73, -128, -128, -125, -123, -69, -128, -128, -128,
+    -125, -124, -128, -128, -81, -128, -128, -113, -61, -127, -124, -106, -128, -102, -128, -128,
+    -128, -128, -92, -105, -128, -128, -128, -120, -90, -124, -41, -109, -128, 15, -128, -49,
+    -128, -120, -125, -119, -128, -128, -112, -128, -107, -128, -128, -95, -27, -128, -128, -128,
+    -128, -100, -69, -128, -121, -128, -128, 5, -128, -128, -111, -126, -128, -73, -128, -62,
+    -128, -105, 17, -128, -68, -128, 44, -100, -81, -41, -3, -61, -128, -128, -128, -128,
+    -128, -128, -121, -111, -128, -128, -121, -72, -128, -128, -128, -123, -56, -128, -128, -128,
+    -128, -128, -128, -128, -54, -128, -128, -79, -128, -128, -86, -113, -106, -128, -128, -128,
+    -102, -110, -107, -128, -128, -121, -90, -125, -128, -128, -85, -128, -128, 15, -115, -63,
+    -128, -128, -128, -105, -120, -128, -89, -128, -128, -128, -32, -90, -128, -128, -128, -128,
+    -128, -82, -128, -128, -123, -128, -128, -53, -128, -128, -71, -128, -124, -73, -128, -62,
+    -128, -128, 17, -128, -89, -128, 45, -101, -58, 2, 2, -42, -128, -128, -128, -128,
+    -109, -65, -121, -89, -128, -128, -128, -71, -128, -128, -128, -123, -75, -128, -88, -92,
+    -125, -128, -128, -128, -102, -128, -128, -128, -67, -128, -128, -94, -128, -109, -128, -128,
+    -128, -128, -112, -96, -128, -128, -128, -114, -77, -119, -38, -120, -128, -54, -128, -65,
+    -128, -99, -15, -128, -128, -128, -128, -128, -120, -110, -128, -87, -35, -128, -128, -128,
+    -128, -112, -47, -128, -126, -16, -123, 27, -128, -128, -108, -102, -128, -73, -128, -65,
+    -128, -128, 17, -121, -66, -128, 44, -97, -53, 33, -4, -71, -128, -128, -128, -128,
+    -128, -128, -128, -83, -128, -128, -126, -68, -121, -128, -128, -123, -47, -127, -117, -122,
+    -112, -128, -128, -128, -115, -128, -128, -107, -128, -128, -22, -114, -128, -112, -128, -128,
+    -107, -128, -128, -119, -128, -128, -95, -121, -128, -128, -95, -117, -128, -128, -87, 3,
+    -128, -109, -128, -110, -126, -126, -78, -128, -128, -128, -58, -128, -128, -128, -128, -128,
+    -128, -124, -128, -93, -128, -128, -120, -39, -128, -127, -112, -128, -128, -73, -128, -69,
+    -128, -106, 17, -75, -91, -128, 42, -108, -39, 35, 13, -67, -128, -128, -128, -128,
+    -70, -67, -122, -96, -128, -128, -128, -68, -128, -128, -128, -123, -80, -128, -63, -128,
+    -128, -128, -128, -128, -128, -128, -128, -128, -62, -128, -128, -111, -89, -128, -128, -128,
+    -128, -128, -128, -69, -93, -128, -128, -121, -55, -128, -67, -128, -128, -128, -119, -84,
+    -128, -94, -58, -128, -122, -128, -128, -128, -70, -120, -128, -128, -29, -111, -96, -128,
+    -128, -102, -71, -128, -128, -30, -128, 8, -128, -128, -128, -69, -128, -73, -128, -61,
+    -128, -87, 17, -110, -75, -128, 42, -56, -60, 8, 15, -67, -128, -128, -79, -128,
+    -128, -128, -128, -128, -128, -128, -128, -68, -128, -128, -128, -123, -67, -128, -93, -128,
+    -128, -128, -128, -128, -113, -128, -128, -58, -128, -128, -28, -128, -128, -100, -84, -128,
+    -122, -122, -128, -128, -95, -128, -128, -117, -128, -128, -39, -123, -128, -128, -123, -75,
+    -128, -75, -128, -128, -128, -128, -115, -128, -128, -128, 3, -105, -128, -128, -128, -97,
+    -68, -115, -128, -128, -117, -128, -91, 20, -128, -85, -122, -128, -128, -73, -128, -71,
+    -128, -128, 17, -110, -93, -128, 35, -103, -55, 33, 22, -84, -128, -128, -128, -128,
+    -128, -98, -126, -108, -128, -128, -119, -68, -128, -128, -128, -123, -97, -106, -128, -128,
+    -128, -128, -128, -128, -110, -128, -128, -120, -48, -125, -76, -128, -128, -128, -77, -128,
+    -115, -128, -128, -112, -109, -120, -86, -120, 5, -128, -108, -118, -128, -128, -118, -10,
+    -128, -114, -104, -128, -84, -128, -128, -128, -128, -128, -128, -128, -95, -86, -128, -128,
+    -128, -92, 9, -128, -127, -128, -128, -26, -128, -128, -113, -105, -128, -73, -128, -77,
+    -128, -128, 17, -100, -103, -128, 34, -128, -51, 51, 15, -50, -128, -128, -128, -128,
+    -125, -63, -128, 16, -127, -128, -110, -68, -128, -121, -128, -123, -69, -128, -43, -128,
+    -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -127, -128, -111, -128,
+    -128, -128, -128, -128, -113, -128, -128, -125, -72, -126, -115, -128, -128, -128, -128, -49,
+    -128, -72, -63, -122, -124, -128, -128, -128, -128, -122, -77, -128, -39, -56, -109, -128,
+    -128, -109, -128, -106, -128, -74, -128, -7, -128, -128, -128, -101, -125, -73, -128, -57,
+    -128, -110, 17, -122, -80, -128, 37, -66, -60, 34, 7, -48, -128, -128, -16, -128,
+    -86, -128, -121, -128, -128, -124, -128, -69, -128, -128, -128, -123, -89, -128, -128, -127,
+    -128, -125, -128, -128, -123, -128, -128, -128, -128, -128, -71, -128, -102, -81, -128, -128,
+    -128, -128, -128, -118, -106, -124, -128, -121, -128, -128, -76, -128, -128, -128, -128, -76,
+    -128, -83, -128, -128, -128, -121, -128, -128, -68, -128, -17, -97, -128, -127, -128, -28,
+    -111, -104, -128, -128, -119, -128, -104, 39, -128, -36, -121, -128, -89, -73, -128, -69,
+    -128, -111, 18, -124, -75, -128, 32, -81, -66, 37, 35, -104, -128, -128, -128, -128,
+    -124, -107, -120, -80, -128, -115, -128, -69, -128, -128, -128, -123, -117, -128, -97, -128,
+    -128, -128, -128, -128, -111, -128, -128, -66, -34, -128, -57, -128, -127, -128, -90, -128,
+    -101, -128, -128, -128, -111, -128, -93, -121, 16, -128, -49, -128, -116, -101, -128, -63,
+    -128, -108, -128, -128, -107, -128, -128, -128, -128, -128, -128, -121, -101, -128, -105, -128,
+    -128, -104, 20, -128, -125, -128, -126, 0, -97, -128, -118, -115, -128, -73, -128, -76,
+    -128, -128, 19, -125, -116, -128, 25, -128, -56, 51, 28, -25, -128, -128, -128, -128,
+    -128, -111, -120, -123, -128, -128, -105, -68, -128, -128, -128, -123, -57, -125, -66, -128,
+    -128, -128, -128, -128, -107, -128, -128, -128, -128, -128, -128, -128, -128, -128, -104, -128,
+    -128, -128, -128, -128, -128, -128, -128, -121, -57, -102, -95, -128, -128, -119, -128, -74,
+    -128, -79, -25, -128, -87, -128, -110, -128, -128, -116, -60, -128, -50, -84, -100, -128,
+    -128, -115, -128, -108, -128, -82, -128, 4, -86, -128, -119, -114, -128, -73, -128, -58,
+    -128, -128, 18, -124, -101, -128, 30, -84, -71, 42, 21, -72, -128, -128, -128, -128,
+    -128, -128, -128, -14, -128, -128, -88, -69, -128, -128, -128, -123, -81, -128, -103, -88,
+    -128, -128, -128, -128, -108, -128, -128, -95, -128, -128, -128, -128, -128, -83, -128, -118,
+    -128, -128, -128, -33, -128, -117, -128, -123, -128, -128, -45, -128, -128, -128, -106, -23,
+    -128, -75, -128, -111, -128, -124, -128, -122, -128, -128, -92, -128, -107, -126, -128, -128,
+    -128, -126, -128, -83, -89, -104, -128, -19, -128, -80, -128, -128, -116, -73, -128, -70,
+    -128, -128, 17, -115, -68, -128, 37, -99, -50, 0, -24, -48, -128, -128, -64, -128,
+    -72, -128, -128, -128, -128, -128, -128, -64, -128, -128, -128, -123, -53, -112, -98, -128,
+    -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -104, -94, -128, -121, -128, -128,
+    -88, -128, -107, -115, -97, -128, -94, -123, -128, -128, -54, -127, -128, -128, -128, -65,
+    -128, -93, -128, -128, -128, -122, -128, -128, -105, -128, -109, -128, -128, -128, -128, -125,
+    -76, -124, -128, -116, -124, -128, -103, 29, -128, -114, -119, -128, -95, -73, -128, -76,
+    -128, -128, 17, -119, -91, -103, 27, -52, -57, -58, 28, -123, -128, -128, -128, -128,
+    -101, -102, -111, -63, -128, -128, -128, -63, -128, -128, -128, -123, -70, -111, -110, -128,
+    -128, -125, -128, -83, -123, -128, -128, -128, -90, -128, -103, -108, -128, -128, -128, -128,
+    -125, -128, -101, -112, -103, -128, -128, -118, -74, -128, -49, -127, -128, -98, -128, -87,
+    -128, -89, -67, -128, -128, -128, -128, -128, -106, -128, -128, -128, -113, -128, -128, -128,
+    -62, -82, -75, -128, -128, -19, -120, 17, -128, -128, -100, -128, -128, -71, -128, -79,
+    -128, -128, 17, -102, -113, -128, 30, -128, -64, -17, -9, -15, -128, -128, -128, -128,
+    -128, -120, -112, -128, -128, -128, -107, -69, -128, -128, -128, -123, -58, -128, -102, -128,
+    -128, -128, -128, -83, -109, -128, -78, -115, -128, -128, -128, -115, -108, -91, -128, -113,
+    -128, -128, -122, -128, -111, -128, -128, -119, -128, -78, -89, -128, -128, -104, -128, -23,
+    -128, -86, -71, -128, -115, -128, -101, -128, -108, -128, -35, -128, -62, -128, -128, -128,
+    -106, -124, -128, -128, -128, -128, -128, -25, -128, -88, -120, -123, -128, -82, -87, -67,
+    -128, -128, 52, -67, -68, -128, 6, -57, -52, 11, 44, -113, -128, -128, -97, -128,
+    -128, -113, -124, -20, -128, -128, -128, -68, -128, -128, -92, -123, -90, -128, -104, -128,
+    -128, -128, -120, -119, -128, -128, -128, 71, -127, -119, -51, -91, -128, -128, -128, -111,
+    -123, -97, -128, -55, -99, -128, -118, -121, -128, -128, -21, -111, -128, -128, -113, -11,
+    -128, -95, -128, -106, -69, -128, -128, -114, -128, -128, -128, -128, -128, -128, -128, -128,
+    -128, -128, -128, -128, -128, -128, -128, 2, -128, -128, -128, -77, -128, -80, -128, -60,
+    -128, -128, 0, -110, -122, -128, 28, -37, -19, 42, 60, -128, -128, -128, -128, -128,
+    -106, -128, -128, 127, -128, -128, -106, -68, -128, -109, -126, -123, -15, -113, -96, -128,
+    -103, -116, -128, -101, -103, -5, -83, -128, -128, -128, -128, -89, -128, -96, -128, -100,
+    -38, -128, -128, -128, -114, -97, -128, -121, -123, -128, -128, -122, -128, -128, -111, 27,
+    -128, -67, -45, -121, -77, -121, -118, -128, 12, -128, -107, -106, -12, -128, -128, -128,
+    -102, -128, -82, -33, -97, -79, -122, 50, -128, -128, -118, -128, -43, -21, -128, -63,
+    -128, -63, 24, -128, -68, -128, 42, -82, -53, 49, 61, -128, -128, -128, -122, -115,
+    -128, -115, -127, -128, -128, -108, -128, -68, -128, -128, -128, -123, -34, -128, -128, -128,
+    -75, -43, -128, -128, -36, -128, -128, -128, -109, -128, -128, -97, -128, -128, -98, -128,
+    -128, -70, -128, -128, -100, -60, -128, -119, -128, -72, -128, -128, -122, -128, -128, -58,
+    -128, -110, -128, -128, -128, -63, -128, -128, -117, -128, -11, -88, -128, -128, -128, -128,
+    -29, -122, -48, -128, -110, -49, -106, 35, -128, -102, -128, -128, -128, -73, -128, -66,
+    -128, -119, 30, -128, -60, -128, 47, -75, -31, 20, 26, -71, -128, -128, -128, -121,
+    -128, -128, -128, -118, -128, -128, -111, -68, -128, -128, -128, -123, -94, -108, -128, -128,
+    -81, -89, -128, -128, -58, -128, -128, -128, -128, -128, -110, -96, -56, -128, -43, -128,
+    -109, -92, -128, -128, -114, -84, -119, -114, -128, -71, -100, -128, -128, -119, -113, -39,
+    -128, -124, -128, -128, -128, -128, -89, -128, -128, -128, -122, -128, -128, -128, -128, -128,
+    -128, -128, -113, -114, -128, -128, -128, -35, -128, -98, -128, -70, -92, -73, -128, -71,
+    -128, -128, 30, -128, -65, -128, 42, -116, -52, 4, 39, -63, -128, -128, -128, -128,
+    -126, -128, -128, -102, -128, -128, -117, -70, -128, -128, -76, -123, -59, -90, -128, -128,
+    -96, -113, -128, -128, -72, -128, -128, -128, -128, -128, -128, -95, -63, -128, -67, -128,
+    -114, -52, -128, -102, -117, -83, -121, -121, -128, -89, -86, -128, -128, -128, -109, -41,
+    -128, -127, -119, -125, -128, -128, -128, -128, -128, -128, -128, -128, -119, -128, -128, -128,
+    -128, -126, -128, -125, -128, -109, -128, -17, -128, -105, -128, -128, -81, -73, -128, -56,
+    -128, -126, 25, -119, -66, -128, 42, -65, -74, -9, 45, -89, -128, -128, -128, -128,
+    -122, -93, -128, -104, -128, -128, -128, -64, -128, -128, -116, -122, -65, -121, -128, -128,
+    -112, -125, -128, -128, -111, -128, -128, -128, -128, -128, -128, -91, -57, -106, -128, -128,
+    -128, -128, -128, -62, -77, -50, -128, -128, -128, -61, -81, -128, -128, -112, -112, -49,
+    -128, -126, -117, -99, -128, -128, -94, -106, -126, -128, -128, -84, -103, -128, -128, -128,
+    -128, -128, -124, -128, -128, -80, -128, -17, -128, -84, -128, -114, -102, -73, -128, -62,
+    -128, -128, 19, -128, -67, -128, 42, -91, -35, -3, 17, -71, -128, -128, -128, -114,
+    -128, -128, -105, -128, -128, -128, -128, -60, -128, -128, -115, -123, -25, -78, -128, -126,
+    -110, -128, -128, -128, -114, -128, -128, -128, -128, -128, -84, -118, -127, -128, -128, -128,
+    -128, -49, -128, -128, -92, -99, -65, -108, -128, -128, -113, -128, -128, -67, -93, -34,
+    -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -73, -128, -128, -128, -64, -128,
+    -128, -113, -128, -128, -117, -128, -128, -8, -128, -128, -128, -128, -112, -73, -128, -62,
+    -128, -122, 17, -128, -77, -128, 42, -100, -62, 26, 41, -41, -128, -128, -128, -128,
+    -128, -61, -122, -94, -128, -128, -128, -57, -128, -128, -128, -122, -48, -62, -102, -128,
+    -114, -128, -128, -128, -122, -128, -128, -107, -128, -128, -128, -101, -99, -120, -128, -110,
+    -128, -128, -128, -104, -128, -89, -128, -127, -110, -97, -41, -128, -128, -125, -93, -32,
+    -128, -128, 3, -106, -128, -128, -94, -128, -128, -128, -128, -113, -64, -128, -85, -128,
+    -128, -128, -84, -128, -91, 1, -128, -10, -128, -98, -128, -105, -128, -73, -128, -66,
+    -128, -128, 17, -128, -45, -128, 42, -97, -59, 38, -8, -63, -128, -128, -102, -110,
+    -128, -128, -113, -127, -128, -118, -128, -64, -128, -128, -128, -123, -17, -90, -128, -128,
+    -127, -128, -128, -128, -59, -128, -128, -119, -128, -128, -64, -128, -128, -119, -128, -128,
+    -102, -72, -108, -128, -128, -80, -77, -125, -128, -128, -110, -116, -128, -128, -77, -55,
+    -128, -128, -128, -121, -128, -128, -128, -128, -128, -128, -60, -83, -128, -128, -128, -128,
+    -27, -118, -128, -128, -85, -128, -101, -46, -128, -128, -99, -128, -128, -73, -128, -66,
+    -128, -95, 17, -128, -86, -128, 42, -73, -60, 44, -16, -88, -128, -128, -128, -128,
+    -120, -4, -117, -128, -128, -128, -91, -69, -128, -128, -128, -123, -102, -128, -128, -128,
+    -128, -118, -128, -128, -52, -128, -128, -128, -72, -128, -128, -106, -128, -128, -128, -128,
+    -128, -128, -65, -66, -128, -82, -128, -96, -51, -97, -64, -116, -128, -128, -84, -43,
+    -128, -115, -19, -128, -124, -128, -128, -128, -86, -128, -128, -111, -13, -128, -128, -128,
+    -128, -110, -30, -128, -89, -14, -128, -15, -128, -128, -102, -122, -124, -73, -128, -67,
+    -128, -107, 17, -128, -75, -128, 42, -128, -73, 31, 13, -2, -128, -128, -46, -128,
+    -128, -128, -128, -82, -128, -128, -128, -69, -128, -128, -128, -123, 0, -128, -111, -115,
+    -113, -91, -128, -128, -68, -128, -128, -103, -128, -128, -127, -128, -83, -90, -104, -128,
+    -128, -128, -91, -128, -128, -49, -128, -121, -128, -128, -81, -125, -128, -128, -128, -3,
+    -128, -100, -128, -93, -128, -128, -117, -128, -128, -128, 33, -114, -128, -128, -128, -41,
+    -128, -126, -128, -100, -103, -128, -117, 17, -128, -19, -128, -100, -99, -73, -128, -79,
+    -128, -128, 17, -128, -69, -128, 36, -41, -37, 20, -21, -116, -128, -128, -128, -116,
+    -103, -103, -128, -128, -128, -99, -128, -68, -128, -128, -128, -123, -93, -118, -128, -125,
+    -127, -105, -128, -128, -85, -128, -128, -128, -79, -128, -1, -128, -127, -128, -128, -128,
+    -97, -128, -105, -80, -128, -114, -61, -121, -30, -128, -105, -109, -128, -128, -89, -58,
+    -128, -128, -128, -128, -128, -128, -128, -128, -47, -128, -128, -128, -98, -128, -115, -128,
+    -93, -95, 11, -128, -120, -128, -88, -10, -128, -128, -90, -128, -128, -73, -128, -71,
+    -128, -128, 17, -128, -101, -128, 38, -128, -46, 42, -10, -24, -128, -128, -128, -128,
+    -128, -16, -112, -95, -128, -128, -63, -73, -128, -128, -128, -123, -77, -123, -52, -128,
+    -128, -120, -128, -128, -93, -128, -128, -74, -128, -128, -128, -128, -128, -128, -128, -128,
+    -128, -128, -94, -128, -128, -127, -128, -121, -84, -113, -128, -103, -120, -128, -128, -17,
+    -128, -95, -6, -97, -97, -128, -92, -128, -128, -125, -76, -128, -27, -119, -128, -128,
+    -128, -111, -125, -128, -128, -45, -128, -2, -128, -128, -118, -88, -128, -73, -128, -67,
+    -128, -112, 17, -128, -94, -128, 31, -128, -93, 42, 19, -24, -128, -128, -44, -128,
+    -121, -128, -99, -124, -128, -124, -128, -79, -128, -128, -128, -123, -68, -128, -128, -128,
+    -128, -128, -128, -128, -57, -128, -128, -95, -128, -128, -128, -128, -128, -63, -89, -128,
+    -128, -128, -89, -128, -128, -112, -128, -121, -128, -128, -43, -109, -107, -128, -128, -47,
+    -128, -94, -128, -94, -128, -118, -91, -128, -128, -128, 7, -91, -128, -128, -128, 9,
+    -128, -115, -128, -105, -91, -128, -119, 17, -128, 14, -128, -128, -85, -73, -128, -69,
+    -128, -128, 20, -128, -61, -128, 24, -22, -60, 4, 11, -123, -128, -128, -128, -114,
+    -56, -128, -109, -50, -128, -92, -128, -69, -91, -128, -128, -123, -97, -128, -128, -109,
+    -128, -128, -128, -128, -89, -128, -128, -128, -75, -128, -10, -128, -128, -128, -128, -128,
+    -128, -128, -106, -78, -128, -109, -75, -121, -32, -128, -74, -108, -122, -54, -128, -44,
+    -128, -126, -128, -128, -128, -128, -114, -128, -102, -128, -128, -124, -128, -128, -128, -128,
+    -79, -105, -2, -82, -113, -128, -83, -14, -128, -128, -109, -128, -87, -73, -94, -73,
+    -128, -128, 5, -123, -111, -128, 40, -128, -31, 26, -14, -20, -128, -128, -128, -128,
+    -128, -102, -121, -128, -128, -128, -59, -66, -93, -128, -128, -123, -30, -116, -83, -128,
+    -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128,
+    -128, -128, -120, -128, -128, -125, -128, -121, -44, -128, -115, -121, -128, -125, -94, 44,
+    -128, -94, 2, -128, -106, -128, -104, -128, -67, -128, -78, -128, -78, -109, -128, -128,
+    -126, -117, -103, -128, -106, -62, -122, -15, -128, -125, -123, -74, -128, -73, -117, -71,
+    -128, -128, 20, -128, -90, -128, 22, -95, -78, 47, 8, -44, -128, -128, -128, -128,
+    -128, -103, -119, -120, -128, -128, -109, -68, -128, -128, -128, -123, -66, -127, -128, -128,
+    -128, -128, -128, -128, -78, -128, -128, -3, -125, -128, -128, -128, -83, -100, -78, -128,
+    -128, -128, -121, -111, -128, -93, -128, -123, -123, -92, -40, -128, -128, -127, -124, -55,
+    -128, -81, -128, -118, -59, -124, -128, -128, -128, -128, -93, -116, -74, -116, -128, -128,
+    -128, -121, -128, -128, -66, -128, -128, 1, -128, -90, -128, -128, -128, -73, -128, -52,
+    -128, -128, 17, -128, -55, -128, 50, -118, -84, 27, 31, -58, -128, -128, -126, -128,
+    -100, -128, -120, -98, -128, -122, -128, -68, -128, -128, -128, -123, -58, -125, -128, -128,
+    -128, -128, -128, -128, -48, -128, -128, -96, -128, -121, -53, -118, -102, -128, -71, -128,
+    -102, -90, -128, -120, -90, -76, -80, -115, -128, -128, -88, -128, -124, -128, -87, -37,
+    -128, -97, -128, -116, -128, -121, -128, -128, -128, -128, -112, -61, -128, -128, -114, -128,
+    -128, -114, -128, -128, -109, -128, -128, 3, -128, -121, -127, -128, -49, -73, -128, -65,
+    -128, -125, 17, -128, -75, -128, 29, -48, -72, -34, 38, -101, -128, -120, -128, -128,
+    -108, -92, -101, -75, -128, -128, -55, -69, -118, -128, -101, -123, -62, -122, -85, -125,
+    -126, -128, -128, -128, -83, -128, -128, -128, -111, -126, -128, -108, -70, -128, -128, -128,
+    -128, -104, -128, -97, -124, -103, -128, -115, -49, -128, -48, -123, -128, -60, -95, -59,
+    -128, -98, -47, -128, -128, -128, -128, -128, -104, -128, -128, -103, -117, -128, -84, -128,
+    -128, -99, -63, -118, -102, -51, -120, -42, -128, -128, -128, -94, -44, -74, -128, -86,
+    -128, -128, 17, -128, -98, -128, 48, -116, -57, -17, -16, -27, -128, -128, -128, -128,
+    -128, -128, -108, -128, -128, -128, -96, -69, -128, -128, -124, -123, -26, -128, -111, -124,
+    -128, -128, -128, -128, -97, -128, -128, -85, -128, -128, -128, -126, -128, -98, -128, -126,
+    -128, -128, -116, -128, -123, -103, -128, -121, -126, -117, -83, -122, -128, -54, -97, -41,
+    -128, -87, -100, -100, -128, -128, -118, -128, -118, -128, -33, -82, -95, -128, -117, -128,
+    -128, -128, -128, -119, -93, -128, -128, 7, -128, -77, -125, -128, -123, -70, -128, -70,
+    -128, -124, 53, -128, -63, -128, 15, -66, -69, 23, 19, -85, -128, -128, -128, -128,
+    -128, -52, -128, -68, -128, -128, -109, -68, -128, -128, -128, -122, -74, -128, -95, -128,
+    -128, -126, -128, -128, -91, -128, -128, 9, -114, -126, -83, -100, -128, -128, -128, -110,
+    -104, -128, -102, -62, -128, -128, -128, -124, -128, -128, -66, -94, -128, -128, -100, -94,
+    -128, -81, -128, -95, -124, -125, -128, -123, -128, -128, -128, -128, -128, -128, -128, -128,
+    -128, -128, -128, -128, -86, -128, -128, 15, -128, -128, -121, -128, -128, -61, -128, -62,
+    -128, -128, -67, -128, -127, -128, 41, -38, 9, 46, 18, -128, -128, -128, -103, -128,
+    -128, -128, -124, 127, -107, -125, -128, -68, -128, -122, -128, -125, -15, -60, -88, -128,
+    -128, -100, -128, -128, -87, -52, -128, -128, -128, -128, -128, -93, -128, -100, -128, -116,
+    -24, -128, -110, -128, -126, -128, -128, -123, -128, -128, -128, -119, -128, -128, -81, 1,
+    -128, -80, -91, -121, -119, -128, -91, -128, -5, -128, -68, -119, -34, -128, -128, -128,
+    -116, -128, -117, -32, -66, -102, -128, 57, -128, -128, -95, -117, -44, -128, -128, -62,
+    -128, -51, 2, -28, -117, -128, 34, -82, 41, 54, -6, -128, -128, -128, -28, -128,
+    -128, -75, -126, -126, -97, -128, -128, -68, -128, -128, -120, -123, -62, -128, -118, -128,
+    -128, -112, -128, -128, -128, -128, -128, -128, -116, -128, -128, -100, -128, -128, -121, -119,
+    -128, -128, -48, -128, -58, -128, -128, -121, -128, -128, -128, -128, -128, -95, -128, -14,
+    -128, -97, -128, -128, -128, -71, -101, -128, -77, -128, 29, -128, -125, -128, -120, -128,
+    -113, -123, -80, -128, -128, 18, -128, 42, -128, -107, -128, -37, -128, -73, -128, -67,
+    -128, -128, -3, -66, -120, -118, 36, -100, -55, 54, -32, -45, -128, -128, 26, -128,
+    -128, -128, -127, -128, -92, -122, -128, -68, -128, -128, -109, -123, -128, -128, -107, -128,
+    -128, -97, -128, -128, -119, -128, -128, -128, -128, -128, -81, -101, -128, -99, -114, -128,
+    -112, -99, -22, -128, -54, -128, -116, -121, -128, -125, -128, -128, -128, -128, -128, -37,
+    -128, -116, -128, -128, -120, -128, -128, -128, -128, -128, -81, -128, -128, -128, -128, -116,
+    -120, -125, -128, -128, -128, -128, -101, 14, -128, -94, -128, -128, -128, -73, -128, -67,
+    -128, -128, -8, -103, -115, -102, 43, -95, -57, 52, -24, -82, -128, -128, -67, -128,
+    -109, -111, -124, -89, -107, -126, -128, -68, -128, -128, -111, -123, -128, -113, -88, -128,
+    -128, -69, -128, -128, -100, -128, -128, -128, -28, -128, -128, -87, -128, -128, -107, -128,
+    -119, -128, -26, -79, -88, -117, -128, -121, -128, -96, -128, -128, -128, -128, -128, -4,
+    -128, -113, -113, -128, -122, -128, -128, -128, -128, -128, -128, -128, -63, -128, -128, -128,
+    -128, -115, -98, -128, -128, -120, -128, 7, -128, -128, -128, -128, -119, -73, -128, -68,
+    -128, -110, 3, -118, -101, -128, 40, -85, -39, 45, -2, -55, -128, -128, -43, -128,
+    -115, -128, -123, -128, -89, -128, -128, -68, -128, -128, -128, -121, -128, -128, -115, -128,
+    -128, -75, -128, -128, -90, -128, -128, -118, -128, -128, -128, -87, -128, -126, -69, -128,
+    -128, -115, -55, -106, -97, -128, -128, -116, -128, -77, -121, -128, -128, -128, -128, -3,
+    -128, -106, -115, -128, -128, -128, -54, -128, -128, -128, -94, -128, -128, -128, -128, -119,
+    -128, -128, -128, -128, -116, -73, -128, -16, -128, -37, -128, -113, -100, -73, -128, -62,
+    -128, -128, 21, -128, -93, -128, 53, -95, -64, 42, -28, -68, -128, -128, -72, -128,
+    -128, -128, -115, -128, -101, -128, -128, -71, -128, -128, -114, -113, -118, -128, -64, -128,
+    -128, -67, -128, -128, -58, -128, -128, -90, -113, -128, -79, -97, -128, -107, -58, -128,
+    -120, -128, -58, -128, -83, -118, -83, -122, -128, -114, -128, -128, -128, -128, -128, -39,
+    -128, -119, -128, -128, -128, -128, -128, -128, -128, -128, -128, -109, -128, -128, -128, -128,
+    -128, -128, -128, -128, -106, -128, -117, 0, -128, -119, -128, -128, -101, -73, -128, -62,
+    -128, -128, 17, -128, -106, -128, 38, -70, -56, 50, -19, -49, -128, -128, -128, -128,
+    -128, -128, -128, -128, -128, -128, -128, -76, -128, -128, -128, -119, -128, -90, -68, -103,
+    -128, -23, -128, -128, -41, -128, -128, -110, -128, -127, -128, -92, -125, -128, -65, -127,
+    -118, -128, -71, -123, -128, -128, -128, -128, -122, -72, -95, -128, -128, -128, -128, -31,
+    -128, -118, -53, -118, -128, -128, -87, -128, -116, -128, -128, -128, -128, -128, -128, -128,
+    -128, -128, -99, -128, -90, -57, -128, -17, -128, -77, -128, -128, -98, -73, -128, -57,
+    -128, -128, 17, -128, -56, -128, 45, -113, -43, 50, -49, -77, -128, -128, -96, -128,
+    -118, -128, -128, -111, -128, -128, -128, -82, -128, -128, -93, -123, -108, -43, -61, -128,
+    -104, -10, -128, -128, -87, -128, -128, -110, -68, -128, -119, -128, -128, -128, -64, -128,
+    -66, -128, -90, -128, -28, -128, -84, -71, -128, -128, -128, -128, -128, -128, -128, -31,
+    -128, -128, -128, -128, -128, -110, -128, -128, -128, -128, -115, -110, -105, -128, -43, -128,
+    -128, -128, -128, -128, -128, -128, -128, 45, -128, -120, -128, -108, -115, -73, -128, -65,
+    -128, -69, 17, -128, -38, -128, 43, -47, -69, 50, -24, -101, -128, -128, -128, -128,
+    -128, 45, -128, -117, -128, -128, -128, -74, -128, -128, -128, -123, -128, -88, -127, -128,
+    -80, -45, -128, -128, -128, -128, -128, -128, -91, -128, -128, -116, -99, -128, -96, -128,
+    -116, -128, -128, -35, -40, -128, -128, -105, -84, -128, -110, -105, -128, -128, -128, -32,
+    -128, -116, -73, -119, -128, -128, -94, -128, -100, -128, -128, -97, -63, -128, -128, -128,
+    -94, -128, -118, -128, -128, -35, -117, -10, -128, -128, -128, -128, -128, -73, -128, -75,
+    -128, -85, 17, -108, -73, -128, 42, -127, -20, 49, -26, -8, -128, -128, -48, -128,
+    -128, -128, -124, -128, -97, -128, -116, -63, -128, -128, -128, -123, -85, -128, -86, -128,
+    -113, -128, -128, -128, -114, -128, -128, -111, -128, -128, -128, -128, -127, -97, -84, -128,
+    -117, -128, -121, -128, -51, -128, -128, -111, -128, -128, -128, -128, -128, -128, -121, -42,
+    -128, -96, -108, -101, -128, -115, -128, -128, -128, -128, 31, -102, -128, -128, -128, -31,
+    -128, -124, -128, -128, -128, -128, -127, -27, -128, -53, -128, -66, -128, -73, -128, -60,
+    -128, -128, 17, -128, -69, -128, 31, -86, -95, 34, -14, -93, -128, -128, -105, -128,
+    -128, -128, -120, -128, -128, -128, -128, -68, -128, -128, -79, -123, -119, -82, -128, -128,
+    -88, -128, -128, -128, -76, -128, -128, -83, -126, -128, -24, -128, -128, -128, -55, -128,
+    -104, -105, -97, -65, -33, -128, -71, -124, -128, -128, -128, -128, -128, -116, -128, -45,
+    -128, -110, -128, -122, -128, -128, -120, -128, -128, -128, -128, -59, -128, -128, -128, -128,
+    -76, -104, -99, -128, -128, -128, -109, 5, -128, -128, -128, -128, -106, -73, -128, -72,
+    -128, -128, 17, -128, -72, -128, 28, -109, -67, 50, -2, -72, -128, -128, -128, -128,
+    -123, -22, -113, -17, -128, -128, -43, -71, -128, -128, -111, -123, -96, -79, -128, -123,
+    -81, -128, -128, -128, -86, -128, -128, -128, -128, -128, -128, -128, -128, -128, -125, -128,
+    -128, -128, -128, -84, -100, -122, -128, -123, -68, -128, -128, -128, -128, -128, -54, -21,
+    -128, -94, -40, -98, -128, -128, -128, -128, -128, -124, -128, -93, -32, -121, -119, -128,
+    -97, -128, -61, -36, -103, -50, -114, -79, -128, -128, -105, -128, -123, -73, -128, -73,
+    -128, -128, 17, -118, -90, -128, 23, -85, -17, 48, 9, -27, -128, -128, -57, -128,
+    -114, -128, -128, -128, -128, -128, -113, -52, -128, -128, -128, -123, -46, -78, -113, -128,
+    -56, -114, -128, -128, -122, -128, -128, -128, -128, -128, -125, -128, -128, -55, -128, -128,
+    -128, -110, -128, -107, -116, -127, -128, -112, -128, -128, -74, -128, -128, -128, -66, 10,
+    -128, -100, -128, -97, -128, -128, -123, -128, -128, -128, 29, -128, -128, -128, -128, 37,
+    -128, -128, -128, -128, -85, -123, -128, 0, -128, -23, -128, -85, -119, -73, -128, -55,
+    -128, -123, 18, -128, -54, -128, 35, -46, -68, 22, -16, -113, -128, -128, -128, -117,
+    -115, -128, -128, -128, -128, -102, -128, -38, -128, -128, -86, -123, -97, -86, -128, -128,
+    -34, -98, -128, -128, -63, -128, -128, -115, -128, -128, -12, -128, -128, -117, -101, -128,
+    -101, -48, -128, -128, -85, -128, -66, -124, -125, -128, -117, -128, -128, -128, -35, -51,
+    -128, -124, -128, -109, -128, -128, -101, -128, -122, -128, -128, -124, -128, -128, -57, -128,
+    -128, -128, -54, -128, -113, -128, -128, -66, -128, -123, -128, -128, -75, -73, -128, -64,
+    -128, -121, 20, -128, -73, -128, 52, -128, -84, 42, -23, -29, -128, -128, -128, -128,
+    -128, -128, -128, -128, -119, -128, -79, -71, -128, -128, -128, -123, -71, -108, -84, -121,
+    -56, -80, -128, -128, -29, -128, -128, -99, -128, -128, -128, -128, -128, -128, -47, -128,
+    -101, -87, -128, -128, -121, -128, -115, -123, -22, -128, -128, -115, -128, -128, -5, -81,
+    -128, -111, -50, -124, -128, -128, -128, -128, -128, -128, -128, -64, -97, -99, -128, -128,
+    -94, -128, -61, -128, -71, -63, -108, -62, -128, -128, -99, -128, -121, -73, -128, -75,
+    -128, -128, 15, -128, -93, -128, 51, -71, -16, 53, -47, -64, -128, -128, -128, -128,
+    -128, -128, -128, -128, -128, -128, -64, -68, -128, -128, -128, -123, -119, -124, -75, -128,
+    -97, -51, -128, -128, -86, -128, -128, -128, -94, -128, -128, -128, -101, -123, -116, -128,
+    -112, -128, -74, -86, -103, -128, -128, -110, -80, -88, -77, -128, -128, -128, -121, -3,
+    -128, -79, -95, -128, -128, -126, -128, -128, -118, -128, -68, -128, -73, -114, -128, -128,
+    -128, -128, -128, -128, -122, -111, -128, 12, -128, -79, -128, -49, -128, -73, -107, -65,
+    -128, -124, 21, -109, -61, -128, 18, -98, -86, 48, 12, -75, -128, -128, -83, -128,
+    -128, -92, -112, -110, -128, -128, -128, -69, -128, -128, -109, -123, -85, -117, -128, -128,
+    -101, -47, -128, -128, -85, -128, -128, -47, -52, -125, -41, -128, -111, -128, -128, -128,
+    -106, -128, -56, -76, -82, -79, -105, -118, -110, -127, -128, -128, -128, -128, -128, -55,
+    -128, -79, -128, -126, -89, -120, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128,
+    -128, -128, -128, -128, -128, -128, -124, 31, -128, -128, -128, -128, -128, -73, -128, -62,
+    -128, -93, 23, -128, -84, -128, 33, -84, -45, 21, -8, -61, -128, -128, -128, -128,
+    -128, -94, -119, -128, -126, -128, -128, -71, -128, -128, -54, -123, -110, -128, -128, -128,
+    -89, -74, -128, -128, -49, -128, -128, -128, -128, -108, -128, -121, -107, -126, -53, -128,
+    -128, -128, -69, -128, -96, -86, -128, -123, -77, -82, -120, -128, -128, -102, -128, 23,
+    -128, -70, -52, -118, -128, -128, -72, -128, -128, -128, -128, -128, -108, -128, -128, -128,
+    -128, -128, -66, -128, -128, -79, -128, -32, -128, -106, -128, -116, -122, -73, -128, -62,
+    -128, -101, 21, -128, -75, -128, 31, -99, -70, 29, -35, -53, -128, -128, -128, -128,
+    -128, -128, -128, -128, -128, -128, -94, -70, -128, -128, -128, -123, -128, -128, -93, -121,
+    -43, -59, -128, -128, -27, -128, -128, -61, -128, -120, -128, -115, -98, -112, -31, -128,
+    -117, -128, -90, -128, -98, -117, -128, -123, -123, -109, -127, -128, -128, -58, -128, 2,
+    -128, -58, -128, -99, -123, -128, -128, -128, -128, -128, -91, -73, -114, -128, -128, -128,
+    -128, -128, -128, -128, -117, -128, -128, -28, -128, -93, -122, -128, -128, -73, -128, -62,
+    -128, -128, 35, -128, -49, -128, 56, -86, -42, 41, 12, -75, -128, -128, -128, -128,
+    -128, -45, -128, -128, -128, -128, -103, -67, -128, -128, -128, -120, -128, -128, -116, -128,
+    -85, -67, -128, -128, -57, -128, -128, -36, -92, -104, -104, -88, -98, -128, -45, -108,
+    -69, -128, -115, -60, -68, -128, -128, -126, -106, -128, -91, -111, -128, -95, -128, -61,
+    -128, -87, -128, -119, -97, -128, -128, -128, -125, -128, -128, -99, -102, -128, -97, -128,
+    -128, -128, -128, -128, -128, -78, -128, 22, -128, -128, -121, -64, -128, -77, -128, -62,
+    -128, -128, 8, -128, -102, -128, 47, -35, -66, 53, 53, -128, -128, -128, -82, -128,
+    -128, -128, -123, 127, -94, -128, -114, -68, -128, -128, -128, -96, -47, -116, -86, -128,
+    -116, -45, -128, -128, -42, -59, -128, -128, -128, -128, -128, -88, -127, -63, -98, -128,
+    -33, -128, -105, -67, -85, -49, -128, -105, -128, -128, -128, -122, -128, -124, -128, 22,
+    -128, -73, -128, -96, -57, -119, -128, -108, -81, -128, -68, -29, -66, -128, -128, -128,
+    -128, -127, -128, 78, -84, -114, -128, 47, -128, -128, -108, -128, -85, -51, -128, -62,
+    -128, -47, 25, -128, -71, -128, 31, -92, -35, 54, 76, -128, -128, -128, -128, -128,
+    -128, -121, -128, -57, -118, -128, -49, -68, -99, -128, -128, -123, 9, -128, -70, -125,
+    -98, -128, -89, -128, -112, -128, -128, -128, -128, -119, -107, -128, -128, -128, -122, -119,
+    -128, -128, -128, -128, -128, -63, -128, -121, -117, -128, -128, -94, -128, -128, -102, -23,
+    -128, -78, -128, -128, -128, -65, -122, -98, -128, -128, -24, -65, -128, -128, -114, -128,
+    -128, -128, -22, -128, -122, -16, -128, 6, -128, -128, -127, -128, -128, -73, -128, -56,
+    -128, -128, 32, -56, -96, -127, 2, -88, -32, 54, 39, -26, -128, -128, -128, -128,
+    -87, -128, -128, -128, -82, -128, -107, -71, -111, -128, -128, -122, -57, -128, -20, -128,
+    -128, -128, -97, -128, -128, -128, -128, -128, -128, -128, -125, -128, -128, -116, -126, -108,
+    -117, -128, -128, -114, -100, -95, -103, -121, -108, -128, -128, -94, -128, -128, -126, -41,
+    -128, -75, -128, -128, -128, -100, -128, -128, -87, -114, -100, -71, -123, -128, -128, -128,
+    -128, -128, -128, -124, -128, -128, -128, 46, -128, -128, -128, -72, -128, -73, -128, -66,
+    -128, -115, 33, -30, -103, -125, -8, -100, -45, 54, 32, -74, -128, -128, -128, -128,
+    -128, -73, -128, -128, -101, -128, -126, -74, -112, -128, -128, -123, -75, -128, -55, -107,
+    -128, -128, -114, -128, -128, -128, -128, -114, -128, -128, -128, -128, -128, -125, -128, -100,
+    -128, -128, -128, -128, -88, -123, -128, -121, -116, -128, -128, -91, -128, -128, -106, -50,
+    -128, -74, -110, -114, -100, -101, -70, -128, -128, -86, -128, -91, -98, -128, -128, -128,
+    -128, -116, -128, -128, -128, -116, -123, 3, -128, -128, -124, -99, -128, -73, -128, -72,
+    -128, -113, 27, -43, -112, -128, 1, -78, -41, 54, 16, -45, -128, -128, -128, -128,
+    -128, -128, -128, -128, -76, -128, -125, -76, -116, -128, -128, -122, -80, -128, -26, -128,
+    -128, -128, -128, -128, -128, -128, -128, -72, -128, -128, -128, -128, -128, -119, -125, -108,
+    -128, -128, -128, -125, -96, -108, -122, -121, -128, -128, -128, -105, -128, -128, -112, -31,
+    -128, -70, -128, -99, -102, -111, -118, -120, -128, -103, -78, -91, -128, -128, -128, -128,
+    -128, -127, -128, -128, -128, -128, -128, 0, -128, -77, -121, -128, -128, -73, -128, -62,
+    -128, -128, 20, -26, -87, -128, -3, -120, -61, 54, 43, -30, -128, -128, -128, -128,
+    -100, -124, -123, -112, -76, -128, -128, -73, -112, -128, -128, -120, -73, -128, -27, -91,
+    -128, -128, -120, -128, -128, -128, -128, -92, -111, -119, -108, -128, -128, -105, -127, -128,
+    -116, -128, -128, -120, -61, -99, -88, -124, -118, -128, -128, -118, -128, -128, -128, -37,
+    -128, -94, -128, -127, -103, -75, -128, -128, -128, -107, -128, -92, -109, -128, -128, -128,
+    -128, -126, -128, -128, -128, -128, -128, 50, -128, -128, -128, -117, -128, -73, -128, -62,
+    -128, -128, 17, -10, -114, -128, 27, -82, -31, 54, 31, -54, -128, -128, -128, -128,
+    -128, -128, -128, -128, -126, -128, -128, -64, -120, -128, -128, -122, -79, -128, -26, -118,
+    -128, -128, -128, -128, -128, -128, -128, -119, -128, -111, -128, -128, -128, -128, -128, -106,
+    -88, -128, -128, -116, -72, -110, -128, -89, -114, -128, -128, -128, -128, -128, -118, -31,
+    -128, -125, -106, -66, -84, -44, -128, -114, -128, -96, -128, -97, -126, -128, -128, -128,
+    -128, -128, -128, -128, -128, -128, -126, -2, -128, -107, -118, -119, -128, -73, -128, -62,
+    -128, -112, 17, -12, -123, -128, 20, -88, -65, 54, 41, -74, -128, -94, -128, -128,
+    -124, -117, -127, -127, -128, -128, -69, -52, -112, -128, -128, -124, -68, -128, -35, -128,
+    -128, -128, -128, -128, -128, -128, -128, -57, -125, -128, -128, -128, -128, -128, -128, -126,
+    -95, -128, -128, -93, -98, -60, -109, -99, -98, -128, -128, -128, -128, -128, -120, -31,
+    -128, -128, -128, -66, -91, -69, -112, -63, -128, -48, -128, -70, -95, -128, -128, -128,
+    -128, -128, -128, -114, -128, -128, -128, -6, -128, -128, -118, -103, -102, -73, -128, -62,
+    -128, -77, 17, -86, -105, -128, 38, -92, -32, 54, 98, -43, -128, -128, -128, -128,
+    -128, -95, -124, -128, -128, -128, -128, -33, -111, -128, -128, -123, -81, -128, -25, -128,
+    -128, -128, -128, -128, -128, -128, -128, -72, -128, -128, -115, -128, -128, -92, -114, -128,
+    -128, -124, -128, -128, -128, -55, -117, -114, -128, -128, -123, -128, -128, -128, -128, -31,
+    -128, -128, -128, -66, -128, -128, -92, -52, -128, 0, -118, -53, -128, -128, -61, -128,
+    -128, -128, -128, -128, -128, -39, -128, 53, -128, -115, -58, -128, -123, -73, -128, -56,
+    -128, -128, 17, -128, -61, -128, 42, -103, -81, 54, 45, -61, -128, -128, -128, -128,
+    -128, -111, -128, -128, -128, -128, -116, -75, -128, -128, -128, -122, -64, -128, -93, -128,
+    -118, -128, -128, -128, -116, -128, -128, -128, -128, -128, -109, -128, -128, -76, -119, -128,
+    -128, -108, -128, -128, -128, 6, -112, -118, -128, -128, -128, -128, -128, -128, -128, -31,
+    -128, -96, -128, -128, -128, -128, -128, -128, -128, -128, -108, -48, -128, -128, -128, -128,
+    -128, -128, -128, -128, -62, -128, -128, -10, -128, -128, -84, -128, -128, -73, -128, -65,
+    -128, -128, 17, -102, -86, -128, 45, -93, -3, 54, 28, -26, -128, -128, -128, -128,
+    -112, -128, -128, -123, -99, -128, -128, -73, -128, -128, -128, -123, -67, -128, -16, -128,
+    -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -126, -128, -128, -128, -123, -128,
+    -113, -128, -128, -128, -102, -77, -125, -125, -128, -128, -128, -128, -128, -128, -128, -32,
+    -128, -84, -109, -128, -105, -128, -128, -88, -128, -101, -118, -120, -128, -128, -128, -128,
+    -128, -128, -128, -128, -108, -128, -127, 9, -128, -80, -128, -23, -128, -73, -128, -72,
+    -128, -118, 17, -128, -72, -128, 51, -101, -64, 54, 42, -76, -128, -128, -128, -128,
+    -107, -38, -127, -84, -128, -128, -128, -70, -124, -128, -128, -123, -112, -113, -2, -128,
+    -128, -128, -128, -128, -127, -128, -128, -122, -89, -128, -128, -128, -128, -128, -103, -128,
+    -128, -128, -128, -109, -116, -77, -101, -105, -74, -128, -128, -128, -128, -128, -128, -48,
+    -128, -72, -128, -128, -93, -128, -109, -128, -128, -113, -128, -98, -61, -128, -43, -128,
+    -128, -128, -128, -128, -97, -123, -123, 38, -128, -128, -76, -128, -128, -73, -128, -62,
+    -128, -121, 17, -126, -95, -128, 51, -86, -60, 54, 44, -28, -128, -128, -104, -128,
+    -128, -128, -128, -128, -109, -128, -116, -68, -128, -128, -128, -123, -111, -128, -20, -128,
+    -128, -128, -128, -128, -122, -128, -128, -128, -128, -128, -113, -128, -128, -86, -91, -128,
+    -121, -114, -128, -116, -97, -89, -128, -120, -128, -128, -119, -128, -128, -128, -128, -56,
+    -128, -89, -106, -128, -100, -128, -128, -126, -128, -123, -10, -50, -128, -128, -128, -96,
+    -128, -128, -128, -128, -71, -103, -114, 2, -128, -67, -80, -106, -128, -73, -128, -62,
+    -128, -125, 17, -90, -97, -128, 45, -62, -42, 54, -5, -90, -128, -128, -121, -128,
+    -128, -128, -128, -128, -94, -128, -128, -82, -128, -128, -128, -123, -121, -120, -16, -128,
+    -128, -128, -128, -128, -128, -128, -128, -99, -24, -128, -58, -128, -128, -125, -94, -128,
+    -94, -128, -128, -111, -36, -90, -74, -125, -93, -128, -128, -128, -128, -128, -128, -35,
+    -128, -99, -128, -128, -128, -128, -128, -106, -128, -128, -128, -69, -128, -128, -128, -128,
+    -128, -128, -117, -124, -97, -128, -128, 43, -128, -75, -106, -118, -101, -73, -128, -62,
+    -128, -101, 17, -83, -78, -128, 32, -128, -77, 54, 49, -16, -128, -128, -128, -128,
+    -70, -94, -122, -106, -73, -128, -128, -82, -124, -105, -128, -123, -80, -69, -9, -102,
+    -128, -128, -128, -128, -128, -128, -128, -128, -8, -128, -128, -128, -128, -128, -117, -128,
+    -98, -128, -128, -128, -50, -62, -84, -103, 10, -128, -128, -128, -128, -128, -128, -32,
+    -128, -96, -113, -128, -128, -105, -128, -128, -128, -107, -128, -23, -75, -124, -61, -128,
+    -128, -128, -118, -116, -128, -105, -128, 69, -128, -128, -76, -128, -110, -73, -128, -62,
+    -128, -123, 17, -58, -87, -128, 1, -72, -65, 54, 54, -68, -128, -128, -128, -128,
+    -128, -84, -123, -114, -128, -128, -128, -68, -126, -128, -128, -123, -112, -123, -68, -128,
+    -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -111, -128, -128, -123, -119, -110,
+    -120, -128, -128, -122, -94, -50, -128, -119, -77, -128, -128, -128, -128, -128, -128, -49,
+    -128, -67, -62, -104, -128, -101, -103, -128, -128, -65, -73, 2, -115, -128, -128, -128,
+    -128, -113, -128, -128, -128, -105, -128, 2, -128, -128, -78, -110, -128, -73, -128, -62,
+    -128, -122, 27, -21, -97, -128, -20, -90, -30, 54, 41, -63, -128, -128, -128, -128,
+    -128, -74, -124, -112, -75, -128, -91, -71, -119, -109, -128, -123, -90, -128, -41, -128,
+    -128, -128, -102, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -97, -97, -100,
+    -128, -128, -128, -101, -97, -128, -110, -121, -105, -128, -128, -128, -128, -128, -84, -37,
+    -128, -66, -128, -99, -128, -114, -76, -126, -127, -63, -112, -122, -128, -128, -128, -128,
+    -128, -115, -128, -128, -128, -128, -128, -17, -128, -128, -99, -41, -128, -73, -128, -62,
+    -128, -115, -20, -30, -108, -128, -20, -115, -43, 54, 18, -17, -128, -128, -128, -128,
+    -128, -128, -128, -127, -42, -128, -128, -68, -126, -126, -128, -123, -55, -128, -16, -123,
+    -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -108, -113, -103,
+    -128, -128, -128, -128, -98, -128, -128, -121, -128, -128, -128, -128, -128, -128, -109, -60,
+    -128, -62, -128, -112, -128, -116, -109, -122, -128, -82, -99, -112, -97, -128, -128, -128,
+    -128, -127, -128, -113, -128, -128, -128, 18, -128, -128, -101, -128, -128, -73, -128, -62,
+    -128, -128, 24, -40, -92, -128, 6, -115, -45, 50, 16, -58, -128, -128, -128, -128,
+    -108, -128, -128, -128, -128, -128, -128, -59, -102, -128, -128, -122, -59, -128, -67, -128,
+    -128, -128, -121, -128, -128, -128, -128, -49, -128, -128, -128, -128, -128, -120, -128, -111,
+    -94, -128, -128, -103, -99, -125, -128, -121, -128, -128, -128, -128, -128, -72, -109, -62,
+    -128, -81, -128, -115, -97, -122, -124, -128, -128, -74, -128, -83, -127, -128, -128, -128,
+    -128, -121, -128, -118, -128, -128, -128, 16, -128, -55, -87, -110, -128, -73, -128, -62,
+    -128, -128, 19, -83, -82, -128, 7, -40, -73, 39, 51, -118, -128, -128, -128, -128,
+    -128, -54, -122, -47, -128, -128, -127, -68, -128, -128, -128, -126, -96, -128, -36, -128,
+    -128, -128, -128, -128, -128, -128, -128, -75, -128, -92, -10, -128, -128, -128, -128, -126,
+    -108, -112, -128, -50, -128, -121, -104, -116, -94, -128, -73, -128, -128, -96, -91, -44,
+    -128, -96, -128, -123, -128, -121, -128, -82, -128, -98, -128, -74, -128, -128, -128, -128,
+    -87, -111, -128, -128, -120, -117, -128, 2, -128, -128, -50, -128, -128, -73, -128, -62,
+    -128, -128, 23, -53, -125, -128, 29, -87, 44, 48, 69, -128, -128, -128, -128, -128,
+    -118, -128, -127, 127, -75, -128, -93, -68, -93, -128, -128, -121, 20, -128, -55, -128,
+    -128, -128, -104, -128, -128, 82, -128, -128, -128, -128, -128, -121, -128, -32, -111, -128,
+    -77, -128, -128, -122, -97, -128, -128, -112, -115, -128, -128, -121, -128, -128, -110, -72,
+    -128, -102, -81, -128, -71, -98, -128, -128, -11, -128, -72, -128, -23, -123, -72, -128,
+    -120, -78, -128, -10, -128, -72, -128, 77, -128, -128, -81, -18, -128, -73, -128, -62,
+    -128, -40, 54, -128, -94, -128, 50, -87, -1, 50, 91, -128, -128, -128, -128, -114,
+    -128, -109, -121, -101, -68, -128, -128, -68, -38, -87, -128, -119, -120, -128, -128, -128,
+    -128, -128, -75, -128, 30, -128, -128, -128, -128, -128, -77, -128, -128, -128, -93, -128,
+    -128, 26, -128, -128, -128, -128, -128, -121, -102, -76, -128, -128, -128, -128, -128, -49,
+    -128, -128, -128, -128, -128, -42, -42, -128, -87, -128, -30, -128, -128, -128, -86, -128,
+    -128, -76, 42, -128, -88, -98, -128, 12, -41, -121, -76, -128, -128, -49, -128, -62,
+    -128, -128, 77, -128, -99, -128, 54, -93, -62, 54, 97, -56, -128, -128, -128, -128,
+    -122, -111, -119, -128, -53, -128, -64, -69, -37, -13, -128, -123, -128, -128, -128, -119,
+    -96, -128, -85, -128, 55, -128, -128, -128, -128, -128, -113, -128, -128, -128, -85, -128,
+    -128, 4, -128, -112, -128, -104, -123, -121, -80, -39, -128, -128, -128, -128, -128, -54,
+    -128, -128, -108, -128, -85, -78, -46, -128, -128, -128, -128, -78, -122, -128, -128, -128,
+    -128, -72, -112, -128, -75, -120, -128, -23, -27, -128, -45, -128, -90, -22, -128, -62,
+    -128, -128, 82, -128, -95, -128, 61, -96, -59, 54, 95, -76, -128, -128, -128, -128,
+    -128, -114, -119, -114, -38, -128, -86, -60, -38, -45, -128, -126, -128, -128, -128, -128,
+    -95, -128, -72, -128, 55, -128, -128, -128, -128, -128, -128, -128, -128, -128, -86, -128,
+    -128, -1, -128, -119, -128, -120, -128, -121, -89, -22, -128, -128, -126, -128, -128, -56,
+    -128, -128, -120, -106, -100, -86, -64, -128, -128, -128, -124, -69, -124, -128, -123, -128,
+    -128, -66, -119, -121, -50, -128, -128, -18, -26, -128, -46, -128, -120, -28, -128, -62,
+    -128, -128, 81, -128, -107, -128, 60, -92, -60, 54, 95, -67, -128, -128, -128, -128,
+    -120, -128, -119, -128, -33, -128, -69, -55, -42, -32, -128, -126, -128, -128, -116, -127,
+    -93, -128, -72, -128, 32, -128, -128, -123, -128, -128, -128, -128, -128, -128, -86, -128,
+    -128, -4, -128, -105, -128, -125, -118, -121, -101, -28, -128, -128, -128, -128, -128, -62,
+    -128, -128, -128, -114, -86, -82, -128, -128, -125, -128, -115, -73, -119, -128, -124, -116,
+    -128, -71, -123, -128, -72, -128, -128, -6, -26, -116, -55, -128, -123, -27, -128, -62,
+    -128, -128, 81, -128, -95, -128, 52, -103, -39, 54, 103, -55, -128, -128, -128, -128,
+    -128, -128, -118, -128, -35, -128, -66, -47, -34, -47, -128, -124, -128, -128, -128, -128,
+    -93, -128, -72, -128, 26, -128, -128, -125, -128, -128, -128, -128, -128, -128, -87, -128,
+    -128, 15, -128, -101, -128, -128, -123, -115, -94, -29, -128, -128, -123, -128, -128, -57,
+    -128, -128, -128, -114, -75, -79, -39, -128, -128, -128, -128, -115, -116, -128, -128, -128,
+    -128, -58, -124, -128, -93, -119, -128, -32, -26, -123, -64, -93, -128, -27, -128, -62,
+    -128, -128, 81, -128, -92, -128, 52, -95, -54, 54, 80, -87, -128, -128, -128, -121,
+    -128, -128, -116, -128, -69, -128, -124, -65, -40, -65, -124, -108, -128, -128, -128, -128,
+    -102, -128, -72, -128, 41, -128, -128, -103, -128, -117, -128, -128, -128, -128, -81, -128,
+    -128, 1, -128, -79, -128, -102, -125, -112, -109, -20, -128, -128, -128, -128, -128, -53,
+    -122, -128, -128, -128, -62, -101, -61, -128, -128, -128, -113, -97, -116, -128, -128, -128,
+    -128, -71, -126, -128, -41, -128, -128, -4, -30, -101, -69, -128, -128, -27, -128, -62,
+    -128, -128, 82, -128, -92, -128, 49, -91, -36, 54, 83, -70, -128, -128, -128, -124,
+    -126, -125, -116, -126, -68, -128, -98, -70, -35, -69, -128, -97, -128, -128, -128, -128,
+    -113, -128, -83, -128, 50, -128, -128, -104, -128, -128, -128, -128, -128, -128, -67, -128,
+    -128, 2, -128, -57, -128, -88, -106, -116, -79, -6, -128, -128, -128, -128, -128, -52,
+    -128, -128, -128, -128, -53, -128, -47, -128, -123, -128, -128, -128, -128, -128, -128, -128,
+    -128, -69, -107, -128, -4, -116, -128, -32, -36, -113, -98, -117, -128, -27, -128, -62,
+    -128, -119, 82, -128, -93, -128, 43, -96, -48, 54, 87, -87, -128, -128, -128, -98,
+    -128, -128, -118, -110, -109, -128, -40, -74, -35, -121, -128, -107, -128, -128, -125, -128,
+    -103, -128, -122, -128, 27, -128, -128, -128, -128, -128, -105, -128, -128, -128, -77, -128,
+    -128, 36, -128, -128, -128, -104, -126, -125, -94, -32, -128, -128, -128, -128, -128, -55,
+    -128, -128, -128, -128, -58, -128, -64, -128, -128, -128, -121, -128, -128, -128, -128, -128,
+    -128, -84, -128, -128, 5, -128, -128, -24, -30, -120, -113, -128, -111, -22, -128, -62,
+    -128, -128, 82, -128, -87, -128, 43, -95, -26, 54, 87, -76, -128, -128, -128, -128,
+    -128, -98, -118, -102, -83, -128, -75, -72, -67, -110, -104, -122, -128, -128, -96, -128,
+    -128, -128, -128, -128, -21, -128, -128, -128, -128, -128, -116, -128, -128, -128, -87, -128,
+    -120, 4, -128, -116, -128, -128, -125, -127, -65, -28, -128, -128, -128, -128, -128, -54,
+    -128, -128, -121, -128, -74, -112, -119, -128, -128, -128, -128, -128, -102, -128, -70, -128,
+    -128, -66, -115, -113, -98, -128, -128, 11, -26, -128, -74, -93, -128, -29, -128, -62,
+    -128, -128, 81, -128, -111, -128, 43, -93, -57, 54, 94, -54, -128, -128, -128, -128,
+    -128, -128, -117, -117, -33, -128, -86, -57, -60, -19, -128, -126, -128, -128, -120, -128,
+    -115, -128, -128, -128, -18, -128, -128, -128, -128, -128, -128, -128, -128, -128, -86, -128,
+    -128, -10, -128, -82, -128, -111, -116, -114, -96, -26, -128, -128, -128, -128, -128, -55,
+    -128, -128, -123, -125, -69, -74, -76, -128, -128, -128, -104, -109, -128, -128, -128, -128,
+    -128, -62, -120, -128, -128, -128, -128, -22, -25, -122, -68, -128, -128, -28, -128, -62,
+    -128, -128, 80, -128, -99, -128, 43, -97, -27, 54, 98, -80, -128, -128, -128, -128,
+    -128, -118, -117, -122, -55, -128, -108, -57, -50, -31, -125, -126, -128, -128, -126, -128,
+    -115, -128, -128, -128, -18, -128, -128, -128, -128, -128, -128, -128, -128, -124, -86, -128,
+    -128, 2, -128, -121, -128, -127, -122, -119, -92, -32, -128, -128, -128, -128, -128, -55,
+    -128, -128, -128, -128, -72, -82, -44, -128, -128, -128, -128, -128, -114, -128, -128, -128,
+    -128, -53, -114, -128, -128, -127, -128, -25, -24, -120, -80, -98, -128, -27, -128, -62,
+    -128, -128, 80, -128, -103, -128, 43, -98, -40, 54, 93, -69, -128, -128, -128, -128,
+    -128, -128, -117, -128, -46, -128, -70, -66, -63, -33, -128, -126, -128, -128, -128, -128,
+    -114, -128, -128, -128, -12, -128, -128, -123, -128, -128, -111, -128, -128, -125, -85, -128,
+    -128, 4, -128, -92, -128, -115, -125, -128, -110, -31, -128, -128, -128, -128, -128, -53,
+    -128, -128, -128, -128, -57, -82, -128, -128, -128, -128, -101, -104, -128, -128, -128, -128,
+    -128, -62, -128, -128, -113, -128, -128, -17, -24, -102, -73, -128, -128, -27, -128, -62,
+    -128, -128, 80, -128, -97, -128, 43, -90, -62, 54, 96, -100, -128, -128, -128, -128,
+    -103, -119, -117, -103, -46, -128, -73, -73, -80, -29, -128, -126, -128, -128, -128, -102,
+    -105, -128, -123, -128, -26, -128, -128, -115, -128, -128, -87, -128, -128, -128, -86, -128,
+    -128, -36, -128, -91, -128, -107, -111, -108, -61, -23, -128, -125, -128, -128, -128, -54,
+    -128, -128, -128, -128, -60, -50, -85, -128, -128, -128, -128, -96, -126, -128, -89, -128,
+    -128, -62, -112, -128, -128, -128, -124, -1, -21, -114, -96, -107, -121, -30, -128, -62,
+    -128, -121, 81, -128, -103, -128, 45, -105, -15, 54, 106, -42, -128, -128, -128, -128,
+    -112, -91, -120, -125, -29, -128, -85, -27, -39, -3, -124, -126, -128, -128, -114, -128,
+    -84, -128, -104, -128, 1, -128, -128, -128, -128, -128, -128, -128, -128, -128, -87, -128,
+    -128, 9, -128, -128, -128, -128, -111, -118, -64, -38, -128, -128, -127, -128, -128, -55,
+    -128, -128, -121, -91, -84, -69, -37, -128, -121, -128, -128, -128, -116, -127, -128, -128,
+    -128, -57, -109, -128, -128, -97, -128, -52, -26, -128, -80, -104, -94, -27, -128, -62,
+    -128, -128, 82, -128, -91, -128, 55, -94, -52, 54, 96, -73, -128, -128, -128, -128,
+    -128, -125, -120, -126, -30, -128, -109, -63, -41, -63, -128, -126, -128, -128, -118, -128,
+    -93, -128, -90, -128, 35, -128, -128, -128, -128, -128, -128, -128, -128, -128, -87, -128,
+    -128, 8, -128, -107, -128, -128, -128, -126, -102, -33, -128, -128, -115, -128, -128, -53,
+    -128, -128, -114, -128, -67, -101, -49, -128, -128, -128, -99, -127, -126, -128, -109, -128,
+    -128, -57, -128, -128, -57, -128, -128, -8, -27, -128, -50, -128, -128, -26, -128, -62,
+    -128, -128, 85, -128, -93, -128, 68, -96, -60, 54, 93, -80, -128, -128, -128, -128,
+    -128, -114, -118, -128, -43, -128, -105, -66, -42, -57, -128, -126, -128, -128, -128, -128,
+    -111, -128, -72, -128, 56, -128, -128, -128, -128, -128, -128, -128, -128, -128, -86, -128,
+    -128, 2, -128, -92, -128, -127, -119, -121, -97, -37, -128, -128, -114, -128, -128, -56,
+    -128, -128, -125, -128, -81, -104, -75, -128, -128, -128, -125, -82, -124, -128, -101, -128,
+    -128, -66, -113, -128, -28, -128, -128, -14, -22, -128, -28, -128, -111, -29, -128, -62,
+    -128, -128, 88, -128, -93, -128, 68, -102, -64, 54, 88, -31, -128, -128, -128, -128,
+    -128, -128, -115, -128, -25, -128, -81, -61, -38, -93, -128, -126, -128, -128, -116, -128,
+    -127, -128, -72, -128, 61, -128, -128, -128, -128, -128, -128, -128, -128, -128, -87, -128,
+    -128, -16, -128, -117, -128, -119, -128, -121, -108, -8, -128, -128, -119, -128, -128, -53,
+    -122, -128, -123, -128, -96, -97, -82, -128, -128, -128, -118, -58, -97, -128, -124, -128,
+    -128, -78, -127, -128, -37, -128, -128, -2, -25, -105, -34, -128, -104, -28, -128, -62,
+    -128, -128, 85, -128, -88, -128, 56, -123, -58, 52, 96, -74, -128, -128, -128, -128,
+    -110, -128, -115, -128, -110, -128, -64, -64, -19, -128, -124, -119, -128, -128, -127, -128,
+    -128, -128, -108, -128, 64, -128, -128, -103, -128, -128, -128, -128, -128, -128, -85, -128,
+    -128, 32, -128, -62, -128, -87, -127, -121, -118, -2, -128, -128, -128, -128, -128, -54,
+    -128, -128, -128, -128, -71, -101, -95, -128, -119, -128, -128, -78, -99, -128, -107, -128,
+    -128, -69, -128, -128, -6, -111, -128, -31, -32, -51, -65, -128, -128, -27, -128, -62,
+    -128, -128, 73, -128, -68, -128, 50, -44, -53, 42, 123, -107, -128, -128, -128, -116,
+    -128, -71, -125, -92, -128, -128, -124, -73, -33, -128, -95, -57, -128, -128, -116, -128,
+    -128, -128, -80, -128, 48, -128, -128, -126, -128, -128, -82, -128, -128, -128, -69, -128,
+    -128, 1, -128, 6, -128, -28, -100, -118, -84, -58, -79, -128, -128, -128, -128, -51,
+    -128, -128, -128, -128, -34, -106, -66, -128, -128, -128, -128, -115, -128, -128, -112, -128,
+    -128, -66, -128, -128, -44, -128, -128, 1, -42, -128, -76, -123, -128, -22, -128, -65,
+    -128, -128, 54, -128, -95, -128, 52, -80, -39, 50, 124, -128, -128, -128, -128, -115,
+    -128, -128, -128, 127, -69, -128, -51, -67, -32, -128, -54, -46, -76, -115, -128, -122,
+    -108, -128, -93, -128, 24, -11, -128, -128, -128, -118, -128, -114, -121, -92, -93, -128,
+    -67, -89, -128, -111, -128, -64, -128, -121, -108, -128, -128, -128, -128, -128, -128, -50,
+    -128, -128, -81, -128, -41, -109, -43, -128, -79, -128, -105, -83, -29, -123, -128, -128,
+    -128, -58, -120, 39, -45, -81, -128, -2, -27, -128, -35, -128, -55, -47, -128, -69,
+    -128, -118, -16, -58, -128, -128, 42, -40, 34, 39, 45, -128, -128, -128, -121, 4,
+    -128, -128, -128, -112, -95, -40, -128, -68, -128, -128, -69, -39, -2, -120, -128, -128,
+    -99, -78, -72, -83, -128, -128, -128, -128, -45, -128, -72, -128, -128, -128, -128, -128,
+    -128, -62, -127, -128, -128, -128, -128, -121, -109, -128, -128, -128, -101, -128, -112, 1,
+    20, -128, -128, -128, -128, -49, -128, -128, -26, -128, 11, -128, -128, -128, -124, -128,
+    -127, -77, 31, -128, -108, -124, -128, 29, -79, -122, -128, -111, -128, -128, -71, -62,
+    -128, -128, -3, -35, -128, -117, 41, -116, -46, 48, 38, -19, -128, -128, -128, -9,
+    -120, -128, -128, -108, -49, -44, -124, -68, -128, -84, -39, -35, -42, -114, -128, -128,
+    -105, -86, -72, -100, -128, -128, -110, -117, -44, -128, -128, -128, -128, -128, -128, -128,
+    -124, -98, -128, -128, -128, -128, -117, -121, -71, -128, -128, -128, -103, -128, -119, 7,
+    14, -128, -98, -128, -124, -128, -128, -128, -128, -128, -128, -128, -121, -128, -128, -128,
+    -128, -90, -87, -128, -92, -122, -128, -9, -76, -125, -128, -116, -91, -128, -47, -61,
+    -128, -128, 11, -32, -128, -115, 40, -109, -49, 54, 36, -28, -128, -128, -128, -11,
+    -118, -128, -128, -103, -45, -37, -118, -68, -128, -73, -18, -46, -52, -119, -128, -128,
+    -109, -91, -72, -100, -128, -128, -106, -128, -50, -128, -128, -128, -128, -128, -128, -128,
+    -128, -100, -128, -128, -128, -128, -113, -121, -69, -127, -128, -128, -103, -128, -119, 5,
+    1, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -124, -128, -128, -128,
+    -128, -91, -102, -128, -86, -128, -128, -9, -76, -123, -128, -128, -85, -128, -54, -62,
+    -128, -128, 10, -32, -128, -114, 40, -110, -53, 54, 37, -26, -128, -128, -128, -12,
+    -118, -128, -128, -110, -45, -37, -113, -70, -128, -67, -23, -47, -49, -119, -128, -128,
+    -109, -91, -72, -100, -128, -128, -103, -125, -48, -128, -128, -128, -128, -128, -128, -128,
+    -128, -102, -128, -128, -128, -128, -111, -121, -69, -128, -128, -128, -103, -128, -118, 4,
+    0, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -119, -128, -128, -128,
+    -128, -93, -103, -128, -80, -126, -128, -9, -76, -122, -128, -122, -77, -128, -54, -62,
+    -128, -128, 11, -29, -128, -116, 40, -108, -53, 53, 38, -26, -128, -128, -128, -10,
+    -128, -128, -128, -114, -50, -38, -119, -72, -128, -70, -12, -46, -53, -119, -128, -128,
+    -114, -89, -72, -101, -128, -128, -99, -123, -53, -128, -128, -128, -128, -128, -128, -128,
+    -128, -99, -128, -128, -128, -128, -113, -121, -72, -128, -128, -128, -103, -128, -118, 6,
+    3, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -121, -128, -128, -128,
+    -128, -90, -103, -128, -82, -120, -128, -8, -76, -124, -128, -128, -87, -128, -54, -62,
+    -128, -128, 10, -29, -128, -118, 41, -111, -48, 54, 37, -37, -128, -128, -128, -12,
+    -128, -128, -128, -108, -54, -36, -107, -71, -128, -82, -29, -42, -53, -119, -128, -128,
+    -114, -93, -72, -103, -128, -128, -99, -116, -53, -128, -128, -128, -128, -128, -128, -128,
+    -125, -103, -128, -128, -128, -128, -110, -121, -74, -126, -128, -128, -104, -128, -116, -2,
+    8, -128, -128, -128, -128, -128, -128, -128, -128, -128, -123, -128, -119, -128, -128, -128,
+    -128, -98, -105, -128, -95, -128, -128, -10, -75, -117, -128, -116, -112, -128, -53, -62,
+    -128, -128, 11, -26, -128, -118, 39, -110, -43, 54, 38, -32, -128, -128, -128, -13,
+    -114, -128, -128, -106, -56, -51, -128, -65, -128, -59, -44, -40, -57, -125, -128, -128,
+    -103, -90, -72, -101, -128, -128, -106, -123, -52, -128, -128, -128, -128, -128, -128, -128,
+    -128, -102, -128, -128, -128, -128, -109, -121, -68, -126, -128, -128, -104, -128, -120, -3,
+    15, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -124, -128, -128, -128,
+    -128, -87, -102, -128, -106, -123, -128, -5, -75, -121, -128, -128, -112, -128, -47, -62,
+    -128, -128, 7, -25, -128, -122, 40, -109, -38, 53, 37, -44, -128, -128, -128, -12,
+    -119, -128, -128, -102, -67, -36, -128, -69, -124, -86, -29, -39, -62, -128, -128, -128,
+    -107, -94, -72, -101, -128, -128, -98, -126, -58, -128, -128, -128, -128, -128, -128, -128,
+    -121, -100, -128, -128, -128, -128, -114, -121, -69, -128, -127, -128, -102, -128, -115, 9,
+    10, -128, -128, -128, -125, -128, -128, -128, -128, -128, -128, -128, -124, -128, -128, -128,
+    -128, -98, -100, -128, -122, -128, -128, -12, -75, -122, -128, -108, -104, -128, -45, -62,
+    -128, -128, 12, -39, -128, -121, 38, -110, -53, 54, 36, -33, -128, -128, -128, -15,
+    -123, -128, -128, -105, -57, -42, -118, -66, -123, -91, -20, -43, -53, -121, -128, -128,
+    -99, -91, -72, -101, -128, -128, -97, -128, -53, -128, -128, -128, -128, -128, -128, -128,
+    -128, -104, -128, -128, -128, -128, -111, -121, -68, -127, -128, -128, -102, -128, -113, 0,
+    4, -128, -128, -128, -128, -128, -99, -128, -128, -128, -128, -128, -120, -128, -128, -128,
+    -128, -93, -104, -128, -108, -123, -128, -14, -76, -123, -128, -128, -84, -128, -57, -62,
+    -128, -128, 9, -42, -128, -116, 40, -111, -49, 54, 36, -27, -128, -128, -128, -12,
+    -128, -128, -128, -105, -46, -40, -103, -69, -127, -58, -41, -47, -50, -119, -128, -128,
+    -108, -91, -72, -100, -128, -128, -104, -124, -50, -128, -128, -128, -128, -128, -128, -128,
+    -128, -107, -128, -128, -128, -128, -111, -121, -73, -128, -128, -128, -103, -128, -118, 5,
+    -1, -128, -128, -128, -128, -128, -128, -128, -128, -128, -124, -128, -118, -128, -128, -128,
+    -128, -93, -104, -128, -79, -126, -128, -8, -76, -126, -128, -126, -88, -128, -55, -62,
+    -128, -128, 11, -38, -128, -115, 41, -108, -53, 53, 37, -30, -128, -128, -128, -10,
+    -126, -128, -128, -110, -54, -37, -117, -71, -128, -76, -34, -50, -55, -119, -128, -128,
+    -110, -90, -72, -101, -128, -128, -104, -121, -57, -128, -128, -128, -128, -128, -128, -128,
+    -128, -100, -128, -128, -128, -128, -112, -121, -81, -128, -128, -128, -103, -128, -121, 4,
+    -6, -128, -128, -128, -128, -128, -128, -128, -128, -128, -126, -128, -122, -128, -128, -128,
+    -128, -93, -109, -128, -72, -123, -128, -8, -77, -121, -128, -128, -88, -128, -53, -62,
+    -128, -128, 14, -39, -128, -111, 42, -113, -54, 54, 35, -31, -128, -128, -128, -10,
+    -125, -128, -128, -109, -51, -34, -127, -69, -128, -75, -42, -52, -50, -119, -128, -128,
+    -103, -89, -72, -103, -128, -128, -109, -124, -52, -128, -128, -128, -128, -128, -128, -128,
+    -128, -99, -128, -128, -128, -128, -111, -119, -82, -128, -128, -128, -104, -128, -125, -1,
+    -5, -128, -128, -128, -128, -128, -128, -128, -128, -128, -126, -128, -127, -128, -128, -128,
+    -128, -97, -111, -128, -86, -128, -128, -5, -77, -118, -128, -125, -97, -128, -56, -62,
+    -128, -128, 13, -41, -128, -111, 42, -104, -32, 53, 35, -37, -128, -128, -128, -13,
+    -123, -128, -128, -108, -56, -51, -127, -68, -128, -73, -36, -49, -53, -119, -128, -128,
+    -103, -89, -72, -99, -128, -128, -111, -122, -48, -128, -126, -128, -128, -128, -128, -128,
+    -128, -106, -128, -128, -128, -128, -112, -121, -68, -126, -128, -128, -103, -128, -120, 3,
+    -2, -128, -128, -128, -126, -128, -102, -128, -128, -128, -128, -128, -125, -128, -128, -128,
+    -128, -94, -99, -128, -87, -128, -128, -8, -78, -121, -128, -118, -93, -128, -58, -62,
+    -128, -128, 9, -32, -128, -113, 41, -114, -55, 54, 35, -20, -128, -128, -128, -11,
+    -128, -128, -128, -110, -45, -44, -120, -70, -128, -65, -5, -47, -51, -119, -128, -128,
+    -116, -88, -72, -102, -128, -128, -108, -126, -43, -128, -128, -128, -128, -128, -128, -128,
+    -128, -99, -128, -128, -128, -128, -109, -124, -63, -128, -128, -128, -103, -128, -122, 6,
+    -2, -128, -126, -128, -128, -128, -128, -128, -128, -128, -128, -128, -115, -125, -128, -128,
+    -128, -93, -97, -128, -71, -116, -128, -5, -77, -125, -128, -128, -66, -128, -57, -62,
+    -128, -128, 9, -28, -128, -116, 41, -110, -49, 54, 36, -24, -128, -128, -128, -11,
+    -128, -128, -128, -109, -43, -35, -104, -75, -128, -67, -1, -47, -48, -119, -128, -128,
+    -116, -92, -72, -101, -128, -128, -109, -124, -57, -128, -128, -128, -128, -128, -128, -128,
+    -128, -98, -128, -128, -128, -128, -112, -121, -76, -127, -128, -128, -103, -128, -118, 0,
+    5, -128, -128, -128, -128, -128, -128, -128, -128, -128, -117, -128, -124, -128, -128, -128,
+    -128, -90, -110, -128, -82, -128, -128, -10, -76, -124, -128, -122, -89, -128, -51, -62,
+    -128, -128, 8, -29, -128, -114, 42, -110, -49, 54, 37, -36, -128, -128, -128, -10,
+    -124, -128, -128, -100, -53, -39, -115, -70, -128, -73, -13, -45, -51, -120, -128, -128,
+    -110, -89, -72, -100, -128, -128, -109, -117, -51, -128, -128, -128, -128, -128, -128, -128,
+    -128, -103, -128, -128, -128, -128, -111, -121, -74, -128, -128, -128, -102, -128, -120, 9,
+    1, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -120, -128, -128, -128,
+    -128, -93, -102, -128, -91, -127, -128, -8, -78, -120, -128, -120, -90, -128, -56, -62,
+    -128, -128, 13, -29, -128, -115, 42, -108, -51, 54, 36, -23, -128, -128, -128, -9,
+    -114, -128, -128, -115, -59, -40, -118, -68, -128, -70, -13, -46, -45, -122, -128, -128,
+    -104, -89, -72, -101, -128, -128, -115, -128, -58, -128, -128, -128, -128, -128, -128, -128,
+    -124, -101, -128, -128, -128, -128, -113, -121, -81, -118, -128, -128, -104, -128, -121, -1,
+    9, -128, -128, -128, -128, -128, -128, -128, -128, -128, -125, -128, -121, -128, -128, -128,
+    -128, -95, -109, -128, -98, -128, -128, -8, -77, -119, -128, -128, -80, -128, -53, -62,
+    -128, -128, 10, -17, -128, -120, 42, -119, -52, 53, 33, -41, -128, -128, -128, -11,
+    -116, -128, -128, -111, -73, -40, -128, -69, -128, -98, -5, -43, -55, -128, -128, -128,
+    -94, -88, -82, -104, -128, -128, -113, -121, -57, -128, -128, -128, -128, -128, -128, -128,
+    -128, -99, -128, -128, -128, -128, -110, -121, -80, -121, -128, -128, -106, -128, -123, 1,
+    14, -128, -128, -128, -128, -126, -128, -128, -128, -128, -128, -128, -108, -128, -128, -128,
+    -128, -95, -102, -128, -106, -121, -128, -5, -76, -111, -128, -119, -90, -128, -50, -62,
+    -128, -128, -5, -14, -128, -128, 42, -94, -27, 48, 36, -32, -128, -128, -128, -17,
+    -128, -122, -128, -105, -81, -45, -128, -56, -126, -113, -10, -30, -64, -128, -128, -128,
+    -95, -102, -75, -102, -128, -128, -108, -128, -88, -128, -128, -128, -128, -128, -128, -128,
+    -105, -105, -128, -128, -128, -128, -113, -123, -94, -128, -104, -128, -98, -128, -114, -5,
+    21, -128, -128, -128, -110, -128, -98, -127, -128, -128, -128, -128, -121, -128, -128, -128,
+    -128, -88, -124, -128, -128, -128, -128, -21, -72, -128, -128, -81, -128, -128, -22, -66,
+    -128, -128, -5, -51, -128, -128, 42, -27, 8, 43, 46, -128, -128, -124, -128, -26,
+    -108, -128, -128, 127, -112, -30, -128, -69, -128, -121, 14, -52, -30, -128, -128, -124,
+    -112, -83, -80, -113, -128, -128, -119, -6, -98, -128, -128, -125, -128, -124, -128, -128,
+    -35, -128, -122, -98, -128, -128, -128, -122, -122, -128, -128, -128, -105, -128, -123, -8,
+    -115, -128, -128, -128, -20, -128, -128, -128, 17, -128, -128, -128, 19, -128, -128, -128,
+    -100, -75, -123, -49, -128, -115, -128, 69, -80, -128, -94, -128, -83, -121, -128, -66,
+    -120, -108, -54, -128, -128, -88, 43, -43, 22, 44, 59, -128, -128, -76, -50, 10,
+    -128, -128, -128, -123, -64, -20, -128, -68, -128, -83, -79, -37, -105, -128, -128, -128,
+    -128, -128, -72, -62, -35, -128, -128, -128, -79, -108, -88, -95, -128, -127, -128, -128,
+    -127, -128, -128, -128, -38, -110, -128, -121, -128, -82, -128, -128, -128, -128, -128, -28,
+    -36, -128, -128, -128, -128, -88, -114, -128, -78, -128, 36, -124, -128, -128, -124, -121,
+    -41, -66, 20, -128, -123, -126, -124, 116, -128, -105, -128, -128, -128, -128, -95, -62,
+    -128, -128, -8, -128, -128, -70, 43, -91, -65, 52, 59, -32, -128, -128, -82, 1,
+    -115, -128, -128, -117, -46, -20, -128, -68, -128, -18, -86, -16, -128, -116, -128, -107,
+    -128, -128, -72, -72, -36, -128, -128, -98, -115, -128, -123, -98, -128, -127, -128, -128,
+    -87, -128, -128, -127, -37, -100, -107, -121, -126, -61, -128, -128, -128, -128, -128, -37,
+    -8, -128, -104, -64, -128, -128, -126, -116, -128, -128, -123, -117, -119, -128, -128, -128,
+    -51, -76, -42, -128, -108, -126, -128, 75, -128, -103, -128, -128, -128, -128, -44, -62,
+    -128, -128, 1, -128, -128, -70, 43, -92, -67, 54, 59, -37, -128, -128, -80, 1,
+    -118, -128, -127, -117, -44, -20, -128, -68, -128, -15, -95, -22, -128, -128, -128, -119,
+    -128, -128, -72, -72, -33, -128, -128, -100, -122, -123, -128, -101, -128, -126, -128, -128,
+    -92, -128, -128, -127, -43, -100, -104, -121, -125, -63, -128, -128, -128, -128, -128, -41,
+    -16, -128, -123, -81, -128, -128, -125, -125, -128, -128, -116, -120, -119, -128, -128, -128,
+    -51, -76, -54, -128, -101, -126, -128, 76, -128, -101, -128, -128, -128, -128, -38, -62,
+    -128, -128, 1, -128, -128, -70, 43, -92, -67, 54, 59, -37, -128, -128, -80, 1,
+    -119, -128, -127, -116, -44, -20, -128, -68, -128, -15, -95, -22, -128, -128, -128, -119,
+    -128, -128, -72, -71, -32, -128, -128, -100, -122, -123, -128, -102, -128, -126, -128, -128,
+    -92, -128, -128, -128, -44, -100, -104, -121, -125, -63, -128, -128, -128, -128, -128, -41,
+    -16, -128, -123, -81, -128, -128, -123, -125, -128, -128, -116, -118, -119, -128, -128, -128,
+    -51, -76, -54, -128, -100, -126, -128, 76, -128, -101, -128, -128, -128, -128, -38, -62,
+    -128, -128, 0, -128, -128, -72, 43, -91, -67, 54, 59, -37, -128, -128, -79, 1,
+    -120, -128, -127, -118, -45, -20, -128, -68, -128, -15, -95, -22, -128, -128, -128, -119,
+    -128, -128, -72, -72, -33, -128, -128, -100, -122, -124, -128, -102, -128, -126, -128, -128,
+    -92, -128, -128, -128, -43, -100, -104, -121, -125, -63, -128, -128, -128, -128, -128, -41,
+    -16, -128, -123, -81, -128, -128, -126, -126, -128, -128, -115, -118, -119, -128, -128, -128,
+    -52, -76, -54, -128, -100, -126, -128, 77, -128, -102, -128, -128, -128, -128, -38, -62,
+    -128, -128, 0, -128, -128, -73, 43, -92, -67, 54, 59, -37, -128, -128, -80, 1,
+    -118, -128, -127, -116, -44, -20, -128, -68, -128, -15, -94, -22, -128, -128, -128, -119,
+    -128, -128, -72, -72, -34, -128, -128, -100, -121, -123, -128, -101, -128, -126, -128, -128,
+    -93, -128, -128, -128, -44, -99, -104, -121, -125, -63, -128, -128, -128, -128, -128, -38,
+    -15, -128, -123, -83, -128, -128, -127, -127, -128, -128, -116, -120, -119, -128, -128, -128,
+    -52, -77, -54, -128, -100, -126, -128, 76, -128, -101, -128, -128, -128, -128, -38, -62,
+    -128, -128, 1, -128, -128, -73, 43, -92, -67, 54, 59, -36, -128, -128, -78, 1,
+    -119, -128, -127, -118, -44, -20, -128, -69, -128, -15, -93, -22, -128, -128, -128, -121,
+    -128, -128, -72, -72, -34, -128, -128, -101, -121, -125, -128, -108, -128, -126, -128, -128,
+    -92, -128, -128, -128, -43, -98, -104, -121, -125, -63, -128, -128, -128, -128, -128, -38,
+    -15, -128, -123, -87, -128, -128, -124, -126, -128, -128, -116, -118, -119, -128, -128, -128,
+    -53, -77, -54, -128, -101, -126, -128, 76, -128, -102, -128, -128, -128, -128, -37, -62,
+    -128, -128, 1, -128, -128, -76, 44, -92, -69, 54, 59, -37, -128, -128, -80, 1,
+    -120, -128, -127, -117, -45, -20, -128, -69, -128, -16, -95, -21, -128, -128, -128, -118,
+    -128, -128, -72, -72, -34, -128, -128, -100, -120, -127, -128, -106, -128, -126, -128, -128,
+    -92, -128, -128, -128, -40, -99, -104, -121, -125, -63, -125, -128, -128, -128, -128, -41,
+    -15, -128, -122, -84, -128, -128, -128, -126, -128, -128, -116, -116, -119, -128, -128, -128,
+    -52, -75, -53, -128, -100, -126, -128, 77, -128, -102, -128, -128, -128, -128, -37, -62,
+    -128, -128, 1, -128, -128, -74, 44, -92, -66, 54, 59, -37, -128, -128, -80, 1,
+    -118, -128, -127, -117, -44, -20, -128, -68, -128, -15, -94, -21, -128, -128, -128, -121,
+    -128, -128, -72, -72, -34, -128, -128, -99, -119, -124, -128, -105, -128, -126, -128, -128,
+    -92, -128, -128, -127, -41, -99, -104, -121, -125, -64, -128, -128, -128, -128, -128, -40,
+    -16, -128, -123, -84, -128, -128, -128, -127, -128, -128, -115, -119, -119, -128, -128, -128,
+    -52, -78, -54, -128, -100, -126, -128, 77, -128, -101, -128, -128, -128, -128, -38, -62,
+    -128, -128, 0, -128, -128, -71, 43, -92, -68, 54, 59, -37, -128, -128, -81, 1,
+    -117, -128, -127, -116, -44, -20, -128, -68, -128, -14, -95, -22, -128, -128, -128, -119,
+    -128, -128, -72, -72, -33, -128, -128, -100, -121, -127, -128, -96, -128, -126, -128, -128,
+    -92, -128, -128, -127, -43, -99, -104, -121, -125, -63, -128, -128, -128, -128, -128, -41,
+    -16, -128, -122, -86, -128, -128, -124, -126, -128, -128, -116, -120, -118, -128, -128, -128,
+    -53, -76, -54, -128, -100, -126, -128, 76, -128, -102, -128, -128, -128, -128, -38, -62,
+    -128, -128, -1, -128, -128, -70, 43, -91, -67, 54, 59, -37, -128, -128, -83, 1,
+    -118, -128, -127, -117, -46, -20, -128, -68, -128, -15, -99, -23, -128, -128, -128, -120,
+    -128, -128, -72, -72, -32, -128, -128, -99, -121, -128, -128, -91, -128, -126, -128, -128,
+    -92, -128, -128, -127, -45, -101, -104, -121, -127, -64, -125, -128, -128, -128, -128, -40,
+    -16, -128, -123, -82, -128, -128, -128, -125, -128, -128, -114, -118, -119, -128, -128, -128,
+    -53, -76, -55, -128, -98, -126, -128, 76, -128, -102, -128, -128, -128, -128, -38, -62,
+    -128, -128, -1, -128, -128, -67, 43, -93, -67, 54, 59, -37, -128, -128, -80, 1,
+    -119, -128, -127, -116, -46, -20, -128, -68, -128, -16, -97, -23, -128, -128, -128, -121,
+    -128, -128, -72, -72, -31, -128, -128, -101, -120, -126, -127, -92, -128, -126, -128, -128,
+    -91, -128, -128, -127, -46, -99, -104, -121, -127, -63, -128, -128, -128, -128, -128, -39,
+    -17, -128, -123, -84, -128, -128, -126, -125, -128, -128, -115, -120, -120, -128, -128, -128,
+    -51, -77, -56, -128, -100, -126, -128, 76, -128, -101, -128, -128, -128, -128, -38, -62,
+    -128, -128, -1, -128, -128, -68, 43, -90, -69, 53, 59, -38, -128, -128, -79, 1,
+    -120, -128, -127, -119, -46, -20, -128, -68, -128, -15, -96, -23, -128, -128, -128, -120,
+    -128, -128, -72, -71, -31, -128, -128, -101, -121, -126, -127, -100, -128, -126, -128, -128,
+    -91, -128, -128, -127, -43, -101, -104, -121, -125, -64, -124, -128, -128, -128, -128, -40,
+    -16, -128, -123, -83, -128, -128, -125, -125, -128, -128, -117, -120, -120, -128, -128, -128,
+    -51, -76, -53, -128, -101, -126, -128, 76, -128, -101, -128, -128, -128, -128, -39, -62,
+    -128, -128, 0, -128, -128, -70, 43, -93, -66, 54, 59, -37, -128, -128, -80, 1,
+    -120, -128, -127, -115, -45, -20, -128, -68, -128, -14, -98, -22, -128, -128, -128, -119,
+    -128, -128, -72, -72, -32, -128, -128, -99, -123, -125, -128, -98, -128, -126, -128, -128,
+    -92, -128, -128, -128, -44, -100, -104, -121, -124, -63, -128, -128, -128, -128, -128, -41,
+    -16, -128, -122, -81, -128, -128, -119, -125, -128, -128, -117, -120, -118, -128, -128, -128,
+    -52, -77, -53, -128, -101, -126, -128, 77, -128, -102, -128, -128, -128, -128, -38, -62,
+    -128, -128, 1, -128, -128, -71, 43, -92, -68, 54, 59, -36, -128, -128, -80, 1,
+    -119, -128, -127, -117, -44, -20, -128, -68, -128, -15, -95, -22, -128, -128, -128, -117,
+    -128, -128, -72, -72, -33, -128, -128, -101, -123, -127, -128, -98, -128, -126, -128, -128,
+    -92, -128, -128, -127, -44, -98, -104, -121, -126, -63, -128, -128, -128, -128, -128, -40,
+    -16, -128, -123, -81, -128, -128, -128, -125, -128, -128, -114, -120, -119, -128, -128, -128,
+    -51, -76, -55, -128, -101, -126, -128, 76, -128, -102, -128, -128, -128, -128, -38, -62,
+    -128, -128, 1, -128, -128, -69, 43, -92, -67, 54, 59, -38, -128, -128, -81, 1,
+    -118, -128, -127, -115, -45, -20, -128, -68, -128, -14, -99, -22, -128, -128, -128, -118,
+    -128, -128, -72, -72, -32, -128, -128, -99, -120, -128, -128, -92, -128, -126, -128, -128,
+    -93, -128, -128, -126, -43, -102, -104, -121, -125, -63, -125, -128, -128, -128, -128, -42,
+    -15, -128, -123, -81, -128, -128, -126, -125, -128, -128, -116, -118, -119, -128, -128, -128,
+    -52, -77, -54, -128, -100, -126, -128, 76, -128, -101, -128, -128, -128, -128, -38, -62,
+    -128, -128, 0, -128, -128, -72, 43, -91, -69, 54, 59, -37, -128, -128, -79, 1,
+    -118, -128, -127, -119, -46, -20, -128, -68, -128, -16, -94, -22, -128, -128, -128, -121,
+    -128, -128, -72, -72, -33, -128, -128, -102, -120, -127, -128, -98, -128, -126, -128, -128,
+    -91, -128, -128, -128, -41, -99, -104, -121, -127, -63, -127, -128, -128, -128, -128, -38,
+    -16, -128, -124, -81, -128, -128, -128, -125, -128, -128, -115, -120, -119, -128, -128, -128,
+    -53, -76, -55, -128, -101, -126, -128, 76, -128, -101, -128, -128, -128, -128, -38, -62,
+    -128, -128, -2, -128, -128, -77, 43, -92, -67, 53, 59, -39, -128, -128, -80, 1,
+    -117, -128, -127, -108, -46, -20, -128, -68, -128, -10, -95, -22, -128, -128, -128, -120,
+    -128, -128, -72, -72, -35, -128, -128, -102, -120, -124, -128, -93, -128, -126, -128, -128,
+    -94, -128, -128, -128, -42, -101, -105, -121, -126, -61, -128, -128, -128, -128, -128, -33,
+    -12, -128, -121, -83, -128, -128, -124, -125, -128, -128, -117, -120, -117, -128, -128, -128,
+    -56, -77, -53, -128, -101, -126, -128, 77, -128, -98, -128, -128, -128, -128, -35, -62,
+    -128, -128, -26, -128, -128, -93, 43, -87, -65, 50, 58, -17, -128, -128, -87, 2,
+    -117, -128, -127, -128, -41, -20, -128, -69, -128, -30, -76, -29, -128, -128, -128, -127,
+    -128, -128, -74, -75, -34, -128, -128, -102, -124, -120, -128, -91, -128, -128, -128, -128,
+    -76, -128, -128, -128, -40, -95, -101, -123, -128, -51, -128, -128, -128, -128, -128, -41,
+    -19, -128, -128, -86, -128, -128, -128, -113, -128, -128, -113, -122, -128, -128, -128, -128,
+    -51, -75, -56, -128, -103, -128, -128, 74, -128, -97, -128, -128, -128, -128, -40, -57,
+    -128, -128, -14, -128, -128, -115, 42, -30, 25, 47, 60, -128, -128, -128, -123, -15,
+    -91, -128, -128, 115, -89, -20, -88, -70, -128, -81, -85, -79, -109, -127, -128, -88,
+    -128, -128, -72, -95, -44, -110, -128, 23, -109, -128, -128, -88, -119, -126, -128, -128,
+    -41, -128, -128, -104, -49, -95, -128, -115, -108, -115, -127, -124, -128, -124, -128, -19,
+    -128, -128, -128, -84, -128, -128, -128, -128, -11, -128, -128, -128, 23, -128, -77, -128,
+    34, -67, -48, -3, -82, -119, -128, 127, -128, -128, -128, -128, -119, -128, -124, -65,
+};
+
+alignas(4) const int8_t bn5_pr_filter[1536] = {
+    -42, -42, -33, -32, -26, -23, 2, -26, -96, 93, 46, 7, 8, -20, -6, -2,
+    -13, -22, -10, -7, -31, -24, -15, -4, 36, 15, 0, 5, 22, -16, -5, -1,
+    20, 14, 12, -3, 37, 13, -41, -4, -19, -15, -23, 14, 30, -40, -36, -3,
+    -16, 4, 0, -57, -12, 68, -43, -97, -29, -45, -71, 24, -9, -42, 12, -13,
+    13, -8, -58, 7, 7, -3, -6, 35, 33, -4, -43, 4, -49, -2, 38, -1,
+    21, 6, -15, -20, 11, -40, -127, -43, -18, -25, 30, -24, 1, 44, 6, 18,
+    -18, 7, 6, 3, -31, 1, -37, 18, 12, -10, 17, -16, 1, 13, -2, -41,
+    2, 7, -39, -2, -1, 11, 1, -44, -6, 9, 5, 8, -9, 36, 36, -4,
+    31, 14, 1, -2, -7, -14, 2, -10, 7, 3, -3, -15, 1, 14, 7, -39,
+    12, -14, 17, -8, 9, -3, -2, -7, -18, 14, 16, 19, 8, 0, 14, -7,
+    -9, -61, 6, 15, 30, 18, -5, 127, -30, -34, 9, 6, -5, -5, 1, -12,
+    0, -64, 5, 12, 16, 8, 19, 28, 1, 7, 28, -5, 7, -4, 3, 2,
+    -24, -29, 41, 49, 7, -48, -74, 55, 89, 52, -127, 18, -56, -53, -15, 46,
+    -44, -42, -15, 1, -36, 44, -47, -3, -7, 25, 5, 38, 20, 42, 32, -48,
+    -7, 8, 26, -73, -21, 8, -76, 30, 16, 29, -24, 13, -37, -21, 46, -23,
+    -53, -20, 5, -15, -22, -1, 0, -33, -41, 46, 46, -31, 16, 30, 43, 13,
+    18, 44, -5, -2, -12, 12, -57, 18, -100, 20, 20, 78, 27, -26, -45, -20,
+    -43, -14, -7, -21, -53, 1, -42, 10, 13, 6, -39, -20, -71, 56, 39, -7,
+    -114, -1, 16, -50, -95, -9, 49, 61, -3, 21, 46, -44, 47, -62, 39, -84,
+    45, 8, -83, 14, -55, -41, 16, 94, -4, -18, -34, -82, 38, 7, 22, -37,
+    -9, 34, -23, -84, 71, 127, -17, 28, -4, -12, 71, 12, -1, 16, 34, 112,
+    19, 75, 19, -16, 29, 12, 79, -7, 15, 24, 16, -19, 37, 9, -13, -30,
+    17, -26, -33, -18, 23, 20, 6, -12, -4, -101, 106, -55, 24, -9, -10, 2,
+    -9, 82, -57, -44, -27, 44, -13, 79, 3, -72, 31, -35, 47, -54, 111, 67,
+    -14, 10, -38, -114, 16, -42, -35, 12, -101, 36, -58, 48, 25, 2, -16, -6,
+    33, 33, -10, 48, -43, -127, -10, 19, 11, -78, -64, 68, 14, -19, -20, -10,
+    -58, -62, 22, 17, 63, 34, 16, 33, -14, -3, 40, 15, -56, 58, 4, -37,
+    38, 1, -55, 49, -27, -97, 77, -3, -13, -40, 31, -42, -62, 54, -79, -26,
+    39, -6, -16, 23, -20, -43, 10, 45, 45, -6, 87, -15, 72, -16, 0, -5,
+    -20, 24, 1, -70, -58, 47, 13, -28, -7, -12, -105, -47, -37, 2, 9, 4,
+    -32, -25, -99, 4, 71, 24, -45, 41, 121, 31, -19, 4, -39, -77, -36, 38,
+    -2, -25, 23, 20, -4, 19, -65, -127, 31, 83, 4, 44, 68, -30, -59, 3,
+    29, 14, -11, -83, 15, -28, 21, -7, -9, -8, -52, 6, -12, 16, 8, -2,
+    14, -62, 12, -51, 0, 24, -40, 31, 24, 19, -30, 36, 55, 15, 3, 47,
+    -5, -6, -17, 12, -24, -70, -77, 44, -35, -7, -42, 6, -12, 61, -73, 69,
+    -46, 11, -3, -24, -8, -5, 37, 0, -4, -15, -20, -53, 3, -31, 7, 36,
+    -67, 14, 55, 9, 31, -33, 8, 42, 46, 47, 127, 2, 37, -33, 23, 49,
+    7, 51, 52, -1, -84, -25, -18, 32, 0, -11, -13, 9, -5, 12, 9, 7,
+    -18, -1, 16, 7, 19, -74, 23, -2, 45, -1, 1, 5, 0, 7, 5, -37,
+    -3, -24, -4, 2, -29, 17, -14, -26, -18, -22, 26, 9, -5, -2, 45, 9,
+    -2, 33, 24, 4, -16, 17, -28, -35, 15, 44, -43, -19, -26, 17, -8, 11,
+    -9, -15, 68, -9, 9, -2, -21, 15, -49, 41, -12, -42, 16, -23, 60, 40,
+    -18, -25, 11, 62, 8, 59, 28, -72, 23, -46, -79, 10, 10, -35, 61, -3,
+    -7, 9, -34, 18, 20, -10, 57, -13, 39, -24, 18, 0, 6, 39, -14, -19,
+    -13, 15, -6, 24, -69, -9, -3, 8, -26, 19, -8, -38, 2, 47, -39, -19,
+    -19, -6, 17, -5, 22, 18, 13, 16, 67, 24, -20, 27, -22, 4, 3, 16,
+    1, -8, 36, -21, 58, -1, -1, 11, 12, -15, 24, 30, 23, 37, -22, 32,
+    30, -4, 38, -30, -3, 18, -127, 70, -5, 29, 25, 17, 53, 13, -44, 26,
+    -25, 0, 22, -36, 110, 10, 36, -19, -40, -2, -42, -14, 16, -4, 12, 101,
+    10, -18, 109, -6, -7, -4, -1, 82, 4, 1, -10, -15, 12, 24, 35, 37,
+    2, -21, -3, -9, 1, 59, -4, 1, -17, -2, 10, -4, 10, -4, -6, -67,
+    -20, 18, 18, -15, 31, 10, 24, -5, 30, 27, -16, 12, 4, 6, -31, 40,
+    -31, 49, -30, -30, 0, 41, 8, -5, 5, 82, 26, -26, 16, -9, -3, 10,
+    -11, -127, -43, 3, -22, -10, -6, -13, -2, -38, -27, 7, 9, -7, -1, 9,
+    -75, -10, 105, 9, 7, -34, 20, -67, 32, 0, 15, -84, 63, -48, 54, 14,
+    -63, 16, -23, -7, 106, -25, 3, 15, 11, 77, -127, 56, 30, -15, -21, 13,
+    28, 2, 15, -30, -31, 3, -85, -26, 34, -37, 14, 19, 30, -27, -17, -1,
+    -24, 40, -26, -71, -58, -39, -29, -17, 32, -18, -61, 36, 21, 101, 42, -6,
+    9, -7, -49, -14, 1, -5, 14, -7, -96, -7, -51, -71, -50, -15, 6, -9,
+    16, 31, 6, -93, 8, -25, 44, -61, -4, 0, 47, -10, 17, -61, -51, 79,
+    -41, 33, 22, 63, 16, 69, 43, -73, 41, -45, -43, 40, 17, -9, -6, 5,
+    32, 14, 4, 26, 17, -18, 4, -11, 56, -31, 26, -5, 24, -26, -17, 29,
+    -6, 27, 3, 30, -51, -7, -11, 31, 90, -40, -5, -5, 18, 21, -36, -12,
+    57, 33, 36, -32, 34, 47, 22, -127, 64, 11, -43, 8, 42, -3, 11, 11,
+    -3, -1, 51, 30, -47, 21, 51, -9, -3, -10, 22, 41, 54, 47, 47, 37,
+    -37, 19, -25, -11, 44, 10, 37, 95, -8, 6, -9, 16, -51, 29, -52, 59,
+    -23, -63, -64, -4, 17, -8, 61, 1, 111, 31, -16, 65, -26, 24, -16, -28,
+    -40, -59, 10, -43, -7, 1, -15, 83, -36, -22, -2, -28, 80, -10, -17, -51,
+    -3, -23, -23, -1, -33, 9, 11, -42, -44, -54, -45, 42, -8, -51, -12, 37,
+    -53, -4, -5, -48, -26, -14, -21, -6, -119, 0, 20, -11, -15, -6, -7, 42,
+    -17, -2, -34, 4, -26, -58, -5, 32, -10, 21, 9, -11, 0, -76, 25, -64,
+    -17, 3, -48, 1, -47, -19, -13, 127, -31, -16, -9, -5, -33, -17, 10, 40,
+    -3, 10, -1, 26, -32, 22, 36, -55, -5, -20, -4, -24, -51, -11, 10, -30,
+    -5, 0, -2, 4, 6, 29, -19, 31, 45, 17, 4, -15, 30, 15, 67, -32,
+    -18, 15, -37, -7, -20, -17, 10, 3, 25, 4, 7, -6, -4, 48, -14, 50,
+    33, -21, -22, -5, 15, 17, -52, -37, 100, -10, -28, -43, 7, 21, 9, 17,
+    -55, 127, 30, -39, -12, 63, -19, -29, -2, -78, -12, 16, -8, 41, -7, 63,
+    -5, -16, 20, -3, -37, 27, 23, -42, -12, -1, -28, 16, 11, 5, -50, 12,
+    27, 1, 76, 70, 62, -64, 55, 35, -80, 0, 127, -70, 34, 4, 19, 0,
+    6, 29, 68, 14, 31, 9, 29, -39, -47, -18, 26, -69, 25, -4, -25, 30,
+    57, -10, -2, -55, -32, 0, -35, 19, 24, 31, 27, 4, 34, 0, 51, -90,
+    18, 47, -1, 52, -29, 3, -10, 4, -43, -18, 0, 64, -3, -20, 65, -17,
+    99, 17, 27, 41, 32, -46, 25, 14, -30, 21, 8, 14, -2, -41, 30, -43,
+    49, -31, 34, 21, 9, -1, -25, 100, 89, 19, 41, 1, 16, 3, 44, -47,
+    -6, 49, 87, -74, 67, 1, 76, -5, 22, -12, 8, 31, 1, 49, -13, 12,
+    7, 9, 20, -26, -101, 40, 2, -127, -22, 14, -53, -41, -59, -45, -72, 29,
+    70, -9, -31, 121, 42, 16, 54, -5, -15, -2, 53, 18, -50, -15, -32, -44,
+    9, 26, -36, 28, 4, -1, 7, 3, 27, 17, 68, 17, -25, 65, -5, 20,
+    -57, 3, -40, 32, -29, -104, 5, 75, 13, -51, 23, -55, -12, -22, -9, -11,
+    33, 22, -20, -16, -6, 15, 13, 43, -64, -37, -10, -9, -10, 30, 43, 15,
+    54, -23, 46, 31, -5, 71, -14, 20, 84, -52, -73, -100, 52, 13, 38, 1,
+    -20, -4, -12, -47, 83, -94, 29, 33, 74, 61, 17, 66, -51, -12, -8, -9,
+    31, 94, 18, -8, -33, 20, 40, -72, -7, 29, -49, -36, 29, -38, 43, -23,
+    -42, 12, 97, -16, 104, 55, -55, 76, -45, 74, 17, 41, 61, -41, 42, 3,
+    -11, 15, -40, -24, 8, 7, 50, -24, -127, -9, -19, 59, -13, 31, -45, 18,
+    0, 5, -39, 55, 55, -22, 98, 94, 26, -56, 49, -17, 8, -26, -28, -22,
+};
+
+const int32_t bn5_pr_bias[16] = {
+    8822, 2434, 6544, -39187, 28901, 14668, -48640, -4924,
+    -8851, 961, -28362, -22757, -1808, -48087, -24982, -3019,
+};
+
+const int32_t bn5_pr_input_offset = -128;
+
+const int32_t bn5_pr_output_offset = 22;
+
+const int32_t bn5_pr_output_multiplier[16] = {
+    1159253516, 2028534063, 1362828561, 1654672804, 1448926967, 2076407717, 1325285969, 1169924075,
+    1500257634, 1620333041, 2048624897, 1613477126, 1181851580, 1176492925, 1607610863, 1487281490,
+};
+
+const int32_t bn5_pr_output_shift[16] = {
+    -9, -10, -11, -11, -10, -11, -10, -9,
+    -10, -11, -10, -9, -10, -10, -11, -10,
+};
+
+alignas(4) const int8_t bn5_final_output[6400] = {
+    26, 22, 24, 26, 14, 28, 37, 19, 11, 33, 22, 33, 12, 26, 22, 23,
+    37, 21, 24, 23, 8, 30, 28, 25, 13, 34, 14, 20, 11, 22, 19, 24,
+    40, 22, 24, 24, 7, 29, 27, 22, 15, 36, 12, 17, 10, 22, 19, 28,
+    40, 22, 24, 24, 7, 29, 27, 22, 15, 36, 12, 17, 10, 22, 19, 28,
+    40, 22, 24, 24, 7, 29, 27, 22, 15, 36, 12, 17, 10, 22, 19, 28,
+    40, 22, 24, 24, 7, 29, 27, 22, 15, 36, 12, 17, 10, 22, 19, 28,
+    40, 22, 24, 24, 7, 29, 27, 22, 15, 36, 12, 17, 10, 22, 19, 28,
+    40, 22, 24, 24, 7, 29, 27, 22, 15, 36, 12, 16, 10, 23, 19, 28,
+    40, 21, 24, 24, 7, 29, 27, 23, 14, 36, 12, 15, 10, 22, 18, 28,
+    39, 21, 24, 24, 7, 29, 28, 23, 14, 36, 12, 15, 10, 22, 19, 28,
+    40, 21, 24, 23, 6, 29, 27, 23, 14, 36, 13, 15, 10, 23, 19, 28,
+    40, 21, 24, 24, 7, 29, 27, 23, 14, 36, 13, 15, 10, 22, 19, 28,
+    39, 21, 24, 23, 7, 29, 28, 23, 14, 36, 14, 17, 11, 22, 19, 27,
+    39, 21, 24, 24, 10, 28, 27, 23, 15, 35, 13, 15, 10, 21, 19, 27,
+    37, 21, 24, 24, 11, 28, 27, 22, 16, 34, 12, 14, 11, 20, 20, 28,
+    38, 21, 23, 24, 10, 29, 27, 23, 15, 35, 14, 14, 11, 20, 20, 28,
+    40, 21, 24, 23, 9, 29, 27, 21, 15, 35, 12, 16, 10, 21, 19, 28,
+    37, 20, 23, 25, 12, 28, 27, 22, 15, 34, 13, 15, 10, 21, 19, 26,
+    38, 20, 24, 25, 13, 30, 26, 22, 13, 32, 12, 29, 9, 18, 19, 25,
+    15, 27, 23, 29, 13, 25, 23, 42, 15, 17, 24, 9, 16, 29, 21, 18,
+    28, 19, 32, 24, 22, 27, 26, 31, 22, 29, 29, 3, 15, 27, 18, 40,
+    38, 18, 34, 16, 18, 34, 15, 30, 20, 32, 33, -10, 11, 21, 12, 54,
+    40, 18, 33, 17, 15, 34, 15, 28, 21, 34, 30, -8, 10, 21, 13, 57,
+    41, 18, 33, 17, 14, 34, 16, 27, 21, 35, 30, -8, 10, 21, 13, 56,
+    41, 18, 33, 17, 14, 34, 16, 27, 21, 35, 30, -8, 10, 21, 13, 56,
+    41, 18, 33, 16, 14, 34, 15, 27, 21, 35, 30, -8, 10, 21, 13, 57,
+    41, 18, 33, 16, 14, 34, 16, 27, 21, 35, 30, -9, 10, 21, 13, 56,
+    41, 18, 33, 16, 14, 34, 15, 27, 21, 35, 30, -8, 10, 21, 13, 57,
+    41, 18, 33, 16, 14, 34, 15, 28, 20, 34, 31, -11, 10, 21, 14, 56,
+    39, 19, 33, 18, 13, 35, 15, 28, 20, 34, 31, -13, 11, 22, 13, 59,
+    39, 19, 34, 19, 14, 34, 13, 30, 19, 33, 34, -10, 10, 20, 12, 62,
+    32, 20, 35, 19, 14, 35, 15, 30, 19, 32, 36, -16, 10, 21, 13, 63,
+    40, 20, 33, 21, 15, 32, 12, 32, 20, 32, 34, -14, 10, 22, 13, 63,
+    31, 18, 34, 19, 14, 33, 18, 38, 20, 32, 34, -9, 13, 22, 15, 55,
+    35, 18, 33, 16, 12, 31, 19, 26, 20, 31, 18, 6, 13, 23, 18, 42,
+    39, 16, 33, 14, 17, 32, 16, 24, 21, 32, 22, -9, 13, 21, 18, 40,
+    38, 16, 31, 17, 17, 31, 16, 30, 23, 34, 31, -4, 13, 21, 16, 47,
+    35, 17, 33, 15, 14, 30, 19, 25, 20, 32, 21, -6, 13, 23, 17, 41,
+    42, 14, 33, 16, 19, 31, 16, 24, 21, 29, 24, 13, 14, 19, 16, 35,
+    17, 20, 25, 26, 24, 31, 22, 35, 18, 14, 44, -5, 15, 32, 22, 19,
+    6, 33, 22, 30, 6, 18, 23, 41, 18, 17, 53, 3, 28, 36, 17, 52,
+    21, 26, 25, 21, -9, 25, 17, 32, 19, 20, 40, 17, 26, 31, 11, 61,
+    26, 26, 27, 21, -11, 24, 14, 28, 17, 25, 32, 18, 25, 34, 11, 67,
+    26, 26, 27, 20, -12, 23, 15, 27, 17, 26, 31, 17, 25, 35, 11, 68,
+    27, 26, 27, 20, -13, 23, 15, 27, 17, 26, 31, 17, 25, 34, 11, 67,
+    27, 27, 27, 20, -12, 24, 15, 27, 16, 26, 32, 16, 25, 34, 12, 68,
+    29, 27, 27, 21, -12, 24, 14, 27, 16, 26, 33, 19, 24, 31, 12, 69,
+    27, 26, 26, 21, -11, 27, 15, 30, 17, 27, 32, 22, 25, 26, 13, 70,
+    27, 26, 27, 20, -9, 29, 12, 30, 18, 26, 34, 23, 24, 23, 13, 71,
+    23, 24, 28, 22, 0, 25, 10, 36, 19, 23, 39, 28, 26, 21, 11, 67,
+    10, 23, 29, 19, -3, 22, 12, 38, 22, 22, 46, 24, 28, 23, 8, 54,
+    17, 26, 26, 21, 7, 23, 13, 41, 17, 20, 38, -7, 28, 28, 13, 49,
+    6, 23, 29, 20, 4, 18, 16, 53, 20, 13, 58, 50, 28, 17, 6, 51,
+    28, 22, 25, 23, 25, 16, 19, 51, 24, 13, 53, -8, 25, 34, 17, 40,
+    15, 29, 26, 17, 12, 28, 25, 33, 27, 17, 23, -1, 21, 29, 22, 56,
+    23, 23, 22, 25, 10, 27, 23, 30, 29, 17, 38, -11, 23, 32, 22, 47,
+    19, 25, 25, 21, 7, 19, 19, 42, 23, 7, 55, 15, 26, 27, 15, 40,
+    22, 25, 29, 26, 15, 24, 24, 30, 32, 14, 37, 2, 17, 36, 20, 54,
+    21, 26, 24, 20, 8, 25, 21, 33, 23, 14, 55, -2, 25, 29, 18, 47,
+    16, 30, 17, 31, 12, 25, 22, 34, 20, 7, 46, -13, 23, 45, 14, 43,
+    9, 29, 26, 29, 24, 19, 28, 41, 13, 26, 42, 9, 31, 31, 14, 16,
+    22, 20, 23, 22, 19, 25, 21, 31, 18, 29, 23, 32, 23, 20, 12, 26,
+    27, 20, 24, 20, 19, 29, 18, 28, 16, 27, 20, 39, 23, 17, 11, 32,
+    29, 19, 24, 19, 17, 30, 19, 25, 16, 29, 18, 37, 23, 17, 13, 33,
+    30, 19, 24, 18, 17, 30, 19, 24, 15, 29, 16, 40, 22, 16, 13, 33,
+    31, 19, 26, 18, 19, 33, 20, 28, 15, 30, 19, 38, 22, 14, 12, 33,
+    31, 18, 28, 20, 22, 33, 18, 32, 17, 27, 20, 43, 21, 13, 9, 33,
+    27, 14, 34, 16, 16, 27, 16, 41, 22, 29, 37, 47, 24, 16, 7, 31,
+    21, 14, 33, 17, 18, 26, 13, 45, 21, 29, 33, 55, 24, 14, 6, 30,
+    13, 11, 29, 18, 26, 20, 26, 43, 25, 22, 44, 58, 18, 18, 11, 17,
+    36, 18, 18, 20, 32, 20, 21, 10, 24, 24, 25, -18, 17, 25, 25, 7,
+    25, 19, 17, 23, 34, 24, 26, 15, 26, 27, 13, -3, 16, 19, 30, 14,
+    26, 23, 18, 19, 17, 12, 17, 24, 20, 22, 15, -11, 20, 25, 18, 20,
+    28, 17, 16, 24, 26, 20, 19, 9, 26, 20, 23, 43, 13, 25, 25, 14,
+    -4, 21, 21, 23, 26, 18, 21, 27, 18, 22, 22, 4, 26, 33, 24, 19,
+    15, 16, 19, 24, 25, 21, 19, 34, 26, 24, 24, -2, 24, 35, 20, 10,
+    -2, 14, 20, 23, 26, 26, 22, 53, 19, 8, 41, 18, 31, 10, 16, 0,
+    18, 20, 25, 27, 26, 22, 20, 42, 27, 20, 37, 6, 24, 36, 19, 17,
+    13, 19, 22, 20, 12, 26, 26, 36, 19, 24, 34, 7, 32, 26, 19, 17,
+    17, 19, 19, 38, 30, 23, 16, 40, 22, 14, 33, 30, 29, 32, 14, 5,
+    13, 21, 18, 31, 34, 17, 30, 25, 18, 21, 16, 30, 26, 18, 22, 19,
+    37, 18, 20, 22, 32, 21, 23, 8, 20, 28, 5, 30, 21, 16, 23, 23,
+    33, 18, 20, 21, 29, 22, 26, 12, 19, 26, 8, 19, 21, 15, 25, 27,
+    32, 19, 22, 23, 28, 27, 21, 18, 20, 23, 15, 32, 20, 10, 23, 37,
+    29, 18, 27, 23, 25, 23, 17, 24, 24, 23, 24, 26, 20, 13, 20, 40,
+    31, 18, 34, 19, 22, 21, 16, 32, 23, 23, 32, 27, 20, 19, 15, 36,
+    25, 13, 30, 18, 30, 14, 28, 31, 25, 19, 40, 15, 16, 24, 18, 30,
+    43, 20, 20, 19, 28, 14, 23, 7, 24, 21, 38, -21, 16, 37, 25, 13,
+    46, 20, 18, 21, 16, 23, 31, 10, 21, 21, 13, -21, 20, 33, 26, 28,
+    43, 30, 16, 16, 11, 14, 21, 11, 23, 19, 15, 1, 18, 30, 22, 21,
+    6, 23, 24, 21, 23, 22, 27, 16, 28, 21, 24, 17, 23, 34, 23, 26,
+    11, 19, 25, 17, 13, 18, 15, 43, 22, 20, 44, 55, 26, 24, 16, 18,
+    12, 22, 28, 19, 14, 26, 24, 27, 21, 19, 16, 28, 19, 25, 20, 33,
+    17, 18, 26, 18, 10, 27, 18, 46, 20, 18, 53, 29, 26, 25, 16, 26,
+    20, 18, 25, 21, 29, 24, 18, 19, 20, 23, 18, 33, 18, 18, 26, 26,
+    21, 16, 18, 27, 34, 18, 23, 17, 23, 25, 8, -33, 21, 30, 25, 6,
+    12, 18, 17, 21, 31, 20, 26, 51, 21, 10, 46, -3, 35, 7, 24, 4,
+    23, 20, 25, 24, 31, 17, 22, 24, 23, 22, 22, 32, 23, 23, 24, 10,
+    25, 21, 22, 21, 27, 22, 26, 23, 22, 25, 22, 24, 30, 17, 25, 14,
+    25, 18, 17, 35, 37, 29, 20, 29, 21, 9, 26, 30, 24, 25, 20, 5,
+    14, 20, 19, 29, 36, 23, 33, 29, 16, 19, 17, 16, 28, 15, 22, 22,
+    29, 19, 25, 24, 29, 26, 19, 25, 22, 23, 20, 40, 19, 11, 18, 39,
+    27, 17, 31, 22, 24, 23, 18, 34, 23, 22, 32, 41, 17, 15, 15, 39,
+    29, 16, 33, 18, 24, 13, 21, 19, 24, 26, 36, 7, 20, 26, 17, 30,
+    36, 16, 27, 16, 19, 17, 28, 9, 21, 24, 41, 1, 21, 34, 18, 21,
+    45, 22, 20, 21, 17, 22, 30, 1, 23, 23, 23, -14, 19, 39, 25, 33,
+    41, 27, 21, 15, 12, 20, 22, 8, 25, 21, 20, 12, 20, 28, 21, 25,
+    30, 18, 21, 24, 21, 22, 23, 13, 29, 22, 17, 5, 18, 33, 22, 22,
+    9, 19, 26, 19, 17, 20, 19, 37, 20, 22, 32, 54, 24, 26, 18, 17,
+    23, 17, 27, 20, 23, 26, 20, 22, 23, 27, 26, 30, 17, 17, 19, 23,
+    5, 19, 23, 21, 25, 21, 20, 38, 22, 20, 42, -4, 26, 26, 19, 22,
+    35, 14, 22, 28, 34, 22, 17, 11, 26, 22, 15, 31, 17, 20, 26, 15,
+    8, 20, 22, 24, 30, 17, 26, 27, 18, 24, 29, 1, 23, 28, 26, 17,
+    21, 16, 25, 18, 23, 26, 18, 31, 23, 24, 31, 43, 30, 17, 17, 10,
+    22, 21, 24, 19, 20, 22, 23, 29, 21, 19, 28, 43, 26, 23, 20, 20,
+    8, 23, 21, 29, 31, 19, 24, 18, 20, 20, 16, 14, 17, 33, 28, 18,
+    13, 19, 19, 19, 31, 19, 29, 32, 19, 15, 30, 10, 31, 13, 23, 6,
+    31, 18, 25, 22, 35, 22, 22, 12, 22, 19, 11, 23, 21, 18, 26, 9,
+    38, 21, 23, 21, 28, 23, 26, 12, 23, 27, 13, 12, 28, 20, 25, 11,
+    21, 22, 17, 38, 36, 27, 20, 25, 21, 9, 21, 23, 26, 23, 19, 11,
+    4, 18, 26, 26, 34, 13, 27, 30, 17, 15, 28, 21, 24, 20, 24, 27,
+    33, 17, 32, 17, 21, 12, 26, 19, 22, 23, 42, 5, 20, 32, 16, 22,
+    48, 16, 24, 21, 19, 17, 24, 0, 16, 23, 25, -20, 19, 34, 22, 26,
+    43, 22, 19, 24, 14, 21, 27, 2, 20, 22, 24, -9, 18, 39, 24, 28,
+    37, 20, 17, 20, 18, 24, 22, 6, 24, 24, 16, 28, 15, 23, 27, 22,
+    2, 20, 18, 20, 25, 14, 18, 25, 21, 18, 21, -12, 20, 30, 22, 24,
+    22, 19, 22, 29, 28, 21, 14, 23, 24, 23, 23, 41, 17, 24, 20, 21,
+    -5, 20, 24, 18, 20, 22, 20, 47, 18, 24, 60, 2, 28, 28, 16, 23,
+    25, 16, 21, 27, 35, 19, 16, 18, 26, 22, 20, 30, 19, 23, 23, 16,
+    17, 16, 21, 23, 27, 22, 26, 34, 24, 27, 44, 8, 24, 24, 23, 13,
+    9, 19, 25, 19, 26, 26, 22, 46, 25, 21, 42, 26, 32, 19, 18, 8,
+    23, 20, 20, 28, 23, 15, 26, 28, 20, 20, 19, 29, 21, 36, 24, 20,
+    21, 17, 24, 22, 29, 27, 31, 26, 20, 28, 25, 17, 26, 19, 24, 7,
+    27, 19, 25, 23, 33, 25, 21, 30, 25, 19, 30, 32, 29, 15, 20, 6,
+    30, 17, 22, 20, 30, 22, 21, 17, 23, 22, 16, 33, 25, 16, 21, 11,
+    15, 21, 19, 28, 30, 11, 25, 11, 19, 20, 7, 11, 17, 26, 30, 11,
+    13, 20, 22, 17, 29, 19, 25, 35, 19, 16, 36, 20, 30, 14, 26, 11,
+    31, 16, 25, 22, 32, 21, 21, 21, 25, 23, 19, 41, 23, 19, 26, 12,
+    27, 19, 25, 22, 27, 24, 27, 22, 23, 28, 24, 27, 25, 22, 26, 17,
+    22, 19, 17, 37, 35, 32, 19, 29, 20, 13, 25, 24, 26, 24, 21, 10,
+    4, 20, 21, 30, 30, 17, 24, 12, 20, 18, 24, -6, 30, 27, 23, 23,
+    31, 19, 19, 24, 27, 22, 14, 3, 29, 19, 28, 4, 16, 31, 22, 21,
+    23, 17, 20, 20, 13, 22, 17, 15, 22, 18, 23, 27, 17, 31, 21, 28,
+    15, 20, 26, 23, 26, 28, 19, 18, 23, 29, 24, 27, 15, 20, 23, 32,
+    24, 15, 24, 21, 25, 26, 12, 25, 22, 22, 27, 49, 19, 19, 19, 19,
+    -5, 23, 25, 20, 25, 24, 23, 35, 18, 16, 45, 5, 26, 26, 21, 24,
+    13, 22, 25, 30, 29, 22, 20, 23, 24, 22, 14, 36, 17, 25, 26, 27,
+    5, 16, 23, 17, 29, 24, 25, 48, 19, 23, 47, 0, 37, 23, 16, -1,
+    4, 21, 23, 29, 30, 19, 26, 39, 23, 16, 22, 44, 23, 26, 25, 18,
+    14, 17, 22, 22, 33, 23, 27, 38, 25, 28, 39, -27, 33, 22, 22, 3,
+    12, 21, 25, 24, 37, 23, 20, 33, 24, 17, 33, 17, 33, 17, 17, 8,
+    15, 18, 19, 28, 36, 13, 26, 19, 22, 19, 12, 22, 18, 23, 30, 13,
+    28, 17, 22, 21, 33, 24, 27, 25, 28, 27, 32, -13, 28, 20, 23, 4,
+    19, 22, 24, 26, 30, 23, 25, 27, 23, 19, 31, 15, 27, 20, 24, 16,
+    25, 18, 23, 23, 31, 23, 21, 28, 24, 25, 17, 37, 25, 18, 22, 15,
+    25, 20, 17, 27, 31, 13, 26, 9, 27, 20, 12, 7, 14, 28, 28, 15,
+    13, 22, 22, 19, 30, 19, 26, 29, 18, 18, 27, 16, 30, 14, 24, 9,
+    37, 18, 23, 20, 29, 19, 21, 20, 23, 23, 19, 22, 22, 20, 23, 10,
+    38, 26, 21, 20, 25, 17, 26, 21, 23, 29, 19, -3, 24, 28, 24, 15,
+    16, 24, 19, 39, 33, 29, 15, 31, 20, 11, 29, 34, 27, 24, 14, 18,
+    11, 25, 21, 30, 31, 17, 21, 28, 18, 20, 26, 47, 28, 21, 21, 11,
+    19, 18, 24, 27, 20, 23, 18, 33, 24, 20, 35, 45, 24, 27, 17, 23,
+    13, 21, 25, 16, 13, 25, 25, 34, 17, 26, 38, 26, 27, 30, 17, 21,
+    13, 21, 24, 22, 17, 24, 23, 29, 22, 23, 31, 33, 22, 30, 21, 30,
+    32, 18, 20, 24, 17, 21, 16, 31, 28, 27, 23, 37, 22, 31, 18, 27,
+    5, 19, 25, 22, 26, 26, 26, 36, 21, 20, 43, 42, 30, 18, 23, 11,
+    9, 23, 23, 29, 35, 16, 21, 26, 26, 21, 13, 35, 20, 23, 29, 18,
+    16, 15, 23, 21, 38, 27, 27, 36, 20, 24, 39, -1, 34, 20, 20, -3,
+    17, 21, 20, 29, 39, 15, 28, 19, 25, 15, 12, 27, 21, 20, 30, 9,
+    18, 17, 24, 24, 39, 25, 27, 29, 24, 30, 36, -6, 29, 22, 23, 2,
+    18, 16, 23, 23, 37, 22, 18, 26, 23, 20, 24, 26, 29, 19, 20, 7,
+    13, 19, 20, 30, 38, 14, 26, 22, 22, 19, 13, 22, 19, 22, 31, 12,
+    22, 18, 22, 16, 24, 25, 25, 41, 19, 26, 46, -7, 35, 16, 21, 7,
+    14, 19, 21, 24, 34, 25, 22, 39, 21, 22, 40, 15, 32, 15, 18, 12,
+    19, 17, 22, 23, 31, 15, 22, 33, 21, 23, 25, 21, 27, 24, 23, 16,
+    14, 20, 22, 22, 35, 17, 27, 20, 21, 22, 15, 16, 20, 21, 30, 12,
+    8, 21, 23, 19, 33, 20, 23, 38, 20, 16, 38, 34, 32, 10, 23, 8,
+    28, 19, 22, 21, 34, 17, 23, 15, 21, 19, 21, 17, 18, 23, 25, 6,
+    20, 23, 18, 26, 30, 17, 33, 22, 19, 31, 23, -30, 22, 36, 31, 11,
+    16, 22, 20, 39, 32, 26, 13, 32, 19, 16, 35, 38, 27, 28, 16, 9,
+    21, 25, 23, 32, 37, 22, 22, 21, 22, 25, 22, 27, 26, 25, 19, 15,
+    6, 19, 20, 23, 26, 15, 22, 24, 21, 13, 20, 43, 22, 25, 26, 16,
+    21, 19, 22, 17, 26, 19, 23, 25, 22, 25, 17, 45, 24, 20, 27, 18,
+    14, 16, 20, 17, 28, 18, 20, 33, 23, 23, 25, 41, 25, 18, 29, 18,
+    19, 25, 23, 21, 29, 18, 21, 26, 24, 20, 17, 47, 23, 14, 28, 21,
+    16, 20, 26, 23, 35, 20, 22, 23, 20, 20, 25, 34, 29, 17, 21, 8,
+    19, 21, 26, 26, 40, 21, 22, 7, 26, 19, 10, 26, 19, 23, 27, 13,
+    14, 15, 22, 21, 36, 24, 25, 34, 17, 26, 32, 17, 32, 21, 22, 2,
+    20, 22, 21, 29, 37, 12, 24, 14, 25, 19, 12, 30, 19, 23, 29, 14,
+    17, 18, 23, 21, 30, 27, 22, 42, 19, 23, 54, 7, 32, 16, 18, 7,
+    28, 16, 21, 25, 34, 22, 21, 23, 19, 22, 25, 26, 26, 19, 22, 9,
+    21, 20, 20, 29, 42, 15, 25, 16, 23, 18, 11, 21, 19, 18, 32, 11,
+    13, 20, 20, 20, 29, 24, 31, 31, 20, 26, 32, -4, 34, 16, 26, 9,
+    29, 17, 21, 23, 38, 26, 19, 32, 23, 18, 32, 12, 32, 11, 18, 11,
+    13, 18, 21, 23, 37, 18, 27, 30, 20, 17, 21, 24, 27, 18, 26, 14,
+    20, 20, 20, 24, 39, 14, 28, 13, 21, 18, 8, 14, 19, 18, 32, 8,
+    16, 19, 23, 24, 37, 22, 24, 28, 21, 19, 30, 12, 30, 21, 21, 3,
+    11, 22, 24, 20, 27, 19, 23, 36, 22, 16, 18, 35, 22, 20, 24, 19,
+    4, 27, 24, 26, 30, 18, 30, 21, 20, 22, 24, -2, 23, 33, 26, 15,
+    24, 23, 20, 37, 31, 23, 18, 24, 19, 16, 25, 19, 25, 40, 15, 14,
+    23, 21, 25, 25, 25, 24, 28, 28, 23, 27, 27, 46, 31, 25, 19, 13,
+    19, 18, 21, 20, 32, 19, 25, 24, 21, 17, 13, 33, 24, 15, 28, 19,
+    17, 19, 21, 18, 29, 20, 21, 18, 23, 23, 14, 38, 24, 14, 29, 23,
+    17, 19, 23, 23, 35, 19, 22, 23, 21, 24, 24, 29, 22, 21, 29, 19,
+    21, 23, 25, 24, 28, 20, 24, 10, 22, 20, 13, 34, 20, 18, 30, 24,
+    24, 16, 25, 23, 33, 23, 22, 27, 19, 24, 31, 34, 27, 19, 22, 8,
+    18, 20, 27, 24, 36, 24, 21, 13, 24, 21, 18, 43, 21, 19, 26, 14,
+    24, 17, 20, 20, 33, 25, 24, 26, 21, 27, 24, 5, 30, 23, 21, 9,
+    14, 22, 25, 26, 39, 17, 23, 15, 25, 14, 11, 38, 23, 15, 29, 12,
+    26, 19, 24, 20, 34, 28, 21, 38, 22, 24, 35, -13, 34, 14, 19, 7,
+    24, 19, 22, 24, 34, 22, 21, 26, 20, 21, 24, 24, 27, 20, 20, 12,
+    18, 21, 21, 26, 40, 18, 25, 21, 23, 18, 13, 21, 22, 18, 29, 11,
+    16, 21, 24, 21, 27, 25, 31, 31, 21, 31, 25, -25, 35, 20, 26, 6,
+    19, 20, 25, 23, 37, 25, 20, 34, 20, 22, 30, 0, 34, 13, 16, 12,
+    21, 19, 22, 25, 36, 20, 25, 18, 18, 19, 19, -5, 27, 25, 22, 16,
+    15, 19, 20, 23, 41, 15, 24, 8, 21, 16, 5, 7, 21, 22, 30, 11,
+    21, 18, 22, 20, 33, 18, 25, 30, 18, 21, 30, 15, 30, 24, 20, 5,
+    19, 22, 23, 22, 32, 20, 23, 28, 23, 19, 17, 45, 24, 14, 25, 16,
+    17, 20, 23, 26, 37, 18, 28, 11, 22, 26, 16, 7, 21, 27, 29, 9,
+    16, 21, 22, 34, 26, 30, 18, 43, 21, 10, 36, 56, 30, 28, 13, 7,
+    26, 20, 23, 26, 27, 22, 27, 27, 22, 25, 18, 48, 25, 21, 24, 20,
+    19, 20, 21, 21, 32, 18, 22, 19, 20, 20, 11, 29, 18, 22, 29, 20,
+    23, 24, 20, 19, 27, 16, 23, 17, 21, 20, 19, 32, 24, 16, 27, 14,
+    24, 19, 19, 21, 32, 21, 23, 20, 24, 27, 25, 18, 20, 25, 30, 16,
+    26, 21, 22, 24, 27, 21, 20, 10, 26, 23, 13, 31, 21, 22, 28, 19,
+    30, 19, 21, 23, 33, 17, 25, 27, 18, 23, 29, 9, 24, 26, 24, 7,
+    27, 21, 25, 28, 37, 21, 22, 13, 24, 21, 15, 41, 18, 22, 27, 11,
+    13, 17, 19, 20, 33, 24, 26, 29, 21, 27, 31, -9, 30, 23, 23, 6,
+    21, 19, 20, 29, 36, 15, 23, 11, 22, 18, 13, 36, 18, 24, 31, 14,
+    36, 15, 23, 20, 27, 30, 24, 29, 20, 29, 26, 10, 29, 16, 23, 4,
+    22, 15, 20, 23, 35, 25, 22, 32, 25, 26, 26, 10, 27, 19, 23, 13,
+    19, 19, 18, 28, 35, 17, 29, 23, 23, 14, 21, 22, 23, 20, 28, 6,
+    27, 16, 22, 24, 34, 20, 28, 24, 24, 29, 31, -35, 30, 27, 27, -6,
+    13, 20, 22, 23, 33, 24, 20, 40, 23, 18, 42, 17, 33, 15, 21, 11,
+    21, 17, 21, 22, 35, 24, 22, 28, 22, 18, 18, 26, 26, 17, 23, 17,
+    14, 22, 19, 24, 33, 14, 23, 16, 23, 18, 15, 28, 22, 19, 30, 14,
+    14, 19, 19, 20, 30, 18, 27, 27, 14, 24, 22, 5, 28, 20, 26, 12,
+    23, 21, 23, 21, 32, 17, 19, 26, 22, 18, 21, 44, 21, 15, 27, 13,
+    21, 21, 25, 27, 35, 18, 25, 16, 22, 27, 22, -14, 21, 28, 25, 8,
+    15, 24, 15, 38, 32, 28, 17, 30, 24, 11, 26, 30, 29, 24, 13, 9,
+    15, 21, 23, 27, 27, 23, 24, 35, 21, 22, 23, 55, 26, 19, 23, 16,
+    24, 23, 23, 23, 37, 19, 22, 17, 20, 20, 11, 8, 19, 25, 25, 10,
+    18, 20, 21, 21, 26, 21, 23, 22, 17, 23, 17, 39, 21, 14, 29, 14,
+    7, 19, 23, 20, 30, 19, 22, 35, 21, 29, 24, 24, 23, 22, 29, 15,
+    11, 23, 27, 24, 29, 23, 18, 25, 26, 24, 22, 48, 24, 20, 27, 17,
+    4, 21, 27, 23, 30, 24, 29, 31, 16, 24, 31, 38, 28, 21, 24, 12,
+    26, 21, 25, 26, 35, 21, 21, 31, 26, 23, 18, 41, 20, 22, 25, 10,
+    23, 22, 22, 20, 33, 28, 25, 28, 22, 22, 30, 3, 28, 19, 24, 10,
+    19, 21, 23, 27, 35, 17, 24, 12, 23, 14, 13, 38, 20, 18, 30, 9,
+    32, 16, 21, 23, 30, 22, 24, 33, 19, 26, 43, 4, 30, 21, 22, 1,
+    29, 18, 22, 23, 35, 28, 23, 27, 24, 21, 28, 9, 27, 20, 23, 11,
+    18, 18, 22, 25, 37, 22, 25, 20, 25, 14, 14, 29, 24, 14, 28, 2,
+    19, 20, 25, 23, 34, 25, 26, 33, 22, 28, 32, -6, 31, 22, 25, -1,
+    21, 17, 24, 23, 38, 22, 21, 35, 21, 21, 34, 11, 30, 17, 23, 13,
+    20, 20, 24, 24, 40, 19, 25, 16, 19, 19, 15, 16, 22, 24, 23, 15,
+    27, 19, 20, 19, 34, 21, 23, 9, 27, 19, 17, 19, 19, 21, 29, 13,
+    15, 19, 19, 18, 27, 21, 27, 24, 20, 23, 29, -7, 30, 23, 29, 19,
+    19, 18, 22, 19, 31, 19, 18, 38, 23, 13, 35, 54, 22, 11, 26, 11,
+    32, 18, 21, 35, 43, 13, 25, 2, 22, 24, 15, -21, 15, 38, 27, 2,
+    10, 23, 14, 36, 33, 26, 18, 37, 19, 7, 29, 37, 29, 24, 14, 1,
+    24, 20, 25, 25, 29, 25, 28, 27, 21, 25, 17, 49, 25, 19, 21, 11,
+    18, 21, 25, 23, 33, 25, 22, 21, 24, 25, 19, 41, 20, 23, 27, 15,
+    20, 19, 22, 21, 30, 23, 20, 26, 23, 25, 22, 44, 23, 20, 26, 20,
+    -1, 20, 25, 21, 39, 25, 22, 28, 20, 27, 31, 25, 23, 18, 31, 18,
+    23, 17, 23, 28, 44, 20, 13, 17, 23, 30, 20, 26, 19, 18, 30, 8,
+    -2, 20, 25, 20, 40, 21, 27, 33, 19, 20, 35, 20, 28, 22, 26, 8,
+    26, 18, 24, 24, 36, 23, 18, 16, 28, 25, 18, 41, 21, 21, 27, 12,
+    8, 18, 21, 21, 32, 17, 27, 34, 19, 18, 39, 12, 32, 22, 22, 6,
+    8, 21, 25, 30, 38, 17, 21, 19, 24, 21, 17, 33, 23, 26, 28, 19,
+    19, 18, 21, 21, 27, 24, 28, 34, 18, 28, 24, -11, 30, 21, 23, 9,
+    20, 18, 24, 23, 36, 23, 21, 35, 23, 22, 36, 19, 33, 16, 18, 8,
+    18, 18, 21, 27, 36, 21, 25, 35, 23, 19, 22, 31, 25, 21, 25, 16,
+    14, 20, 22, 23, 33, 21, 29, 23, 20, 27, 24, -18, 30, 26, 26, 4,
+    19, 20, 24, 24, 34, 19, 19, 32, 23, 20, 29, 31, 29, 19, 20, 9,
+    21, 20, 24, 20, 37, 20, 24, 17, 21, 18, 11, 23, 22, 24, 24, 10,
+    17, 20, 23, 24, 31, 21, 19, 28, 27, 21, 20, 51, 22, 19, 25, 22,
+    5, 21, 20, 23, 30, 19, 25, 30, 16, 23, 22, 13, 27, 24, 27, 19,
+    13, 18, 23, 21, 37, 18, 17, 33, 25, 18, 25, 49, 25, 13, 26, 12,
+    13, 23, 27, 25, 29, 18, 26, 23, 22, 21, 15, 16, 20, 34, 26, 10,
+    23, 22, 17, 33, 31, 26, 23, 33, 21, 9, 29, 29, 29, 28, 19, 6,
+    31, 25, 22, 31, 20, 22, 27, 16, 24, 24, 20, 26, 23, 31, 27, 27,
+    29, 21, 23, 23, 17, 24, 23, 11, 26, 26, 10, 35, 18, 24, 26, 27,
+    33, 21, 22, 24, 20, 24, 23, 18, 25, 24, 15, 42, 19, 26, 24, 21,
+    27, 25, 22, 21, 23, 23, 24, 22, 23, 21, 20, 30, 20, 28, 24, 24,
+    26, 18, 24, 27, 30, 22, 20, 21, 31, 28, 22, 58, 18, 22, 27, 15,
+    15, 24, 23, 20, 30, 18, 29, 29, 18, 19, 30, 33, 25, 25, 21, 6,
+    37, 18, 23, 25, 30, 23, 19, 18, 29, 27, 17, 35, 18, 24, 26, 16,
+    7, 20, 21, 22, 34, 21, 30, 33, 17, 18, 28, -9, 24, 23, 26, 17,
+    30, 20, 23, 25, 31, 26, 22, 35, 28, 19, 33, 44, 25, 21, 23, 15,
+    14, 18, 19, 24, 31, 22, 27, 21, 19, 25, 19, -7, 23, 22, 29, 8,
+    14, 20, 23, 23, 37, 19, 19, 41, 24, 20, 38, 24, 27, 18, 22, 9,
+    24, 20, 22, 24, 37, 24, 25, 32, 23, 18, 26, 22, 24, 22, 24, 15,
+    8, 20, 19, 25, 33, 24, 29, 15, 24, 25, 12, -19, 23, 27, 31, 10,
+    16, 16, 22, 19, 28, 23, 19, 48, 24, 20, 38, 37, 33, 12, 21, 7,
+    29, 20, 26, 24, 35, 22, 23, 22, 23, 19, 18, 30, 19, 22, 23, 14,
+    37, 16, 21, 27, 31, 22, 23, 17, 27, 22, 18, 30, 21, 27, 26, 15,
+    14, 19, 17, 21, 26, 18, 27, 26, 21, 23, 15, -7, 29, 27, 23, 11,
+    19, 19, 27, 21, 35, 22, 17, 32, 25, 21, 31, 54, 24, 19, 25, 13,
+    26, 21, 25, 24, 36, 19, 28, 12, 21, 23, 17, 15, 19, 30, 27, 12,
+    20, 25, 18, 36, 30, 31, 20, 31, 21, 14, 28, 48, 25, 24, 14, 13,
+    0, 25, 26, 29, 18, 21, 20, 47, 22, 24, 39, 49, 29, 20, 19, 33,
+    22, 23, 25, 25, 21, 21, 15, 38, 24, 25, 28, 41, 23, 16, 19, 38,
+    23, 23, 26, 23, 22, 24, 20, 29, 22, 21, 31, 30, 24, 17, 18, 35,
+    20, 21, 24, 22, 23, 22, 20, 27, 24, 24, 19, 38, 20, 17, 21, 33,
+    29, 22, 25, 26, 27, 22, 18, 20, 28, 24, 18, 29, 21, 16, 21, 31,
+    25, 26, 26, 23, 25, 23, 24, 18, 20, 20, 15, 24, 21, 14, 22, 24,
+    21, 29, 26, 25, 22, 22, 16, 31, 29, 19, 32, 37, 22, 18, 21, 37,
+    7, 24, 21, 20, 34, 21, 24, 26, 24, 19, 24, -8, 23, 27, 28, 29,
+    14, 19, 27, 21, 31, 23, 15, 40, 29, 22, 32, 38, 29, 12, 21, 20,
+    25, 20, 24, 25, 34, 18, 17, 19, 26, 18, 12, 11, 19, 27, 26, 26,
+    19, 21, 21, 13, 29, 21, 25, 30, 22, 20, 22, -14, 28, 26, 22, 13,
+    15, 24, 26, 24, 28, 28, 25, 41, 24, 22, 26, 44, 27, 18, 24, 18,
+    34, 22, 22, 26, 25, 17, 23, 10, 28, 27, 8, 9, 19, 28, 26, 16,
+    32, 22, 23, 19, 23, 23, 20, 27, 20, 26, 26, -13, 30, 23, 23, 17,
+    9, 22, 28, 23, 23, 22, 18, 33, 27, 18, 27, 39, 25, 14, 25, 31,
+    34, 20, 23, 26, 24, 22, 25, 24, 28, 23, 29, 13, 24, 28, 24, 25,
+    20, 19, 25, 18, 19, 27, 24, 24, 26, 20, 24, 15, 27, 18, 24, 28,
+    30, 20, 29, 21, 30, 26, 17, 16, 29, 23, 17, 22, 24, 17, 27, 26,
+    18, 20, 23, 26, 31, 20, 24, 16, 23, 22, 23, 16, 23, 28, 29, 23,
+    30, 30, 21, 31, 26, 25, 19, 24, 25, 8, 23, 13, 25, 35, 17, 33,
+    32, 28, 24, 26, 26, 24, 30, 28, 25, 26, 24, 26, 31, 30, 20, 17,
+    29, 22, 26, 20, 18, 22, 22, 30, 24, 20, 30, 50, 28, 20, 15, 21,
+    29, 21, 26, 16, 15, 21, 23, 26, 22, 27, 27, 31, 26, 23, 14, 28,
+    30, 24, 30, 18, 18, 23, 21, 26, 21, 24, 23, 43, 26, 20, 14, 21,
+    30, 24, 26, 19, 18, 21, 22, 32, 27, 22, 36, 35, 27, 23, 14, 22,
+    28, 28, 27, 18, 11, 22, 24, 26, 20, 22, 22, 38, 27, 19, 13, 23,
+    34, 32, 25, 18, 16, 17, 22, 30, 25, 20, 25, 27, 23, 26, 14, 20,
+    39, 33, 23, 21, 19, 19, 32, 20, 24, 21, 31, 61, 17, 31, 19, 15,
+    51, 20, 22, 20, 18, 25, 24, 21, 25, 23, 23, 36, 23, 24, 22, 22,
+    31, 26, 26, 15, 15, 25, 22, 24, 25, 23, 24, 63, 26, 18, 19, 18,
+    32, 23, 21, 23, 24, 16, 27, 23, 28, 23, 30, 25, 27, 27, 21, 19,
+    27, 26, 24, 24, 25, 17, 22, 26, 23, 19, 22, 32, 26, 22, 19, 21,
+    22, 29, 26, 23, 17, 21, 23, 28, 23, 22, 34, 21, 27, 23, 20, 28,
+    25, 26, 22, 20, 14, 20, 23, 40, 29, 21, 57, 7, 35, 25, 16, 21,
+    31, 20, 27, 18, 16, 21, 26, 27, 23, 19, 30, 21, 28, 25, 15, 24,
+    23, 20, 26, 15, 12, 20, 23, 23, 22, 28, 22, 29, 26, 24, 13, 26,
+    29, 22, 28, 16, 18, 24, 17, 24, 22, 24, 24, 60, 27, 18, 10, 24,
+    29, 20, 28, 16, 20, 23, 24, 30, 21, 25, 26, 43, 26, 22, 16, 16,
+    23, 29, 25, 25, 29, 17, 28, 17, 20, 24, 7, 2, 22, 34, 24, 13,
+    11, 23, 20, 40, 26, 19, 11, 44, 20, 18, 45, 44, 29, 31, 11, 17,
+    29, 20, 16, 33, 25, 12, 29, 12, 17, 33, 24, -11, 19, 32, 24, 27,
+    47, 21, 17, 30, 11, 16, 19, 13, 18, 35, 16, -17, 17, 32, 24, 40,
+    47, 20, 18, 29, 11, 16, 18, 9, 17, 35, 19, -9, 16, 33, 23, 43,
+    44, 22, 20, 30, 12, 16, 18, 12, 18, 34, 15, -3, 17, 32, 22, 41,
+    41, 18, 18, 29, 13, 13, 16, 11, 19, 37, 17, -1, 16, 30, 23, 40,
+    42, 20, 20, 29, 16, 17, 19, 11, 19, 32, 16, -5, 13, 33, 24, 42,
+    39, 19, 18, 28, 18, 18, 20, 11, 18, 32, 17, -17, 13, 29, 26, 39,
+    45, 19, 17, 30, 19, 14, 21, 13, 22, 33, 20, -10, 13, 32, 28, 36,
+    33, 21, 19, 30, 15, 14, 20, 19, 19, 31, 24, 8, 18, 33, 25, 30,
+    38, 20, 20, 29, 14, 15, 16, 13, 19, 34, 12, 1, 19, 30, 22, 37,
+    37, 18, 20, 29, 12, 17, 18, 12, 19, 37, 15, 6, 19, 29, 23, 38,
+    38, 21, 21, 30, 13, 17, 18, 14, 17, 34, 11, 5, 18, 31, 23, 36,
+    34, 21, 18, 29, 13, 14, 17, 16, 21, 34, 16, -17, 20, 35, 23, 34,
+    37, 18, 17, 30, 12, 15, 19, 13, 20, 39, 18, -6, 22, 26, 22, 35,
+    44, 21, 17, 31, 13, 14, 17, 9, 18, 36, 19, 2, 14, 34, 24, 41,
+    47, 20, 17, 30, 12, 15, 19, 9, 17, 35, 17, -9, 14, 35, 24, 42,
+    43, 20, 19, 28, 14, 14, 18, 16, 19, 31, 23, 3, 14, 32, 22, 41,
+    45, 18, 17, 29, 20, 10, 23, 15, 17, 27, 23, -12, 14, 33, 25, 32,
+    39, 21, 18, 32, 25, 13, 30, 5, 17, 24, 12, -26, 12, 38, 28, 35,
+    39, 23, 12, 34, 23, 17, 17, 25, 15, 19, 28, -27, 17, 40, 14, 34,
+    16, 18, 28, 24, 16, 29, 34, 27, 15, 26, 29, 33, 17, 33, 14, 15,
+    28, 16, 27, 14, 8, 34, 25, 28, 16, 30, 32, 23, 19, 29, 13, 19,
+    29, 16, 26, 14, 5, 34, 24, 27, 17, 30, 30, 23, 18, 29, 14, 22,
+    29, 17, 26, 14, 4, 34, 24, 27, 17, 30, 30, 22, 18, 29, 14, 22,
+    29, 16, 26, 14, 5, 34, 25, 26, 17, 29, 30, 23, 18, 29, 14, 23,
+    28, 16, 27, 14, 7, 33, 24, 26, 17, 29, 30, 24, 18, 30, 14, 21,
+    29, 16, 28, 15, 8, 35, 25, 24, 16, 31, 30, 25, 17, 29, 14, 23,
+    28, 16, 28, 14, 7, 35, 26, 25, 17, 29, 28, 25, 19, 29, 15, 20,
+    30, 16, 26, 15, 8, 32, 24, 26, 18, 29, 29, 23, 18, 29, 14, 22,
+    30, 17, 26, 14, 6, 34, 24, 26, 18, 31, 29, 24, 18, 28, 14, 23,
+    30, 17, 26, 14, 6, 33, 25, 25, 18, 30, 28, 25, 17, 29, 15, 22,
+    30, 17, 27, 14, 6, 33, 24, 24, 18, 31, 29, 27, 17, 29, 15, 22,
+    28, 17, 26, 14, 6, 34, 25, 26, 17, 31, 31, 25, 18, 28, 15, 24,
+    29, 16, 26, 14, 4, 34, 24, 30, 17, 29, 33, 20, 19, 29, 13, 23,
+    29, 16, 27, 14, 4, 34, 23, 27, 17, 29, 30, 25, 17, 30, 13, 23,
+    29, 16, 27, 14, 5, 34, 24, 27, 17, 29, 30, 23, 18, 29, 13, 22,
+    30, 16, 27, 15, 5, 34, 25, 26, 18, 29, 29, 27, 17, 30, 14, 22,
+    29, 16, 27, 15, 7, 33, 25, 28, 17, 27, 31, 26, 18, 31, 14, 20,
+    27, 16, 29, 16, 10, 32, 24, 20, 16, 25, 25, 37, 14, 30, 14, 20,
+    14, 21, 23, 23, 17, 35, 24, 38, 14, 10, 37, 23, 18, 34, 13, 8,
+    13, 22, 22, 25, 19, 27, 29, 29, 16, 20, 19, 42, 13, 25, 25, 33,
+    33, 21, 23, 18, 17, 32, 28, 21, 16, 24, 20, 23, 9, 26, 25, 27,
+    34, 19, 23, 19, 17, 31, 27, 20, 17, 25, 17, 25, 9, 25, 26, 29,
+    34, 19, 23, 19, 17, 31, 27, 20, 17, 25, 17, 25, 9, 25, 26, 29,
+    34, 19, 23, 19, 17, 31, 27, 20, 17, 25, 17, 25, 9, 25, 26, 29,
+    34, 19, 23, 19, 17, 31, 28, 20, 17, 25, 17, 25, 9, 25, 25, 29,
+    34, 19, 23, 19, 17, 31, 27, 20, 17, 25, 17, 25, 9, 25, 25, 29,
+    34, 19, 23, 19, 17, 31, 28, 20, 17, 25, 17, 24, 9, 25, 26, 29,
+    34, 19, 23, 19, 17, 31, 28, 20, 17, 25, 17, 25, 9, 25, 25, 29,
+    34, 19, 23, 19, 17, 31, 27, 20, 17, 25, 17, 25, 9, 25, 25, 29,
+    34, 19, 23, 19, 18, 31, 28, 19, 17, 25, 17, 27, 9, 25, 26, 28,
+    34, 19, 23, 19, 17, 31, 27, 19, 17, 25, 17, 26, 9, 25, 26, 28,
+    34, 19, 23, 19, 17, 31, 27, 20, 17, 25, 17, 25, 9, 25, 26, 29,
+    34, 19, 23, 19, 17, 31, 27, 20, 17, 25, 17, 25, 9, 25, 26, 29,
+    34, 19, 23, 19, 17, 31, 27, 20, 17, 25, 17, 26, 9, 25, 26, 29,
+    34, 19, 23, 19, 18, 31, 28, 19, 17, 25, 17, 25, 9, 25, 26, 29,
+    34, 19, 23, 19, 17, 31, 28, 19, 17, 25, 17, 26, 9, 25, 26, 29,
+    34, 19, 23, 19, 17, 31, 28, 20, 17, 25, 17, 26, 9, 25, 25, 29,
+    36, 21, 23, 19, 18, 32, 26, 18, 16, 22, 16, 33, 9, 24, 25, 26,
+    16, 19, 17, 25, 21, 29, 28, 27, 15, 10, 39, 16, 13, 32, 26, 12,
+};
+
@@ -0,0 +1,42 @@
+#pragma once
+#include <stdint.h>
+
+// Tensors and requantization parameters of bottleneck 5 (ops 15-17) as
+// captured in data_capture_output.log. Note that the "_input_offset" values
+// are the input zero points, exactly as printed by PrintQuantParams; the
+// kernels use their negation. bn5_dw_ifmap and bn5_pr_ifmap are the outputs
+// of the expansion and the depthwise stage, so that each stage can run on
+// its own (see bn5_bench.h). The int8 arrays are word aligned, for kernels
+// that read them a word at a time.
+
+extern const int8_t bn5_ex_ifmap[6400];
+extern const int8_t bn5_ex_filter[1536];
+extern const int32_t bn5_ex_bias[96];
+extern const int32_t bn5_ex_input_offset;
+extern const int32_t bn5_ex_output_offset;
+extern const int32_t bn5_ex_output_multiplier[96];
+extern const int32_t bn5_ex_output_shift[96];
+extern const int8_t bn5_dw_ifmap[38400];
+extern const int8_t bn5_dw_filter[864];
+extern const int32_t bn5_dw_bias[96];
+extern const int32_t bn5_dw_input_offset;
+extern const int32_t bn5_dw_output_offset;
+extern const int32_t bn5_dw_output_multiplier[96];
+extern const int32_t bn5_dw_output_shift[96];
+extern const int8_t bn5_pr_ifmap[38400];
+extern const int8_t bn5_pr_filter[1536];
+extern const int32_t bn5_pr_bias[16];
+extern const int32_t bn5_pr_input_offset;
+extern const int32_t bn5_pr_output_offset;
+extern const int32_t bn5_pr_output_multiplier[16];
+extern const int32_t bn5_pr_output_shift[16];
+extern const int8_t bn5_final_output[6400];
+
+// The expansion and depthwise stages end in ReLU6, whose quantized range is
+// [output zero point, 6.0 quantized]. The capture does not record it, but
+// both stages output with zero point -128 and with scales that quantize 6.0
+// to 127, so the range is the whole int8 range and the kernels are given
+// that. Check these against the model before using a capture with other
+// scales. The projection has no activation.
+constexpr int32_t bn5_relu6_min = -128;
+constexpr int32_t bn5_relu6_max = 127;
@@ -0,0 +1,70 @@
+#pragma once
+#include <cstdint>
+
+#include "capture_format.h"
+
+// Capture of a layer's int32 accumulators: for every output element, the sum
+// of bias and products that goes into requantization. Meant for checking a
+// MAC array stage by stage, so the kernels report the values they computed
+// themselves, e.g. as read back from the CFU.
+//
+// The capture hook of a selected conv points the sink at a record in the
+// capture arena (see begin_accumulators in data_capture.h) and the kernel
+// calls CaptureAccumulator for each output element. tools/capture_decode
+// prints the record, and the same values less the bias, from it.
+//
+// These sink calls are the one piece of capture code the kernels carry, as
+// the values never leave the kernel otherwise. Everything else is in the
+// capture hook (see capture_hook.h), which also computes the accumulators of
+// a CONV_2D whose kernel makes no calls, i.e. reference ConvPerChannel, and
+// says so in the capture. Those are a recomputation, not what ran. In mnv2
+// that is every 1x1 conv but the streaming ones on the 5x5 maps and, with
+// FUSE_RESIDUAL_ADD, the projections folded into an ADD. So bn5's ex and pr
+// accumulators are recomputed, while its dw accumulators come from the
+// kernel.
+//
+// Only a header, so that reference kernel overlays can use it. Without
+// DATA_CAPTURE the calls are empty.
+
+namespace data_capture {
+
+#ifdef DATA_CAPTURE
+
+// Whether selected ops capture their accumulators too. Off by default: the
+// kernels store them inside their own invoke, so the tick table of an
+// inference that captures any is marked as not valid (see capture_hook.h).
+// Records go in an arena of their own (see DATA_CAPTURE_ACCUMULATOR_BYTES in
+// data_capture.h), and an op whose record does not fit is skipped.
+inline bool& accumulators_enabled() {
+  static bool enabled = false;
+  return enabled;
+}
+
+// Where the running kernel stores its accumulators, or nullptr.
+inline uint8_t*& accumulator_sink() {
+  static uint8_t* sink = nullptr;
+  return sink;
+}
+
+// Whether anything was stored since the sink was last pointed at a record.
+inline bool& accumulators_reported() {
+  static bool reported = false;
+  return reported;
+}
+
+// Stores the accumulator of output element `index` (in NHWC order).
+inline void CaptureAccumulator(int index, int32_t acc) {
+  uint8_t* sink = accumulator_sink();
+  if (sink != nullptr) {
+    capture_format::PutU32(sink + 4 * index, static_cast<uint32_t>(acc));
+    accumulators_reported() = true;
+  }
+}
+
+#else  // DATA_CAPTURE
+
+inline void CaptureAccumulator(int index, int32_t acc) {}
+
+#endif  // DATA_CAPTURE
+
+}  // namespace data_capture
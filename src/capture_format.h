@@ -0,0 +1,449 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+// Framed binary records for data capture, shared by the firmware
+// (data_capture.h) and the host tools, which decode them from logs
+// (tools/capture_decode.cc) and read them from archives
+// (tools/capture_archive.h). Only plain C++ here, so the host can build it
+// without TFLM.
+//
+// A record is a header, the name, the payload and a CRC-32 of all of it,
+// every field little-endian:
+//
+//   u32 magic   u8 version   u8 kind   u8 dtype   u8 rank
+//   u16 name_length   u8 encoding   u8 flags   u32 payload_bytes
+//   i32 op   i32 zero_point   u32 channels
+//   i32 dims[rank]   char name[name_length]
+//   i32 multipliers[channels]   i32 shifts[channels]
+//   u8 payload[payload_bytes]
+//   u32 crc
+//
+// `op` is the index of the op the record comes from, or -1, and
+// `zero_point` that of the tensor, if flags has kHasZeroPoint. Records of a
+// tensor an op requantized into, such as a conv's output, carry the op's
+// per-channel multipliers and shifts; others have no channels. Version 2
+// headers end at payload_bytes, and version 1 headers also have no
+// encoding; both read as op -1 with no zero point and no channels.
+//
+// kTensor records carry the tensor data, stored as chosen by
+// ChooseEncoding; the other kinds are always kRaw. kQuantParams records
+// carry, for dims[0] channels: i32 input zero point, i32 output zero point,
+// i32 multipliers[channels], i32 shifts[channels]. kText records carry
+// console text that belongs with the data, such as section banners.
+// kAccumulators records carry a layer's int32 accumulators, bias included,
+// in the shape of its output (see capture_accumulators.h). kStats records
+// are named after an op's type and carry statistics of one of its int8
+// tensors (see tensor_stats.h): i32 op index, i32 tensor (input k, or
+// output -1 - k), i32 zero point, u32 elements, u32 histogram[256] for
+// values -128 to 127.
+//
+// Renode logs the UART a line at a time, so records go out base64 encoded
+// on lines that start with kLinePrefix. A record starts at a prefix and
+// every line of it but the last decodes to a multiple of three bytes.
+
+namespace capture_format {
+
+constexpr uint32_t kMagic = 0x5041434d;  // "MCAP"
+constexpr uint8_t kVersion = 3;
+constexpr int kMaxRank = 6;
+constexpr int kHeaderBytes = 28;
+// Header bytes up to payload_bytes, all that versions 1 and 2 have.
+constexpr int kShortHeaderBytes = 16;
+// More channels than this mark a header as corrupt.
+constexpr uint32_t kMaxChannels = 1 << 16;
+constexpr int kCrcBytes = 4;
+
+constexpr char kLinePrefix[] = "@C ";
+constexpr int kLinePrefixLength = 3;
+// Raw bytes per line; a multiple of three, 256 characters once encoded.
+constexpr int kLineBytes = 192;
+constexpr int kLineChars = kLineBytes / 3 * 4;
+
+enum Kind : uint8_t {
+  kTensor = 1,
+  kQuantParams = 2,
+  kText = 3,
+  kAccumulators = 4,
+  kStats = 5,
+};
+
+constexpr int kStatsPayloadBytes = 4 * (4 + 256);
+
+enum Flags : uint8_t {
+  kHasZeroPoint = 1,
+};
+
+enum DType : uint8_t {
+  kInt8 = 1,
+  kInt32 = 2,
+};
+
+enum Encoding : uint8_t {
+  kRaw = 0,
+  // PackBits run-length coding of the bytes.
+  kRunLength = 1,
+  // Each byte replaced by its zig-zagged difference from the byte one
+  // DeltaStride back, then run-length coded. The stride is the innermost
+  // dimension, so for NHWC activations that is the same channel of the
+  // previous pixel.
+  kDeltaRunLength = 2,
+  // The most common byte, a bitmap of where it is, then every other byte in
+  // order. Suits ReLU outputs, where the zero point is common but seldom in
+  // runs, since neighbouring bytes are different channels.
+  kSparse = 3,
+};
+
+inline int DTypeSize(uint8_t dtype) { return dtype == kInt32 ? 4 : 1; }
+
+inline uint8_t* PutU16(uint8_t* p, uint16_t value) {
+  p[0] = static_cast<uint8_t>(value);
+  p[1] = static_cast<uint8_t>(value >> 8);
+  return p + 2;
+}
+
+inline uint8_t* PutU32(uint8_t* p, uint32_t value) {
+  p[0] = static_cast<uint8_t>(value);
+  p[1] = static_cast<uint8_t>(value >> 8);
+  p[2] = static_cast<uint8_t>(value >> 16);
+  p[3] = static_cast<uint8_t>(value >> 24);
+  return p + 4;
+}
+
+inline uint16_t GetU16(const uint8_t* p) {
+  return static_cast<uint16_t>(p[0] | (p[1] << 8));
+}
+
+inline uint32_t GetU32(const uint8_t* p) {
+  return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+         (static_cast<uint32_t>(p[2]) << 16) |
+         (static_cast<uint32_t>(p[3]) << 24);
+}
+
+// What a version 3 header adds to a record: where it comes from and how
+// its values are quantized.
+struct TensorInfo {
+  int32_t op = -1;
+  bool has_zero_point = false;
+  int32_t zero_point = 0;
+  int channels = 0;
+  // Per-channel requantization, `channels` of each.
+  const int32_t* multipliers = nullptr;
+  const int32_t* shifts = nullptr;
+};
+
+// Bytes of a record other than the header, payload and CRC.
+inline size_t MetadataBytes(int rank, int name_length, int channels) {
+  return 4 * rank + name_length + 8 * channels;
+}
+
+// The header. Returns the number of bytes written.
+inline int PutHeader(uint8_t* p, uint8_t kind, uint8_t dtype, int rank,
+                     int name_length, uint32_t payload_bytes,
+                     uint8_t encoding = kRaw,
+                     const TensorInfo& info = TensorInfo()) {
+  p = PutU32(p, kMagic);
+  *p++ = kVersion;
+  *p++ = kind;
+  *p++ = dtype;
+  *p++ = static_cast<uint8_t>(rank);
+  p = PutU16(p, static_cast<uint16_t>(name_length));
+  *p++ = encoding;
+  *p++ = info.has_zero_point ? kHasZeroPoint : 0;
+  p = PutU32(p, payload_bytes);
+  p = PutU32(p, static_cast<uint32_t>(info.op));
+  p = PutU32(p, static_cast<uint32_t>(info.zero_point));
+  PutU32(p, static_cast<uint32_t>(info.channels));
+  return kHeaderBytes;
+}
+
+// The multipliers and shifts of `info`, which go after the name. Returns
+// the end of them.
+inline uint8_t* PutChannels(uint8_t* p, const TensorInfo& info) {
+  for (int i = 0; i < info.channels; ++i) {
+    p = PutU32(p, static_cast<uint32_t>(info.multipliers[i]));
+  }
+  for (int i = 0; i < info.channels; ++i) {
+    p = PutU32(p, static_cast<uint32_t>(info.shifts[i]));
+  }
+  return p;
+}
+
+struct Header {
+  uint8_t version;
+  uint8_t kind;
+  uint8_t dtype;
+  int rank;
+  int name_length;
+  uint8_t encoding;
+  uint32_t payload_bytes;
+  int32_t op;
+  bool has_zero_point;
+  int32_t zero_point;
+  uint32_t channels;
+  int header_bytes;
+};
+
+// Size of the header that starts at `p`, which must hold its first five
+// bytes, from its version.
+inline int HeaderBytes(const uint8_t* p) {
+  return p[4] >= 3 ? kHeaderBytes : kShortHeaderBytes;
+}
+
+// Parses the header at `p`, which must hold HeaderBytes(p) bytes. Returns
+// false if it is not one.
+inline bool ParseHeader(const uint8_t* p, Header* header) {
+  if (GetU32(p) != kMagic || p[4] < 1 || p[4] > kVersion ||
+      p[7] > kMaxRank) {
+    return false;
+  }
+  header->version = p[4];
+  header->kind = p[5];
+  header->dtype = p[6];
+  header->rank = p[7];
+  header->name_length = GetU16(p + 8);
+  header->encoding = p[4] == 1 ? static_cast<uint8_t>(kRaw) : p[10];
+  header->payload_bytes = GetU32(p + 12);
+  header->header_bytes = HeaderBytes(p);
+  if (p[4] < 3) {
+    header->op = -1;
+    header->has_zero_point = false;
+    header->zero_point = 0;
+    header->channels = 0;
+    return true;
+  }
+  header->op = static_cast<int32_t>(GetU32(p + 16));
+  header->has_zero_point = (p[11] & kHasZeroPoint) != 0;
+  header->zero_point = static_cast<int32_t>(GetU32(p + 20));
+  header->channels = GetU32(p + 24);
+  return header->channels <= kMaxChannels;
+}
+
+// Size of a whole record, CRC included.
+inline size_t RecordBytes(const Header& header) {
+  return header.header_bytes +
+         MetadataBytes(header.rank, header.name_length, header.channels) +
+         header.payload_bytes + kCrcBytes;
+}
+
+// Byte distance used by kDeltaRunLength: the innermost dimension, in bytes.
+inline int DeltaStride(uint8_t dtype, const int32_t* dims, int rank) {
+  return (rank > 1 ? dims[rank - 1] : 1) * DTypeSize(dtype);
+}
+
+inline uint8_t ZigZag(uint8_t delta) {
+  return static_cast<uint8_t>((delta << 1) ^ -(delta >> 7));
+}
+
+inline uint8_t UnZigZag(uint8_t value) {
+  return static_cast<uint8_t>((value >> 1) ^ -(value & 1));
+}
+
+// Byte sources for PackBits.
+struct RawBytes {
+  uint8_t operator()(size_t i) const { return data[i]; }
+  const uint8_t* data;
+};
+
+struct DeltaBytes {
+  uint8_t operator()(size_t i) const {
+    return ZigZag(i < stride ? data[i]
+                             : static_cast<uint8_t>(data[i] - data[i - stride]));
+  }
+  const uint8_t* data;
+  size_t stride;
+};
+
+// PackBits over `size` bytes given by byte_at(i): a control byte n, then
+// n + 1 literal bytes if n < 128, or one byte to repeat 257 - n times if
+// n > 128. Writes to `out` unless it is null, and returns the coded size.
+template <typename ByteAt>
+size_t PackBits(const ByteAt& byte_at, size_t size, uint8_t* out) {
+  size_t written = 0;
+  size_t i = 0;
+  while (i < size) {
+    const uint8_t value = byte_at(i);
+    size_t run = 1;
+    while (i + run < size && run < 128 && byte_at(i + run) == value) ++run;
+    if (run >= 3) {
+      if (out != nullptr) {
+        out[written] = static_cast<uint8_t>(257 - run);
+        out[written + 1] = value;
+      }
+      written += 2;
+      i += run;
+      continue;
+    }
+    // Literals up to the next run of three.
+    const size_t start = i;
+    while (i < size && i - start < 128 &&
+           !(i + 2 < size && byte_at(i) == byte_at(i + 1) &&
+             byte_at(i) == byte_at(i + 2))) {
+      ++i;
+    }
+    if (out != nullptr) {
+      out[written] = static_cast<uint8_t>(i - start - 1);
+      for (size_t j = start; j < i; ++j) {
+        out[written + 1 + j - start] = byte_at(j);
+      }
+    }
+    written += 1 + i - start;
+  }
+  return written;
+}
+
+// Most common byte of `data`, and how often it occurs.
+inline uint8_t MostCommonByte(const uint8_t* data, size_t size,
+                              size_t* count) {
+  uint32_t counts[256] = {};
+  for (size_t i = 0; i < size; ++i) ++counts[data[i]];
+  int value = 0;
+  for (int i = 1; i < 256; ++i) {
+    if (counts[i] > counts[value]) value = i;
+  }
+  *count = counts[value];
+  return static_cast<uint8_t>(value);
+}
+
+// The encoding that makes `data` smallest, and that size.
+inline Encoding ChooseEncoding(const uint8_t* data, size_t size, int stride,
+                               size_t* encoded_bytes) {
+  size_t common;
+  MostCommonByte(data, size, &common);
+  const size_t sizes[] = {
+      size,
+      PackBits(RawBytes{data}, size, nullptr),
+      PackBits(DeltaBytes{data, static_cast<size_t>(stride)}, size, nullptr),
+      1 + (size + 7) / 8 + size - common,
+  };
+  int best = kRaw;
+  for (int i = 1; i < 4; ++i) {
+    if (sizes[i] < sizes[best]) best = i;
+  }
+  *encoded_bytes = sizes[best];
+  return static_cast<Encoding>(best);
+}
+
+inline void Encode(Encoding encoding, const uint8_t* data, size_t size,
+                   int stride, uint8_t* out) {
+  if (encoding == kRunLength) {
+    PackBits(RawBytes{data}, size, out);
+  } else if (encoding == kDeltaRunLength) {
+    PackBits(DeltaBytes{data, static_cast<size_t>(stride)}, size, out);
+  } else if (encoding == kSparse) {
+    size_t count;
+    const uint8_t value = MostCommonByte(data, size, &count);
+    *out++ = value;
+    uint8_t* bitmap = out;
+    uint8_t* others = bitmap + (size + 7) / 8;
+    for (size_t i = 0; i < (size + 7) / 8; ++i) bitmap[i] = 0;
+    for (size_t i = 0; i < size; ++i) {
+      if (data[i] == value) {
+        bitmap[i / 8] |= 1 << (i % 8);
+      } else {
+        *others++ = data[i];
+      }
+    }
+  } else {
+    for (size_t i = 0; i < size; ++i) out[i] = data[i];
+  }
+}
+
+// Restores the `size` bytes that Encode coded as `in`. Returns false if
+// `in` does not decode to exactly that many.
+inline bool Decode(uint8_t encoding, const uint8_t* in, size_t in_size,
+                   int stride, uint8_t* out, size_t size) {
+  if (encoding == kRaw) {
+    if (in_size != size) return false;
+    for (size_t i = 0; i < size; ++i) out[i] = in[i];
+    return true;
+  }
+  if (encoding == kSparse) {
+    const size_t bitmap_bytes = (size + 7) / 8;
+    if (in_size < 1 + bitmap_bytes) return false;
+    const uint8_t* bitmap = in + 1;
+    const uint8_t* others = bitmap + bitmap_bytes;
+    const uint8_t* end = in + in_size;
+    for (size_t i = 0; i < size; ++i) {
+      if (bitmap[i / 8] & (1 << (i % 8))) {
+        out[i] = in[0];
+      } else {
+        if (others == end) return false;
+        out[i] = *others++;
+      }
+    }
+    return others == end;
+  }
+  if (encoding != kRunLength && encoding != kDeltaRunLength) return false;
+  size_t read = 0;
+  size_t written = 0;
+  while (read < in_size) {
+    const uint8_t control = in[read++];
+    if (control < 128) {
+      const size_t count = control + 1u;
+      if (read + count > in_size || written + count > size) return false;
+      for (size_t j = 0; j < count; ++j) out[written++] = in[read++];
+    } else if (control > 128) {
+      const size_t count = 257u - control;
+      if (read >= in_size || written + count > size) return false;
+      for (size_t j = 0; j < count; ++j) out[written++] = in[read];
+      ++read;
+    }
+  }
+  if (written != size) return false;
+  if (encoding == kDeltaRunLength) {
+    for (size_t i = 0; i < size; ++i) {
+      const uint8_t delta = UnZigZag(out[i]);
+      out[i] = i < static_cast<size_t>(stride)
+                   ? delta
+                   : static_cast<uint8_t>(out[i - stride] + delta);
+    }
+  }
+  return true;
+}
+
+// CRC-32 (IEEE 802.3), a nibble at a time to keep the table small.
+class Crc32 {
+ public:
+  void Update(const void* data, size_t size) {
+    static const uint32_t kTable[16] = {
+        0x00000000, 0x1db71064, 0x3b6e20c8, 0x26d930ac, 0x76dc4190, 0x6b6b51f4,
+        0x4db26158, 0x5005713c, 0xedb88320, 0xf00f9344, 0xd6d6a3e8, 0xcb61b38c,
+        0x9b64c2b0, 0x86d3d2d4, 0xa00ae278, 0xbdbdf21c,
+    };
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; ++i) {
+      crc_ ^= bytes[i];
+      crc_ = (crc_ >> 4) ^ kTable[crc_ & 0xf];
+      crc_ = (crc_ >> 4) ^ kTable[crc_ & 0xf];
+    }
+  }
+  uint32_t value() const { return ~crc_; }
+
+ private:
+  uint32_t crc_ = 0xffffffff;
+};
+
+// Encodes `size` (1 to 3) bytes as four base64 characters.
+inline void Base64Encode(const uint8_t* in, int size, char* out) {
+  static const char kAlphabet[] =
+      "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  const uint32_t bits = (in[0] << 16) | (size > 1 ? in[1] << 8 : 0) |
+                        (size > 2 ? in[2] : 0);
+  out[0] = kAlphabet[(bits >> 18) & 0x3f];
+  out[1] = kAlphabet[(bits >> 12) & 0x3f];
+  out[2] = size > 1 ? kAlphabet[(bits >> 6) & 0x3f] : '=';
+  out[3] = size > 2 ? kAlphabet[bits & 0x3f] : '=';
+}
+
+// Value of a base64 character, or -1.
+inline int Base64Value(char c) {
+  if (c >= 'A' && c <= 'Z') return c - 'A';
+  if (c >= 'a' && c <= 'z') return c - 'a' + 26;
+  if (c >= '0' && c <= '9') return c - '0' + 52;
+  if (c == '+') return 62;
+  if (c == '/') return 63;
+  return -1;
+}
+
+}  // namespace capture_format
@@ -0,0 +1,328 @@
+#include "capture_hook.h"
+
+#ifdef DATA_CAPTURE
+
+#include <cstdio>
+
+#include "capture_registry.h"
+#include "data_capture.h"
+#include "graph_rewrite.h"
+#include "op_checksums.h"
+#include "perf.h"
+#include "tensor_stats.h"
+#include "tensorflow/lite/builtin_ops.h"
+#include "tensorflow/lite/c/builtin_op_data.h"
+#include "tensorflow/lite/kernels/internal/common.h"
+#include "tensorflow/lite/micro/kernels/conv.h"
+#include "tensorflow/lite/micro/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/micro_time.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+namespace data_capture {
+namespace {
+
+// Ops beyond this are not wrapped.
+constexpr int kMaxNodes = 128;
+
+int num_ops;
+// Profiler tag of every op.
+const char* op_tags[kMaxNodes];
+
+// The wrapper's own time in the last inference: profiler ticks per op, and
+// cycles over all of them.
+uint32_t hook_ticks[kMaxNodes];
+uint32_t hook_cycles;
+// Whether an inference has ended since FinishInference last ran.
+bool inference_pending;
+// Whether an op has captured accumulators since FinishInference last ran.
+bool accumulators_captured;
+
+// Ops whose inputs 1 and 2 are a filter and a bias.
+bool HasFilter(int builtin_code) {
+  return builtin_code == kTfLiteBuiltinConv2d ||
+         builtin_code == kTfLiteBuiltinDepthwiseConv2d ||
+         builtin_code == kTfLiteBuiltinFullyConnected;
+}
+
+// Ops whose user_data starts with an OpDataConv.
+bool HasOpDataConv(int builtin_code) {
+  return builtin_code == kTfLiteBuiltinConv2d ||
+         builtin_code == kTfLiteBuiltinDepthwiseConv2d;
+}
+
+const char* TensorName(Target& capture, const char* base, int position) {
+  if (position == 0) return capture.Name(base);
+  char name[16];
+  snprintf(name, sizeof(name), "%s%d", base, position);
+  return capture.Name(name);
+}
+
+const char* InputName(Target& capture, int builtin_code, int position) {
+  if (HasFilter(builtin_code) && position == 1) return capture.Name("filter");
+  if (HasFilter(builtin_code) && position == 2) return capture.Name("bias");
+  return TensorName(capture, "ifmap", position);
+}
+
+// Record header fields of tensor `tensor_index` of op `index`: the op and
+// the zero point of an activation.
+capture_format::TensorInfo OpTensorInfo(int index, int tensor_index) {
+  capture_format::TensorInfo info;
+  info.op = index;
+  info.has_zero_point =
+      ActivationZeroPoint(index, tensor_index, &info.zero_point);
+  return info;
+}
+
+// Adds the per-channel requantization of a conv to `info`, for its output.
+void AddRequantization(const TfLiteNode* node,
+                       const TfLiteEvalTensor* output,
+                       capture_format::TensorInfo* info) {
+  const tflite::OpDataConv& data =
+      *static_cast<const tflite::OpDataConv*>(node->user_data);
+  info->channels = tflite::micro::GetTensorShape(output).Dims(3);
+  info->multipliers = data.per_channel_output_multiplier;
+  info->shifts = data.per_channel_output_shift;
+}
+
+// Tensors of other types are left out; mnv2 has none.
+void PrintTensor(const char* name, const TfLiteEvalTensor* tensor,
+                 const capture_format::TensorInfo& info) {
+  if (tensor->type == kTfLiteInt8) {
+    print_tensor_as_h(name, tensor, info);
+  } else if (tensor->type == kTfLiteInt32) {
+    print_tensor_as_h(name, tensor, true, info);
+  }
+}
+
+void CaptureInputs(TfLiteContext* context, TfLiteNode* node, int index,
+                   int builtin_code, Target& capture) {
+  capture_printf("\n// ======================================================================");
+  capture_printf("\n// %s: LAYER DATA", capture.prefix());
+  capture_printf("\n// ======================================================================\n");
+  for (int i = 0; i < node->inputs->size; ++i) {
+    if (node->inputs->data[i] < 0) continue;
+    capture_format::TensorInfo info =
+        OpTensorInfo(index, node->inputs->data[i]);
+    // int8 filters are symmetric.
+    if (HasFilter(builtin_code) && i == 1) info.has_zero_point = true;
+    PrintTensor(InputName(capture, builtin_code, i),
+                tflite::graph_rewrite::GetEvalTensor(context,
+                                                     node->inputs->data[i]),
+                info);
+  }
+
+  if (!HasOpDataConv(builtin_code)) return;
+  const TfLiteEvalTensor* input =
+      tflite::graph_rewrite::GetEvalTensor(context, node->inputs->data[0]);
+  const TfLiteEvalTensor* output =
+      tflite::graph_rewrite::GetEvalTensor(context, node->outputs->data[0]);
+  print_quant_params_as_h(capture.prefix(),
+                          *static_cast<const tflite::OpDataConv*>(
+                              node->user_data),
+                          tflite::micro::GetTensorShape(output).Dims(3));
+  if (accumulators_enabled() && input->type == kTfLiteInt8) {
+    capture_format::TensorInfo info;
+    info.op = index;
+    AddRequantization(node, output, &info);
+    begin_accumulators(capture.Name("acc"), output, info);
+    if (accumulator_sink() != nullptr) accumulators_captured = true;
+#ifndef DATA_CAPTURE_TEXT
+    if (accumulator_sink() == nullptr) {
+      capture_printf("\n// %s: accumulators skipped, as they do not fit in"
+                     " the accumulator arena\n",
+                     capture.prefix());
+    }
+#endif
+  }
+}
+
+// The accumulators of a CONV_2D, computed again from its inputs the way
+// reference_integer_ops::ConvPerChannel computes them. For kernels that do
+// not report their own.
+void ConvAccumulators(TfLiteContext* context, const TfLiteNode* node) {
+  const TfLiteEvalTensor* input =
+      tflite::graph_rewrite::GetEvalTensor(context, node->inputs->data[0]);
+  const TfLiteEvalTensor* filter =
+      tflite::graph_rewrite::GetEvalTensor(context, node->inputs->data[1]);
+  const TfLiteEvalTensor* bias =
+      node->inputs->size > 2 && node->inputs->data[2] >= 0
+          ? tflite::graph_rewrite::GetEvalTensor(context,
+                                                 node->inputs->data[2])
+          : nullptr;
+  const TfLiteEvalTensor* output =
+      tflite::graph_rewrite::GetEvalTensor(context, node->outputs->data[0]);
+  const tflite::ConvParams params = tflite::ConvParamsQuantized(
+      *static_cast<const TfLiteConvParams*>(node->builtin_data),
+      *static_cast<const tflite::OpDataConv*>(node->user_data));
+  const tflite::RuntimeShape input_shape =
+      tflite::micro::GetTensorShape(input);
+  const tflite::RuntimeShape filter_shape =
+      tflite::micro::GetTensorShape(filter);
+  const tflite::RuntimeShape output_shape =
+      tflite::micro::GetTensorShape(output);
+  const int8_t* input_data = tflite::micro::GetTensorData<int8_t>(input);
+  const int8_t* filter_data = tflite::micro::GetTensorData<int8_t>(filter);
+  const int32_t* bias_data =
+      tflite::micro::GetOptionalTensorData<int32_t>(bias);
+
+  const int batches = tflite::MatchingDim(input_shape, 0, output_shape, 0);
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int input_depth = tflite::MatchingDim(input_shape, 3, filter_shape, 3);
+  const int filter_height = filter_shape.Dims(1);
+  const int filter_width = filter_shape.Dims(2);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+  const int output_depth =
+      tflite::MatchingDim(filter_shape, 0, output_shape, 3);
+  for (int batch = 0; batch < batches; ++batch) {
+    for (int out_y = 0; out_y < output_height; ++out_y) {
+      const int in_y_origin =
+          out_y * params.stride_height - params.padding_values.height;
+      for (int out_x = 0; out_x < output_width; ++out_x) {
+        const int in_x_origin =
+            out_x * params.stride_width - params.padding_values.width;
+        for (int out_channel = 0; out_channel < output_depth; ++out_channel) {
+          int32_t acc = bias_data ? bias_data[out_channel] : 0;
+          for (int filter_y = 0; filter_y < filter_height; ++filter_y) {
+            const int in_y =
+                in_y_origin + params.dilation_height_factor * filter_y;
+            for (int filter_x = 0; filter_x < filter_width; ++filter_x) {
+              const int in_x =
+                  in_x_origin + params.dilation_width_factor * filter_x;
+              if (in_x < 0 || in_x >= input_width || in_y < 0 ||
+                  in_y >= input_height) {
+                continue;
+              }
+              for (int in_channel = 0; in_channel < input_depth;
+                   ++in_channel) {
+                acc += filter_data[tflite::Offset(filter_shape, out_channel,
+                                                  filter_y, filter_x,
+                                                  in_channel)] *
+                       (input_data[tflite::Offset(input_shape, batch, in_y,
+                                                  in_x, in_channel)] +
+                        params.input_offset);
+              }
+            }
+          }
+          CaptureAccumulator(
+              tflite::Offset(output_shape, batch, out_y, out_x, out_channel),
+              acc);
+        }
+      }
+    }
+  }
+}
+
+void CaptureOutputs(TfLiteContext* context, TfLiteNode* node, int index,
+                    int builtin_code, Target& capture) {
+  const bool accumulators = accumulator_sink() != nullptr;
+  if (accumulators && !accumulators_reported() &&
+      builtin_code == kTfLiteBuiltinConv2d) {
+    ConvAccumulators(context, node);
+    capture_printf("\n// %s: accumulators recomputed from the inputs, as the"
+                   " kernel does not report them\n",
+                   capture.prefix());
+  }
+  end_accumulators();
+  capture_printf("\n// --- %s: OUTPUT DATA ---\n", capture.prefix());
+  for (int i = 0; i < node->outputs->size; ++i) {
+    const TfLiteEvalTensor* output =
+        tflite::graph_rewrite::GetEvalTensor(context, node->outputs->data[i]);
+    capture_format::TensorInfo info =
+        OpTensorInfo(index, node->outputs->data[i]);
+    if (HasOpDataConv(builtin_code) && i == 0) {
+      AddRequantization(node, output, &info);
+    }
+    PrintTensor(TensorName(capture, "ofmap", i), output, info);
+  }
+}
+
+TfLiteStatus CaptureInvoke(TfLiteContext* context, TfLiteNode* node) {
+  const uint32_t start_ticks = tflite::GetCurrentTimeTicks();
+  const uint32_t start_cycles = perf_get_mcycle();
+  const int index = tflite::graph_rewrite::GetNodeIndex(context, node);
+  const int builtin_code =
+      tflite::graph_rewrite::GetNodes(context)[index].registration->builtin_code;
+  Target capture;
+  const bool capturing = SelectNode(context, node, &capture);
+
+  if (capturing) CaptureInputs(context, node, index, builtin_code, capture);
+  CollectInputStats(context, index);
+  const uint32_t invoke_ticks = tflite::GetCurrentTimeTicks();
+  const uint32_t invoke_cycles = perf_get_mcycle();
+  TF_LITE_ENSURE_STATUS(tflite::graph_rewrite::InvokeOriginal(context, node));
+  const uint32_t return_ticks = tflite::GetCurrentTimeTicks();
+  const uint32_t return_cycles = perf_get_mcycle();
+  CollectOutputStats(context, index);
+  if (capturing) CaptureOutputs(context, node, index, builtin_code, capture);
+  TF_LITE_ENSURE_STATUS(ChecksumOutputs(context, node, index));
+
+  if (index == 0) hook_cycles = 0;
+  hook_ticks[index] = invoke_ticks - start_ticks +
+                      (tflite::GetCurrentTimeTicks() - return_ticks);
+  hook_cycles +=
+      invoke_cycles - start_cycles + (perf_get_mcycle() - return_cycles);
+  if (index == num_ops - 1) inference_pending = true;
+  return kTfLiteOk;
+}
+
+void PrintCaptureTicks() {
+  puts("\"Event\",\"Tag\",\"Capture ticks\"");
+  for (int i = 0; i < num_ops; ++i) {
+    printf("%d,%s,%lu\n", i, op_tags[i],
+           static_cast<unsigned long>(hook_ticks[i]));
+  }
+  printf("// capture: %lu cycles in the capture hook\n",
+         static_cast<unsigned long>(hook_cycles));
+}
+
+// For tools/tick_diff, which leaves out tables so marked.
+void PrintTickTableNotValid() {
+  puts("// capture: tick table not valid, accumulators were captured");
+}
+
+}  // namespace
+
+TfLiteStatus InstallCaptureHook(TfLiteContext* context) {
+  const tflite::NodeAndRegistration* nodes =
+      tflite::graph_rewrite::GetNodes(context);
+  const int num_nodes = tflite::graph_rewrite::GetNumNodes(context);
+  if (num_nodes < 0) return kTfLiteOk;
+
+  num_ops = num_nodes < kMaxNodes ? num_nodes : kMaxNodes;
+  inference_pending = false;
+  accumulators_captured = false;
+  ResetForGraph();
+  ResetOpChecksums();
+  for (int i = 0; i < num_ops; ++i) {
+    const TfLiteRegistration* registration = nodes[i].registration;
+    op_tags[i] = registration->builtin_code == kTfLiteBuiltinCustom
+                     ? registration->custom_name
+                     : tflite::EnumNameBuiltinOperator(
+                           static_cast<tflite::BuiltinOperator>(
+                               registration->builtin_code));
+    TF_LITE_ENSURE_STATUS(PrepareTensorStats(context, i));
+    TF_LITE_ENSURE_STATUS(tflite::graph_rewrite::ReplaceInvoke(
+        context, i, CaptureInvoke, nullptr));
+  }
+  return kTfLiteOk;
+}
+
+int NumOps() { return num_ops; }
+
+const char* OpTag(int index) { return index < num_ops ? op_tags[index] : ""; }
+
+void FinishInference() {
+  if (!inference_pending) return;
+  inference_pending = false;
+  capture_flush();
+  if (op_checksums_enabled()) PrintOpChecksums();
+  PrintCaptureTicks();
+  if (accumulators_captured) PrintTickTableNotValid();
+  accumulators_captured = false;
+}
+
+}  // namespace data_capture
+
+#endif  // DATA_CAPTURE
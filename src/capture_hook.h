@@ -0,0 +1,80 @@
+#pragma once
+#include "tensorflow/lite/c/common.h"
+
+// The one place capture happens: a wrapper around every op's invoke that
+// sees the op's eval tensors before and after it runs, so any op type can be
+// captured without capture code in its kernel.
+//
+// Around each op the wrapper, in order:
+//  - dumps the inputs of an op the capture registry selects (see
+//    capture_registry.h), and its quantization parameters for CONV_2D and
+//    DEPTHWISE_CONV_2D, whose user_data starts with an OpDataConv;
+//  - points the accumulator sink at a record for a selected int8 conv (see
+//    capture_accumulators.h), and computes the accumulators itself for a
+//    CONV_2D whose kernel did not report them, noting that in the capture.
+//    An op whose record does not fit in the accumulator arena is skipped,
+//    also with a note;
+//  - collects input statistics (see tensor_stats.h);
+//  - runs the op;
+//  - collects output statistics, dumps the outputs of a selected op and
+//    hashes them into the op checksum table (see op_checksums.h).
+//
+// All of that but the op itself runs inside the op's profiler scope, so the
+// wrapper times its own share and FinishInference reports it beside the
+// profiler's tick table, one line per op, in the same units:
+//
+//   "Event","Tag","Capture ticks"
+//   15,CONV_2D,5120
+//   // capture: 5370112 cycles in the capture hook
+//
+// tools/tick_diff takes these off the tick table and the inference's cycles
+// total, so that captured runs compare with runs without capture.
+//
+// The kernels store accumulators inside their own invoke, where the wrapper
+// cannot take them out, so after an inference that captured any,
+// FinishInference says the tick table is not valid, and tick_diff leaves it
+// out:
+//
+//   // capture: tick table not valid, accumulators were captured
+//
+// FinishInference also sends the capture and prints the op checksum table,
+// once the interpreter has returned, so that no UART output lands in an op's
+// ticks; only DATA_CAPTURE_TEXT, which prints as it goes, still writes from
+// inside the graph.
+//
+// Tensors are named as before the hook, e.g. "bn5_ex_ifmap", "_filter",
+// "_bias" and "_ofmap"; further inputs and outputs get their position,
+// as in "op18_add_ifmap1".
+//
+// Each record names the op it comes from and, for activations and filters,
+// the tensor's zero point; a conv's output and accumulators also carry its
+// per-channel requantization (see capture_format.h).
+//
+// The micro interpreter has no hook of its own, so the wrapper is put in by
+// ReplaceInvoke, from the registration wrapper in graph_hooks.h.
+
+namespace data_capture {
+
+// Wraps every op. Call once the graph's rewrites are in (see graph_hooks.h).
+TfLiteStatus InstallCaptureHook(TfLiteContext* context);
+
+// Number of ops wrapped.
+int NumOps();
+
+// Profiler tag of op `index`, once the wrappers are in.
+const char* OpTag(int index);
+
+#ifdef DATA_CAPTURE
+// Sends what the last inference captured (see capture_flush), then prints its
+// op checksum table, if checksums are on, and the wrapper's ticks. Does
+// nothing if no inference has ended since the last call. Call it once the
+// interpreter has returned: the replay benchmark does after each inference,
+// and the project and capture menus do on entry, for inferences run from
+// elsewhere, such as the golden tests. If several inferences ran in between,
+// their captures all go out, but the ticks are the last one's.
+void FinishInference();
+#else
+inline void FinishInference() {}
+#endif
+
+}  // namespace data_capture
@@ -0,0 +1,162 @@
+#include "capture_registry.h"
+
+#ifdef DATA_CAPTURE
+
+#include <cstdio>
+
+#include "graph_rewrite.h"
+#include "tensorflow/lite/builtin_ops.h"
+#include "tensorflow/lite/micro/kernels/kernel_util.h"
+
+namespace data_capture {
+namespace {
+
+// Ops beyond this are never captured.
+constexpr int kMaxNodes = 128;
+
+enum Role : uint8_t {
+  kRoleNone,
+  kRoleExpand,
+  kRoleDepthwise,
+  kRoleProject,
+};
+
+const char* const kRoleNames[] = {"", "ex", "dw", "pr"};
+
+Selection current_selection = {kSelectBottleneck, 5};
+// Ops captured since the last Arm, one bit each.
+uint32_t captured[kMaxNodes / 32];
+
+// Bottleneck number (0 for none) and role of every op, worked out from the
+// current graph the first time it is needed.
+bool table_ready;
+uint8_t node_bottleneck[kMaxNodes];
+uint8_t node_role[kMaxNodes];
+
+bool Is1x1Conv(TfLiteContext* context, const tflite::NodeAndRegistration& op) {
+  if (op.registration->builtin_code != kTfLiteBuiltinConv2d) return false;
+  const tflite::RuntimeShape filter_shape = tflite::micro::GetTensorShape(
+      tflite::graph_rewrite::GetEvalTensor(context, op.node.inputs->data[1]));
+  return filter_shape.Dims(1) == 1 && filter_shape.Dims(2) == 1;
+}
+
+bool Feeds(const TfLiteNode& from, const TfLiteNode& to) {
+  return to.inputs->data[0] == from.outputs->data[0];
+}
+
+void BuildBottleneckTable(TfLiteContext* context) {
+  const tflite::NodeAndRegistration* nodes =
+      tflite::graph_rewrite::GetNodes(context);
+  int num_nodes = tflite::graph_rewrite::GetNumNodes(context);
+  if (num_nodes > kMaxNodes) num_nodes = kMaxNodes;
+  int bottleneck = 0;
+  for (int i = 0; i < num_nodes; ++i) {
+    if (nodes[i].registration->builtin_code != kTfLiteBuiltinDepthwiseConv2d) {
+      continue;
+    }
+    ++bottleneck;
+    node_bottleneck[i] = bottleneck;
+    node_role[i] = kRoleDepthwise;
+    if (i > 0 && Is1x1Conv(context, nodes[i - 1]) &&
+        Feeds(nodes[i - 1].node, nodes[i].node)) {
+      node_bottleneck[i - 1] = bottleneck;
+      node_role[i - 1] = kRoleExpand;
+    }
+    if (i + 1 < num_nodes && Is1x1Conv(context, nodes[i + 1]) &&
+        Feeds(nodes[i].node, nodes[i + 1].node)) {
+      node_bottleneck[i + 1] = bottleneck;
+      node_role[i + 1] = kRoleProject;
+    }
+  }
+  table_ready = true;
+}
+
+}  // namespace
+
+Selection& selection() { return current_selection; }
+
+void Arm() {
+  for (uint32_t& word : captured) word = 0;
+}
+
+void ResetForGraph() {
+  table_ready = false;
+  for (int i = 0; i < kMaxNodes; ++i) {
+    node_bottleneck[i] = 0;
+    node_role[i] = kRoleNone;
+  }
+  Arm();
+}
+
+const char* Target::Name(const char* tensor) {
+  snprintf(name_, sizeof(name_), "%s_%s", prefix_, tensor);
+  return name_;
+}
+
+bool SelectNode(TfLiteContext* context, const TfLiteNode* node,
+                Target* target) {
+  if (current_selection.by == kSelectNone) return false;
+  const int index = tflite::graph_rewrite::GetNodeIndex(context, node);
+  if (index < 0 || index >= kMaxNodes) return false;
+  const uint32_t bit = 1u << (index % 32);
+  if (captured[index / 32] & bit) return false;
+  if (!table_ready) BuildBottleneckTable(context);
+
+  const int builtin_code =
+      tflite::graph_rewrite::GetNodes(context)[index].registration->builtin_code;
+  bool selected = false;
+  switch (current_selection.by) {
+    case kSelectOpIndex:
+      selected = index == current_selection.value;
+      break;
+    case kSelectOpType:
+      selected = builtin_code == current_selection.value;
+      break;
+    case kSelectBottleneck:
+      selected = node_bottleneck[index] != 0 &&
+                 node_bottleneck[index] == current_selection.value;
+      break;
+    default:
+      break;
+  }
+  if (!selected) return false;
+
+  captured[index / 32] |= bit;
+  if (current_selection.by == kSelectBottleneck) {
+    snprintf(target->prefix_, sizeof(target->prefix_), "bn%d_%s",
+             current_selection.value, kRoleNames[node_role[index]]);
+  } else {
+    snprintf(target->prefix_, sizeof(target->prefix_), "op%d_%s", index,
+             OpTypeName(builtin_code));
+  }
+  return true;
+}
+
+const char* OpTypeName(int builtin_code) {
+  switch (builtin_code) {
+    case kTfLiteBuiltinAdd:
+      return "add";
+    case kTfLiteBuiltinAveragePool2d:
+      return "average_pool_2d";
+    case kTfLiteBuiltinConv2d:
+      return "conv_2d";
+    case kTfLiteBuiltinDepthwiseConv2d:
+      return "depthwise_conv_2d";
+    case kTfLiteBuiltinFullyConnected:
+      return "fully_connected";
+    case kTfLiteBuiltinMul:
+      return "mul";
+    case kTfLiteBuiltinReshape:
+      return "reshape";
+    case kTfLiteBuiltinSoftmax:
+      return "softmax";
+    case kTfLiteBuiltinSub:
+      return "sub";
+    default:
+      return "op";
+  }
+}
+
+}  // namespace data_capture
+
+#endif  // DATA_CAPTURE
@@ -0,0 +1,67 @@
+#pragma once
+#include "tensorflow/lite/c/common.h"
+
+// Which ops the capture hook (see capture_hook.h) dumps, chosen at run time
+// from the project menu instead of being compiled in.
+//
+// A selection picks ops by position in the operator list, by builtin op
+// type, or by mnv2 bottleneck. Bottlenecks are numbered from 1 in graph
+// order, one per depthwise conv; a bottleneck's ops are the 1x1 expansion
+// conv feeding its depthwise conv (if any), the depthwise conv, and the 1x1
+// projection conv it feeds. Bottleneck 5 is ops 15 to 17.
+//
+// Each selected op is captured once per arming, so the golden tests do not
+// capture every inference.
+
+namespace data_capture {
+
+enum SelectBy {
+  kSelectNone,
+  kSelectOpIndex,
+  kSelectOpType,
+  kSelectBottleneck,
+};
+
+struct Selection {
+  SelectBy by;
+  // Op index, builtin op code or bottleneck number, depending on `by`.
+  int value;
+};
+
+// The current selection. Starts as bottleneck 5, armed.
+Selection& selection();
+
+// Captures the selected ops again on the next inference.
+void Arm();
+
+// Forgets the bottleneck numbering of the previous graph, so it is worked
+// out again for the next one, and arms. The capture hook calls this each
+// time it wraps a graph.
+void ResetForGraph();
+
+// Names for the tensors of one captured op: "bn5_ex_ifmap" when selecting
+// by bottleneck, "op15_conv_2d_ifmap" otherwise.
+class Target {
+ public:
+  // Prefix shared by the op's tensors, e.g. "bn5_ex".
+  const char* prefix() const { return prefix_; }
+  // `prefix`_`tensor`. Valid until the next call.
+  const char* Name(const char* tensor);
+
+ private:
+  friend bool SelectNode(TfLiteContext* context, const TfLiteNode* node,
+                         Target* target);
+  char prefix_[32];
+  char name_[48];
+};
+
+// Whether `node` should be captured now. If so, marks it as captured for
+// this arming and fills in `target`.
+bool SelectNode(TfLiteContext* context, const TfLiteNode* node,
+                Target* target);
+
+// Lower-case name of a builtin op in mnv2, e.g. "depthwise_conv_2d"; "op"
+// for others.
+const char* OpTypeName(int builtin_code);
+
+}  // namespace data_capture
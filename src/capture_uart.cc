@@ -0,0 +1,46 @@
+#include "capture_uart.h"
+
+#ifdef DATA_CAPTURE
+
+#include <generated/soc.h>
+#include <libbase/uart.h>
+
+#include <cstdio>
+
+#include "perf.h"
+
+namespace data_capture {
+namespace {
+
+uint32_t bytes_sent;
+uint32_t start_cycle;
+
+}  // namespace
+
+void BeginUartTransfer() {
+  fflush(stdout);
+  uart_sync();
+  bytes_sent = 0;
+  start_cycle = perf_get_mcycle();
+}
+
+void UartWrite(const void* data, size_t size) {
+  const char* bytes = static_cast<const char*>(data);
+  for (size_t i = 0; i < size; ++i) uart_write(bytes[i]);
+  bytes_sent += size;
+}
+
+UartTransfer EndUartTransfer() {
+  uart_sync();
+  return {bytes_sent, perf_get_mcycle() - start_cycle};
+}
+
+uint32_t UartBytesPerSecond(const UartTransfer& transfer) {
+  if (transfer.cycles == 0) return 0;
+  return static_cast<uint64_t>(transfer.bytes) * CONFIG_CLOCK_FREQUENCY /
+         transfer.cycles;
+}
+
+}  // namespace data_capture
+
+#endif  // DATA_CAPTURE
@@ -0,0 +1,40 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+// Sends the capture records through the console's UART driver and measures
+// the rate.
+//
+// The libbase driver keeps its own transmit ring and refills the UART from
+// the transmit interrupt, so the CPU goes on encoding while the UART sends
+// what it has already encoded, and only waits while that ring is full. The
+// bytes skip printf and go to the driver directly.
+//
+// A transfer starts once the console has sent everything printed before it,
+// and ends when the driver's ring is empty, so that the rate counts only the
+// transfer's own bytes; nothing else may print in between.
+
+namespace data_capture {
+
+// What the UART sent during one transfer.
+struct UartTransfer {
+  uint32_t bytes;
+  uint32_t cycles;
+};
+
+// The UART line rate, 8N1, in bytes per second.
+constexpr uint32_t kUartBaud = 1843200;
+constexpr uint32_t kUartBytesPerSecond = kUartBaud / 10;
+
+void BeginUartTransfer();
+
+// Queues `size` bytes with the driver.
+void UartWrite(const void* data, size_t size);
+
+// Waits until the driver has sent everything.
+UartTransfer EndUartTransfer();
+
+// Bytes per second for `transfer` at the CPU clock.
+uint32_t UartBytesPerSecond(const UartTransfer& transfer);
+
+}  // namespace data_capture
@@ -0,0 +1,257 @@
+#include "cfu_bench.h"
+
+#include <cstdint>
+#include <cstdio>
+
+#include "mnv2_cfu.h"
+#include "perf.h"
+#include "software_cfu.h"
+
+namespace {
+
+// Ops per timed loop; a multiple of eight.
+constexpr int kOps = 2048;
+constexpr int32_t kInputOffset = 128;
+
+const char* const kOpNames[kNumCfuBenchOps] = {
+    "op0 rs1",  "op1 rs2", "mac4",    "set acc",
+    "mac4 1st", "set off", "get acc", "get off"};
+
+uint32_t operands_a[kOps];
+uint32_t operands_b[kOps];
+uint32_t results[kOps];
+
+template <int kOp>
+inline uint32_t Issue(uint32_t a, uint32_t b) {
+  switch (kOp) {
+    case 0:
+      return cfu_op0(0, a, b);
+    case 1:
+      return cfu_op1(0, a, b);
+    case 2:
+      return CFU_MAC4(a, b);
+    case 3:
+      return CFU_SET_ACC(a);
+    case 4:
+      return CFU_MAC4_FIRST(a, b);
+    case 5:
+      return CFU_SET_INPUT_OFFSET(a);
+    case 6:
+      return CFU_GET_ACC();
+    default:
+      return CFU_GET_INPUT_OFFSET();
+  }
+}
+
+// Op `op` as software_cfu() computes it, given the operands Issue<op> passes.
+uint32_t ModelIssue(int op, uint32_t a, uint32_t b) {
+  switch (op) {
+    case 0:
+      return software_cfu(0, 0, a, b);
+    case 1:
+      return software_cfu(1, 0, a, b);
+    case 2:
+      return software_cfu(2, 0, a, b);
+    case 3:
+      return software_cfu(3, 1, a, 0);
+    case 4:
+      return software_cfu(2, 1, a, b);
+    case 5:
+      return software_cfu(3, 0, a, 0);
+    case 6:
+      return software_cfu(3, 2, 0, 0);
+    default:
+      return software_cfu(3, 3, 0, 0);
+  }
+}
+
+// Puts software_cfu() in the state ResetCfu puts the CFU in.
+void ResetModel() {
+  software_cfu(3, 0, kInputOffset, 0);
+  software_cfu(3, 1, 0, 0);
+}
+
+void ResetCfu() {
+  CFU_SET_INPUT_OFFSET(kInputOffset);
+  CFU_SET_ACC(0);
+}
+
+template <int kOp>
+uint32_t IssueLoop() {
+  const uint32_t a0 = operands_a[0], b0 = operands_b[0];
+  const uint32_t a1 = operands_a[1], b1 = operands_b[1];
+  const uint32_t a2 = operands_a[2], b2 = operands_b[2];
+  const uint32_t a3 = operands_a[3], b3 = operands_b[3];
+  const uint32_t a4 = operands_a[4], b4 = operands_b[4];
+  const uint32_t a5 = operands_a[5], b5 = operands_b[5];
+  const uint32_t a6 = operands_a[6], b6 = operands_b[6];
+  const uint32_t a7 = operands_a[7], b7 = operands_b[7];
+  uint32_t sum = 0;
+  for (int i = 0; i < kOps; i += 8) {
+    sum += Issue<kOp>(a0, b0);
+    sum += Issue<kOp>(a1, b1);
+    sum += Issue<kOp>(a2, b2);
+    sum += Issue<kOp>(a3, b3);
+    sum += Issue<kOp>(a4, b4);
+    sum += Issue<kOp>(a5, b5);
+    sum += Issue<kOp>(a6, b6);
+    sum += Issue<kOp>(a7, b7);
+  }
+  return sum;
+}
+
+uint32_t ModelIssueLoop(int op) {
+  ResetModel();
+  uint32_t sum = 0;
+  for (int i = 0; i < kOps; ++i) {
+    sum += ModelIssue(op, operands_a[i % 8], operands_b[i % 8]);
+  }
+  return sum;
+}
+
+template <int kOp>
+uint32_t ChainLoop() {
+  uint32_t x = operands_a[0];
+  for (int i = 0; i < kOps; i += 8) {
+    x = Issue<kOp>(x, x);
+    x = Issue<kOp>(x, x);
+    x = Issue<kOp>(x, x);
+    x = Issue<kOp>(x, x);
+    x = Issue<kOp>(x, x);
+    x = Issue<kOp>(x, x);
+    x = Issue<kOp>(x, x);
+    x = Issue<kOp>(x, x);
+  }
+  return x;
+}
+
+uint32_t ModelChainLoop(int op) {
+  ResetModel();
+  uint32_t x = operands_a[0];
+  for (int i = 0; i < kOps; ++i) x = ModelIssue(op, x, x);
+  return x;
+}
+
+template <int kOp>
+uint32_t LoadLoop() {
+  for (int i = 0; i < kOps; i += 8) {
+    results[i] = Issue<kOp>(operands_a[i], operands_b[i]);
+    results[i + 1] = Issue<kOp>(operands_a[i + 1], operands_b[i + 1]);
+    results[i + 2] = Issue<kOp>(operands_a[i + 2], operands_b[i + 2]);
+    results[i + 3] = Issue<kOp>(operands_a[i + 3], operands_b[i + 3]);
+    results[i + 4] = Issue<kOp>(operands_a[i + 4], operands_b[i + 4]);
+    results[i + 5] = Issue<kOp>(operands_a[i + 5], operands_b[i + 5]);
+    results[i + 6] = Issue<kOp>(operands_a[i + 6], operands_b[i + 6]);
+    results[i + 7] = Issue<kOp>(operands_a[i + 7], operands_b[i + 7]);
+  }
+  return 0;
+}
+
+// Times `loop`, run from a known CFU state. Returns cycles per op in
+// hundredths.
+unsigned Time(uint32_t (*loop)(), uint32_t* result) {
+  ResetCfu();
+  const unsigned start = perf_get_mcycle();
+  *result = loop();
+  const unsigned cycles = perf_get_mcycle() - start;
+  return static_cast<unsigned>(100ull * cycles / kOps);
+}
+
+// Failures of one op, as they are summarized.
+struct Failures {
+  int count;
+  char summary[3][96];
+};
+
+void CheckSum(const char* pattern, uint32_t got, uint32_t expected,
+              Failures* failures) {
+  if (got == expected) return;
+  snprintf(failures->summary[failures->count++], sizeof(failures->summary[0]),
+           "%s: result 0x%08lx, expected 0x%08lx", pattern,
+           static_cast<unsigned long>(got),
+           static_cast<unsigned long>(expected));
+}
+
+void CheckLoads(int op, Failures* failures) {
+  ResetModel();
+  int wrong = 0;
+  int first = 0;
+  uint32_t expected_first = 0;
+  for (int i = 0; i < kOps; ++i) {
+    const uint32_t expected = ModelIssue(op, operands_a[i], operands_b[i]);
+    if (results[i] != expected && wrong++ == 0) {
+      first = i;
+      expected_first = expected;
+    }
+  }
+  if (wrong == 0) return;
+  snprintf(failures->summary[failures->count++], sizeof(failures->summary[0]),
+           "loads: %d of %d wrong, the first at %d: 0x%08lx, expected 0x%08lx",
+           wrong, kOps, first, static_cast<unsigned long>(results[first]),
+           static_cast<unsigned long>(expected_first));
+}
+
+void PrintHundredths(unsigned value) {
+  printf("%4u.%02u", value / 100, value % 100);
+}
+
+// Returns the number of patterns that failed.
+template <int kOp>
+int BenchmarkOp() {
+  Failures failures = {};
+  uint32_t result;
+  const unsigned issue = Time(IssueLoop<kOp>, &result);
+  CheckSum("issue", result, ModelIssueLoop(kOp), &failures);
+  const unsigned chain = Time(ChainLoop<kOp>, &result);
+  CheckSum("chain", result, ModelChainLoop(kOp), &failures);
+  const unsigned loads = Time(LoadLoop<kOp>, &result);
+  CheckLoads(kOp, &failures);
+
+  printf("%-8s", kOpNames[kOp]);
+  PrintHundredths(issue);
+  PrintHundredths(chain);
+  PrintHundredths(loads);
+  printf("  %s\n", failures.count == 0 ? "OK" : "FAIL");
+  for (int i = 0; i < failures.count; ++i) {
+    printf("  %s\n", failures.summary[i]);
+  }
+  return failures.count;
+}
+
+void FillOperands() {
+  // xorshift32, so that every run uses the same operands.
+  uint32_t state = 0x2545f491;
+  for (int i = 0; i < kOps; ++i) {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    operands_a[i] = state;
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    operands_b[i] = state;
+  }
+}
+
+}  // namespace
+
+void RunCfuBenchmark(int op) {
+  FillOperands();
+  printf("cycles per op over %d ops\n", kOps);
+  printf("%-8s %6s %6s %6s\n", "op", "issue", "chain", "loads");
+  int failed = 0;
+  if (op < 0 || op == 0) failed += BenchmarkOp<0>();
+  if (op < 0 || op == 1) failed += BenchmarkOp<1>();
+  if (op < 0 || op == 2) failed += BenchmarkOp<2>();
+  if (op < 0 || op == 3) failed += BenchmarkOp<3>();
+  if (op < 0 || op == 4) failed += BenchmarkOp<4>();
+  if (op < 0 || op == 5) failed += BenchmarkOp<5>();
+  if (op < 0 || op == 6) failed += BenchmarkOp<6>();
+  if (op < 0 || op == 7) failed += BenchmarkOp<7>();
+  if (failed > 0) {
+    printf("%d of %d patterns failed\n", failed,
+           3 * (op < 0 ? kNumCfuBenchOps : 1));
+  } else {
+    puts("all results as modelled");
+  }
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+// Throughput benchmark of the CFU ops (see mnv2_cfu.h): tight loops of one
+// op, timed with the cycle counter, in three patterns:
+//   issue: eight independent ops back to back, for the issue rate;
+//   chain: each op taking the result of the one before, for the latency;
+//   loads: operands loaded from and results stored to memory, as kernels do.
+// Cycles per op include the add that folds each result into a checksum, or
+// the loads and store, and an eighth of a loop branch.
+//
+// The get ops take no operands, so their chain pattern only repeats the
+// issue one.
+//
+// Results are checked against software_cfu() (software_cfu.cc), the model
+// the CFU fuzzer (cfu_fuzz.h) also checks against, without printing them;
+// only failures are reported, one line per pattern.
+
+// Ops, by number (see mnv2_cfu.h): 0 and 1 pass rs1 and rs2 through, 2 is
+// the four-way MAC and 3 sets the accumulator; 4 is the MAC from a zero
+// accumulator, 5 sets the input offset, 6 gets the accumulator and 7 gets
+// the input offset.
+constexpr int kNumCfuBenchOps = 8;
+
+// Benchmarks op `op`, or every op if `op` is negative.
+void RunCfuBenchmark(int op);
@@ -0,0 +1,187 @@
+#include "cfu_fuzz.h"
+
+#include <generated/soc.h>
+
+#include <cstdio>
+
+#include "cfu.h"
+#include "perf.h"
+#include "software_cfu.h"
+
+#ifdef CFU_SOFTWARE_DEFINED
+
+void RunCfuFuzzer(uint32_t, uint32_t) {
+  puts("the CFU is software_cfu() in this build; nothing to compare");
+}
+
+#else
+
+namespace {
+
+// Ops timed at a time; the cycle counter would wrap over all of them.
+constexpr uint32_t kBatch = 4096;
+
+enum Kind {
+  kMac4,
+  kMac4First,
+  kSetInputOffset,
+  kSetAcc,
+  kGetAcc,
+  kGetInputOffset,
+  kPassRs1,
+  kPassRs2,
+  // A control funct7 that cfu.v does not decode.
+  kOtherControl,
+};
+
+struct Op {
+  const char* name;
+  int funct3;
+  int funct7;
+};
+
+// By Kind.
+const Op kOps[] = {
+    {"mac4", 2, 0},
+    {"mac4 first", 2, 1},
+    {"set input offset", 3, 0},
+    {"set acc", 3, 1},
+    {"get acc", 3, 2},
+    {"get input offset", 3, 3},
+    {"pass rs1", 0, 0},
+    {"pass rs2", 1, 0},
+    {"control 127", 3, 127},
+};
+
+// Kinds weighted by how often they come up: mostly MACs.
+const Kind kKinds[16] = {
+    kMac4,      kMac4,           kMac4,       kMac4,
+    kMac4,      kMac4,           kMac4,       kMac4First,
+    kMac4First, kSetInputOffset, kSetAcc,     kGetAcc,
+    kGetInputOffset, kPassRs1,   kPassRs2,    kOtherControl,
+};
+
+const uint8_t kEdgeBytes[] = {0x80, 0xff, 0x00, 0x01, 0x7f};
+const uint32_t kEdgeWords[] = {
+    0,          1,          0xffffffff, 128,        0xffffff80,
+    127,        0x7fffffff, 0x80000000, 0x7fff0000, 0x80010000,
+};
+
+uint32_t state;
+
+// xorshift32.
+uint32_t Random() {
+  state ^= state << 13;
+  state ^= state >> 17;
+  state ^= state << 5;
+  return state;
+}
+
+// A MAC operand: each byte is an edge case one time in four.
+uint32_t RandomWord() {
+  uint32_t word = Random();
+  const uint32_t picks = Random();
+  for (int i = 0; i < 4; ++i) {
+    const uint32_t pick = picks >> (8 * i);
+    if ((pick & 3) != 0) continue;
+    const uint32_t byte = kEdgeBytes[(pick >> 2) % sizeof(kEdgeBytes)];
+    word = (word & ~(0xffu << (8 * i))) | (byte << (8 * i));
+  }
+  return word;
+}
+
+// An input offset or accumulator: an edge case three times in four.
+uint32_t RandomScalar() {
+  const uint32_t pick = Random();
+  if ((pick & 3) == 0) return Random();
+  return kEdgeWords[(pick >> 2) %
+                    (sizeof(kEdgeWords) / sizeof(kEdgeWords[0]))];
+}
+
+// funct7 has to be an immediate, hence the switch.
+uint32_t IssueHardware(Kind kind, uint32_t a, uint32_t b) {
+  switch (kind) {
+    case kMac4:
+      return cfu_op2(0, a, b);
+    case kMac4First:
+      return cfu_op2(1, a, b);
+    case kSetInputOffset:
+      return cfu_op3(0, a, b);
+    case kSetAcc:
+      return cfu_op3(1, a, b);
+    case kGetAcc:
+      return cfu_op3(2, a, b);
+    case kGetInputOffset:
+      return cfu_op3(3, a, b);
+    case kPassRs1:
+      return cfu_op0(0, a, b);
+    case kPassRs2:
+      return cfu_op1(0, a, b);
+    default:
+      return cfu_op3(127, a, b);
+  }
+}
+
+uint32_t IssueModel(Kind kind, uint32_t a, uint32_t b) {
+  return software_cfu(kOps[kind].funct3, kOps[kind].funct7, a, b);
+}
+
+// Puts both into the same state.
+void Reset() {
+  IssueHardware(kSetInputOffset, 0, 0);
+  IssueModel(kSetInputOffset, 0, 0);
+  IssueHardware(kSetAcc, 0, 0);
+  IssueModel(kSetAcc, 0, 0);
+}
+
+void PrintMismatch(uint32_t seed, uint32_t index, Kind kind, uint32_t a,
+                   uint32_t b, uint32_t hardware, uint32_t model) {
+  printf("FAIL at op %lu of seed %lu: %s rs1 0x%08lx rs2 0x%08lx\n",
+         static_cast<unsigned long>(index), static_cast<unsigned long>(seed),
+         kOps[kind].name, static_cast<unsigned long>(a),
+         static_cast<unsigned long>(b));
+  printf("  cfu 0x%08lx, software_cfu 0x%08lx\n",
+         static_cast<unsigned long>(hardware),
+         static_cast<unsigned long>(model));
+  printf("  then acc 0x%08lx / 0x%08lx, input offset 0x%08lx / 0x%08lx\n",
+         static_cast<unsigned long>(IssueHardware(kGetAcc, 0, 0)),
+         static_cast<unsigned long>(IssueModel(kGetAcc, 0, 0)),
+         static_cast<unsigned long>(IssueHardware(kGetInputOffset, 0, 0)),
+         static_cast<unsigned long>(IssueModel(kGetInputOffset, 0, 0)));
+}
+
+}  // namespace
+
+void RunCfuFuzzer(uint32_t seed, uint32_t ops) {
+  printf("fuzzing %lu CFU ops, seed %lu\n", static_cast<unsigned long>(ops),
+         static_cast<unsigned long>(seed));
+  state = seed != 0 ? seed : 1;
+  Reset();
+  uint64_t cycles = 0;
+  for (uint32_t done = 0; done < ops;) {
+    const uint32_t end = ops - done < kBatch ? ops : done + kBatch;
+    const unsigned start = perf_get_mcycle();
+    for (; done < end; ++done) {
+      const Kind kind = kKinds[Random() & 15];
+      const bool mac = kind == kMac4 || kind == kMac4First;
+      const uint32_t a = mac ? RandomWord() : RandomScalar();
+      const uint32_t b = mac ? RandomWord() : Random();
+      const uint32_t hardware = IssueHardware(kind, a, b);
+      const uint32_t model = IssueModel(kind, a, b);
+      if (hardware != model) {
+        PrintMismatch(seed, done, kind, a, b, hardware, model);
+        return;
+      }
+    }
+    cycles += perf_get_mcycle() - start;
+  }
+  const uint64_t per_second =
+      cycles == 0 ? 0 : uint64_t{ops} * CONFIG_CLOCK_FREQUENCY / cycles;
+  printf("OK: %lu ops in %llu cycles, %llu cycles per op, %llu ops/s\n",
+         static_cast<unsigned long>(ops),
+         static_cast<unsigned long long>(cycles),
+         static_cast<unsigned long long>(ops == 0 ? 0 : cycles / ops),
+         static_cast<unsigned long long>(per_second));
+}
+
+#endif  // CFU_SOFTWARE_DEFINED
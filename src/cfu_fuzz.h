@@ -0,0 +1,19 @@
+#pragma once
+#include <cstdint>
+
+// Differential fuzzer of the CFU (see mnv2_cfu.h): random sequences of CFU
+// ops go to the hardware and to software_cfu(), its C model, and every
+// result is compared.
+//
+// Operands lean towards the edge cases: bytes of -128, -1, 0, 1 and 127, so
+// that -128 * -128 comes up often; input offsets and accumulators of 0,
+// +-1, +-128 and the int32 extremes, so that sums wrap. Most ops are MACs,
+// with and without clearing the accumulator, between which the offset and
+// accumulator are set and read back.
+//
+// The fuzzer stops at the first mismatch and prints the op, its operands,
+// both results and the state after it, with the seed and op number to
+// reproduce it. Otherwise it prints how many ops it compared per second.
+// A build with CFU_SOFTWARE_DEFINED has no hardware to compare with.
+
+void RunCfuFuzzer(uint32_t seed, uint32_t ops);
@@ -0,0 +1,23 @@
+#pragma once
+#include <cstdint>
+
+#include "tensorflow/lite/kernels/internal/types.h"
+
+// The int8 convolution that the CONV_2D kernel (conv.cc) runs for a layer
+// with no input normalization or residual ADD folded into it, so that code
+// outside the interpreter, e.g. the bn5 microbenchmark (bn5_bench.h), times
+// exactly what an inference would.
+
+namespace tflite {
+
+// Runs StreamingConv1x1PerChannel if the shapes suit it, and the reference
+// ConvPerChannel otherwise. `bias_data` may be nullptr.
+void OptimizedConvPerChannel(
+    const ConvParams& params, const int32_t* output_multiplier,
+    const int32_t* output_shift, const RuntimeShape& input_shape,
+    const int8_t* input_data, const RuntimeShape& filter_shape,
+    const int8_t* filter_data, const RuntimeShape& bias_shape,
+    const int32_t* bias_data, const RuntimeShape& output_shape,
+    int8_t* output_data);
+
+}  // namespace tflite
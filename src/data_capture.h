@@ -1,13 +1,257 @@
 #pragma once
 #include <tensorflow/lite/c/common.h>
+#include <tensorflow/lite/micro/kernels/conv.h>
+
+#include "capture_format.h"
+
+// Capture is compiled in only with DATA_CAPTURE defined (see the Makefile).
+// Without it the hooks below are empty, and the capture hook (see
+// capture_hook.h) is never put in.
+
+#ifdef DATA_CAPTURE
 #include <tensorflow/lite/micro/kernels/kernel_util.h>
+#include <algorithm>
+#include <cstdarg>
 #include <cstdio>
+#include <cstring>
 #include <cinttypes>
 
+#include "capture_accumulators.h"
+#include "capture_uart.h"
+
 using namespace tflite;
 
-// Helper to print a tensor's data as a C-style array
-inline void print_tensor_as_h(const char* name, const TfLiteEvalTensor* tensor) {
+// Captured tensors are copied into a capture arena during inference,
+// run-length coded when that makes them smaller, and sent as framed binary
+// records (see capture_format.h) by capture_flush(), which FinishInference
+// (see capture_hook.h) calls once the interpreter has returned.
+// tools/capture_decode turns a log back into the C headers the printf dumps
+// used to produce. Define DATA_CAPTURE_RAW to leave tensors uncoded, or
+// DATA_CAPTURE_TEXT to print those headers directly, as it happens.
+
+#ifndef DATA_CAPTURE_TEXT
+#ifndef DATA_CAPTURE_ARENA_BYTES
+// Enough for the bn5 tensors (about 135 KB raw, 102 KB coded).
+#define DATA_CAPTURE_ARENA_BYTES (192 * 1024)
+#endif
+#ifndef DATA_CAPTURE_ACCUMULATOR_BYTES
+// Accumulator records (see capture_accumulators.h) have an arena of their
+// own, enough for bn5's three convs: 150 KB each for ex and dw and 25 KB for
+// pr.
+#define DATA_CAPTURE_ACCUMULATOR_BYTES (336 * 1024)
+#endif
+
+namespace data_capture {
+
+// Streams one record to the UART (see capture_uart.h) as base64 lines.
+class RecordWriter {
+public:
+    RecordWriter() {
+        memcpy(line_, capture_format::kLinePrefix,
+               capture_format::kLinePrefixLength);
+    }
+
+    void Write(const void* data, size_t size) {
+        crc_.Update(data, size);
+        Put(data, size);
+    }
+
+    // Appends the CRC and sends what is left.
+    void Finish() {
+        uint8_t crc[capture_format::kCrcBytes];
+        capture_format::PutU32(crc, crc_.value());
+        Put(crc, sizeof(crc));
+        if (group_size_ > 0) EncodeGroup();
+        FlushLine();
+    }
+
+private:
+    void Put(const void* data, size_t size) {
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        for (size_t i = 0; i < size; ++i) {
+            group_[group_size_++] = bytes[i];
+            if (group_size_ == 3) EncodeGroup();
+        }
+    }
+
+    void EncodeGroup() {
+        capture_format::Base64Encode(group_, group_size_, line_ + line_size_);
+        line_size_ += 4;
+        group_size_ = 0;
+        if (line_size_ == kLineEnd) FlushLine();
+    }
+
+    void FlushLine() {
+        if (line_size_ == capture_format::kLinePrefixLength) return;
+        line_[line_size_++] = '\n';
+        UartWrite(line_, line_size_);
+        line_size_ = capture_format::kLinePrefixLength;
+    }
+
+    static constexpr int kLineEnd =
+        capture_format::kLinePrefixLength + capture_format::kLineChars;
+    char line_[kLineEnd + 1];
+    int line_size_ = capture_format::kLinePrefixLength;
+    uint8_t group_[3];
+    int group_size_ = 0;
+    capture_format::Crc32 crc_;
+};
+
+// Records captured during inference, each after a u32 length and without
+// its CRC, in kBytes of buffer. Nothing is sent until Flush, so capturing
+// keeps the UART out of inference and only costs a copy. Lives in static
+// storage and relies on its zero initialisation.
+template <size_t kBytes>
+class CaptureArena {
+public:
+    // Appends a record header and returns where its payload goes, or
+    // nullptr if the record does not fit, in which case it is dropped.
+    uint8_t* Reserve(uint8_t kind, uint8_t dtype, const char* name,
+                     const int32_t* dims, int rank, uint32_t payload_bytes,
+                     uint8_t encoding = capture_format::kRaw,
+                     const capture_format::TensorInfo& info = {}) {
+        const int name_length = strlen(name);
+        const size_t record_bytes =
+            capture_format::kHeaderBytes +
+            capture_format::MetadataBytes(rank, name_length, info.channels) +
+            payload_bytes;
+        if (used_ + 4 + record_bytes > sizeof(buffer_)) {
+            ++dropped_;
+            text_record_ = nullptr;
+            return nullptr;
+        }
+        uint8_t* record = capture_format::PutU32(buffer_ + used_, record_bytes);
+        uint8_t* p = record + capture_format::PutHeader(
+            record, kind, dtype, rank, name_length, payload_bytes, encoding,
+            info);
+        for (int i = 0; i < rank; ++i) {
+            p = capture_format::PutU32(p, static_cast<uint32_t>(dims[i]));
+        }
+        memcpy(p, name, name_length);
+        used_ += 4 + record_bytes;
+        ++records_;
+        text_record_ = kind == capture_format::kText ? record : nullptr;
+        return capture_format::PutChannels(p + name_length, info);
+    }
+
+    // Appends text, extending the previous record if that was text too.
+    void AppendText(const char* text, int length) {
+        if (text_record_ != nullptr && used_ + length <= sizeof(buffer_)) {
+            const uint32_t payload_bytes = capture_format::GetU32(text_record_ + 12);
+            capture_format::PutU32(text_record_ - 4,
+                                   capture_format::GetU32(text_record_ - 4) + length);
+            capture_format::PutU32(text_record_ + 12, payload_bytes + length);
+            memcpy(buffer_ + used_, text, length);
+            used_ += length;
+            return;
+        }
+        uint8_t* payload = Reserve(capture_format::kText, capture_format::kInt8,
+                                   "", nullptr, 0, length);
+        if (payload != nullptr) memcpy(payload, text, length);
+    }
+
+    // Sends every record and empties the arena.
+    void Flush() {
+        if (used_ == 0 && dropped_ == 0) return;
+        BeginUartTransfer();
+        size_t offset = 0;
+        while (offset < used_) {
+            const uint32_t record_bytes = capture_format::GetU32(buffer_ + offset);
+            RecordWriter writer;
+            writer.Write(buffer_ + offset + 4, record_bytes);
+            writer.Finish();
+            offset += 4 + record_bytes;
+        }
+        const UartTransfer transfer = EndUartTransfer();
+        if (transfer.bytes > 0) {
+            const uint32_t rate = UartBytesPerSecond(transfer);
+            printf("// capture: %lu bytes in %lu cycles, %lu bytes/s, %lu%% of"
+                   " the %lu baud line\n",
+                   static_cast<unsigned long>(transfer.bytes),
+                   static_cast<unsigned long>(transfer.cycles),
+                   static_cast<unsigned long>(rate),
+                   static_cast<unsigned long>(
+                       100ull * rate / kUartBytesPerSecond),
+                   static_cast<unsigned long>(kUartBaud));
+        }
+        if (dropped_ > 0) {
+            printf("// capture: %d records did not fit in the %d byte arena\n",
+                   dropped_, static_cast<int>(sizeof(buffer_)));
+        }
+        used_ = 0;
+        records_ = 0;
+        dropped_ = 0;
+        text_record_ = nullptr;
+    }
+
+    int records() const { return records_; }
+    size_t used() const { return used_; }
+
+private:
+    uint8_t buffer_[kBytes];
+    size_t used_;
+    int records_;
+    int dropped_;
+    // The last record, if it is text.
+    uint8_t* text_record_;
+};
+
+inline CaptureArena<DATA_CAPTURE_ARENA_BYTES>& arena() {
+    static CaptureArena<DATA_CAPTURE_ARENA_BYTES> arena;
+    return arena;
+}
+
+inline CaptureArena<DATA_CAPTURE_ACCUMULATOR_BYTES>& accumulator_arena() {
+    static CaptureArena<DATA_CAPTURE_ACCUMULATOR_BYTES> arena;
+    return arena;
+}
+
+// Adds a record holding `data`, coded as ChooseEncoding finds best.
+inline void write_record(uint8_t kind, uint8_t dtype, const char* name,
+                         const int32_t* dims, int rank, const void* data,
+                         size_t size,
+                         const capture_format::TensorInfo& info = {}) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    const int stride = capture_format::DeltaStride(dtype, dims, rank);
+    size_t payload_bytes = size;
+    const capture_format::Encoding encoding =
+#ifdef DATA_CAPTURE_RAW
+        capture_format::kRaw;
+#else
+        capture_format::ChooseEncoding(bytes, size, stride, &payload_bytes);
+#endif
+    uint8_t* payload = arena().Reserve(kind, dtype, name, dims, rank,
+                                       payload_bytes, encoding, info);
+    if (payload != nullptr) {
+        capture_format::Encode(encoding, bytes, size, stride, payload);
+    }
+}
+
+inline void write_tensor(const char* name, const TfLiteEvalTensor* tensor,
+                         uint8_t dtype, bool flat,
+                         const capture_format::TensorInfo& info) {
+    const RuntimeShape shape = tflite::micro::GetTensorShape(tensor);
+    int32_t dims[capture_format::kMaxRank];
+    int rank = flat ? 1 : shape.DimensionsCount();
+    if (flat) {
+        dims[0] = shape.FlatSize();
+    } else {
+        for (int i = 0; i < rank; ++i) dims[i] = shape.Dims(i);
+    }
+    // The core is little-endian, so the data goes out as it is in memory.
+    write_record(capture_format::kTensor, dtype, name, dims, rank,
+                 tensor->data.data,
+                 shape.FlatSize() * capture_format::DTypeSize(dtype), info);
+}
+
+}  // namespace data_capture
+#endif  // DATA_CAPTURE_TEXT
+
+// Helper to print a tensor's data as a C-style array. `info` goes into the
+// record header; the text capture has no place for it.
+inline void print_tensor_as_h(const char* name, const TfLiteEvalTensor* tensor,
+                              const capture_format::TensorInfo& info = {}) {
+#ifdef DATA_CAPTURE_TEXT
     // Print shape as a comment
     printf("// Tensor '%s', Shape: [", name);
     for (int i = 0; i < tflite::micro::GetTensorShape(tensor).DimensionsCount(); ++i) {
@@ -19,17 +263,23 @@ inline void print_tensor_as_h(const char* name, const TfLiteEvalTensor* tensor)
     // Print data as a C array
     const int8_t* data = tflite::micro::GetTensorData<int8_t>(tensor);
     int flat_size = tflite::micro::GetTensorShape(tensor).FlatSize();
-    
+
     printf("const int8_t %s[] = {", name);
     for (int i = 0; i < flat_size; ++i) {
         if (i % 16 == 0) printf("\n    ");
         printf("0x%02x, ", data[i]);
     }
     printf("\n};\n\n");
+#else
+    data_capture::write_tensor(name, tensor, capture_format::kInt8, false,
+                               info);
+#endif
 }
 
 // Overloaded version for bias data (int32_t)
-inline void print_tensor_as_h(const char* name, const TfLiteEvalTensor* tensor, bool is_bias) {
+inline void print_tensor_as_h(const char* name, const TfLiteEvalTensor* tensor, bool is_bias,
+                              const capture_format::TensorInfo& info = {}) {
+#ifdef DATA_CAPTURE_TEXT
     printf("// Tensor '%s', Shape: [%" PRId32 "]\n", name, static_cast<int32_t>(tflite::micro::GetTensorShape(tensor).FlatSize()));
     const int32_t* data = tflite::micro::GetTensorData<int32_t>(tensor);
     printf("const int32_t %s[] = {", name);
@@ -38,4 +288,151 @@ inline void print_tensor_as_h(const char* name, const TfLiteEvalTensor* tensor,
         printf("0x%08" PRIx32 ", ", data[i]);
     }
     printf("\n};\n\n");
-}
\ No newline at end of file
+#else
+    data_capture::write_tensor(name, tensor, capture_format::kInt32, true,
+                               info);
+#endif
+}
+
+// Prints all quantization parameters for a layer
+inline void print_quant_params_as_h(const char* layer_name, const OpDataConv& data, int num_channels) {
+#ifdef DATA_CAPTURE_TEXT
+    printf("\n// --- %s: REQUANTIZATION PARAMS ---\n", layer_name);
+    printf("const int32_t %s_input_offset = %ld;\n", layer_name, data.input_zero_point);
+    printf("const int32_t %s_output_offset = %ld;\n\n", layer_name, data.output_zero_point);
+
+    printf("// Per-channel output multipliers:\n");
+    printf("const int32_t %s_output_multiplier[] = {\n    ", layer_name);
+    for (int i = 0; i < num_channels; ++i) {
+        printf("0x%08lx, ", data.per_channel_output_multiplier[i]);
+        if ((i + 1) % 8 == 0 && (i + 1) < num_channels) printf("\n    ");
+    }
+    printf("\n};\n\n");
+
+    printf("// Per-channel output shifts:\n");
+    printf("const int32_t %s_output_shift[] = {\n    ", layer_name);
+    for (int i = 0; i < num_channels; ++i) {
+        printf("%ld, ", data.per_channel_output_shift[i]);
+        if ((i + 1) % 16 == 0 && (i + 1) < num_channels) printf("\n    ");
+    }
+    printf("\n};\n");
+#else
+    const int32_t dims[1] = {num_channels};
+    const int32_t zero_points[2] = {data.input_zero_point, data.output_zero_point};
+    uint8_t* payload = data_capture::arena().Reserve(
+        capture_format::kQuantParams, capture_format::kInt32, layer_name, dims,
+        1, (2 + 2 * num_channels) * 4);
+    if (payload == nullptr) return;
+    memcpy(payload, zero_points, sizeof(zero_points));
+    memcpy(payload + 8, data.per_channel_output_multiplier, num_channels * 4);
+    memcpy(payload + 8 + num_channels * 4, data.per_channel_output_shift,
+           num_channels * 4);
+#endif
+}
+
+// Prints one row of the tensor statistics table (see tensor_stats.h):
+// op, tag, tensor, min, max, zero point, zero point hits, elements, then
+// the 256 histogram bins for -128 to 127. `tensor` is input k for k >= 0
+// and output -1 - k otherwise.
+inline void print_tensor_stats(int op, const char* tag, int tensor,
+                               int zero_point, uint32_t elements,
+                               const uint32_t* bins) {
+#ifdef DATA_CAPTURE_TEXT
+    int min = 0;
+    while (min < 255 && bins[min] == 0) ++min;
+    int max = 255;
+    while (max > 0 && bins[max] == 0) --max;
+    printf("%d,%s,%s%d,%d,%d,%d,%lu,%lu", op, tag,
+           tensor >= 0 ? "input" : "output", tensor >= 0 ? tensor : -1 - tensor,
+           min - 128, max - 128, zero_point,
+           static_cast<unsigned long>(bins[zero_point + 128]),
+           static_cast<unsigned long>(elements));
+    for (int i = 0; i < 256; ++i) {
+        printf(",%lu", static_cast<unsigned long>(bins[i]));
+    }
+    printf("\n");
+#else
+    uint8_t payload[capture_format::kStatsPayloadBytes];
+    uint8_t* p = capture_format::PutU32(payload, op);
+    p = capture_format::PutU32(p, tensor);
+    p = capture_format::PutU32(p, zero_point);
+    p = capture_format::PutU32(p, elements);
+    for (int i = 0; i < 256; ++i) p = capture_format::PutU32(p, bins[i]);
+    data_capture::write_record(capture_format::kStats, capture_format::kInt32,
+                               tag, nullptr, 0, payload, sizeof(payload));
+#endif
+}
+
+// Has the kernel about to run store its accumulators (see
+// capture_accumulators.h) in a record named `name`, shaped like `output`, in
+// the accumulator arena. If the record does not fit, the sink is left empty
+// and nothing is stored.
+inline void begin_accumulators(const char* name, const TfLiteEvalTensor* output,
+                               const capture_format::TensorInfo& info = {}) {
+#ifdef DATA_CAPTURE_TEXT
+    printf("// %s: accumulators are only captured as binary records\n", name);
+#else
+    const RuntimeShape shape = tflite::micro::GetTensorShape(output);
+    int32_t dims[capture_format::kMaxRank];
+    for (int i = 0; i < shape.DimensionsCount(); ++i) dims[i] = shape.Dims(i);
+    const uint32_t payload_bytes = shape.FlatSize() * 4;
+    uint8_t* payload = data_capture::accumulator_arena().Reserve(
+        capture_format::kAccumulators, capture_format::kInt32, name, dims,
+        shape.DimensionsCount(), payload_bytes, capture_format::kRaw, info);
+    // Elements a kernel does not reach read as zero.
+    if (payload != nullptr) memset(payload, 0, payload_bytes);
+    data_capture::accumulator_sink() = payload;
+    data_capture::accumulators_reported() = false;
+#endif
+}
+
+inline void end_accumulators() {
+    data_capture::accumulator_sink() = nullptr;
+}
+
+// printf for text that belongs with the captured data.
+inline void capture_printf(const char* format, ...)
+    __attribute__((format(printf, 1, 2)));
+
+inline void capture_printf(const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+#ifdef DATA_CAPTURE_TEXT
+    vprintf(format, args);
+#else
+    // Longer text is cut short.
+    char text[256];
+    const int length = vsnprintf(text, sizeof(text), format, args);
+    if (length > 0) {
+        data_capture::arena().AppendText(
+            text, std::min(length, static_cast<int>(sizeof(text)) - 1));
+    }
+#endif
+    va_end(args);
+}
+
+// Sends everything captured so far. Call it outside inference, as
+// FinishInference (see capture_hook.h) does.
+inline void capture_flush() {
+#ifndef DATA_CAPTURE_TEXT
+    data_capture::arena().Flush();
+    data_capture::accumulator_arena().Flush();
+#endif
+}
+
+#else  // DATA_CAPTURE
+
+inline void print_tensor_as_h(const char*, const TfLiteEvalTensor*,
+                              const capture_format::TensorInfo& = {}) {}
+inline void print_tensor_as_h(const char*, const TfLiteEvalTensor*, bool,
+                              const capture_format::TensorInfo& = {}) {}
+inline void print_quant_params_as_h(const char*, const tflite::OpDataConv&, int) {}
+inline void print_tensor_stats(int, const char*, int, int, uint32_t,
+                               const uint32_t*) {}
+inline void begin_accumulators(const char*, const TfLiteEvalTensor*,
+                               const capture_format::TensorInfo& = {}) {}
+inline void end_accumulators() {}
+inline void capture_printf(const char*, ...) {}
+inline void capture_flush() {}
+
+#endif  // DATA_CAPTURE
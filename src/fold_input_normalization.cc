@@ -0,0 +1,328 @@
+#include "fold_input_normalization.h"
+
+#include <algorithm>
+
+#include "graph_rewrite.h"
+#include "tensorflow/lite/c/builtin_op_data.h"
+#include "tensorflow/lite/kernels/internal/common.h"
+#include "tensorflow/lite/kernels/internal/quantization_util.h"
+#include "tensorflow/lite/kernels/internal/types.h"
+#include "tensorflow/lite/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/micro_context.h"
+
+namespace tflite {
+namespace {
+
+// The MUL kernel's int8 parameter calculation. Returns false if the MUL is
+// not one the table can stand in for.
+bool CalculateMulParams(TfLiteContext* context, const TfLiteMulParams& mul,
+                        const TfLiteTensor* input1, const TfLiteTensor* input2,
+                        const TfLiteTensor* output, ArithmeticParams* params) {
+  if (output->type != kTfLiteInt8) return false;
+  params->input1_offset = -input1->params.zero_point;
+  params->input2_offset = -input2->params.zero_point;
+  params->output_offset = output->params.zero_point;
+  const double real_multiplier = static_cast<double>(input1->params.scale) *
+                                 static_cast<double>(input2->params.scale) /
+                                 static_cast<double>(output->params.scale);
+  QuantizeMultiplier(real_multiplier, &params->output_multiplier,
+                     &params->output_shift);
+  return CalculateActivationRangeQuantized(
+             context, mul.activation, output,
+             &params->quantized_activation_min,
+             &params->quantized_activation_max) == kTfLiteOk;
+}
+
+// The SUB kernel's int8 parameter calculation, which unlike ADD's works out
+// the multipliers in float.
+bool CalculateSubParams(TfLiteContext* context, const TfLiteSubParams& sub,
+                        const TfLiteTensor* input1, const TfLiteTensor* input2,
+                        const TfLiteTensor* output, ArithmeticParams* params) {
+  if (output->type != kTfLiteInt8) return false;
+  params->input1_offset = -input1->params.zero_point;
+  params->input2_offset = -input2->params.zero_point;
+  params->output_offset = output->params.zero_point;
+  params->left_shift = 20;
+  const float twice_max_input_scale =
+      2 * std::max(input1->params.scale, input2->params.scale);
+  const double real_input1_multiplier =
+      input1->params.scale / twice_max_input_scale;
+  const double real_input2_multiplier =
+      input2->params.scale / twice_max_input_scale;
+  const double real_output_multiplier =
+      twice_max_input_scale /
+      ((1 << params->left_shift) * output->params.scale);
+  QuantizeMultiplierSmallerThanOneExp(real_input1_multiplier,
+                                      &params->input1_multiplier,
+                                      &params->input1_shift);
+  QuantizeMultiplierSmallerThanOneExp(real_input2_multiplier,
+                                      &params->input2_multiplier,
+                                      &params->input2_shift);
+  QuantizeMultiplierSmallerThanOneExp(real_output_multiplier,
+                                      &params->output_multiplier,
+                                      &params->output_shift);
+  return CalculateActivationRangeQuantized(
+             context, sub.activation, output,
+             &params->quantized_activation_min,
+             &params->quantized_activation_max) == kTfLiteOk;
+}
+
+// The same arithmetic as reference_integer_ops::MulElementwise.
+int8_t MulElement(const ArithmeticParams& params, int32_t input1,
+                  int32_t input2) {
+  const int32_t input1_val = params.input1_offset + input1;
+  const int32_t input2_val = params.input2_offset + input2;
+  const int32_t unclamped_result =
+      params.output_offset +
+      MultiplyByQuantizedMultiplier(input1_val * input2_val,
+                                    params.output_multiplier,
+                                    params.output_shift);
+  const int32_t clamped_output =
+      std::min(params.quantized_activation_max,
+               std::max(params.quantized_activation_min, unclamped_result));
+  return static_cast<int8_t>(clamped_output);
+}
+
+// The same arithmetic as reference_ops::SubElementwise for int8.
+int8_t SubElement(const ArithmeticParams& params, int32_t input1,
+                  int32_t input2) {
+  const int32_t input1_val = params.input1_offset + input1;
+  const int32_t input2_val = params.input2_offset + input2;
+  const int32_t shifted_input1_val = input1_val * (1 << params.left_shift);
+  const int32_t shifted_input2_val = input2_val * (1 << params.left_shift);
+  const int32_t scaled_input1_val =
+      MultiplyByQuantizedMultiplierSmallerThanOneExp(
+          shifted_input1_val, params.input1_multiplier, params.input1_shift);
+  const int32_t scaled_input2_val =
+      MultiplyByQuantizedMultiplierSmallerThanOneExp(
+          shifted_input2_val, params.input2_multiplier, params.input2_shift);
+  const int32_t raw_sub = scaled_input1_val - scaled_input2_val;
+  const int32_t raw_output =
+      MultiplyByQuantizedMultiplierSmallerThanOneExp(
+          raw_sub, params.output_multiplier, params.output_shift) +
+      params.output_offset;
+  const int32_t clamped_output =
+      std::min(params.quantized_activation_max,
+               std::max(params.quantized_activation_min, raw_output));
+  return static_cast<int8_t>(clamped_output);
+}
+
+// Element `channel` of a constant that is either one value or one per
+// channel.
+int8_t ChannelValue(const TfLiteTensor* constant, int channel) {
+  return constant->data.int8[NumElements(constant) == 1 ? 0 : channel];
+}
+
+// Works the MUL and SUB through for every input value and channel, from
+// their quantization parameters. Sets *lut to nullptr if their parameters
+// are not ones the table can stand in for.
+TfLiteStatus BuildLut(TfLiteContext* context, const TfLiteNode& mul,
+                      const TfLiteNode& sub, int input_index,
+                      int mul_constant_index, int sub_constant_index,
+                      int channels, const int8_t** lut) {
+  *lut = nullptr;
+  const int mul_output_index = mul.outputs->data[0];
+  const bool mul_output_is_input1 = sub.inputs->data[0] == mul_output_index;
+  MicroContext* micro_context = GetMicroContext(context);
+  TfLiteTensor* input = micro_context->AllocateTempTfLiteTensor(input_index);
+  TF_LITE_ENSURE(context, input != nullptr);
+  TfLiteTensor* mul_constant =
+      micro_context->AllocateTempTfLiteTensor(mul_constant_index);
+  TF_LITE_ENSURE(context, mul_constant != nullptr);
+  TfLiteTensor* mul_output =
+      micro_context->AllocateTempTfLiteTensor(mul_output_index);
+  TF_LITE_ENSURE(context, mul_output != nullptr);
+  TfLiteTensor* sub_constant =
+      micro_context->AllocateTempTfLiteTensor(sub_constant_index);
+  TF_LITE_ENSURE(context, sub_constant != nullptr);
+  TfLiteTensor* output =
+      micro_context->AllocateTempTfLiteTensor(sub.outputs->data[0]);
+  TF_LITE_ENSURE(context, output != nullptr);
+
+  TFLITE_DCHECK(mul.builtin_data != nullptr);
+  TFLITE_DCHECK(sub.builtin_data != nullptr);
+  ArithmeticParams mul_params;
+  ArithmeticParams sub_params;
+  const bool foldable =
+      CalculateMulParams(
+          context, *static_cast<const TfLiteMulParams*>(mul.builtin_data),
+          input, mul_constant, mul_output, &mul_params) &&
+      CalculateSubParams(
+          context, *static_cast<const TfLiteSubParams*>(sub.builtin_data),
+          mul_output_is_input1 ? mul_output : sub_constant,
+          mul_output_is_input1 ? sub_constant : mul_output, output,
+          &sub_params);
+
+  int8_t* table = nullptr;
+  if (foldable) {
+    table = static_cast<int8_t*>(
+        context->AllocatePersistentBuffer(context, 256 * channels));
+  }
+  if (table != nullptr) {
+    for (int value = -128; value < 128; ++value) {
+      int8_t* row = table + static_cast<uint8_t>(value) * channels;
+      for (int c = 0; c < channels; ++c) {
+        const int8_t product =
+            MulElement(mul_params, value, ChannelValue(mul_constant, c));
+        const int8_t constant = ChannelValue(sub_constant, c);
+        row[c] = mul_output_is_input1
+                     ? SubElement(sub_params, product, constant)
+                     : SubElement(sub_params, constant, product);
+      }
+    }
+  }
+
+  micro_context->DeallocateTempTfLiteTensor(input);
+  micro_context->DeallocateTempTfLiteTensor(mul_constant);
+  micro_context->DeallocateTempTfLiteTensor(mul_output);
+  micro_context->DeallocateTempTfLiteTensor(sub_constant);
+  micro_context->DeallocateTempTfLiteTensor(output);
+  TF_LITE_ENSURE(context, !foldable || table != nullptr);
+  *lut = table;
+  return kTfLiteOk;
+}
+
+// Runs in the MUL and SUB slots.
+TfLiteStatus SkippedInvoke(TfLiteContext* context, TfLiteNode* node) {
+  return kTfLiteOk;
+}
+
+// Returns the input of `node` that is not `tensor_index`, or -1 if
+// `tensor_index` is not one of its two inputs.
+int OtherInput(const TfLiteNode& node, int tensor_index) {
+  if (node.inputs->size != 2) return -1;
+  if (node.inputs->data[0] == tensor_index) return node.inputs->data[1];
+  if (node.inputs->data[1] == tensor_index) return node.inputs->data[0];
+  return -1;
+}
+
+// True if `tensor_index` is a constant that broadcasts per channel.
+bool IsChannelConstant(TfLiteContext* context, int tensor_index,
+                       int channels) {
+  MicroContext* micro_context = GetMicroContext(context);
+  TfLiteTensor* tensor = micro_context->AllocateTempTfLiteTensor(tensor_index);
+  if (tensor == nullptr) return false;
+  const int size = NumElements(tensor);
+  const bool result = IsConstantTensor(tensor) && tensor->type == kTfLiteInt8 &&
+                      (size == 1 || size == channels);
+  micro_context->DeallocateTempTfLiteTensor(tensor);
+  return result;
+}
+
+}  // namespace
+
+TfLiteStatus FoldInputNormalization(TfLiteContext* context, TfLiteNode* node,
+                                    InputNormalization** result) {
+  *result = nullptr;
+  const int conv_index = graph_rewrite::GetNodeIndex(context, node);
+  if (conv_index < 2) return kTfLiteOk;
+  NodeAndRegistration* nodes = graph_rewrite::GetNodes(context);
+  NodeAndRegistration& mul = nodes[conv_index - 2];
+  NodeAndRegistration& sub = nodes[conv_index - 1];
+  if (mul.registration->builtin_code != kTfLiteBuiltinMul ||
+      sub.registration->builtin_code != kTfLiteBuiltinSub) {
+    return kTfLiteOk;
+  }
+
+  TfLiteEvalTensor* input = graph_rewrite::GetGraphInput(context, 0);
+  const int mul_output_index = mul.node.outputs->data[0];
+  const int sub_output_index = sub.node.outputs->data[0];
+  if (sub_output_index != node->inputs->data[0]) return kTfLiteOk;
+  int input_index = -1;
+  for (int i = 0; i < mul.node.inputs->size; ++i) {
+    if (graph_rewrite::GetEvalTensor(context, mul.node.inputs->data[i]) ==
+        input) {
+      input_index = mul.node.inputs->data[i];
+    }
+  }
+  if (input_index < 0 || input->type != kTfLiteInt8) return kTfLiteOk;
+  TfLiteEvalTensor* output =
+      graph_rewrite::GetEvalTensor(context, sub_output_index);
+  if (tflite::micro::GetTensorShape(input).FlatSize() !=
+      tflite::micro::GetTensorShape(output).FlatSize()) {
+    return kTfLiteOk;
+  }
+
+  const int channels = tflite::micro::GetTensorShape(input).Dims(
+      tflite::micro::GetTensorShape(input).DimensionsCount() - 1);
+  const int mul_constant = OtherInput(mul.node, input_index);
+  const int sub_constant = OtherInput(sub.node, mul_output_index);
+  if (mul_constant < 0 || sub_constant < 0 ||
+      !IsChannelConstant(context, mul_constant, channels) ||
+      !IsChannelConstant(context, sub_constant, channels)) {
+    return kTfLiteOk;
+  }
+
+  // Skipping MUL is only safe if SUB is the sole reader of its output.
+  const int num_nodes = graph_rewrite::GetNumNodes(context);
+  if (num_nodes < 0) return kTfLiteOk;
+  for (int i = 0; i < num_nodes; ++i) {
+    if (i == conv_index - 1) continue;
+    const TfLiteIntArray* inputs = nodes[i].node.inputs;
+    for (int j = 0; j < inputs->size; ++j) {
+      if (inputs->data[j] == mul_output_index) return kTfLiteOk;
+    }
+  }
+
+  const int8_t* lut;
+  TF_LITE_ENSURE_STATUS(BuildLut(context, mul.node, sub.node, input_index,
+                                 mul_constant, sub_constant, channels, &lut));
+  if (lut == nullptr) return kTfLiteOk;
+
+  InputNormalization* normalization = static_cast<InputNormalization*>(
+      context->AllocatePersistentBuffer(context, sizeof(InputNormalization)));
+  TF_LITE_ENSURE(context, normalization != nullptr);
+  normalization->input = input;
+  normalization->output = output;
+  normalization->channels = channels;
+  normalization->lut = lut;
+
+  TF_LITE_ENSURE_STATUS(graph_rewrite::ReplaceInvoke(
+      context, conv_index - 2, SkippedInvoke, nullptr));
+  TF_LITE_ENSURE_STATUS(graph_rewrite::ReplaceInvoke(
+      context, conv_index - 1, SkippedInvoke, nullptr));
+  *result = normalization;
+  return kTfLiteOk;
+}
+
+const int8_t* NormalizedInput(const InputNormalization& normalization,
+                              const TfLiteEvalTensor* conv_output,
+                              const int8_t** lut) {
+  const int channels = normalization.channels;
+  const int size =
+      tflite::micro::GetTensorShape(normalization.input).FlatSize();
+  const int8_t* input =
+      tflite::micro::GetTensorData<int8_t>(normalization.input);
+  const int8_t* conv_data = tflite::micro::GetTensorData<int8_t>(conv_output);
+  const int conv_size = tflite::micro::GetTensorShape(conv_output).FlatSize();
+  if (conv_data + conv_size <= input || input + size <= conv_data) {
+    *lut = normalization.lut;
+    return input;
+  }
+
+  // The planner may also place the SUB output over the graph input, since
+  // the input is dead once MUL has run. Walk in the direction that never
+  // overwrites bytes still to be read.
+  const uint8_t* in = reinterpret_cast<const uint8_t*>(input);
+  int8_t* output = tflite::micro::GetTensorData<int8_t>(normalization.output);
+  const int8_t* table = normalization.lut;
+  if (reinterpret_cast<const void*>(output) <=
+      reinterpret_cast<const void*>(in)) {
+    for (int i = 0; i < size; i += channels) {
+      for (int c = 0; c < channels; ++c) {
+        output[i + c] = table[in[i + c] * channels + c];
+      }
+    }
+  } else {
+    for (int i = size - channels; i >= 0; i -= channels) {
+      for (int c = channels - 1; c >= 0; --c) {
+        output[i + c] = table[in[i + c] * channels + c];
+      }
+    }
+  }
+  *lut = nullptr;
+  return output;
+}
+
+}  // namespace tflite
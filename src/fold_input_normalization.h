@@ -0,0 +1,39 @@
+#pragma once
+#include <cstdint>
+
+#include "tensorflow/lite/c/common.h"
+
+namespace tflite {
+
+// Init-time graph transformation for the mnv2 preprocessing. When the graph
+// starts with  input -> MUL(const) -> SUB(const) -> `node`,  both ops are
+// folded into one per-channel byte lookup table, which the first convolution
+// applies as it gathers each input patch. The MUL and SUB slots do nothing,
+// so their outputs are never written. The table is built in Prepare from the
+// ops' quantization parameters, with the integer arithmetic of their int8
+// kernels, for all 256 input values, so the result is bit-exact.
+struct InputNormalization {
+  // The graph input, and the SUB output that the conv would have read.
+  TfLiteEvalTensor* input;
+  TfLiteEvalTensor* output;
+  int channels;
+
+  // Indexed by (uint8_t)value * channels + channel.
+  const int8_t* lut;
+};
+
+// If the graph has that shape, sets *result to the folded state and takes
+// over the MUL and SUB slots. Otherwise sets *result to nullptr and leaves the
+// graph alone. Call from the Prepare of the first convolution.
+TfLiteStatus FoldInputNormalization(TfLiteContext* context, TfLiteNode* node,
+                                    InputNormalization** result);
+
+// For the conv's Eval: the data to gather its input from, with *lut set to
+// the table to read it through. That is the graph input, unless the planner
+// has put the conv output over it. Then the graph input is first normalized
+// into the SUB output in one pass, which is returned with *lut = nullptr.
+const int8_t* NormalizedInput(const InputNormalization& normalization,
+                              const TfLiteEvalTensor* conv_output,
+                              const int8_t** lut);
+
+}  // namespace tflite
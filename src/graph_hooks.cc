@@ -0,0 +1,53 @@
+#include "graph_hooks.h"
+
+#include "capture_hook.h"
+#include "graph_rewrite.h"
+
+namespace tflite {
+namespace {
+
+// Prepare of the wrapped kernel.
+TfLiteStatus (*kernel_prepare)(TfLiteContext* context, TfLiteNode* node);
+
+NodeAndRegistration* hooked_nodes;
+int hooked_num_nodes;
+
+// True if no later node has the same op as node `index`.
+bool IsLastOfItsOp(TfLiteContext* context, int index) {
+  const NodeAndRegistration* nodes = graph_rewrite::GetNodes(context);
+  const int num_nodes = graph_rewrite::GetNumNodes(context);
+  if (num_nodes < 0) return false;
+  const int32_t builtin_code = nodes[index].registration->builtin_code;
+  for (int i = index + 1; i < num_nodes; ++i) {
+    if (nodes[i].registration->builtin_code == builtin_code) return false;
+  }
+  return true;
+}
+
+TfLiteStatus HookedPrepare(TfLiteContext* context, TfLiteNode* node) {
+  TF_LITE_ENSURE_STATUS(kernel_prepare(context, node));
+  if (!IsLastOfItsOp(context, graph_rewrite::GetNodeIndex(context, node))) {
+    return kTfLiteOk;
+  }
+  hooked_nodes = graph_rewrite::GetNodes(context);
+  hooked_num_nodes = graph_rewrite::GetNumNodes(context);
+#ifdef DATA_CAPTURE
+  TF_LITE_ENSURE_STATUS(data_capture::InstallCaptureHook(context));
+#endif
+  return kTfLiteOk;
+}
+
+}  // namespace
+
+TfLiteRegistration WithGraphHooks(TfLiteRegistration registration) {
+  kernel_prepare = registration.prepare;
+  registration.prepare = HookedPrepare;
+  return registration;
+}
+
+NodeAndRegistration* HookedNodes(int* num_nodes) {
+  *num_nodes = hooked_num_nodes;
+  return hooked_nodes;
+}
+
+}  // namespace tflite
@@ -0,0 +1,25 @@
+#pragma once
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/micro/micro_allocator.h"
+
+// Instrumentation that wraps op invokes (the capture hook, see
+// capture_hook.h) has to go in after the graph rewrites that kernel Prepares
+// make, and the micro interpreter has no hook for that. So it rides on one
+// kernel's registration instead of living in the kernel: the Prepare of the
+// registration that WithGraphHooks returns runs the kernel's own, then puts
+// the instrumentation in once it has been called for the last node of that
+// op in the graph. It also notes the graph's node list there, for
+// instrumentation that goes in later, between inferences (the inference
+// timer, see inference_timer.h).
+
+namespace tflite {
+
+// For the Register_ function of one kernel, e.g. CONV_2D, whose Prepares make
+// the rewrites. Only one kernel may be wrapped.
+TfLiteRegistration WithGraphHooks(TfLiteRegistration registration);
+
+// The node list of the graph last prepared, with its length in *num_nodes,
+// or nullptr if there is none. Valid until the next model load.
+NodeAndRegistration* HookedNodes(int* num_nodes);
+
+}  // namespace tflite
@@ -0,0 +1,127 @@
+#include "graph_rewrite.h"
+
+#include "tensorflow/lite/micro/micro_context.h"
+#include "tensorflow/lite/micro/micro_graph.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+namespace tflite {
+namespace graph_rewrite {
+namespace {
+
+// MicroGraph keeps the model it runs, but has no accessor for it. Access
+// checks do not apply to the arguments of an explicit instantiation, so
+// instantiating PrivateMember with &MicroGraph::model_ defines Get(GraphModel)
+// to return that pointer to member.
+template <typename Tag, typename Tag::Type kMember>
+struct PrivateMember {
+  friend typename Tag::Type Get(Tag) { return kMember; }
+};
+
+struct GraphModel {
+  using Type = const Model* MicroGraph::*;
+  friend Type Get(GraphModel);
+};
+
+template struct PrivateMember<GraphModel, &MicroGraph::model_>;
+
+MicroGraph& GetGraph(TfLiteContext* context) {
+  return GetMicroContext(context)->graph();
+}
+
+SubgraphAllocations& GetAllocations(TfLiteContext* context) {
+  MicroGraph& graph = GetGraph(context);
+  return graph.GetAllocations()[graph.GetCurrentSubgraphIndex()];
+}
+
+}  // namespace
+
+NodeAndRegistration* GetNodes(TfLiteContext* context) {
+  return GetAllocations(context).node_and_registrations;
+}
+
+int GetNodeIndex(TfLiteContext* context, const TfLiteNode* node) {
+  // The node is the first member of its NodeAndRegistration entry.
+  return static_cast<int>(reinterpret_cast<const NodeAndRegistration*>(node) -
+                          GetNodes(context));
+}
+
+int GetNumNodes(TfLiteContext* context) {
+  // The interpreter does not keep the length of its operator list, and there
+  // is nothing after the last entry to stop a walk, so read it from the
+  // model the graph runs.
+  MicroGraph& graph = GetGraph(context);
+  const Model* model = graph.*Get(GraphModel());
+  const auto* subgraphs = model == nullptr ? nullptr : model->subgraphs();
+  const int subgraph = graph.GetCurrentSubgraphIndex();
+  if (subgraphs == nullptr || subgraph >= static_cast<int>(subgraphs->size())) {
+    return -1;
+  }
+  const auto* operators = subgraphs->Get(subgraph)->operators();
+  return operators == nullptr ? -1 : static_cast<int>(operators->size());
+}
+
+TfLiteEvalTensor* GetEvalTensor(TfLiteContext* context, int tensor_index) {
+  return &GetAllocations(context).tensors[tensor_index];
+}
+
+TfLiteEvalTensor* GetGraphInput(TfLiteContext* context, int index) {
+  MicroGraph& graph = GetGraph(context);
+  return graph.GetSubgraphInput(graph.GetCurrentSubgraphIndex(), index);
+}
+
+TfLiteEvalTensor* GetGraphOutput(TfLiteContext* context, int index) {
+  MicroGraph& graph = GetGraph(context);
+  return graph.GetSubgraphOutput(graph.GetCurrentSubgraphIndex(), index);
+}
+
+TfLiteStatus ReplaceInvoke(TfLiteContext* context, int index, InvokeFn invoke,
+                           void* user_data) {
+  TFLITE_DCHECK(context->AllocatePersistentBuffer != nullptr);
+  Replacement* replacement = static_cast<Replacement*>(
+      context->AllocatePersistentBuffer(context, sizeof(Replacement)));
+  TF_LITE_ENSURE(context, replacement != nullptr);
+
+  ReplaceInvokeWith(&GetNodes(context)[index], replacement, invoke, user_data);
+  return kTfLiteOk;
+}
+
+void ReplaceInvokeWith(NodeAndRegistration* entry, Replacement* replacement,
+                       InvokeFn invoke, void* user_data) {
+  replacement->registration = *entry->registration;
+  replacement->registration.invoke = invoke;
+  replacement->original = entry->registration;
+  replacement->user_data = user_data;
+  entry->registration = &replacement->registration;
+}
+
+void RestoreInvoke(NodeAndRegistration* entry) {
+  entry->registration =
+      reinterpret_cast<const Replacement*>(entry->registration)->original;
+}
+
+const TfLiteRegistration* GetOriginalRegistration(TfLiteContext* context,
+                                                  const TfLiteNode* node) {
+  const NodeAndRegistration* entry =
+      reinterpret_cast<const NodeAndRegistration*>(node);
+  return reinterpret_cast<const Replacement*>(entry->registration)->original;
+}
+
+void* GetReplacementData(TfLiteContext* context, const TfLiteNode* node) {
+  const NodeAndRegistration* entry =
+      reinterpret_cast<const NodeAndRegistration*>(node);
+  return reinterpret_cast<const Replacement*>(entry->registration)->user_data;
+}
+
+TfLiteStatus InvokeOriginal(TfLiteContext* context, TfLiteNode* node) {
+  NodeAndRegistration* entry = reinterpret_cast<NodeAndRegistration*>(node);
+  const TfLiteRegistration* replacement = entry->registration;
+  // Step the entry down a level for the call, as GetReplacementData looks
+  // at whatever the entry points to.
+  entry->registration = GetOriginalRegistration(context, node);
+  const TfLiteStatus status = entry->registration->invoke(context, node);
+  entry->registration = replacement;
+  return status;
+}
+
+}  // namespace graph_rewrite
+}  // namespace tflite
@@ -0,0 +1,63 @@
+#pragma once
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/micro/micro_allocator.h"
+
+// Helpers for looking at and rewriting the interpreter's node list from
+// inside a kernel. They act on the subgraph currently being prepared or
+// invoked; for mnv2 that is the only one.
+
+namespace tflite {
+namespace graph_rewrite {
+
+using InvokeFn = TfLiteStatus (*)(TfLiteContext* context, TfLiteNode* node);
+
+NodeAndRegistration* GetNodes(TfLiteContext* context);
+
+// Position of `node` in the operator list.
+int GetNodeIndex(TfLiteContext* context, const TfLiteNode* node);
+
+// Number of operators, read from the model the interpreter's graph runs.
+// Returns -1 if the model has no operator list for the subgraph, in which
+// case callers leave the graph alone.
+int GetNumNodes(TfLiteContext* context);
+
+TfLiteEvalTensor* GetEvalTensor(TfLiteContext* context, int tensor_index);
+TfLiteEvalTensor* GetGraphInput(TfLiteContext* context, int index);
+TfLiteEvalTensor* GetGraphOutput(TfLiteContext* context, int index);
+
+// Replaces the invoke function of node `index` and keeps every other
+// registration field, so the profiler still tags the node with its original
+// op. Replacements stack. Allocates, so only call it from Init or Prepare.
+TfLiteStatus ReplaceInvoke(TfLiteContext* context, int index, InvokeFn invoke,
+                           void* user_data);
+
+// A replacement registration. The node's registration pointer points at
+// `registration`, which must stay first.
+struct Replacement {
+  TfLiteRegistration registration;
+  const TfLiteRegistration* original;
+  void* user_data;
+};
+
+// Like ReplaceInvoke, but into `replacement`, which the caller owns, on an
+// entry it found earlier, so it does not allocate and may be used between
+// inferences. Undo with RestoreInvoke, latest first.
+void ReplaceInvokeWith(NodeAndRegistration* entry, Replacement* replacement,
+                       InvokeFn invoke, void* user_data);
+
+// Puts back the registration that the latest replacement of `entry` replaced.
+void RestoreInvoke(NodeAndRegistration* entry);
+
+// For a node passed to a replacement invoke: the registration it had before
+// ReplaceInvoke, and the user_data given to ReplaceInvoke.
+const TfLiteRegistration* GetOriginalRegistration(TfLiteContext* context,
+                                                  const TfLiteNode* node);
+void* GetReplacementData(TfLiteContext* context, const TfLiteNode* node);
+
+// For a node passed to a replacement invoke: runs the invoke it replaced.
+// Use this rather than calling GetOriginalRegistration()->invoke, so that a
+// replacement underneath sees its own user_data.
+TfLiteStatus InvokeOriginal(TfLiteContext* context, TfLiteNode* node);
+
+}  // namespace graph_rewrite
+}  // namespace tflite
@@ -0,0 +1,58 @@
+#include "inference_timer.h"
+
+#include "graph_hooks.h"
+#include "graph_rewrite.h"
+#include "perf.h"
+
+namespace tflite {
+namespace {
+
+uint32_t start_cycle;
+uint32_t last_cycles;
+
+// The wrapped entries, while the timer runs.
+NodeAndRegistration* first_op;
+NodeAndRegistration* last_op;
+graph_rewrite::Replacement start_replacement;
+graph_rewrite::Replacement stop_replacement;
+
+TfLiteStatus StartInvoke(TfLiteContext* context, TfLiteNode* node) {
+  start_cycle = perf_get_mcycle();
+  return graph_rewrite::InvokeOriginal(context, node);
+}
+
+TfLiteStatus StopInvoke(TfLiteContext* context, TfLiteNode* node) {
+  const TfLiteStatus status = graph_rewrite::InvokeOriginal(context, node);
+  last_cycles = perf_get_mcycle() - start_cycle;
+  return status;
+}
+
+}  // namespace
+
+bool StartInferenceTimer() {
+  if (first_op != nullptr) return true;
+  int num_nodes;
+  NodeAndRegistration* nodes = HookedNodes(&num_nodes);
+  if (nodes == nullptr || num_nodes <= 0) return false;
+  last_cycles = 0;
+  first_op = &nodes[0];
+  last_op = &nodes[num_nodes - 1];
+  // If one op is both, the stop wraps the start.
+  graph_rewrite::ReplaceInvokeWith(first_op, &start_replacement, StartInvoke,
+                                   nullptr);
+  graph_rewrite::ReplaceInvokeWith(last_op, &stop_replacement, StopInvoke,
+                                   nullptr);
+  return true;
+}
+
+void StopInferenceTimer() {
+  if (first_op == nullptr) return;
+  graph_rewrite::RestoreInvoke(last_op);
+  graph_rewrite::RestoreInvoke(first_op);
+  first_op = nullptr;
+  last_op = nullptr;
+}
+
+uint32_t LastInferenceCycles() { return last_cycles; }
+
+}  // namespace tflite
@@ -0,0 +1,27 @@
+#pragma once
+#include <cstdint>
+
+// Cycles of one inference alone: from the start of the graph's first op to
+// the end of its last. Timing a call to tflite_classify would also count the
+// profiler's per-op table and the counters it prints over the UART
+// afterwards.
+//
+// The timer wraps the first and last ops' invokes only while it runs, so the
+// ops' ticks and every other use of the graph are as without it. Anything
+// else that wraps those ops is counted too.
+
+namespace tflite {
+
+// Wraps the first and last ops of the graph last prepared (see
+// graph_hooks.h). Returns false if there is none. Call between inferences,
+// e.g. just after loading the model.
+bool StartInferenceTimer();
+
+// Unwraps them again.
+void StopInferenceTimer();
+
+// Cycles of the last inference to finish, or 0 if none has since the timer
+// started.
+uint32_t LastInferenceCycles();
+
+}  // namespace tflite
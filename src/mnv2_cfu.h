@@ -0,0 +1,19 @@
+#pragma once
+#include "cfu.h"
+
+// CFU ops implemented by cfu.v (and modelled in software_cfu.cc):
+//
+//   funct3 0/1  pass rs1 / rs2 through (template op, used by the op0 tests)
+//   funct3 2    four-way int8 MAC:
+//                 acc = (funct7 & 1 ? 0 : acc)
+//                       + sum_i (rs1.byte[i] + input_offset) * rs2.byte[i]
+//               and return acc
+//   funct3 3    control: funct7 0 sets input_offset = rs1, 1 sets acc = rs1,
+//               2 returns acc, 3 returns input_offset
+
+#define CFU_MAC4(input, filter) cfu_op2(0, (input), (filter))
+#define CFU_MAC4_FIRST(input, filter) cfu_op2(1, (input), (filter))
+#define CFU_SET_INPUT_OFFSET(offset) cfu_op3(0, (offset), 0)
+#define CFU_SET_ACC(value) cfu_op3(1, (value), 0)
+#define CFU_GET_ACC() cfu_op3(2, 0, 0)
+#define CFU_GET_INPUT_OFFSET() cfu_op3(3, 0, 0)
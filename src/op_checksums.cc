@@ -0,0 +1,61 @@
+#include "op_checksums.h"
+
+#ifdef DATA_CAPTURE
+
+#include <cstdio>
+
+#include "capture_hook.h"
+#include "graph_rewrite.h"
+#include "tensorflow/lite/micro/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/memory_helpers.h"
+
+namespace data_capture {
+namespace {
+
+// Ops beyond this are not checksummed.
+constexpr int kMaxNodes = 128;
+
+bool enabled = false;
+uint32_t checksums[kMaxNodes];
+// Ops hashed since the last reset, one bit each.
+uint32_t hashed[kMaxNodes / 32];
+
+}  // namespace
+
+TfLiteStatus ChecksumOutputs(TfLiteContext* context, TfLiteNode* node,
+                             int index) {
+  if (!enabled || index >= kMaxNodes) return kTfLiteOk;
+  uint32_t hash = kOpChecksumSeed;
+  for (int i = 0; i < node->outputs->size; ++i) {
+    const TfLiteEvalTensor* output = tflite::graph_rewrite::GetEvalTensor(
+        context, node->outputs->data[i]);
+    size_t type_size;
+    TF_LITE_ENSURE_STATUS(tflite::TfLiteTypeSizeOf(output->type, &type_size));
+    hash = OpChecksum(
+        hash, output->data.data,
+        tflite::micro::GetTensorShape(output).FlatSize() * type_size);
+  }
+  checksums[index] = hash;
+  hashed[index / 32] |= 1u << (index % 32);
+  return kTfLiteOk;
+}
+
+void ResetOpChecksums() {
+  for (uint32_t& word : hashed) word = 0;
+}
+
+bool& op_checksums_enabled() { return enabled; }
+
+void PrintOpChecksums() {
+  puts("\"Event\",\"Tag\",\"Checksum\"");
+  for (int i = 0; i < NumOps() && i < kMaxNodes; ++i) {
+    if (hashed[i / 32] & (1u << (i % 32))) {
+      printf("%d,%s,0x%08lx\n", i, OpTag(i),
+             static_cast<unsigned long>(checksums[i]));
+    }
+  }
+}
+
+}  // namespace data_capture
+
+#endif  // DATA_CAPTURE
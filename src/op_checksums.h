@@ -0,0 +1,66 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+#include "tensorflow/lite/c/common.h"
+
+// A 32-bit checksum of every op's output, for finding the first op that
+// diverged after a kernel or CFU change without dumping whole tensors.
+//
+// The capture hook (see capture_hook.h) hashes each op's outputs into a
+// table once the op has run, and FinishInference prints the table after the
+// interpreter returns, in the layout of the profiler's tick table, one line
+// per op:
+//
+//   "Event","Tag","Checksum"
+//   0,MUL,0x1c9a07e3
+//
+// and tools/checksum_diff compares the tables of two logs.
+//
+// Checksums are a capture mode, off until turned on from the capture menu.
+// The hashing then runs inside each op's profiler scope, but as part of the
+// capture hook's own ticks, which are reported apart from the op's (see
+// capture_hook.h).
+//
+// With FOLD_INPUT_NORMALIZATION or FUSE_RESIDUAL_ADD, some intermediate
+// outputs are never written (the MUL output, and the projection conv output
+// before a folded ADD), so compare such runs only with runs built the same
+// way.
+
+namespace data_capture {
+
+// For the capture hook: hashes the outputs of op `index`, which has just
+// run, into the table.
+TfLiteStatus ChecksumOutputs(TfLiteContext* context, TfLiteNode* node,
+                             int index);
+
+// Empties the table.
+void ResetOpChecksums();
+
+// Whether the capture hook hashes outputs and prints the table. Off by
+// default.
+bool& op_checksums_enabled();
+
+// Prints the checksums from the last inference. FinishInference calls this;
+// the capture menu can print it again.
+void PrintOpChecksums();
+
+// FNV-1a over 32-bit words, then over any bytes left at the end.
+inline uint32_t OpChecksum(uint32_t hash, const void* data, size_t size) {
+  const uint8_t* bytes = static_cast<const uint8_t*>(data);
+  size_t i = 0;
+  if ((reinterpret_cast<uintptr_t>(bytes) & 3) == 0) {
+    const uint32_t* words = reinterpret_cast<const uint32_t*>(bytes);
+    for (; i + 4 <= size; i += 4) {
+      hash = (hash ^ *words++) * 16777619u;
+    }
+  }
+  for (; i < size; ++i) {
+    hash = (hash ^ bytes[i]) * 16777619u;
+  }
+  return hash;
+}
+
+constexpr uint32_t kOpChecksumSeed = 2166136261u;
+
+}  // namespace data_capture
@@ -18,8 +18,23 @@
 
 #include <stdio.h>
 
+#include <algorithm>
+
+#include "bn5_bench.h"
+#include "bn5_data.h"
+#include "capture_hook.h"
+#include "capture_registry.h"
 #include "cfu.h"
+#include "cfu_bench.h"
+#include "cfu_fuzz.h"
+#include "data_capture.h"
 #include "menu.h"
+#include "op_checksums.h"
+#include "perf.h"
+#include "replay_inputs.h"
+#include "tensor_stats.h"
+#include "tensorflow/lite/builtin_ops.h"
+#include "tensorflow/lite/kernels/internal/reference/integer_ops/fused_bottleneck.h"
 
 namespace {
 
@@ -45,35 +60,358 @@ void do_grid_cfu_op0(void) {
   }
 }
 
-// Test template instruction
-void do_exercise_cfu_op0(void) {
-  puts("\nExercise CFU Op0\n");
-  int count = 0;
-  for (int a = -0x71234567; a < 0x68000000; a += 0x10012345) {
-    for (int b = -0x7edcba98; b < 0x68000000; b += 0x10770077) {
-      int cfu = cfu_op0(0, a, b);
-      printf("a: %08x b:%08x cfu=%08x\n", a, b, cfu);
-      if (cfu != a) {
-        printf("\n***FAIL\n");
-        return;
+// CFU op benchmark (see cfu_bench.h)
+
+void do_benchmark_all_cfu_ops(void) { RunCfuBenchmark(-1); }
+void do_benchmark_cfu_op0(void) { RunCfuBenchmark(0); }
+void do_benchmark_cfu_op1(void) { RunCfuBenchmark(1); }
+void do_benchmark_cfu_mac4(void) { RunCfuBenchmark(2); }
+void do_benchmark_cfu_set_acc(void) { RunCfuBenchmark(3); }
+void do_benchmark_cfu_mac4_first(void) { RunCfuBenchmark(4); }
+void do_benchmark_cfu_set_input_offset(void) { RunCfuBenchmark(5); }
+void do_benchmark_cfu_get_acc(void) { RunCfuBenchmark(6); }
+void do_benchmark_cfu_get_input_offset(void) { RunCfuBenchmark(7); }
+
+struct Menu CFU_BENCH_MENU = {
+    "CFU Benchmark Menu",
+    "cfu",
+    {
+        MENU_ITEM('0', "op0, pass rs1", do_benchmark_cfu_op0),
+        MENU_ITEM('1', "op1, pass rs2", do_benchmark_cfu_op1),
+        MENU_ITEM('2', "mac4", do_benchmark_cfu_mac4),
+        MENU_ITEM('3', "set acc", do_benchmark_cfu_set_acc),
+        MENU_ITEM('4', "mac4 first", do_benchmark_cfu_mac4_first),
+        MENU_ITEM('5', "set input offset", do_benchmark_cfu_set_input_offset),
+        MENU_ITEM('6', "get acc", do_benchmark_cfu_get_acc),
+        MENU_ITEM('7', "get input offset", do_benchmark_cfu_get_input_offset),
+        MENU_ITEM('a', "all ops", do_benchmark_all_cfu_ops),
+        MENU_END,
+    },
+};
+
+void do_cfu_bench_menu(void) { menu_run(&CFU_BENCH_MENU); }
+
+// CFU fuzzer (see cfu_fuzz.h)
+
+uint32_t cfu_fuzz_seed = 1;
+uint32_t cfu_fuzz_ops = 1u << 20;
+
+void do_print_cfu_fuzz_settings(void) {
+  printf("cfu fuzzer: seed %lu, %lu ops\n",
+         static_cast<unsigned long>(cfu_fuzz_seed),
+         static_cast<unsigned long>(cfu_fuzz_ops));
+}
+
+void do_more_cfu_fuzz_ops(void) {
+  cfu_fuzz_ops = std::min(cfu_fuzz_ops * 4, uint32_t{1} << 28);
+  do_print_cfu_fuzz_settings();
+}
+
+void do_fewer_cfu_fuzz_ops(void) {
+  cfu_fuzz_ops = std::max(cfu_fuzz_ops / 4, uint32_t{1} << 12);
+  do_print_cfu_fuzz_settings();
+}
+
+void do_next_cfu_fuzz_seed(void) {
+  ++cfu_fuzz_seed;
+  do_print_cfu_fuzz_settings();
+}
+
+void do_run_cfu_fuzz(void) { RunCfuFuzzer(cfu_fuzz_seed, cfu_fuzz_ops); }
+
+struct Menu CFU_FUZZ_MENU = {
+    "CFU Fuzzer Menu",
+    "fuzz",
+    {
+        MENU_ITEM('+', "more ops", do_more_cfu_fuzz_ops),
+        MENU_ITEM('-', "fewer ops", do_fewer_cfu_fuzz_ops),
+        MENU_ITEM('p', "print settings", do_print_cfu_fuzz_settings),
+        MENU_ITEM('r', "run", do_run_cfu_fuzz),
+        MENU_ITEM('s', "next seed", do_next_cfu_fuzz_seed),
+        MENU_END,
+    },
+};
+
+void do_cfu_fuzz_menu(void) { menu_run(&CFU_FUZZ_MENU); }
+
+// Runs bottleneck 5 (ops 15-17) through the fused expand/depthwise/project
+// executor on the captured input and checks it against the captured output.
+void do_fused_bn5(void) {
+  using tflite::reference_integer_ops::BottleneckStage;
+  puts("\nFused bottleneck 5 (expand -> depthwise -> project)\n");
+
+  const tflite::RuntimeShape input_shape({1, 20, 20, 16});
+  const tflite::RuntimeShape dw_filter_shape({1, 3, 3, 96});
+  const tflite::RuntimeShape output_shape({1, 20, 20, 16});
+
+  tflite::ConvParams ex_params = {};
+  ex_params.input_offset = -bn5_ex_input_offset;
+  ex_params.output_offset = bn5_ex_output_offset;
+  ex_params.quantized_activation_min = bn5_relu6_min;
+  ex_params.quantized_activation_max = bn5_relu6_max;
+
+  tflite::DepthwiseParams dw_params = {};
+  dw_params.stride_width = 1;
+  dw_params.stride_height = 1;
+  dw_params.padding_values.width = 1;
+  dw_params.padding_values.height = 1;
+  dw_params.dilation_width_factor = 1;
+  dw_params.dilation_height_factor = 1;
+  dw_params.depth_multiplier = 1;
+  dw_params.input_offset = -bn5_dw_input_offset;
+  dw_params.output_offset = bn5_dw_output_offset;
+  dw_params.quantized_activation_min = bn5_relu6_min;
+  dw_params.quantized_activation_max = bn5_relu6_max;
+
+  tflite::ConvParams pr_params = {};
+  pr_params.input_offset = -bn5_pr_input_offset;
+  pr_params.output_offset = bn5_pr_output_offset;
+  pr_params.quantized_activation_min = -128;
+  pr_params.quantized_activation_max = 127;
+
+  const BottleneckStage ex = {bn5_ex_filter, bn5_ex_bias,
+                              bn5_ex_output_multiplier, bn5_ex_output_shift};
+  const BottleneckStage dw = {bn5_dw_filter, bn5_dw_bias,
+                              bn5_dw_output_multiplier, bn5_dw_output_shift};
+  const BottleneckStage pr = {bn5_pr_filter, bn5_pr_bias,
+                              bn5_pr_output_multiplier, bn5_pr_output_shift};
+
+  static int8_t scratch[(3 * 20 + 1) * 96];
+  static int8_t output[20 * 20 * 16];
+  const int scratch_size = tflite::reference_integer_ops::
+      FusedBottleneckScratchSize(input_shape, dw_filter_shape);
+  if (scratch_size > static_cast<int>(sizeof(scratch))) {
+    printf("scratch too small: need %d bytes\n", scratch_size);
+    return;
+  }
+
+  unsigned start = perf_get_mcycle();
+  tflite::reference_integer_ops::FusedBottleneckPerChannel(
+      ex_params, ex, dw_params, dw, dw_filter_shape, pr_params, pr,
+      input_shape, bn5_ex_ifmap, output_shape, output, scratch);
+  unsigned cycles = perf_get_mcycle() - start;
+
+  int mismatches = 0;
+  for (int i = 0; i < output_shape.FlatSize(); i++) {
+    if (output[i] != bn5_final_output[i]) {
+      if (mismatches == 0) {
+        printf("first mismatch at %d: got %d, expected %d\n", i, output[i],
+               bn5_final_output[i]);
       }
-      count++;
+      mismatches++;
     }
   }
-  printf("Performed %d comparisons", count);
+
+  const int intermediate_bytes = 2 * 20 * 20 * 96;
+  printf("intermediates: %d bytes unfused, %d bytes fused (%d saved)\n",
+         intermediate_bytes, scratch_size, intermediate_bytes - scratch_size);
+  printf("cycles: %u\n", cycles);
+  printf("%s: %d mismatches against bn5_final_output\n",
+         mismatches ? "FAIL" : "OK", mismatches);
 }
 
+// bn5 microbenchmark (see bn5_bench.h)
+
+int bn5_kernel = 0;
+// Odd, so that the median is one of the runs.
+int bn5_runs = 7;
+
+void do_print_bn5_settings(void) {
+  printf("bn5: %s kernels, %d runs\n", Bn5KernelName(bn5_kernel), bn5_runs);
+}
+
+void do_next_bn5_kernel(void) {
+  bn5_kernel = (bn5_kernel + 1) % NumBn5Kernels();
+  do_print_bn5_settings();
+}
+
+void do_more_bn5_runs(void) {
+  bn5_runs = std::min(2 * bn5_runs + 1, kMaxBn5Runs);
+  do_print_bn5_settings();
+}
+
+void do_fewer_bn5_runs(void) {
+  bn5_runs = std::max((bn5_runs - 1) / 2, 1);
+  do_print_bn5_settings();
+}
+
+void do_run_bn5(void) { RunBn5Benchmark(bn5_kernel, bn5_runs); }
+
+struct Menu BN5_MENU = {
+    "bn5 Microbenchmark Menu",
+    "bn5",
+    {
+        MENU_ITEM('+', "more runs", do_more_bn5_runs),
+        MENU_ITEM('-', "fewer runs", do_fewer_bn5_runs),
+        MENU_ITEM('k', "next kernel", do_next_bn5_kernel),
+        MENU_ITEM('p', "print settings", do_print_bn5_settings),
+        MENU_ITEM('r', "run", do_run_bn5),
+        MENU_END,
+    },
+};
+
+void do_bn5_menu(void) { menu_run(&BN5_MENU); }
+
+void do_replay_inputs(void) {
+  puts("\nReplay input set\n");
+  RunReplayBenchmark();
+}
+
+#ifdef DATA_CAPTURE
+// Capture selection (see capture_registry.h)
+
+// Op types in mnv2, in graph order, for selecting by op type.
+const int kCaptureOpTypes[] = {
+    kTfLiteBuiltinMul,           kTfLiteBuiltinSub,
+    kTfLiteBuiltinConv2d,        kTfLiteBuiltinDepthwiseConv2d,
+    kTfLiteBuiltinAdd,           kTfLiteBuiltinAveragePool2d,
+    kTfLiteBuiltinReshape,       kTfLiteBuiltinFullyConnected,
+    kTfLiteBuiltinSoftmax};
+constexpr int kNumCaptureOpTypes =
+    sizeof(kCaptureOpTypes) / sizeof(kCaptureOpTypes[0]);
+
+void do_print_capture_selection(void) {
+  const data_capture::Selection& selection = data_capture::selection();
+  switch (selection.by) {
+    case data_capture::kSelectOpIndex:
+      printf("capture: op %d\n", selection.value);
+      break;
+    case data_capture::kSelectOpType:
+      printf("capture: every %s\n",
+             data_capture::OpTypeName(selection.value));
+      break;
+    case data_capture::kSelectBottleneck:
+      printf("capture: bottleneck %d\n", selection.value);
+      break;
+    default:
+      puts("capture: off");
+      break;
+  }
+}
+
+void do_cycle_capture_mode(void) {
+  data_capture::Selection& selection = data_capture::selection();
+  switch (selection.by) {
+    case data_capture::kSelectNone:
+      selection = {data_capture::kSelectOpIndex, 0};
+      break;
+    case data_capture::kSelectOpIndex:
+      selection = {data_capture::kSelectOpType, kCaptureOpTypes[0]};
+      break;
+    case data_capture::kSelectOpType:
+      selection = {data_capture::kSelectBottleneck, 1};
+      break;
+    default:
+      selection = {data_capture::kSelectNone, 0};
+      break;
+  }
+  do_print_capture_selection();
+}
+
+void step_capture_selection(int step) {
+  data_capture::Selection& selection = data_capture::selection();
+  if (selection.by == data_capture::kSelectOpType) {
+    int i = 0;
+    while (i < kNumCaptureOpTypes && kCaptureOpTypes[i] != selection.value) {
+      i++;
+    }
+    i = (i + step + kNumCaptureOpTypes) % kNumCaptureOpTypes;
+    selection.value = kCaptureOpTypes[i];
+  } else if (selection.by != data_capture::kSelectNone) {
+    const int first = selection.by == data_capture::kSelectBottleneck ? 1 : 0;
+    selection.value = std::max(first, selection.value + step);
+  }
+  do_print_capture_selection();
+}
+
+void do_next_capture_selection(void) { step_capture_selection(1); }
+
+void do_previous_capture_selection(void) { step_capture_selection(-1); }
+
+void do_arm_capture(void) {
+  data_capture::Arm();
+  puts("capture armed for the next inference");
+}
+
+// Finishes the last inference, if the menus have not yet, and sends
+// anything else captured since the last flush, e.g. by an inference cut
+// short.
+void do_flush_capture(void) {
+  data_capture::FinishInference();
+  capture_flush();
+  puts("capture flushed");
+}
+
+void do_toggle_accumulators(void) {
+  bool& enabled = data_capture::accumulators_enabled();
+  enabled = !enabled;
+  printf("accumulator capture %s\n", enabled ? "on" : "off");
+}
+
+void do_print_op_checksums(void) { data_capture::PrintOpChecksums(); }
+
+void do_toggle_op_checksums(void) {
+  bool& enabled = data_capture::op_checksums_enabled();
+  enabled = !enabled;
+  printf("op checksums %s\n", enabled ? "on" : "off");
+}
+
+void do_toggle_tensor_stats(void) {
+  bool& enabled = data_capture::tensor_stats_enabled();
+  enabled = !enabled;
+  printf("tensor statistics %s\n", enabled ? "on" : "off");
+}
+
+struct Menu CAPTURE_MENU = {
+    "Capture Menu",
+    "capture",
+    {
+        MENU_ITEM('+', "next op / op type / bottleneck",
+                  do_next_capture_selection),
+        MENU_ITEM('-', "previous op / op type / bottleneck",
+                  do_previous_capture_selection),
+        MENU_ITEM('a', "arm for the next inference", do_arm_capture),
+        MENU_ITEM('c', "print op checksums", do_print_op_checksums),
+        MENU_ITEM('f', "flush capture", do_flush_capture),
+        MENU_ITEM('k', "op checksums on / off", do_toggle_op_checksums),
+        MENU_ITEM('m', "select by op / op type / bottleneck / off",
+                  do_cycle_capture_mode),
+        MENU_ITEM('p', "print selection", do_print_capture_selection),
+        MENU_ITEM('s', "tensor statistics on / off", do_toggle_tensor_stats),
+        MENU_ITEM('u', "accumulators on / off", do_toggle_accumulators),
+        MENU_END,
+    },
+};
+
+void do_capture_menu(void) {
+  data_capture::FinishInference();
+  menu_run(&CAPTURE_MENU);
+}
+#endif  // DATA_CAPTURE
+
 struct Menu MENU = {
     "Project Menu",
     "project",
     {
-        MENU_ITEM('0', "exercise cfu op0", do_exercise_cfu_op0),
+        MENU_ITEM('b', "bn5 microbenchmark", do_bn5_menu),
+#ifdef DATA_CAPTURE
+        MENU_ITEM('c', "capture menu", do_capture_menu),
+#endif
+        MENU_ITEM('f', "fused bottleneck 5", do_fused_bn5),
         MENU_ITEM('g', "grid cfu op0", do_grid_cfu_op0),
         MENU_ITEM('h', "say Hello", do_hello_world),
+        MENU_ITEM('r', "replay input set", do_replay_inputs),
+        MENU_ITEM('x', "cfu op benchmark", do_cfu_bench_menu),
+        MENU_ITEM('z', "cfu fuzzer", do_cfu_fuzz_menu),
         MENU_END,
     },
 };
 
 };  // anonymous namespace
 
-extern "C" void do_proj_menu() { menu_run(&MENU); }
+extern "C" void do_proj_menu() {
+  // Inferences run from the other menus, e.g. the golden tests, leave their
+  // capture for here.
+  data_capture::FinishInference();
+  menu_run(&MENU);
+}
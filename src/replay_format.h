@@ -0,0 +1,29 @@
+#pragma once
+#include <cstdint>
+
+// Layout of the blob of input images that the replay benchmark runs (see
+// replay_inputs.h), shared by the firmware and the host tool that packs it
+// (tools/replay_pack.cc). Only plain C++ here, so the host can build it.
+//
+// Every field is little-endian:
+//
+//   u32 magic   u32 version   u32 images   u32 image_bytes
+//   i8 data[images][image_bytes]
+//
+// Each image is the model input as it goes into the input tensor: int8,
+// NHWC, i.e. a uint8 pixel less 128 for mnv2.
+
+namespace replay_format {
+
+constexpr uint32_t kMagic = 0x594c5052;  // "RPLY"
+constexpr uint32_t kVersion = 1;
+constexpr int kHeaderBytes = 16;
+
+// The mnv2 input, 160x160x3.
+constexpr int kMnv2InputBytes = 160 * 160 * 3;
+
+inline uint32_t GetU32(const uint8_t* p) {
+  return p[0] | p[1] << 8 | p[2] << 16 | static_cast<uint32_t>(p[3]) << 24;
+}
+
+}  // namespace replay_format
@@ -0,0 +1,109 @@
+#include "replay_inputs.h"
+
+#include <cstdint>
+#include <cstdio>
+
+#include "capture_hook.h"
+#include "inference_timer.h"
+#include "models/mnv2/model_mobilenetv2_160_035.h"
+#include "replay_format.h"
+#include "tflite.h"
+
+// Defined by the generated replay_inputs_data.cc, if there is one.
+extern const uint8_t replay_blob[] __attribute__((weak));
+extern const uint32_t replay_blob_bytes __attribute__((weak));
+
+namespace {
+
+// Checks the blob and returns its image count, or 0 after saying why.
+uint32_t CheckBlob() {
+  if (&replay_blob_bytes == nullptr) {
+    puts("no replay inputs: generate src/replay_inputs_data.cc with "
+         "tools/replay_pack");
+    return 0;
+  }
+  using replay_format::GetU32;
+  if (replay_blob_bytes < replay_format::kHeaderBytes ||
+      GetU32(replay_blob) != replay_format::kMagic ||
+      GetU32(replay_blob + 4) != replay_format::kVersion) {
+    puts("replay inputs: not a replay blob of this version");
+    return 0;
+  }
+  const uint32_t images = GetU32(replay_blob + 8);
+  const uint32_t image_bytes = GetU32(replay_blob + 12);
+  if (image_bytes != replay_format::kMnv2InputBytes ||
+      replay_blob_bytes !=
+          replay_format::kHeaderBytes + images * image_bytes) {
+    printf("replay inputs: %lu images of %lu bytes do not fit mnv2\n",
+           static_cast<unsigned long>(images),
+           static_cast<unsigned long>(image_bytes));
+    return 0;
+  }
+  return images;
+}
+
+uint64_t SquareRoot(uint64_t value) {
+  uint64_t root = 0;
+  for (uint64_t bit = uint64_t{1} << 62; bit != 0; bit >>= 2) {
+    if (value >= root + bit) {
+      value -= root + bit;
+      root = (root >> 1) + bit;
+    } else {
+      root >>= 1;
+    }
+  }
+  return root;
+}
+
+}  // namespace
+
+void RunReplayBenchmark() {
+  const uint32_t images = CheckBlob();
+  if (images == 0) return;
+  tflite_load_model(model_mobilenetv2_160_035_tflite,
+                    model_mobilenetv2_160_035_tflite_len);
+  if (!tflite::StartInferenceTimer()) {
+    puts("replay: no graph to time");
+    return;
+  }
+
+  // Sums of differences from the first image's cycles, which keeps the sum
+  // of squares in range; the variance does not depend on the origin.
+  uint32_t origin = 0;
+  int64_t sum = 0;
+  int64_t sum_of_squares = 0;
+  for (uint32_t i = 0; i < images; ++i) {
+    tflite_set_input(replay_blob + replay_format::kHeaderBytes +
+                     i * replay_format::kMnv2InputBytes);
+    tflite_classify();
+    data_capture::FinishInference();
+    const uint32_t cycles = tflite::LastInferenceCycles();
+    if (cycles == 0) {
+      puts("replay: the inference timer did not run");
+      tflite::StopInferenceTimer();
+      return;
+    }
+    printf("replay image %lu: %lu cycles\n", static_cast<unsigned long>(i),
+           static_cast<unsigned long>(cycles));
+    if (i == 0) origin = cycles;
+    const int64_t difference = static_cast<int64_t>(cycles) - origin;
+    sum += difference;
+    sum_of_squares += difference * difference;
+  }
+  tflite::StopInferenceTimer();
+
+  const int64_t mean = origin + sum / images;
+  const uint64_t variance =
+      (sum_of_squares - sum * sum / static_cast<int64_t>(images)) / images;
+  const uint64_t deviation = SquareRoot(variance);
+  // Thousandths of a percent.
+  const uint64_t share = deviation * 100000 / mean;
+  printf("replay: %lu images, mean %llu cycles, variance %llu, "
+         "standard deviation %llu (%llu.%03llu%% of the mean)\n",
+         static_cast<unsigned long>(images),
+         static_cast<unsigned long long>(mean),
+         static_cast<unsigned long long>(variance),
+         static_cast<unsigned long long>(deviation),
+         static_cast<unsigned long long>(share / 1000),
+         static_cast<unsigned long long>(share % 1000));
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+// Replays a set of input images through mnv2, for performance work that
+// depends on realistic activations, such as zero skipping, rather than on
+// the two golden images.
+//
+// The images come from a blob (see replay_format.h) that tools/replay_pack
+// writes as src/replay_inputs_data.cc, so it is linked in like any other
+// source. Without that file there are no images and the benchmark says so.
+//
+// RunReplayBenchmark loads mnv2, runs every image once and prints the cycles
+// of each, then their mean, variance and standard deviation. The cycles are
+// the inference's alone (see inference_timer.h), without the per-op table
+// that tflite_classify prints afterwards.
+
+void RunReplayBenchmark();
@@ -0,0 +1,171 @@
+#include "residual_add.h"
+
+#include "graph_rewrite.h"
+#include "tensorflow/lite/c/builtin_op_data.h"
+#include "tensorflow/lite/kernels/internal/quantization_util.h"
+#include "tensorflow/lite/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/micro_context.h"
+
+namespace tflite {
+namespace {
+
+// The ADD kernel's own parameter calculation for int8, with the conv output
+// as input 1. Returns false if the ADD is not one the epilogue can do. As
+// ResidualAddElement is the kernel's element arithmetic, matching parameters
+// make the fold bit-exact.
+bool CalculateAddParams(TfLiteContext* context, const TfLiteAddParams& add,
+                        const TfLiteTensor* conv_output,
+                        const TfLiteTensor* skip, const TfLiteTensor* output,
+                        ArithmeticParams* params) {
+  if (conv_output->type != kTfLiteInt8 || skip->type != kTfLiteInt8 ||
+      output->type != kTfLiteInt8) {
+    return false;
+  }
+  if (!HaveSameShapes(conv_output, skip) ||
+      !HaveSameShapes(conv_output, output)) {
+    return false;
+  }
+
+  params->input1_offset = -conv_output->params.zero_point;
+  params->input2_offset = -skip->params.zero_point;
+  params->output_offset = output->params.zero_point;
+  params->left_shift = 20;
+  const double twice_max_input_scale =
+      2 * static_cast<double>(
+              std::max(conv_output->params.scale, skip->params.scale));
+  const double real_input1_multiplier =
+      static_cast<double>(conv_output->params.scale) / twice_max_input_scale;
+  const double real_input2_multiplier =
+      static_cast<double>(skip->params.scale) / twice_max_input_scale;
+  const double real_output_multiplier =
+      twice_max_input_scale /
+      ((1 << params->left_shift) * static_cast<double>(output->params.scale));
+  QuantizeMultiplierSmallerThanOneExp(real_input1_multiplier,
+                                      &params->input1_multiplier,
+                                      &params->input1_shift);
+  QuantizeMultiplierSmallerThanOneExp(real_input2_multiplier,
+                                      &params->input2_multiplier,
+                                      &params->input2_shift);
+  QuantizeMultiplierSmallerThanOneExp(real_output_multiplier,
+                                      &params->output_multiplier,
+                                      &params->output_shift);
+  return CalculateActivationRangeQuantized(
+             context, add.activation, output,
+             &params->quantized_activation_min,
+             &params->quantized_activation_max) == kTfLiteOk;
+}
+
+// Runs in the ADD slot.
+TfLiteStatus FoldedAddInvoke(TfLiteContext* context, TfLiteNode* node) {
+  const ResidualAdd* residual = static_cast<const ResidualAdd*>(
+      graph_rewrite::GetReplacementData(context, node));
+  if (residual->enabled) return kTfLiteOk;
+  return graph_rewrite::InvokeOriginal(context, node);
+}
+
+bool Overlaps(const TfLiteEvalTensor* a, const TfLiteEvalTensor* b) {
+  const int8_t* a_begin = tflite::micro::GetTensorData<int8_t>(a);
+  const int8_t* b_begin = tflite::micro::GetTensorData<int8_t>(b);
+  const int8_t* a_end = a_begin + tflite::micro::GetTensorShape(a).FlatSize();
+  const int8_t* b_end = b_begin + tflite::micro::GetTensorShape(b).FlatSize();
+  return a_begin < b_end && b_begin < a_end;
+}
+
+// The planner may place the ADD output over the conv input, since the input
+// is dead by the time the ADD runs. The epilogue reads the whole of an input
+// pixel before writing the output pixel at the same position, so this is
+// harmless as long as the output starts no later than the input and is no
+// deeper.
+bool BuffersAllowFolding(const ResidualAdd& residual,
+                         const TfLiteEvalTensor* conv_input) {
+  if (Overlaps(residual.output, residual.skip)) return false;
+  if (!Overlaps(residual.output, conv_input)) return true;
+  const RuntimeShape input_shape = tflite::micro::GetTensorShape(conv_input);
+  const RuntimeShape output_shape =
+      tflite::micro::GetTensorShape(residual.output);
+  return tflite::micro::GetTensorData<int8_t>(residual.output) <=
+             tflite::micro::GetTensorData<int8_t>(conv_input) &&
+         output_shape.Dims(3) <= input_shape.Dims(3);
+}
+
+}  // namespace
+
+TfLiteStatus PrepareResidualAdd(TfLiteContext* context, TfLiteNode* node,
+                                ResidualAdd** result) {
+  *result = nullptr;
+  const int conv_index = graph_rewrite::GetNodeIndex(context, node);
+  const int num_nodes = graph_rewrite::GetNumNodes(context);
+  if (num_nodes < 0 || conv_index + 1 >= num_nodes) return kTfLiteOk;
+  NodeAndRegistration* nodes = graph_rewrite::GetNodes(context);
+  NodeAndRegistration& add = nodes[conv_index + 1];
+  if (add.registration->builtin_code != kTfLiteBuiltinAdd ||
+      add.node.inputs->size != 2 || add.node.outputs->size != 1) {
+    return kTfLiteOk;
+  }
+
+  const int conv_output_index = node->outputs->data[0];
+  const bool conv_is_input1 = add.node.inputs->data[0] == conv_output_index;
+  const int skip_index = add.node.inputs->data[conv_is_input1 ? 1 : 0];
+  if (add.node.inputs->data[conv_is_input1 ? 0 : 1] != conv_output_index ||
+      skip_index == conv_output_index) {
+    return kTfLiteOk;
+  }
+  const int output_index = add.node.outputs->data[0];
+
+  // The conv output is never written, so the ADD must be its only reader.
+  if (graph_rewrite::GetEvalTensor(context, conv_output_index) ==
+      graph_rewrite::GetGraphOutput(context, 0)) {
+    return kTfLiteOk;
+  }
+  for (int i = 0; i < num_nodes; ++i) {
+    if (i == conv_index + 1) continue;
+    const TfLiteIntArray* inputs = nodes[i].node.inputs;
+    for (int j = 0; j < inputs->size; ++j) {
+      if (inputs->data[j] == conv_output_index) return kTfLiteOk;
+    }
+  }
+
+  MicroContext* micro_context = GetMicroContext(context);
+  TfLiteTensor* conv_output =
+      micro_context->AllocateTempTfLiteTensor(conv_output_index);
+  TF_LITE_ENSURE(context, conv_output != nullptr);
+  TfLiteTensor* skip = micro_context->AllocateTempTfLiteTensor(skip_index);
+  TF_LITE_ENSURE(context, skip != nullptr);
+  TfLiteTensor* output = micro_context->AllocateTempTfLiteTensor(output_index);
+  TF_LITE_ENSURE(context, output != nullptr);
+  TFLITE_DCHECK(add.node.builtin_data != nullptr);
+  ArithmeticParams params;
+  const bool foldable = CalculateAddParams(
+      context, *static_cast<const TfLiteAddParams*>(add.node.builtin_data),
+      conv_output, skip, output, &params);
+  micro_context->DeallocateTempTfLiteTensor(conv_output);
+  micro_context->DeallocateTempTfLiteTensor(skip);
+  micro_context->DeallocateTempTfLiteTensor(output);
+  if (!foldable) return kTfLiteOk;
+
+  ResidualAdd* residual = static_cast<ResidualAdd*>(
+      context->AllocatePersistentBuffer(context, sizeof(ResidualAdd)));
+  TF_LITE_ENSURE(context, residual != nullptr);
+  residual->params = params;
+  residual->skip = graph_rewrite::GetEvalTensor(context, skip_index);
+  residual->output = graph_rewrite::GetEvalTensor(context, output_index);
+  residual->checked = false;
+  residual->enabled = false;
+
+  TF_LITE_ENSURE_STATUS(graph_rewrite::ReplaceInvoke(
+      context, conv_index + 1, FoldedAddInvoke, residual));
+  *result = residual;
+  return kTfLiteOk;
+}
+
+bool ResidualAddEnabled(ResidualAdd* residual,
+                        const TfLiteEvalTensor* conv_input) {
+  if (!residual->checked) {
+    residual->checked = true;
+    residual->enabled = BuffersAllowFolding(*residual, conv_input);
+  }
+  return residual->enabled;
+}
+
+}  // namespace tflite
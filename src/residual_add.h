@@ -0,0 +1,69 @@
+#pragma once
+#include <algorithm>
+
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/kernels/internal/common.h"
+#include "tensorflow/lite/kernels/internal/types.h"
+
+// Folds the residual ADD at the end of an mnv2 bottleneck into the epilogue
+// of the 1x1 projection conv feeding it. The conv then reads the skip tensor
+// and writes the ADD output itself, and the ADD slot does nothing, which
+// saves the ADD's pass over the block output. That is all it saves: the conv
+// output tensor is still planned in the arena, it is just never written, so
+// no memory is freed. It also means captures of that output (the pr ofmap of
+// a bottleneck) are garbage while this is on.
+
+namespace tflite {
+
+struct ResidualAdd {
+  // ADD arithmetic with the conv output as input 1 and the skip tensor as
+  // input 2, whichever order the ADD itself has them in.
+  ArithmeticParams params;
+  TfLiteEvalTensor* skip;
+  TfLiteEvalTensor* output;
+
+  // Set by ResidualAddEnabled on the first Eval.
+  bool checked;
+  bool enabled;
+};
+
+// If the op after the 1x1 conv `node` is an int8 ADD of its output and a
+// tensor of the same shape, nothing else reads the conv output, and the ADD's
+// quantization parameters are ones ResidualAddElement computes the same way
+// as the ADD kernel, sets *result to state for folding it and takes over the
+// ADD slot. Otherwise sets *result to nullptr. Call from the conv's Prepare.
+TfLiteStatus PrepareResidualAdd(TfLiteContext* context, TfLiteNode* node,
+                                ResidualAdd** result);
+
+// Whether the conv should write the ADD output. Decided on the first call,
+// as the buffers the planner chose are only known once inference starts: if
+// they do not allow it, the conv writes its own output and the ADD runs as
+// before.
+bool ResidualAddEnabled(ResidualAdd* residual,
+                        const TfLiteEvalTensor* conv_input);
+
+// The same arithmetic as reference_integer_ops::AddElementwise.
+inline int8_t ResidualAddElement(const ArithmeticParams& params,
+                                 int32_t conv_value, int32_t skip_value) {
+  const int32_t input1_val = params.input1_offset + conv_value;
+  const int32_t input2_val = params.input2_offset + skip_value;
+  const int32_t shifted_input1_val = input1_val * (1 << params.left_shift);
+  const int32_t shifted_input2_val = input2_val * (1 << params.left_shift);
+  const int32_t scaled_input1_val =
+      MultiplyByQuantizedMultiplierSmallerThanOneExp(
+          shifted_input1_val, params.input1_multiplier, params.input1_shift);
+  const int32_t scaled_input2_val =
+      MultiplyByQuantizedMultiplierSmallerThanOneExp(
+          shifted_input2_val, params.input2_multiplier, params.input2_shift);
+  const int32_t raw_sum = scaled_input1_val + scaled_input2_val;
+  const int32_t raw_output =
+      MultiplyByQuantizedMultiplierSmallerThanOneExp(
+          raw_sum, params.output_multiplier, params.output_shift) +
+      params.output_offset;
+  const int32_t clamped_output =
+      std::min(params.quantized_activation_max,
+               std::max(params.quantized_activation_min, raw_output));
+  return static_cast<int8_t>(clamped_output);
+}
+
+}  // namespace tflite
@@ -21,7 +21,42 @@
 // In this function, place C code to emulate your CFU. You can switch between
 // hardware and emulated CFU by setting the CFU_SOFTWARE_DEFINED DEFINE in
 // the Makefile.
+//
+// This model must stay bit-exact with cfu.v; see mnv2_cfu.h for the op map.
+static int32_t input_offset;
+static uint32_t acc;
+
 uint32_t software_cfu(int funct3, int funct7, uint32_t rs1, uint32_t rs2)
 {
-  return (funct3 & 1) ? rs2 : rs1;
+  switch (funct3) {
+    case 2: {
+      uint32_t sum = (funct7 & 1) ? 0 : acc;
+      // Unsigned, so that it wraps as the 32-bit adders and multipliers of
+      // cfu.v do, whatever the input offset.
+      for (int i = 0; i < 32; i += 8) {
+        uint32_t in = (uint32_t)(int8_t)(rs1 >> i) + (uint32_t)input_offset;
+        uint32_t filter = (uint32_t)(int8_t)(rs2 >> i);
+        sum += in * filter;
+      }
+      acc = sum;
+      return acc;
+    }
+    case 3:
+      switch (funct7) {
+        case 0:
+          input_offset = rs1;
+          return rs1;
+        case 1:
+          acc = rs1;
+          return rs1;
+        case 2:
+          return acc;
+        case 3:
+          return input_offset;
+        default:
+          return rs1;
+      }
+    default:
+      return (funct3 & 1) ? rs2 : rs1;
+  }
 }
@@ -0,0 +1,141 @@
+#include "tensor_stats.h"
+
+#ifdef DATA_CAPTURE
+
+#include <cstring>
+
+#include "capture_hook.h"
+#include "data_capture.h"
+#include "graph_rewrite.h"
+#include "tensorflow/lite/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/micro_context.h"
+
+namespace data_capture {
+namespace {
+
+// Ops beyond this have no statistics.
+constexpr int kMaxNodes = 128;
+// Tensors per op with statistics; mnv2 ops have one or two.
+constexpr int kMaxStatsTensors = 4;
+
+struct StatsTensor {
+  int16_t tensor_index;
+  // Input k for k >= 0, output -1 - k otherwise.
+  int8_t position;
+  int8_t zero_point;
+};
+
+struct OpStats {
+  uint8_t num_inputs;
+  uint8_t num_outputs;
+  // Inputs first, then outputs.
+  StatsTensor tensors[kMaxStatsTensors];
+};
+
+bool enabled = false;
+OpStats op_stats[kMaxNodes];
+uint32_t bins[256];
+
+void PrintHeader() {
+  capture_printf(
+      "\"Event\",\"Tag\",\"Tensor\",\"Min\",\"Max\",\"ZeroPoint\","
+      "\"ZeroPointHits\",\"Elements\"");
+  for (int value = -128; value < 128; ++value) {
+    capture_printf(",\"%d\"", value);
+  }
+  capture_printf("\n");
+}
+
+void Collect(TfLiteContext* context, int index, const StatsTensor* tensors,
+             int count) {
+  for (int i = 0; i < count; ++i) {
+    const TfLiteEvalTensor* tensor =
+        tflite::graph_rewrite::GetEvalTensor(context, tensors[i].tensor_index);
+    const int elements = tflite::micro::GetTensorShape(tensor).FlatSize();
+    memset(bins, 0, sizeof(bins));
+    CountValues(tflite::micro::GetTensorData<int8_t>(tensor), elements, bins);
+    print_tensor_stats(index, OpTag(index), tensors[i].position,
+                       tensors[i].zero_point, elements, bins);
+  }
+}
+
+}  // namespace
+
+TfLiteStatus PrepareTensorStats(TfLiteContext* context, int index) {
+  if (index >= kMaxNodes) return kTfLiteOk;
+  const TfLiteNode& node = tflite::graph_rewrite::GetNodes(context)[index].node;
+  tflite::MicroContext* micro_context = tflite::GetMicroContext(context);
+  OpStats& stats = op_stats[index];
+  stats.num_inputs = 0;
+  stats.num_outputs = 0;
+  int count = 0;
+  for (int pass = 0; pass < 2; ++pass) {
+    const TfLiteIntArray* tensors = pass == 0 ? node.inputs : node.outputs;
+    for (int i = 0; i < tensors->size && count < kMaxStatsTensors; ++i) {
+      if (tensors->data[i] < 0) continue;
+      TfLiteTensor* tensor =
+          micro_context->AllocateTempTfLiteTensor(tensors->data[i]);
+      TF_LITE_ENSURE(context, tensor != nullptr);
+      if (tensor->type == kTfLiteInt8 && !tflite::IsConstantTensor(tensor)) {
+        stats.tensors[count].tensor_index = tensors->data[i];
+        stats.tensors[count].position = pass == 0 ? i : -1 - i;
+        stats.tensors[count].zero_point = tensor->params.zero_point;
+        ++count;
+        ++(pass == 0 ? stats.num_inputs : stats.num_outputs);
+      }
+      micro_context->DeallocateTempTfLiteTensor(tensor);
+    }
+  }
+  return kTfLiteOk;
+}
+
+bool ActivationZeroPoint(int index, int tensor_index, int32_t* zero_point) {
+  if (index >= kMaxNodes) return false;
+  const OpStats& stats = op_stats[index];
+  for (int i = 0; i < stats.num_inputs + stats.num_outputs; ++i) {
+    if (stats.tensors[i].tensor_index == tensor_index) {
+      *zero_point = stats.tensors[i].zero_point;
+      return true;
+    }
+  }
+  return false;
+}
+
+bool& tensor_stats_enabled() { return enabled; }
+
+void CollectInputStats(TfLiteContext* context, int index) {
+  if (!enabled || index >= kMaxNodes) return;
+  if (index == 0) PrintHeader();
+  Collect(context, index, op_stats[index].tensors, op_stats[index].num_inputs);
+}
+
+void CollectOutputStats(TfLiteContext* context, int index) {
+  if (!enabled || index >= kMaxNodes) return;
+  const OpStats& stats = op_stats[index];
+  Collect(context, index, stats.tensors + stats.num_inputs, stats.num_outputs);
+}
+
+void CountValues(const int8_t* data, size_t size, uint32_t* bins) {
+  const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
+  size_t i = 0;
+  // Flipping the sign bit turns a value into its bin.
+  for (; i < size && (reinterpret_cast<uintptr_t>(bytes + i) & 3) != 0; ++i) {
+    ++bins[bytes[i] ^ 0x80];
+  }
+  const uint32_t* words = reinterpret_cast<const uint32_t*>(bytes + i);
+  for (; i + 4 <= size; i += 4) {
+    const uint32_t word = *words++ ^ 0x80808080;
+    ++bins[word & 0xff];
+    ++bins[(word >> 8) & 0xff];
+    ++bins[(word >> 16) & 0xff];
+    ++bins[word >> 24];
+  }
+  for (; i < size; ++i) {
+    ++bins[bytes[i] ^ 0x80];
+  }
+}
+
+}  // namespace data_capture
+
+#endif  // DATA_CAPTURE
@@ -0,0 +1,44 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+#include "tensorflow/lite/c/common.h"
+
+// Statistics of every int8 activation an op reads or writes, for guiding
+// sparsity and range work without dumping tensors: min, max, how often the
+// zero point occurs and a 256-bin histogram.
+//
+// The capture hook (see capture_hook.h) collects them: every op's
+// non-constant inputs before it runs and its outputs after. Each tensor
+// becomes one row of a table that goes out with the rest of the capture when
+// it is flushed:
+//
+//   "Event","Tag","Tensor","Min","Max","ZeroPoint","ZeroPointHits",
+//   "Elements","-128",...,"127"
+//   2,CONV_2D,output0,-128,127,-128,61250,204800,61250,...
+//
+// Only the histogram is counted; the rest is read off it.
+
+namespace data_capture {
+
+// Notes the int8 activations and zero points of op `index`. Call while
+// preparing the graph.
+TfLiteStatus PrepareTensorStats(TfLiteContext* context, int index);
+
+// Zero point of tensor `tensor_index` if it is an int8 activation of op
+// `index`, as PrepareTensorStats noted it. Returns false otherwise.
+bool ActivationZeroPoint(int index, int tensor_index, int32_t* zero_point);
+
+// Whether the capture hook collects statistics. Off by default.
+bool& tensor_stats_enabled();
+
+// For the capture hook: statistics of op `index`'s inputs, before it runs,
+// and of its outputs, after.
+void CollectInputStats(TfLiteContext* context, int index);
+void CollectOutputStats(TfLiteContext* context, int index);
+
+// Adds the values in `data` to `bins`, indexed by value + 128. Reads a word
+// at a time where it can.
+void CountValues(const int8_t* data, size_t size, uint32_t* bins);
+
+}  // namespace data_capture
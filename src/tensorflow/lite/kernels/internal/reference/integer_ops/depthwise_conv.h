@@ -17,13 +17,10 @@ limitations under the License.
 
 #include <algorithm>
 
+#include "capture_accumulators.h"
 #include "tensorflow/lite/kernels/internal/common.h"
 #include "tensorflow/lite/kernels/internal/portable_tensor_utils.h"
 
-// --- START: ADDED FOR DEBUGGING ---
-#include <cstdio>
-// --- END: ADDED FOR DEBUGGING ---
-
 namespace tflite {
 namespace reference_integer_ops {
 inline void DepthwiseConvPerChannel(
@@ -64,11 +61,6 @@ inline void DepthwiseConvPerChannel(
   TFLITE_DCHECK_EQ(output_depth, input_depth * depth_multiplier);
   TFLITE_DCHECK_EQ(bias_shape.FlatSize(), output_depth);
 
-  // --- START: MODIFIED DEBUG CODE ---
-  // This flag ensures we only print debug info once for the target pixel.
-  bool has_printed_intermediate_debug = false;
-  // --- END: MODIFIED DEBUG CODE ---
-
   for (int batch = 0; batch < batches; ++batch) {
     for (int out_y = 0; out_y < output_height; ++out_y) {
       for (int out_x = 0; out_x < output_width; ++out_x) {
@@ -79,15 +71,6 @@ inline void DepthwiseConvPerChannel(
             const int in_y_origin = (out_y * stride_height) - pad_height;
             int32_t acc = 0;
 
-            // --- START: MODIFIED DEBUG CODE ---
-            // Print the effective input window and filter just before the MAC operation.
-            if (!has_printed_intermediate_debug && batch == 0 && out_y == 0 && out_x == 0 && output_channel == 0) {
-                printf("\n\n--- DEBUG DUMP: DEPTHWISE STAGE, TOP-LEFT 3x3 WINDOW, CHANNEL 0 ---\n\n");
-                printf("// 1. DW Input Data (Padded Window for output 0,0,0):\n");
-                printf("const int8_t debug_dw_window_ch0[] = {");
-            }
-            // --- END: MODIFIED DEBUG CODE ---
-
             for (int filter_y = 0; filter_y < filter_height; ++filter_y) {
               for (int filter_x = 0; filter_x < filter_width; ++filter_x) {
                 const int in_x = in_x_origin + dilation_width_factor * filter_x;
@@ -97,65 +80,21 @@ inline void DepthwiseConvPerChannel(
                     (in_x >= 0) && (in_x < input_width) && (in_y >= 0) &&
                     (in_y < input_height);
 
-                int32_t input_val = 0; // Default to 0 for padding
                 if (is_point_inside_image) {
-                  input_val = input_data[Offset(
+                  int32_t input_val = input_data[Offset(
                       input_shape, batch, in_y, in_x, in_channel)];
                   int32_t filter_val = filter_data[Offset(
                       filter_shape, 0, filter_y, filter_x, output_channel)];
                   acc += filter_val * (input_val + input_offset);
                 }
-
-                // --- START: MODIFIED DEBUG CODE ---
-                if (!has_printed_intermediate_debug && batch == 0 && out_y == 0 && out_x == 0 && output_channel == 0) {
-                    printf(" %d,", static_cast<int8_t>(input_val));
-                }
-                // --- END: MODIFIED DEBUG CODE ---
               }
             }
-            
-            // --- START: MODIFIED DEBUG CODE ---
-            if (!has_printed_intermediate_debug && batch == 0 && out_y == 0 && out_x == 0 && output_channel == 0) {
-                printf(" };\n\n");
-                printf("// 2. DW Filter Data (First Filter, Channel 0, 3x3):\n");
-                printf("const int8_t debug_dw_filter_ch0[] = {");
-                for (int i = 0; i < 9; ++i) {
-                  printf(" %d,", filter_data[Offset(filter_shape, 0, i / 3, i % 3, output_channel)]);
-                }
-                printf(" };\n\n");
-            }
-            // --- END: MODIFIED DEBUG CODE ---
-            
+
             if (bias_data) {
               acc += bias_data[output_channel];
             }
-
-            // --- START: MODIFIED DEBUG CODE ---
-            if (!has_printed_intermediate_debug && batch == 0 && out_y == 0 && out_x == 0 && output_channel == 0) {
-                printf("\n// --- INTERMEDIATE DEBUG DUMP (y=0, x=0, c=0) ---\n");
-                if (bias_data) {
-                    printf("// Accumulator (post-MAC, pre-bias): %ld\n", (long int)acc - bias_data[output_channel]);
-                } else {
-                    printf("// Accumulator (post-MAC, pre-bias): %ld\n", (long int)acc);
-                }
-                printf("// Accumulator (post-bias): %ld\n", (long int)acc);
-
-                int32_t scaled_acc_debug = MultiplyByQuantizedMultiplier(
-                    acc, output_multiplier[output_channel],
-                    output_shift[output_channel]);
-
-                printf("// Result after MultiplyByQuantizedMultiplier: %ld\n", (long int)scaled_acc_debug);
-                
-                scaled_acc_debug += output_offset;
-                printf("// Result after adding output_offset: %ld\n", (long int)scaled_acc_debug);
-
-                scaled_acc_debug = std::max(scaled_acc_debug, output_activation_min);
-                scaled_acc_debug = std::min(scaled_acc_debug, output_activation_max);
-                printf("// Final clamped value: %ld (0x%lx)\n", (long int)scaled_acc_debug, (long int)scaled_acc_debug & 0xFFFFFFFF);
-
-                has_printed_intermediate_debug = true;
-            }
-            // --- END: MODIFIED DEBUG CODE ---
+            data_capture::CaptureAccumulator(
+                Offset(output_shape, batch, out_y, out_x, output_channel), acc);
 
             acc = MultiplyByQuantizedMultiplier(
                 acc, output_multiplier[output_channel],
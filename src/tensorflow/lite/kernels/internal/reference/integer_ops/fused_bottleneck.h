@@ -0,0 +1,181 @@
+/* Copyright 2019 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#ifndef TENSORFLOW_LITE_KERNELS_INTERNAL_REFERENCE_INTEGER_OPS_FUSED_BOTTLENECK_H_
+#define TENSORFLOW_LITE_KERNELS_INTERNAL_REFERENCE_INTEGER_OPS_FUSED_BOTTLENECK_H_
+
+#include <algorithm>
+
+#include "tensorflow/lite/kernels/internal/common.h"
+
+namespace tflite {
+namespace reference_integer_ops {
+
+// Per-channel quantized parameters of one stage of an inverted-residual
+// bottleneck. Filters use the TFLite layouts: [out, 1, 1, in] for the 1x1
+// expansion and projection, [1, fh, fw, depth] for the depthwise stage.
+struct BottleneckStage {
+  const int8_t* filter_data;
+  const int32_t* bias_data;
+  const int32_t* output_multiplier;
+  const int32_t* output_shift;
+};
+
+// Bytes of scratch needed by FusedBottleneckPerChannel: one expansion row per
+// depthwise filter row, plus one depthwise output pixel.
+inline int FusedBottleneckScratchSize(const RuntimeShape& input_shape,
+                                      const RuntimeShape& dw_filter_shape) {
+  const int input_width = input_shape.Dims(2);
+  const int expand_depth = dw_filter_shape.Dims(3);
+  const int filter_height = dw_filter_shape.Dims(1);
+  return (filter_height * input_width + 1) * expand_depth;
+}
+
+namespace fused_bottleneck {
+
+inline int8_t Requantize(int32_t acc, int32_t multiplier, int32_t shift,
+                         int32_t output_offset, int32_t activation_min,
+                         int32_t activation_max) {
+  acc = MultiplyByQuantizedMultiplier(acc, multiplier, shift);
+  acc += output_offset;
+  acc = std::max(acc, activation_min);
+  acc = std::min(acc, activation_max);
+  return static_cast<int8_t>(acc);
+}
+
+// 1x1 convolution of a single pixel.
+inline void PointwisePixel(const ConvParams& params,
+                           const BottleneckStage& stage, const int8_t* input,
+                           int input_depth, int8_t* output, int output_depth) {
+  for (int out_c = 0; out_c < output_depth; ++out_c) {
+    const int8_t* filter = stage.filter_data + out_c * input_depth;
+    int32_t acc = 0;
+    for (int in_c = 0; in_c < input_depth; ++in_c) {
+      acc += filter[in_c] * (input[in_c] + params.input_offset);
+    }
+    if (stage.bias_data) {
+      acc += stage.bias_data[out_c];
+    }
+    output[out_c] = Requantize(
+        acc, stage.output_multiplier[out_c], stage.output_shift[out_c],
+        params.output_offset, params.quantized_activation_min,
+        params.quantized_activation_max);
+  }
+}
+
+}  // namespace fused_bottleneck
+
+// Runs expand (1x1) -> depthwise (fh x fw) -> project (1x1) as one pass over
+// the output. Expansion rows are computed on demand into a ring of fh rows;
+// every depthwise output pixel is projected as soon as it is produced, so
+// neither of the two expanded intermediates is ever materialised. The
+// arithmetic is the same as ConvPerChannel and DepthwiseConvPerChannel, so
+// the result is bit-exact with running the three ops separately.
+inline void FusedBottleneckPerChannel(
+    const ConvParams& ex_params, const BottleneckStage& ex,
+    const DepthwiseParams& dw_params, const BottleneckStage& dw,
+    const RuntimeShape& dw_filter_shape, const ConvParams& pr_params,
+    const BottleneckStage& pr, const RuntimeShape& input_shape,
+    const int8_t* input_data, const RuntimeShape& output_shape,
+    int8_t* output_data, int8_t* scratch) {
+  TFLITE_DCHECK_EQ(input_shape.DimensionsCount(), 4);
+  TFLITE_DCHECK_EQ(dw_filter_shape.DimensionsCount(), 4);
+  TFLITE_DCHECK_EQ(output_shape.DimensionsCount(), 4);
+  TFLITE_DCHECK_EQ(dw_params.depth_multiplier, 1);
+  TFLITE_DCHECK_EQ(dw_params.dilation_width_factor, 1);
+  TFLITE_DCHECK_EQ(dw_params.dilation_height_factor, 1);
+
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int input_depth = input_shape.Dims(3);
+  const int expand_depth = dw_filter_shape.Dims(3);
+  const int filter_height = dw_filter_shape.Dims(1);
+  const int filter_width = dw_filter_shape.Dims(2);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+  const int output_depth = output_shape.Dims(3);
+  const int stride_width = dw_params.stride_width;
+  const int stride_height = dw_params.stride_height;
+  const int pad_width = dw_params.padding_values.width;
+  const int pad_height = dw_params.padding_values.height;
+
+  const int row_size = input_width * expand_depth;
+  int8_t* dw_pixel = scratch + filter_height * row_size;
+
+  for (int batch = 0; batch < batches; ++batch) {
+    const int8_t* input_batch =
+        input_data + batch * input_height * input_width * input_depth;
+    // Input row held by each slot of the expansion ring, or -1.
+    int slot_row[8];
+    TFLITE_DCHECK_LE(filter_height, 8);
+    for (int i = 0; i < filter_height; ++i) slot_row[i] = -1;
+
+    for (int out_y = 0; out_y < output_height; ++out_y) {
+      const int in_y_origin = (out_y * stride_height) - pad_height;
+      for (int filter_y = 0; filter_y < filter_height; ++filter_y) {
+        const int in_y = in_y_origin + filter_y;
+        if (in_y < 0 || in_y >= input_height) continue;
+        const int slot = in_y % filter_height;
+        if (slot_row[slot] == in_y) continue;
+        int8_t* row = scratch + slot * row_size;
+        for (int x = 0; x < input_width; ++x) {
+          fused_bottleneck::PointwisePixel(
+              ex_params, ex,
+              input_batch + (in_y * input_width + x) * input_depth,
+              input_depth, row + x * expand_depth, expand_depth);
+        }
+        slot_row[slot] = in_y;
+      }
+
+      for (int out_x = 0; out_x < output_width; ++out_x) {
+        const int in_x_origin = (out_x * stride_width) - pad_width;
+        for (int c = 0; c < expand_depth; ++c) {
+          int32_t acc = 0;
+          for (int filter_y = 0; filter_y < filter_height; ++filter_y) {
+            const int in_y = in_y_origin + filter_y;
+            if (in_y < 0 || in_y >= input_height) continue;
+            const int8_t* row = scratch + (in_y % filter_height) * row_size;
+            for (int filter_x = 0; filter_x < filter_width; ++filter_x) {
+              const int in_x = in_x_origin + filter_x;
+              if (in_x < 0 || in_x >= input_width) continue;
+              const int32_t input_val = row[in_x * expand_depth + c];
+              const int32_t filter_val =
+                  dw.filter_data[(filter_y * filter_width + filter_x) *
+                                     expand_depth +
+                                 c];
+              acc += filter_val * (input_val + dw_params.input_offset);
+            }
+          }
+          if (dw.bias_data) {
+            acc += dw.bias_data[c];
+          }
+          dw_pixel[c] = fused_bottleneck::Requantize(
+              acc, dw.output_multiplier[c], dw.output_shift[c],
+              dw_params.output_offset, dw_params.quantized_activation_min,
+              dw_params.quantized_activation_max);
+        }
+        fused_bottleneck::PointwisePixel(
+            pr_params, pr, dw_pixel, expand_depth,
+            output_data + Offset(output_shape, batch, out_y, out_x, 0),
+            output_depth);
+      }
+    }
+  }
+}
+
+}  // namespace reference_integer_ops
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_KERNELS_INTERNAL_REFERENCE_INTEGER_OPS_FUSED_BOTTLENECK_H_
@@ -14,47 +14,438 @@ limitations under the License.
 ==============================================================================*/
 #include "tensorflow/lite/micro/kernels/conv.h"
 
-#include "data_capture.h"  // ADDED FOR DATA CAPTURE
+#include <cstring>
+
+#include "capture_accumulators.h"
+#include "conv_kernels.h"
+#include "fold_input_normalization.h"
+#include "graph_hooks.h"
+#include "mnv2_cfu.h"
+#include "residual_add.h"
 #include "tensorflow/lite/c/builtin_op_data.h"
 #include "tensorflow/lite/c/common.h"
 #include "tensorflow/lite/kernels/internal/common.h"
 #include "tensorflow/lite/kernels/internal/quantization_util.h"
 #include "tensorflow/lite/kernels/internal/reference/conv.h"
 #include "tensorflow/lite/kernels/internal/reference/integer_ops/conv.h"
+#include "tensorflow/lite/kernels/internal/tensor_ctypes.h"
 #include "tensorflow/lite/kernels/kernel_util.h"
 #include "tensorflow/lite/micro/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/micro_context.h"
 #include "tensorflow/lite/micro/micro_log.h"
 
 namespace tflite {
 namespace {
 
-// Helper function to print all quantization parameters for a layer
-void PrintQuantParams(const char* layer_name, const OpDataConv& data, int num_channels) {
-    printf("\n// --- %s: REQUANTIZATION PARAMS ---\n", layer_name);
-    printf("const int32_t %s_input_offset = %ld;\n", layer_name, data.input_zero_point);
-    printf("const int32_t %s_output_offset = %ld;\n\n", layer_name, data.output_zero_point);
-
-    printf("// Per-channel output multipliers:\n");
-    printf("const int32_t %s_output_multiplier[] = {\n    ", layer_name);
-    for (int i = 0; i < num_channels; ++i) {
-        printf("0x%08lx, ", data.per_channel_output_multiplier[i]);
-        if ((i + 1) % 8 == 0 && (i + 1) < num_channels) printf("\n    ");
+// A 3x3x3 patch of the first layer, padded to a whole number of words.
+constexpr int kFirstLayerPatchSize = 28;
+
+// Largest spatial map (in pixels) StreamingConv1x1PerChannel takes. It reads
+// the whole input map again for each block of output channels, so it only
+// pays off on small maps, e.g. the 5x5 maps at the end of mnv2.
+constexpr int kMaxStreamingPixels = 32;
+
+// Output channels StreamingConv1x1PerChannel computes at once.
+constexpr int kStreamingChannels = 4;
+
+// Deepest output Conv1x1ResidualPerChannel buffers a pixel of.
+constexpr int kMaxResidualDepth = 320;
+
+struct OpData {
+  // First, so that the capture hook can read it as the node's OpDataConv.
+  OpDataConv reference_op_data;
+
+  // Filter repacked for FirstLayerConvPerChannel, or nullptr.
+  int8_t* first_layer_filter;
+
+  // MUL/SUB before the first layer, folded into its input gather, or nullptr.
+  InputNormalization* input_normalization;
+
+  // Residual ADD folded into Conv1x1ResidualPerChannel, or nullptr.
+  ResidualAdd* residual;
+};
+
+// 3x3 convolution over a 3-channel input, i.e. the first layer of mnv2. The
+// generic kernel spends most of its time in loop overhead here, so each
+// 3x3x3 input patch is instead gathered into seven words (padding positions
+// hold the zero point, which the input offset cancels) and fed through the
+// CFU four-way MAC against a filter row packed the same way. If `input_lut`
+// is given, each input byte is read through it as it is gathered (see
+// fold_input_normalization.h).
+void FirstLayerConvPerChannel(
+    const ConvParams& params, const int32_t* output_multiplier,
+    const int32_t* output_shift, const RuntimeShape& input_shape,
+    const int8_t* input_data, const int8_t* input_lut,
+    const int8_t* packed_filter, const int32_t* bias_data,
+    const RuntimeShape& output_shape, int8_t* output_data) {
+  const int stride_width = params.stride_width;
+  const int stride_height = params.stride_height;
+  const int pad_width = params.padding_values.width;
+  const int pad_height = params.padding_values.height;
+  const int32_t input_offset = params.input_offset;
+  const int32_t output_offset = params.output_offset;
+  const int32_t output_activation_min = params.quantized_activation_min;
+  const int32_t output_activation_max = params.quantized_activation_max;
+
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+  const int output_depth = output_shape.Dims(3);
+  const int8_t pad_value = static_cast<int8_t>(-input_offset);
+
+  CFU_SET_INPUT_OFFSET(input_offset);
+
+  union {
+    int8_t bytes[kFirstLayerPatchSize];
+    uint32_t words[kFirstLayerPatchSize / 4];
+  } patch;
+  patch.bytes[kFirstLayerPatchSize - 1] = pad_value;
+
+  for (int batch = 0; batch < batches; ++batch) {
+    for (int out_y = 0; out_y < output_height; ++out_y) {
+      const int in_y_origin = (out_y * stride_height) - pad_height;
+      for (int out_x = 0; out_x < output_width; ++out_x) {
+        const int in_x_origin = (out_x * stride_width) - pad_width;
+        const bool is_inside_image =
+            in_y_origin >= 0 && in_y_origin + 3 <= input_height &&
+            in_x_origin >= 0 && in_x_origin + 3 <= input_width;
+        for (int filter_y = 0; filter_y < 3; ++filter_y) {
+          const int in_y = in_y_origin + filter_y;
+          int8_t* patch_row = patch.bytes + filter_y * 9;
+          if (is_inside_image) {
+            const int8_t* in =
+                &input_data[Offset(input_shape, batch, in_y, in_x_origin, 0)];
+            if (input_lut == nullptr) {
+              memcpy(patch_row, in, 9);
+              continue;
+            }
+            for (int i = 0; i < 9; i += 3) {
+              patch_row[i] = input_lut[static_cast<uint8_t>(in[i]) * 3];
+              patch_row[i + 1] =
+                  input_lut[static_cast<uint8_t>(in[i + 1]) * 3 + 1];
+              patch_row[i + 2] =
+                  input_lut[static_cast<uint8_t>(in[i + 2]) * 3 + 2];
+            }
+            continue;
+          }
+          for (int filter_x = 0; filter_x < 3; ++filter_x) {
+            const int in_x = in_x_origin + filter_x;
+            const bool is_point_inside_image =
+                (in_x >= 0) && (in_x < input_width) && (in_y >= 0) &&
+                (in_y < input_height);
+            for (int c = 0; c < 3; ++c) {
+              if (!is_point_inside_image) {
+                patch_row[filter_x * 3 + c] = pad_value;
+                continue;
+              }
+              const int8_t value =
+                  input_data[Offset(input_shape, batch, in_y, in_x, c)];
+              patch_row[filter_x * 3 + c] =
+                  input_lut == nullptr
+                      ? value
+                      : input_lut[static_cast<uint8_t>(value) * 3 + c];
+            }
+          }
+        }
+
+        int8_t* out = &output_data[Offset(output_shape, batch, out_y, out_x,
+                                          0)];
+        const uint32_t* filter =
+            reinterpret_cast<const uint32_t*>(packed_filter);
+        for (int out_channel = 0; out_channel < output_depth; ++out_channel) {
+          CFU_SET_ACC(bias_data ? bias_data[out_channel] : 0);
+          CFU_MAC4(patch.words[0], filter[0]);
+          CFU_MAC4(patch.words[1], filter[1]);
+          CFU_MAC4(patch.words[2], filter[2]);
+          CFU_MAC4(patch.words[3], filter[3]);
+          CFU_MAC4(patch.words[4], filter[4]);
+          CFU_MAC4(patch.words[5], filter[5]);
+          int32_t acc = CFU_MAC4(patch.words[6], filter[6]);
+          filter += kFirstLayerPatchSize / 4;
+          data_capture::CaptureAccumulator(out - output_data + out_channel,
+                                           acc);
+
+          acc = MultiplyByQuantizedMultiplier(acc,
+                                              output_multiplier[out_channel],
+                                              output_shift[out_channel]);
+          acc += output_offset;
+          acc = std::max(acc, output_activation_min);
+          acc = std::min(acc, output_activation_max);
+          out[out_channel] = static_cast<int8_t>(acc);
+        }
+      }
+    }
+  }
+}
+
+// Requantizes the accumulator of output element `index`, of channel
+// `out_channel`, and stores it.
+inline void StoreConvOutput(const ConvParams& params,
+                            const int32_t* output_multiplier,
+                            const int32_t* output_shift, int out_channel,
+                            int index, int32_t acc, int8_t* output_data) {
+  data_capture::CaptureAccumulator(index, acc);
+  acc = MultiplyByQuantizedMultiplier(acc, output_multiplier[out_channel],
+                                      output_shift[out_channel]);
+  acc += params.output_offset;
+  acc = std::max(acc, params.quantized_activation_min);
+  acc = std::min(acc, params.quantized_activation_max);
+  output_data[index] = static_cast<int8_t>(acc);
+}
+
+// 1x1 convolution over a small spatial map with many filters, e.g. the
+// 320->1280 head conv (op 63). It is bound by memory traffic: the reference
+// kernel re-reads all filters for every pixel. Here four output channels are
+// computed over four pixels at a time, with the sixteen sums in registers:
+// each step loads four filter words and four input words and issues sixteen
+// MACs, each from a zero accumulator, so the single CFU accumulator never has
+// to be saved. The four filter rows stay in the data cache while the block
+// moves across the map, and the input map is read once per four channels.
+// Needs a multiple of four output channels.
+void StreamingConv1x1PerChannel(
+    const ConvParams& params, const int32_t* output_multiplier,
+    const int32_t* output_shift, const RuntimeShape& input_shape,
+    const int8_t* input_data, const RuntimeShape& filter_shape,
+    const int8_t* filter_data, const int32_t* bias_data,
+    const RuntimeShape& output_shape, int8_t* output_data) {
+  const int pixels = output_shape.FlatSize() / output_shape.Dims(3);
+  const int input_depth = MatchingDim(input_shape, 3, filter_shape, 3);
+  const int output_depth = MatchingDim(filter_shape, 0, output_shape, 3);
+  const int input_words = input_depth / 4;
+  TFLITE_DCHECK_LE(pixels, kMaxStreamingPixels);
+  TFLITE_DCHECK_EQ(output_depth % kStreamingChannels, 0);
+
+  CFU_SET_INPUT_OFFSET(params.input_offset);
+
+  const uint32_t* input = reinterpret_cast<const uint32_t*>(input_data);
+  for (int out_channel = 0; out_channel < output_depth;
+       out_channel += kStreamingChannels) {
+    const uint32_t* filter0 =
+        reinterpret_cast<const uint32_t*>(filter_data) +
+        out_channel * input_words;
+    const uint32_t* filter1 = filter0 + input_words;
+    const uint32_t* filter2 = filter1 + input_words;
+    const uint32_t* filter3 = filter2 + input_words;
+    const int32_t bias0 = bias_data ? bias_data[out_channel] : 0;
+    const int32_t bias1 = bias_data ? bias_data[out_channel + 1] : 0;
+    const int32_t bias2 = bias_data ? bias_data[out_channel + 2] : 0;
+    const int32_t bias3 = bias_data ? bias_data[out_channel + 3] : 0;
+
+    int p = 0;
+    for (; p + 4 <= pixels; p += 4) {
+      const uint32_t* in0 = input + p * input_words;
+      const uint32_t* in1 = in0 + input_words;
+      const uint32_t* in2 = in1 + input_words;
+      const uint32_t* in3 = in2 + input_words;
+      // acc<channel><pixel>
+      int32_t acc00 = bias0, acc01 = bias0, acc02 = bias0, acc03 = bias0;
+      int32_t acc10 = bias1, acc11 = bias1, acc12 = bias1, acc13 = bias1;
+      int32_t acc20 = bias2, acc21 = bias2, acc22 = bias2, acc23 = bias2;
+      int32_t acc30 = bias3, acc31 = bias3, acc32 = bias3, acc33 = bias3;
+      for (int w = 0; w < input_words; ++w) {
+        const uint32_t x0 = in0[w];
+        const uint32_t x1 = in1[w];
+        const uint32_t x2 = in2[w];
+        const uint32_t x3 = in3[w];
+        uint32_t weights = filter0[w];
+        acc00 += static_cast<int32_t>(CFU_MAC4_FIRST(x0, weights));
+        acc01 += static_cast<int32_t>(CFU_MAC4_FIRST(x1, weights));
+        acc02 += static_cast<int32_t>(CFU_MAC4_FIRST(x2, weights));
+        acc03 += static_cast<int32_t>(CFU_MAC4_FIRST(x3, weights));
+        weights = filter1[w];
+        acc10 += static_cast<int32_t>(CFU_MAC4_FIRST(x0, weights));
+        acc11 += static_cast<int32_t>(CFU_MAC4_FIRST(x1, weights));
+        acc12 += static_cast<int32_t>(CFU_MAC4_FIRST(x2, weights));
+        acc13 += static_cast<int32_t>(CFU_MAC4_FIRST(x3, weights));
+        weights = filter2[w];
+        acc20 += static_cast<int32_t>(CFU_MAC4_FIRST(x0, weights));
+        acc21 += static_cast<int32_t>(CFU_MAC4_FIRST(x1, weights));
+        acc22 += static_cast<int32_t>(CFU_MAC4_FIRST(x2, weights));
+        acc23 += static_cast<int32_t>(CFU_MAC4_FIRST(x3, weights));
+        weights = filter3[w];
+        acc30 += static_cast<int32_t>(CFU_MAC4_FIRST(x0, weights));
+        acc31 += static_cast<int32_t>(CFU_MAC4_FIRST(x1, weights));
+        acc32 += static_cast<int32_t>(CFU_MAC4_FIRST(x2, weights));
+        acc33 += static_cast<int32_t>(CFU_MAC4_FIRST(x3, weights));
+      }
+      const int32_t accs[4][4] = {{acc00, acc01, acc02, acc03},
+                                  {acc10, acc11, acc12, acc13},
+                                  {acc20, acc21, acc22, acc23},
+                                  {acc30, acc31, acc32, acc33}};
+      for (int c = 0; c < kStreamingChannels; ++c) {
+        for (int i = 0; i < 4; ++i) {
+          StoreConvOutput(params, output_multiplier, output_shift,
+                          out_channel + c,
+                          (p + i) * output_depth + out_channel + c, accs[c][i],
+                          output_data);
+        }
+      }
     }
-    printf("\n};\n\n");
-    
-    printf("// Per-channel output shifts:\n");
-    printf("const int32_t %s_output_shift[] = {\n    ", layer_name);
-    for (int i = 0; i < num_channels; ++i) {
-        printf("%ld, ", data.per_channel_output_shift[i]);
-        if ((i + 1) % 16 == 0 && (i + 1) < num_channels) printf("\n    ");
+
+    // The pixels left over, one at a time.
+    for (; p < pixels; ++p) {
+      const uint32_t* in = input + p * input_words;
+      int32_t acc0 = bias0, acc1 = bias1, acc2 = bias2, acc3 = bias3;
+      for (int w = 0; w < input_words; ++w) {
+        const uint32_t x = in[w];
+        acc0 += static_cast<int32_t>(CFU_MAC4_FIRST(x, filter0[w]));
+        acc1 += static_cast<int32_t>(CFU_MAC4_FIRST(x, filter1[w]));
+        acc2 += static_cast<int32_t>(CFU_MAC4_FIRST(x, filter2[w]));
+        acc3 += static_cast<int32_t>(CFU_MAC4_FIRST(x, filter3[w]));
+      }
+      const int index = p * output_depth + out_channel;
+      StoreConvOutput(params, output_multiplier, output_shift, out_channel,
+                      index, acc0, output_data);
+      StoreConvOutput(params, output_multiplier, output_shift,
+                      out_channel + 1, index + 1, acc1, output_data);
+      StoreConvOutput(params, output_multiplier, output_shift,
+                      out_channel + 2, index + 2, acc2, output_data);
+      StoreConvOutput(params, output_multiplier, output_shift,
+                      out_channel + 3, index + 3, acc3, output_data);
     }
-    printf("\n};\n");
+  }
 }
 
+// 1x1 convolution feeding a residual ADD, i.e. the projection at the end of
+// an mnv2 bottleneck. The ADD is done in the epilogue: each requantized value
+// is added to the skip tensor and written straight to the ADD output, so the
+// conv output is never written, though its arena space is still planned. A
+// whole output pixel is computed before it is stored, which lets the ADD
+// output share memory with the input (see ResidualAddEnabled).
+void Conv1x1ResidualPerChannel(
+    const ConvParams& params, const int32_t* output_multiplier,
+    const int32_t* output_shift, const RuntimeShape& input_shape,
+    const int8_t* input_data, const RuntimeShape& filter_shape,
+    const int8_t* filter_data, const int32_t* bias_data,
+    const ArithmeticParams& add_params, const int8_t* skip_data,
+    const RuntimeShape& output_shape, int8_t* output_data) {
+  const int32_t output_offset = params.output_offset;
+  const int32_t output_activation_min = params.quantized_activation_min;
+  const int32_t output_activation_max = params.quantized_activation_max;
+
+  const int pixels = output_shape.FlatSize() / output_shape.Dims(3);
+  const int input_depth = MatchingDim(input_shape, 3, filter_shape, 3);
+  const int output_depth = MatchingDim(filter_shape, 0, output_shape, 3);
+  const int input_words = input_depth / 4;
+  TFLITE_DCHECK_LE(output_depth, kMaxResidualDepth);
+
+  CFU_SET_INPUT_OFFSET(params.input_offset);
+
+  int8_t out[kMaxResidualDepth];
+  for (int p = 0; p < pixels; ++p) {
+    const uint32_t* in =
+        reinterpret_cast<const uint32_t*>(input_data) + p * input_words;
+    const uint32_t* filter = reinterpret_cast<const uint32_t*>(filter_data);
+    const int8_t* skip = skip_data + p * output_depth;
+    for (int out_channel = 0; out_channel < output_depth; ++out_channel) {
+      int32_t acc = bias_data ? bias_data[out_channel] : 0;
+      CFU_SET_ACC(acc);
+      for (int w = 0; w < input_words; ++w) {
+        acc = CFU_MAC4(in[w], *filter++);
+      }
+      data_capture::CaptureAccumulator(p * output_depth + out_channel, acc);
+      acc = MultiplyByQuantizedMultiplier(acc, output_multiplier[out_channel],
+                                          output_shift[out_channel]);
+      acc += output_offset;
+      acc = std::max(acc, output_activation_min);
+      acc = std::min(acc, output_activation_max);
+      out[out_channel] = ResidualAddElement(add_params, acc, skip[out_channel]);
+    }
+    memcpy(output_data + p * output_depth, out, output_depth);
+  }
+}
+
+bool Is1x1CfuConv(int stride_width, int stride_height,
+                  const RuntimeShape& input_shape,
+                  const RuntimeShape& filter_shape, const int8_t* filter_data) {
+  if (stride_width != 1 || stride_height != 1) return false;
+  return filter_shape.Dims(1) == 1 && filter_shape.Dims(2) == 1 &&
+         input_shape.Dims(3) % 4 == 0 &&
+         reinterpret_cast<uintptr_t>(filter_data) % 4 == 0;
+}
+
+#ifdef FUSE_RESIDUAL_ADD
+bool Is1x1CfuConv(const TfLiteConvParams& params, const TfLiteTensor* input,
+                  const TfLiteTensor* filter) {
+  if (input->type != kTfLiteInt8 || filter->type != kTfLiteInt8) return false;
+  return Is1x1CfuConv(params.stride_width, params.stride_height,
+                      GetTensorShape(input), GetTensorShape(filter),
+                      GetTensorData<int8_t>(filter));
+}
+#endif
+
+bool IsFirstLayerConv(const TfLiteConvParams& params, const TfLiteTensor* input,
+                      const TfLiteTensor* filter) {
+  if (input->type != kTfLiteInt8 || filter->type != kTfLiteInt8) return false;
+  if (params.dilation_width_factor != 1 || params.dilation_height_factor != 1)
+    return false;
+  const RuntimeShape filter_shape = GetTensorShape(filter);
+  return GetTensorShape(input).Dims(3) == 3 && filter_shape.Dims(1) == 3 &&
+         filter_shape.Dims(2) == 3 && filter_shape.Dims(3) == 3;
+}
 
 void* Init(TfLiteContext* context, const char* buffer, size_t length) {
   TFLITE_DCHECK(context->AllocatePersistentBuffer != nullptr);
-  return context->AllocatePersistentBuffer(context, sizeof(OpDataConv));
+  return context->AllocatePersistentBuffer(context, sizeof(OpData));
+}
+
+TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
+  TF_LITE_ENSURE_STATUS(ConvPrepare(context, node));
+
+  OpData* data = static_cast<OpData*>(node->user_data);
+  const auto& params =
+      *(reinterpret_cast<TfLiteConvParams*>(node->builtin_data));
+  MicroContext* micro_context = GetMicroContext(context);
+  TfLiteTensor* input =
+      micro_context->AllocateTempInputTensor(node, kConvInputTensor);
+  TF_LITE_ENSURE(context, input != nullptr);
+  TfLiteTensor* filter =
+      micro_context->AllocateTempInputTensor(node, kConvWeightsTensor);
+  TF_LITE_ENSURE(context, filter != nullptr);
+  TfLiteTensor* output =
+      micro_context->AllocateTempOutputTensor(node, kConvOutputTensor);
+  TF_LITE_ENSURE(context, output != nullptr);
+
+  data->first_layer_filter = nullptr;
+  if (IsFirstLayerConv(params, input, filter)) {
+    const int output_depth = GetTensorShape(filter).Dims(0);
+    int8_t* packed = static_cast<int8_t*>(context->AllocatePersistentBuffer(
+        context, output_depth * kFirstLayerPatchSize));
+    TF_LITE_ENSURE(context, packed != nullptr);
+    const int8_t* filter_data = GetTensorData<int8_t>(filter);
+    for (int out_channel = 0; out_channel < output_depth; ++out_channel) {
+      int8_t* row = packed + out_channel * kFirstLayerPatchSize;
+      memcpy(row, filter_data + out_channel * 27, 27);
+      row[kFirstLayerPatchSize - 1] = 0;
+    }
+    data->first_layer_filter = packed;
+  }
+#ifdef FUSE_RESIDUAL_ADD
+  const bool may_fold_residual =
+      Is1x1CfuConv(params, input, filter) &&
+      GetTensorShape(output).Dims(3) <= kMaxResidualDepth;
+#endif
+
+  micro_context->DeallocateTempTfLiteTensor(input);
+  micro_context->DeallocateTempTfLiteTensor(filter);
+  micro_context->DeallocateTempTfLiteTensor(output);
+
+  data->residual = nullptr;
+#ifdef FUSE_RESIDUAL_ADD
+  if (may_fold_residual) {
+    TF_LITE_ENSURE_STATUS(PrepareResidualAdd(context, node, &data->residual));
+  }
+#endif
+  data->input_normalization = nullptr;
+#ifdef FOLD_INPUT_NORMALIZATION
+  if (data->first_layer_filter != nullptr) {
+    TF_LITE_ENSURE_STATUS(FoldInputNormalization(
+        context, node, &data->input_normalization));
+  }
+#endif
+  return kTfLiteOk;
 }
 
 TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
@@ -73,37 +464,8 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
   const auto& params =
       *(reinterpret_cast<TfLiteConvParams*>(node->builtin_data));
   TFLITE_DCHECK(node->user_data != nullptr);
-  const auto& data = *(static_cast<const OpDataConv*>(node->user_data));
-
-  // ========================================================================
-  // DATA CAPTURE BLOCK
-  // ========================================================================
-  static int conv_bn_counter = 0;
-  const int input_depth = tflite::micro::GetTensorShape(input).Dims(3);
-  const int output_depth = tflite::micro::GetTensorShape(output).Dims(3);
-  const bool is_1x1_kernel = (tflite::micro::GetTensorShape(filter).Dims(1) == 1 && tflite::micro::GetTensorShape(filter).Dims(2) == 1);
-  const bool is_expansion = is_1x1_kernel && (output_depth > input_depth);
-  const bool is_projection = is_1x1_kernel && (output_depth < input_depth);
-
-  // --- Pre-computation data dump ---
-  if (is_expansion && conv_bn_counter == 4) {
-    printf("\n// ======================================================================");
-    printf("\n// BN 5: EXPANSION LAYER DATA");
-    printf("\n// ======================================================================\n");
-    print_tensor_as_h("bn5_ex_ifmap", input);
-    print_tensor_as_h("bn5_ex_filter", filter);
-    if (bias) print_tensor_as_h("bn5_ex_bias", bias, true);
-    PrintQuantParams("bn5_ex", data, output_depth);
-  }
-  if (is_projection && conv_bn_counter == 4) {
-    printf("\n// ======================================================================");
-    printf("\n// BN 5: PROJECTION LAYER DATA");
-    printf("\n// ======================================================================\n");
-    print_tensor_as_h("bn5_pr_ifmap", input);
-    print_tensor_as_h("bn5_pr_filter", filter);
-    if (bias) print_tensor_as_h("bn5_pr_bias", bias, true);
-    PrintQuantParams("bn5_pr", data, output_depth);
-  }
+  const auto& op_data = *(static_cast<const OpData*>(node->user_data));
+  const OpDataConv& data = op_data.reference_op_data;
 
   TF_LITE_ENSURE_EQ(context, input->type, output->type);
   TF_LITE_ENSURE_MSG(
@@ -139,7 +501,43 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
           break;
         }
         case kTfLiteInt8: {
-          reference_integer_ops::ConvPerChannel(
+          if (op_data.first_layer_filter != nullptr) {
+            const int8_t* input_data =
+                tflite::micro::GetTensorData<int8_t>(input);
+            const int8_t* input_lut = nullptr;
+            if (op_data.input_normalization != nullptr) {
+              input_data = NormalizedInput(*op_data.input_normalization,
+                                           output, &input_lut);
+            }
+            FirstLayerConvPerChannel(
+                ConvParamsQuantized(params, data),
+                data.per_channel_output_multiplier,
+                data.per_channel_output_shift,
+                tflite::micro::GetTensorShape(input), input_data, input_lut,
+                op_data.first_layer_filter,
+                tflite::micro::GetOptionalTensorData<int32_t>(bias),
+                tflite::micro::GetTensorShape(output),
+                tflite::micro::GetTensorData<int8_t>(output));
+            break;
+          }
+          if (op_data.residual != nullptr &&
+              ResidualAddEnabled(op_data.residual, input)) {
+            Conv1x1ResidualPerChannel(
+                ConvParamsQuantized(params, data),
+                data.per_channel_output_multiplier,
+                data.per_channel_output_shift,
+                tflite::micro::GetTensorShape(input),
+                tflite::micro::GetTensorData<int8_t>(input),
+                tflite::micro::GetTensorShape(filter),
+                tflite::micro::GetTensorData<int8_t>(filter),
+                tflite::micro::GetOptionalTensorData<int32_t>(bias),
+                op_data.residual->params,
+                tflite::micro::GetTensorData<int8_t>(op_data.residual->skip),
+                tflite::micro::GetTensorShape(op_data.residual->output),
+                tflite::micro::GetTensorData<int8_t>(op_data.residual->output));
+            break;
+          }
+          OptimizedConvPerChannel(
               ConvParamsQuantized(params, data),
               data.per_channel_output_multiplier, data.per_channel_output_shift,
               tflite::micro::GetTensorShape(input),
@@ -164,25 +562,37 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
                   input->type);
       return kTfLiteError;
   }
-  
-  // --- Post-computation data dump ---
-  if (is_projection && conv_bn_counter == 4) {
-    printf("\n// --- BN 5: FINAL OUTPUT DATA ---\n");
-    print_tensor_as_h("bn5_final_output", output);
-  }
-
-  if (is_projection) {
-    conv_bn_counter++;
-  }
-  // ========================================================================
 
   return kTfLiteOk;
 }
 
 }  // namespace
 
+void OptimizedConvPerChannel(
+    const ConvParams& params, const int32_t* output_multiplier,
+    const int32_t* output_shift, const RuntimeShape& input_shape,
+    const int8_t* input_data, const RuntimeShape& filter_shape,
+    const int8_t* filter_data, const RuntimeShape& bias_shape,
+    const int32_t* bias_data, const RuntimeShape& output_shape,
+    int8_t* output_data) {
+  if (Is1x1CfuConv(params.stride_width, params.stride_height, input_shape,
+                   filter_shape, filter_data) &&
+      output_shape.FlatSize() / output_shape.Dims(3) <= kMaxStreamingPixels &&
+      output_shape.Dims(3) % kStreamingChannels == 0) {
+    StreamingConv1x1PerChannel(params, output_multiplier, output_shift,
+                               input_shape, input_data, filter_shape,
+                               filter_data, bias_data, output_shape,
+                               output_data);
+    return;
+  }
+  reference_integer_ops::ConvPerChannel(
+      params, output_multiplier, output_shift, input_shape, input_data,
+      filter_shape, filter_data, bias_shape, bias_data, output_shape,
+      output_data);
+}
+
 TfLiteRegistration Register_CONV_2D() {
-  return tflite::micro::RegisterOp(Init, ConvPrepare, Eval);
+  return WithGraphHooks(tflite::micro::RegisterOp(Init, Prepare, Eval));
 }
 
 }  // namespace tflite
@@ -0,0 +1,326 @@
+// Runs a captured mnv2 bottleneck (1x1 expansion, depthwise, 1x1 projection)
+// on the host with the arithmetic of the TFLite reference kernels, and checks
+// the output of each stage against the captured one. For checking CFU kernels
+// and RTL against many captured inputs without a simulator.
+//
+//   bottleneck_ref [-j threads] dir [prefix]
+//
+// `dir` holds the arrays that capture_extract wrote from a log, and `prefix`
+// (bn5 by default) names the bottleneck. Needs <prefix>_ex_ifmap and, for
+// each of the ex, dw and pr stages, _filter, _bias, _input_offset,
+// _output_offset, _output_multiplier and _output_shift. The expected outputs
+// are the first found of
+//   expansion: <prefix>_ex_ofmap, _dw_ifmap
+//   depthwise: <prefix>_dw_ofmap, _pr_ifmap, _dw_output_pr_ifmap
+//   final:     <prefix>_pr_ofmap, _final_output
+// Further captures of the input (<prefix>_ex_ifmap_1, ...) are run too,
+// against the expected outputs with the same number.
+//
+// Each stage is spread over the output rows. The depthwise stage has SAME
+// padding, and its stride is worked out from the captured shapes. The
+// exit status is 0 if every output matches, 1 if any differs and 2 if the
+// arrays cannot be read.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "npy.h"
+
+namespace {
+
+// MultiplyByQuantizedMultiplier of tensorflow/lite/kernels/internal/common.h.
+int32_t SaturatingRoundingDoublingHighMul(int32_t a, int32_t b) {
+  if (a == b && a == INT32_MIN) return INT32_MAX;
+  const int64_t ab = static_cast<int64_t>(a) * b;
+  const int32_t nudge = ab >= 0 ? (1 << 30) : (1 - (1 << 30));
+  return static_cast<int32_t>((ab + nudge) / (1ll << 31));
+}
+
+int32_t RoundingDivideByPOT(int32_t x, int exponent) {
+  const int32_t mask = (1ll << exponent) - 1;
+  const int32_t remainder = x & mask;
+  const int32_t threshold = (mask >> 1) + (x < 0 ? 1 : 0);
+  return (x >> exponent) + (remainder > threshold ? 1 : 0);
+}
+
+int32_t MultiplyByQuantizedMultiplier(int32_t x, int32_t multiplier,
+                                      int shift) {
+  const int left_shift = shift > 0 ? shift : 0;
+  const int right_shift = shift > 0 ? 0 : -shift;
+  return RoundingDivideByPOT(
+      SaturatingRoundingDoublingHighMul(x * (1 << left_shift), multiplier),
+      right_shift);
+}
+
+struct Stage {
+  NpyArray filter;
+  NpyArray bias;
+  NpyArray multiplier;
+  NpyArray shift;
+  // Zero points, as captured.
+  int32_t input_zero_point;
+  int32_t output_offset;
+
+  int8_t Requantize(int32_t acc, int channel) const {
+    acc = MultiplyByQuantizedMultiplier(acc, multiplier.values[channel],
+                                        shift.values[channel]);
+    acc += output_offset;
+    return static_cast<int8_t>(std::min(127, std::max(-128, acc)));
+  }
+};
+
+// Runs `row(y)` for every y in [0, rows) on `threads` threads.
+void ParallelRows(int rows, int threads,
+                  const std::function<void(int)>& row) {
+  std::atomic<int> next(0);
+  auto work = [&] {
+    for (int y = next++; y < rows; y = next++) row(y);
+  };
+  std::vector<std::thread> pool;
+  for (int i = 1; i < threads; ++i) pool.emplace_back(work);
+  work();
+  for (std::thread& thread : pool) thread.join();
+}
+
+// 1x1 convolution of an NHWC map.
+std::vector<int8_t> Pointwise(const Stage& stage, const std::vector<int8_t>& in,
+                              int height, int width, int in_depth,
+                              int threads) {
+  const int out_depth = stage.filter.dim(0);
+  std::vector<int8_t> out(static_cast<size_t>(height) * width * out_depth);
+  ParallelRows(height, threads, [&](int y) {
+    for (int x = 0; x < width; ++x) {
+      const int8_t* pixel = &in[(static_cast<size_t>(y) * width + x) * in_depth];
+      int8_t* result = &out[(static_cast<size_t>(y) * width + x) * out_depth];
+      for (int o = 0; o < out_depth; ++o) {
+        int32_t acc = 0;
+        for (int i = 0; i < in_depth; ++i) {
+          acc += stage.filter.i8(o * in_depth + i) *
+                 (pixel[i] - stage.input_zero_point);
+        }
+        acc += stage.bias.values[o];
+        result[o] = stage.Requantize(acc, o);
+      }
+    }
+  });
+  return out;
+}
+
+// Depthwise convolution, depth multiplier 1, SAME padding.
+std::vector<int8_t> Depthwise(const Stage& stage, const std::vector<int8_t>& in,
+                              int height, int width, int depth, int out_height,
+                              int out_width, int threads) {
+  const int filter_height = stage.filter.dim(1);
+  const int filter_width = stage.filter.dim(2);
+  const int stride_y = (height + out_height - 1) / out_height;
+  const int stride_x = (width + out_width - 1) / out_width;
+  const int pad_y =
+      std::max((out_height - 1) * stride_y + filter_height - height, 0) / 2;
+  const int pad_x =
+      std::max((out_width - 1) * stride_x + filter_width - width, 0) / 2;
+  std::vector<int8_t> out(static_cast<size_t>(out_height) * out_width * depth);
+  ParallelRows(out_height, threads, [&](int out_y) {
+    for (int out_x = 0; out_x < out_width; ++out_x) {
+      for (int c = 0; c < depth; ++c) {
+        int32_t acc = 0;
+        for (int fy = 0; fy < filter_height; ++fy) {
+          const int y = out_y * stride_y - pad_y + fy;
+          if (y < 0 || y >= height) continue;
+          for (int fx = 0; fx < filter_width; ++fx) {
+            const int x = out_x * stride_x - pad_x + fx;
+            if (x < 0 || x >= width) continue;
+            acc += stage.filter.i8((fy * filter_width + fx) * depth + c) *
+                   (in[(static_cast<size_t>(y) * width + x) * depth + c] -
+                    stage.input_zero_point);
+          }
+        }
+        acc += stage.bias.values[c];
+        out[(static_cast<size_t>(out_y) * out_width + out_x) * depth + c] =
+            stage.Requantize(acc, c);
+      }
+    }
+  });
+  return out;
+}
+
+class Reader {
+ public:
+  explicit Reader(const std::string& dir) : dir_(dir) {}
+
+  bool Read(const std::string& name, NpyArray* array) {
+    if (ReadNpy(dir_ + "/" + name + ".npy", array)) return true;
+    fprintf(stderr, "bottleneck_ref: cannot read %s/%s.npy\n", dir_.c_str(),
+            name.c_str());
+    ok_ = false;
+    return false;
+  }
+
+  bool Exists(const std::string& name) {
+    return std::ifstream(dir_ + "/" + name + ".npy").good();
+  }
+
+  // The first of `names` there is, with `suffix`; false if none is.
+  bool ReadFirst(const std::vector<std::string>& names,
+                 const std::string& suffix, NpyArray* array,
+                 std::string* found) {
+    for (const std::string& name : names) {
+      if (Exists(name + suffix)) {
+        *found = name + suffix;
+        return Read(*found, array);
+      }
+    }
+    return false;
+  }
+
+  bool ReadStage(const std::string& prefix, Stage* stage) {
+    NpyArray input_zero_point;
+    NpyArray output_offset;
+    Read(prefix + "_filter", &stage->filter);
+    Read(prefix + "_bias", &stage->bias);
+    Read(prefix + "_output_multiplier", &stage->multiplier);
+    Read(prefix + "_output_shift", &stage->shift);
+    Read(prefix + "_input_offset", &input_zero_point);
+    Read(prefix + "_output_offset", &output_offset);
+    if (!ok_) return false;
+    stage->input_zero_point = input_zero_point.values.at(0);
+    stage->output_offset = output_offset.values.at(0);
+    return true;
+  }
+
+  bool ok() const { return ok_; }
+
+ private:
+  std::string dir_;
+  bool ok_ = true;
+};
+
+// Prints how `actual` compares with `expected`, an NHWC map; returns the
+// number of values that differ.
+int Compare(const char* what, const std::string& name,
+            const std::vector<int8_t>& actual, const NpyArray& expected) {
+  if (expected.values.size() != actual.size() || expected.shape.size() != 4) {
+    printf("  %s: %s has %zu values, expected %zu\n", what, name.c_str(),
+           expected.values.size(), actual.size());
+    return 1;
+  }
+  int differ = 0;
+  for (size_t i = 0; i < actual.size(); ++i) {
+    if (actual[i] == expected.i8(i)) continue;
+    if (differ++ == 0) {
+      const int depth = expected.dim(3);
+      const int width = expected.dim(2);
+      printf("  %s: first difference at y=%zu x=%zu c=%zu: %d, %s has %d\n",
+             what, i / depth / width, i / depth % width, i % depth, actual[i],
+             name.c_str(), expected.i8(i));
+    }
+  }
+  printf("  %s: %zu values, %d differ from %s\n", what, actual.size(), differ,
+         name.c_str());
+  return differ;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  int threads = std::max(1u, std::thread::hardware_concurrency());
+  int arg = 1;
+  if (arg + 1 < argc && strcmp(argv[arg], "-j") == 0) {
+    threads = std::max(1, atoi(argv[arg + 1]));
+    arg += 2;
+  }
+  if (argc - arg < 1 || argc - arg > 2) {
+    fprintf(stderr, "usage: bottleneck_ref [-j threads] dir [prefix]\n");
+    return 2;
+  }
+  Reader reader(argv[arg]);
+  const std::string prefix = argc - arg == 2 ? argv[arg + 1] : "bn5";
+
+  Stage ex, dw, pr;
+  if (!reader.ReadStage(prefix + "_ex", &ex) ||
+      !reader.ReadStage(prefix + "_dw", &dw) ||
+      !reader.ReadStage(prefix + "_pr", &pr)) {
+    return 2;
+  }
+
+  const std::vector<std::string> ex_names = {prefix + "_ex_ofmap",
+                                             prefix + "_dw_ifmap"};
+  const std::vector<std::string> dw_names = {prefix + "_dw_ofmap",
+                                             prefix + "_pr_ifmap",
+                                             prefix + "_dw_output_pr_ifmap"};
+  const std::vector<std::string> final_names = {prefix + "_pr_ofmap",
+                                                prefix + "_final_output"};
+  int runs = 0;
+  int differ = 0;
+  for (int n = 0;; ++n) {
+    const std::string suffix = n == 0 ? "" : "_" + std::to_string(n);
+    if (!reader.Exists(prefix + "_ex_ifmap" + suffix)) break;
+    NpyArray input;
+    if (!reader.Read(prefix + "_ex_ifmap" + suffix, &input)) return 2;
+    if (input.shape.size() != 4) {
+      fprintf(stderr, "bottleneck_ref: %s_ex_ifmap%s is not NHWC\n",
+              prefix.c_str(), suffix.c_str());
+      return 2;
+    }
+    NpyArray expected_ex, expected_dw, expected_final;
+    std::string ex_name, dw_name, final_name;
+    const bool have_ex =
+        reader.ReadFirst(ex_names, suffix, &expected_ex, &ex_name);
+    const bool have_dw =
+        reader.ReadFirst(dw_names, suffix, &expected_dw, &dw_name);
+    const bool have_final =
+        reader.ReadFirst(final_names, suffix, &expected_final, &final_name);
+    if (!reader.ok()) return 2;
+
+    const int height = input.dim(1);
+    const int width = input.dim(2);
+    int out_height = height;
+    int out_width = width;
+    if (have_dw && expected_dw.shape.size() == 4) {
+      out_height = expected_dw.dim(1);
+      out_width = expected_dw.dim(2);
+    }
+    const int expand_depth = ex.filter.dim(0);
+    std::vector<int8_t> in8(input.values.begin(), input.values.end());
+
+    const auto start = std::chrono::steady_clock::now();
+    const std::vector<int8_t> expanded =
+        Pointwise(ex, in8, height, width, input.dim(3), threads);
+    const std::vector<int8_t> dw_out =
+        Depthwise(dw, expanded, height, width, expand_depth, out_height,
+                  out_width, threads);
+    const std::vector<int8_t> output =
+        Pointwise(pr, dw_out, out_height, out_width, expand_depth, threads);
+    const double ms = std::chrono::duration<double, std::milli>(
+                          std::chrono::steady_clock::now() - start)
+                          .count();
+
+    printf("%s_ex_ifmap%s: %dx%dx%d -> %dx%dx%d in %.2f ms on %d threads\n",
+           prefix.c_str(), suffix.c_str(), height, width, input.dim(3),
+           out_height, out_width, pr.filter.dim(0), ms, threads);
+    if (have_ex) {
+      differ += Compare("expansion", ex_name, expanded, expected_ex);
+    }
+    if (have_dw) differ += Compare("depthwise", dw_name, dw_out, expected_dw);
+    if (have_final) {
+      differ += Compare("output", final_name, output, expected_final);
+    }
+    if (!have_ex && !have_dw && !have_final) printf("  no captured outputs to compare\n");
+    ++runs;
+  }
+  if (runs == 0) {
+    fprintf(stderr, "bottleneck_ref: no %s_ex_ifmap in %s\n", prefix.c_str(),
+            argv[arg]);
+    return 2;
+  }
+  return differ == 0 ? 0 : 1;
+}
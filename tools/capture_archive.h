@@ -0,0 +1,166 @@
+#pragma once
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "capture_format.h"
+
+// Capture archives: the binary records of a capture (see
+// src/capture_format.h) kept in a file as they are, for tools that go over
+// many captures and would rather not decode base64 logs each time.
+// capture_decode -a writes one from a log.
+//
+// An archive is a u32 magic and a u32 version, then records back to back,
+// CRCs included, every field little-endian.
+//
+// Reader maps the file instead of reading it, so opening an archive costs
+// the same whatever its size and a Record points into the mapping: the OS
+// pages in only the records a tool looks at. Nothing is checked up front;
+// Next parses headers as it goes and Record::CrcMatches checks a record
+// when asked.
+
+namespace capture_archive {
+
+constexpr uint32_t kMagic = 0x5241434d;  // "MCAR"
+constexpr uint32_t kVersion = 1;
+constexpr int kHeaderBytes = 8;
+
+inline void PutHeader(uint8_t* p) {
+  p = capture_format::PutU32(p, kMagic);
+  capture_format::PutU32(p, kVersion);
+}
+
+// One record, in place in the archive.
+struct Record {
+  capture_format::Header header;
+  // The whole record, CRC included.
+  const uint8_t* data;
+  size_t size;
+  const char* name;
+  const uint8_t* dims;
+  // Multipliers, then shifts, header.channels of each.
+  const uint8_t* channels;
+  const uint8_t* payload;
+
+  std::string Name() const { return std::string(name, header.name_length); }
+  int32_t dim(int i) const {
+    return static_cast<int32_t>(capture_format::GetU32(dims + 4 * i));
+  }
+  int32_t multiplier(int channel) const {
+    return static_cast<int32_t>(capture_format::GetU32(channels + 4 * channel));
+  }
+  int32_t shift(int channel) const {
+    return static_cast<int32_t>(capture_format::GetU32(
+        channels + 4 * (header.channels + channel)));
+  }
+
+  // Bytes the payload decodes to: the product of the dims in dtype units.
+  // Only for kinds that are shaped that way.
+  size_t DecodedBytes() const {
+    size_t bytes = capture_format::DTypeSize(header.dtype);
+    for (int i = 0; i < header.rank; ++i) bytes *= dim(i);
+    return bytes;
+  }
+
+  bool CrcMatches() const {
+    capture_format::Crc32 crc;
+    crc.Update(data, size - capture_format::kCrcBytes);
+    return crc.value() ==
+           capture_format::GetU32(data + size - capture_format::kCrcBytes);
+  }
+
+  // The payload of a kTensor record, decoded. A raw payload needs no copy,
+  // so use `payload` directly for those. Returns false if it does not
+  // decode.
+  bool Decode(std::vector<uint8_t>* out) const {
+    out->resize(DecodedBytes());
+    int32_t shape[capture_format::kMaxRank];
+    for (int i = 0; i < header.rank; ++i) shape[i] = dim(i);
+    return capture_format::Decode(
+        header.encoding, payload, header.payload_bytes,
+        capture_format::DeltaStride(header.dtype, shape, header.rank),
+        out->data(), out->size());
+  }
+};
+
+class Reader {
+ public:
+  Reader() = default;
+  Reader(const Reader&) = delete;
+  Reader& operator=(const Reader&) = delete;
+  ~Reader() { Close(); }
+
+  // Maps the archive at `path`. Returns an error message, or "".
+  std::string Open(const std::string& path) {
+    Close();
+    const int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) return "cannot open " + path;
+    struct stat info;
+    std::string error;
+    if (fstat(fd, &info) != 0 || info.st_size < kHeaderBytes) {
+      error = path + " is not a capture archive";
+    } else {
+      void* map = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (map == MAP_FAILED) {
+        error = "cannot map " + path;
+      } else {
+        data_ = static_cast<const uint8_t*>(map);
+        size_ = info.st_size;
+        if (capture_format::GetU32(data_) != kMagic ||
+            capture_format::GetU32(data_ + 4) != kVersion) {
+          error = path + " is not a capture archive of this version";
+          Close();
+        }
+      }
+    }
+    close(fd);
+    return error;
+  }
+
+  void Close() {
+    if (data_ != nullptr) munmap(const_cast<uint8_t*>(data_), size_);
+    data_ = nullptr;
+    size_ = 0;
+  }
+
+  // Offset of the first record.
+  size_t begin() const { return kHeaderBytes; }
+  size_t size() const { return size_; }
+
+  // Points `record` at the record at `offset` and moves `offset` past it.
+  // Returns false, leaving `offset` as it was, at the end of the archive or
+  // at a record cut short or not parsing; offset != size() tells the two
+  // apart.
+  bool Next(size_t* offset, Record* record) const {
+    namespace cf = capture_format;
+    const size_t left = size_ - *offset;
+    const uint8_t* p = data_ + *offset;
+    if (*offset >= size_ || left < cf::kShortHeaderBytes ||
+        left < static_cast<size_t>(cf::HeaderBytes(p)) ||
+        !cf::ParseHeader(p, &record->header) ||
+        left < cf::RecordBytes(record->header)) {
+      return false;
+    }
+    const cf::Header& header = record->header;
+    record->data = p;
+    record->size = cf::RecordBytes(header);
+    record->dims = p + header.header_bytes;
+    record->name = reinterpret_cast<const char*>(record->dims + 4 * header.rank);
+    record->channels =
+        reinterpret_cast<const uint8_t*>(record->name) + header.name_length;
+    record->payload = record->channels + 8 * header.channels;
+    *offset += record->size;
+    return true;
+  }
+
+ private:
+  const uint8_t* data_ = nullptr;
+  size_t size_ = 0;
+};
+
+}  // namespace capture_archive
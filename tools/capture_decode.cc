@@ -0,0 +1,361 @@
+// Turns a console log containing binary capture records (see
+// src/capture_format.h) back into the C headers that the text capture
+// (DATA_CAPTURE_TEXT) prints, byte for byte.
+//
+//   capture_decode [-a archive] [log] > capture.h
+//
+// Reads a Renode log, of which only the UART lines are used, or a plain
+// console transcript, from the file or stdin. Text outside records is passed
+// through, as it is read. Records that fail their CRC are reported and left
+// out, and the exit status is then 1. With -a, every record that passes is
+// also written, as it is, to a capture archive (see capture_archive.h).
+
+#include <cinttypes>
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "capture_archive.h"
+#include "capture_format.h"
+#include "console_log.h"
+
+namespace {
+
+namespace cf = capture_format;
+
+bool DecodeBase64(const std::string& text, size_t begin,
+                  std::vector<uint8_t>* out) {
+  uint32_t bits = 0;
+  int count = 0;
+  for (size_t i = begin; i < text.size(); ++i) {
+    if (text[i] == '=') break;
+    const int value = cf::Base64Value(text[i]);
+    if (value < 0) return false;
+    bits = (bits << 6) | value;
+    if (++count == 4) {
+      out->push_back(static_cast<uint8_t>(bits >> 16));
+      out->push_back(static_cast<uint8_t>(bits >> 8));
+      out->push_back(static_cast<uint8_t>(bits));
+      bits = 0;
+      count = 0;
+    }
+  }
+  if (count == 2) {
+    out->push_back(static_cast<uint8_t>(bits >> 4));
+  } else if (count == 3) {
+    out->push_back(static_cast<uint8_t>(bits >> 10));
+    out->push_back(static_cast<uint8_t>(bits >> 2));
+  }
+  return count != 1;
+}
+
+void Append(std::string* out, const char* format, ...)
+    __attribute__((format(printf, 2, 3)));
+
+void Append(std::string* out, const char* format, ...) {
+  char buffer[256];
+  va_list args;
+  va_start(args, format);
+  vsnprintf(buffer, sizeof(buffer), format, args);
+  va_end(args);
+  *out += buffer;
+}
+
+int32_t GetI32(const uint8_t* p) { return static_cast<int32_t>(cf::GetU32(p)); }
+
+// Mirrors print_tensor_as_h in src/data_capture.h, including the int8
+// values printed through int promotion (0xffffffee for -18).
+void RenderTensor(const std::string& name, const cf::Header& header,
+                  const int32_t* dims, size_t size, const uint8_t* data,
+                  std::string* out) {
+  if (header.dtype == cf::kInt32) {
+    const int words = size / 4;
+    Append(out, "// Tensor '%s', Shape: [%d]\n", name.c_str(), words);
+    Append(out, "const int32_t %s[] = {", name.c_str());
+    for (int i = 0; i < words; ++i) {
+      if (i % 8 == 0) *out += "\n    ";
+      Append(out, "0x%08" PRIx32 ", ", cf::GetU32(data + 4 * i));
+    }
+    *out += "\n};\n\n";
+    return;
+  }
+  Append(out, "// Tensor '%s', Shape: [", name.c_str());
+  for (int i = 0; i < header.rank; ++i) {
+    Append(out, "%d", dims[i]);
+    if (i < header.rank - 1) *out += ", ";
+  }
+  *out += "]\n";
+  Append(out, "const int8_t %s[] = {", name.c_str());
+  for (size_t i = 0; i < size; ++i) {
+    if (i % 16 == 0) *out += "\n    ";
+    Append(out, "0x%02x, ",
+           static_cast<unsigned>(static_cast<int8_t>(data[i])));
+  }
+  *out += "\n};\n\n";
+}
+
+// An int32 array shaped `dims`, eight values a line.
+void RenderInt32(const std::string& name, const int32_t* dims, int rank,
+                 const std::vector<int32_t>& values, std::string* out) {
+  Append(out, "// Tensor '%s', Shape: [", name.c_str());
+  for (int i = 0; i < rank; ++i) {
+    Append(out, "%d", dims[i]);
+    if (i < rank - 1) *out += ", ";
+  }
+  *out += "]\n";
+  Append(out, "const int32_t %s[] = {", name.c_str());
+  for (size_t i = 0; i < values.size(); ++i) {
+    if (i % 8 == 0) *out += "\n    ";
+    Append(out, "%" PRId32 ", ", values[i]);
+  }
+  *out += "\n};\n\n";
+}
+
+// Mirrors print_quant_params_as_h in src/data_capture.h.
+void RenderQuantParams(const std::string& name, int channels,
+                       const uint8_t* payload, std::string* out) {
+  const char* n = name.c_str();
+  Append(out, "\n// --- %s: REQUANTIZATION PARAMS ---\n", n);
+  Append(out, "const int32_t %s_input_offset = %d;\n", n, GetI32(payload));
+  Append(out, "const int32_t %s_output_offset = %d;\n\n", n,
+         GetI32(payload + 4));
+
+  const uint8_t* multipliers = payload + 8;
+  *out += "// Per-channel output multipliers:\n";
+  Append(out, "const int32_t %s_output_multiplier[] = {\n    ", n);
+  for (int i = 0; i < channels; ++i) {
+    Append(out, "0x%08" PRIx32 ", ", cf::GetU32(multipliers + 4 * i));
+    if ((i + 1) % 8 == 0 && (i + 1) < channels) *out += "\n    ";
+  }
+  *out += "\n};\n\n";
+
+  const uint8_t* shifts = multipliers + 4 * channels;
+  *out += "// Per-channel output shifts:\n";
+  Append(out, "const int32_t %s_output_shift[] = {\n    ", n);
+  for (int i = 0; i < channels; ++i) {
+    Append(out, "%d, ", GetI32(shifts + 4 * i));
+    if ((i + 1) % 16 == 0 && (i + 1) < channels) *out += "\n    ";
+  }
+  *out += "\n};\n";
+}
+
+// Mirrors print_tensor_stats in src/data_capture.h.
+void RenderStats(const std::string& tag, const uint8_t* payload,
+                 std::string* out) {
+  const int32_t op = GetI32(payload);
+  const int32_t tensor = GetI32(payload + 4);
+  const int32_t zero_point = GetI32(payload + 8);
+  const uint32_t elements = cf::GetU32(payload + 12);
+  const uint8_t* bins = payload + 16;
+  auto bin = [&](int i) { return cf::GetU32(bins + 4 * i); };
+  int min = 0;
+  while (min < 255 && bin(min) == 0) ++min;
+  int max = 255;
+  while (max > 0 && bin(max) == 0) --max;
+  Append(out, "%" PRId32 ",%s,%s%" PRId32 ",%d,%d,%" PRId32 ",%" PRIu32
+              ",%" PRIu32,
+         op, tag.c_str(), tensor >= 0 ? "input" : "output",
+         tensor >= 0 ? tensor : -1 - tensor, min - 128, max - 128, zero_point,
+         bin(zero_point + 128), elements);
+  for (int i = 0; i < 256; ++i) Append(out, ",%" PRIu32, bin(i));
+  *out += '\n';
+}
+
+class Decoder {
+ public:
+  // Records that pass their CRC are written to `archive`, unless it is null.
+  explicit Decoder(FILE* archive) : archive_(archive) {}
+
+  void Line(const std::string& text) {
+    const size_t prefix = text.find(cf::kLinePrefix);
+    if (prefix == std::string::npos) {
+      if (!record_.empty()) Fail("record cut short");
+      out_ += text;
+      out_ += '\n';
+      return;
+    }
+    out_.append(text, 0, prefix);
+    if (!DecodeBase64(text, prefix + cf::kLinePrefixLength, &record_)) {
+      Fail("bad base64");
+      return;
+    }
+    cf::Header header;
+    if (record_.size() < cf::kShortHeaderBytes ||
+        record_.size() < static_cast<size_t>(cf::HeaderBytes(record_.data()))) {
+      return;
+    }
+    if (!cf::ParseHeader(record_.data(), &header)) {
+      Fail("bad record header");
+      return;
+    }
+    if (record_.size() < cf::RecordBytes(header)) return;
+    if (record_.size() > cf::RecordBytes(header)) {
+      Fail("trailing bytes after record");
+      return;
+    }
+    Render(header);
+    record_.clear();
+  }
+
+  void Finish() {
+    if (!record_.empty()) Fail("record cut short");
+  }
+
+  // Output so far; TakeOutput empties it.
+  std::string TakeOutput() {
+    std::string out;
+    out.swap(out_);
+    return out;
+  }
+  int errors() const { return errors_; }
+
+ private:
+  void Render(const cf::Header& header) {
+    const uint8_t* p = record_.data() + header.header_bytes;
+    int32_t dims[cf::kMaxRank];
+    for (int i = 0; i < header.rank; ++i) dims[i] = GetI32(p + 4 * i);
+    p += 4 * header.rank;
+    const std::string name(reinterpret_cast<const char*>(p),
+                           header.name_length);
+    // The text capture has no place for the per-channel requantization.
+    const uint8_t* payload = p + header.name_length + 8 * header.channels;
+    const uint8_t* crc = payload + header.payload_bytes;
+
+    cf::Crc32 computed;
+    computed.Update(record_.data(), crc - record_.data());
+    if (computed.value() != cf::GetU32(crc)) {
+      Fail(("CRC mismatch in " + name).c_str());
+      return;
+    }
+    if (archive_ != nullptr) {
+      fwrite(record_.data(), 1, record_.size(), archive_);
+    }
+    if (header.kind == cf::kQuantParams && header.rank == 1 &&
+        header.payload_bytes == 8u + 8u * dims[0]) {
+      RenderQuantParams(name, dims[0], payload, &out_);
+    } else if (header.kind == cf::kText) {
+      out_.append(reinterpret_cast<const char*>(payload), header.payload_bytes);
+    } else if (header.kind == cf::kAccumulators &&
+               header.dtype == cf::kInt32 && header.encoding == cf::kRaw &&
+               header.rank > 0) {
+      RenderAccumulators(name, header, dims, payload);
+    } else if (header.kind == cf::kStats && header.dtype == cf::kInt32) {
+      std::vector<uint8_t> data(cf::kStatsPayloadBytes);
+      if (!cf::Decode(header.encoding, payload, header.payload_bytes,
+                      cf::DTypeSize(header.dtype), data.data(), data.size()) ||
+          GetI32(data.data() + 8) < -128 || GetI32(data.data() + 8) > 127) {
+        Fail(("cannot decode statistics of " + name).c_str());
+        return;
+      }
+      RenderStats(name, data.data(), &out_);
+    } else if (header.kind == cf::kTensor) {
+      size_t size = cf::DTypeSize(header.dtype);
+      for (int i = 0; i < header.rank; ++i) size *= dims[i];
+      std::vector<uint8_t> data(size);
+      if (!cf::Decode(header.encoding, payload, header.payload_bytes,
+                      cf::DeltaStride(header.dtype, dims, header.rank),
+                      data.data(), size)) {
+        Fail(("cannot decode " + name).c_str());
+        return;
+      }
+      RenderTensor(name, header, dims, size, data.data(), &out_);
+      if (header.dtype == cf::kInt32) {
+        std::vector<int32_t>& values = int32_tensors_[name];
+        values.resize(size / 4);
+        for (size_t i = 0; i < values.size(); ++i) {
+          values[i] = GetI32(data.data() + 4 * i);
+        }
+      }
+    } else {
+      Fail(("unknown record kind in " + name).c_str());
+    }
+  }
+
+  // Prints the accumulators as captured, bias included, then without the
+  // bias if the op's bias was captured before them.
+  void RenderAccumulators(const std::string& name, const cf::Header& header,
+                          const int32_t* dims, const uint8_t* payload) {
+    std::vector<int32_t> values(header.payload_bytes / 4);
+    for (size_t i = 0; i < values.size(); ++i) {
+      values[i] = GetI32(payload + 4 * i);
+    }
+    RenderInt32(name, dims, header.rank, values, &out_);
+
+    const std::string suffix = "_acc";
+    if (name.size() <= suffix.size() ||
+        name.compare(name.size() - suffix.size(), suffix.size(), suffix) != 0) {
+      return;
+    }
+    const std::string prefix = name.substr(0, name.size() - suffix.size());
+    const auto bias = int32_tensors_.find(prefix + "_bias");
+    const size_t channels = dims[header.rank - 1];
+    if (bias == int32_tensors_.end() || bias->second.size() != channels) {
+      return;
+    }
+    for (size_t i = 0; i < values.size(); ++i) {
+      values[i] -= bias->second[i % channels];
+    }
+    RenderInt32(name + "_pre_bias", dims, header.rank, values, &out_);
+  }
+
+  void Fail(const char* message) {
+    fprintf(stderr, "capture_decode: %s\n", message);
+    ++errors_;
+    record_.clear();
+  }
+
+  FILE* archive_;
+  std::string out_;
+  // Every int32 tensor so far, by name, for RenderAccumulators.
+  std::map<std::string, std::vector<int32_t>> int32_tensors_;
+  std::vector<uint8_t> record_;
+  int errors_ = 0;
+};
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  int arg = 1;
+  FILE* archive = nullptr;
+  if (arg + 1 < argc && strcmp(argv[arg], "-a") == 0) {
+    archive = fopen(argv[arg + 1], "wb");
+    if (archive == nullptr) {
+      fprintf(stderr, "capture_decode: cannot write %s\n", argv[arg + 1]);
+      return 2;
+    }
+    uint8_t header[capture_archive::kHeaderBytes];
+    capture_archive::PutHeader(header);
+    fwrite(header, 1, sizeof(header), archive);
+    arg += 2;
+  }
+  std::ifstream file;
+  if (arg < argc) {
+    file.open(argv[arg]);
+    if (!file) {
+      fprintf(stderr, "capture_decode: cannot open %s\n", argv[arg]);
+      return 2;
+    }
+  }
+  std::istream& in = arg < argc ? file : std::cin;
+
+  Decoder decoder(archive);
+  std::string line;
+  std::string text;
+  while (std::getline(in, line)) {
+    if (!line.empty() && line.back() == '\r') line.pop_back();
+    if (ConsoleText(line, &text)) decoder.Line(text);
+    const std::string out = decoder.TakeOutput();
+    fwrite(out.data(), 1, out.size(), stdout);
+  }
+  decoder.Finish();
+  if (archive != nullptr && fclose(archive) != 0) {
+    fprintf(stderr, "capture_decode: cannot write the archive\n");
+    return 2;
+  }
+  return decoder.errors() == 0 ? 0 : 1;
+}
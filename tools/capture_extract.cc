@@ -0,0 +1,334 @@
+// Pulls every int8 and int32 array and scalar out of a capture log into a
+// NumPy .npy file and a standalone C header each.
+//
+//   capture_extract [-o dir] [log]
+//
+// Reads the C headers that the text capture (DATA_CAPTURE_TEXT) prints, from
+// a Renode log, of which only the UART lines are used, or a plain console
+// transcript, from the file or stdin. For a log of binary records, decode it
+// on the way in:
+//
+//   capture_decode data_capture_output.log | capture_extract -o tensors
+//
+// Arrays take the shape of the "// Tensor" comment before them, if any, and
+// are flat otherwise. An array seen again, e.g. from a later inference, gets
+// a numbered name: bn5_ex_ifmap_1. Values go out as they are read, so memory
+// does not grow with the log. The exit status is 0 if every array was whole,
+// 1 if any was cut short and 2 if a file cannot be opened.
+
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "console_log.h"
+
+namespace {
+
+// Room for the .npy header whatever the shape: a multiple of 64 bytes, as
+// the format asks, with the dictionary padded out by spaces.
+constexpr int kNpyHeaderBytes = 192;
+
+struct DType {
+  const char* c_name;
+  const char* npy_descr;
+  int size;
+  // Values per line of the .h file.
+  int per_line;
+};
+
+constexpr DType kInt8 = {"int8_t", "|i1", 1, 16};
+constexpr DType kInt32 = {"int32_t", "<i4", 4, 8};
+
+// "[1, 20, 20, 96]" or, for Python, "(1, 20, 20, 96)", "(96,)" and "()".
+std::string ShapeText(const std::vector<long>& shape, bool python) {
+  std::string text = python ? "(" : "[";
+  for (size_t i = 0; i < shape.size(); ++i) {
+    if (i > 0) text += ", ";
+    text += std::to_string(shape[i]);
+  }
+  if (python && shape.size() == 1) text += ",";
+  return text + (python ? ")" : "]");
+}
+
+void WriteNpyHeader(FILE* npy, const DType& dtype,
+                    const std::vector<long>& shape) {
+  std::string dict = "{'descr': '";
+  dict += dtype.npy_descr;
+  dict += "', 'fortran_order': False, 'shape': ";
+  dict += ShapeText(shape, true);
+  dict += ", }";
+  dict.resize(kNpyHeaderBytes - 10 - 1, ' ');
+  dict += '\n';
+  const uint8_t preamble[10] = {0x93, 'N', 'U', 'M', 'P', 'Y', 1, 0,
+                                static_cast<uint8_t>(dict.size()),
+                                static_cast<uint8_t>(dict.size() >> 8)};
+  fwrite(preamble, 1, sizeof(preamble), npy);
+  fwrite(dict.data(), 1, dict.size(), npy);
+}
+
+void WriteValue(FILE* npy, const DType& dtype, long value) {
+  uint8_t bytes[4];
+  for (int i = 0; i < dtype.size; ++i) bytes[i] = value >> (8 * i);
+  fwrite(bytes, 1, dtype.size, npy);
+}
+
+// One array, written out as its values are read. The .npy header goes in
+// last, once the number of values is known.
+class ArrayWriter {
+ public:
+  bool Open(const std::string& path, const std::string& name,
+            const DType& dtype, const std::vector<long>& shape) {
+    npy_ = fopen((path + ".npy").c_str(), "wb");
+    h_ = fopen((path + ".h").c_str(), "w");
+    if (npy_ == nullptr || h_ == nullptr) {
+      Close();
+      return false;
+    }
+    name_ = name;
+    dtype_ = &dtype;
+    shape_ = shape;
+    count_ = 0;
+    static const uint8_t kPlaceholder[kNpyHeaderBytes] = {};
+    fwrite(kPlaceholder, 1, kNpyHeaderBytes, npy_);
+    fprintf(h_, "#pragma once\n#include <stdint.h>\n\n");
+    if (!shape.empty()) {
+      fprintf(h_, "// Tensor '%s', Shape: %s\n", name.c_str(),
+              ShapeText(shape, false).c_str());
+    }
+    fprintf(h_, "const %s %s[] = {", dtype.c_name, name.c_str());
+    return true;
+  }
+
+  void Put(long value) {
+    value = dtype_->size == 1 ? static_cast<int8_t>(value)
+                              : static_cast<int32_t>(value);
+    WriteValue(npy_, *dtype_, value);
+    if (count_ % dtype_->per_line == 0) fputs("\n    ", h_);
+    fprintf(h_, "%ld, ", value);
+    ++count_;
+  }
+
+  // Finishes the files. Returns false, and writes the .npy flat, if the
+  // shape does not match the number of values.
+  bool Close() {
+    bool matches = true;
+    if (npy_ != nullptr && h_ != nullptr) {
+      fputs("\n};\n", h_);
+      long expected = 1;
+      for (long dim : shape_) expected *= dim;
+      if (shape_.empty() || expected != count_) {
+        matches = shape_.empty();
+        shape_ = {count_};
+      }
+      fseek(npy_, 0, SEEK_SET);
+      WriteNpyHeader(npy_, *dtype_, shape_);
+    }
+    if (npy_ != nullptr) fclose(npy_);
+    if (h_ != nullptr) fclose(h_);
+    npy_ = nullptr;
+    h_ = nullptr;
+    return matches;
+  }
+
+  bool is_open() const { return npy_ != nullptr; }
+  const std::string& name() const { return name_; }
+
+ private:
+  FILE* npy_ = nullptr;
+  FILE* h_ = nullptr;
+  std::string name_;
+  const DType* dtype_ = nullptr;
+  std::vector<long> shape_;
+  long count_ = 0;
+};
+
+class Extractor {
+ public:
+  explicit Extractor(const std::string& dir) : dir_(dir) {}
+
+  void Line(const std::string& text) {
+    if (array_.is_open()) {
+      Values(text.c_str());
+      return;
+    }
+    const char* p = text.c_str();
+    if (strncmp(p, "// Tensor '", 11) == 0) {
+      ParseShapeComment(p + 11);
+      return;
+    }
+    const DType* dtype;
+    if (strncmp(p, "const int8_t ", 13) == 0) {
+      dtype = &kInt8;
+      p += 13;
+    } else if (strncmp(p, "const int32_t ", 14) == 0) {
+      dtype = &kInt32;
+      p += 14;
+    } else {
+      return;
+    }
+    const char* name_end = p;
+    while (isalnum(static_cast<unsigned char>(*name_end)) || *name_end == '_') {
+      ++name_end;
+    }
+    const std::string name(p, name_end);
+    if (name.empty()) return;
+
+    if (strncmp(name_end, "[] = {", 6) == 0) {
+      std::vector<long> shape;
+      if (name == shape_name_) shape = shape_;
+      shape_name_.clear();
+      const std::string unique = Unique(name);
+      if (!array_.Open(dir_ + "/" + unique, unique, *dtype, shape)) {
+        CannotWrite(unique);
+        return;
+      }
+      ++arrays_;
+      Values(name_end + 6);
+    } else if (strncmp(name_end, " = ", 3) == 0) {
+      char* end;
+      const long value = strtol(name_end + 3, &end, 0);
+      if (*end == ';') WriteScalar(Unique(name), *dtype, value);
+    }
+  }
+
+  void Finish() {
+    if (array_.is_open()) {
+      fprintf(stderr, "capture_extract: %s cut short\n", array_.name().c_str());
+      array_.Close();
+      cut_short_ = true;
+    }
+  }
+
+  int arrays() const { return arrays_; }
+  int status() const { return unwritable_ ? 2 : cut_short_ ? 1 : 0; }
+
+ private:
+  // Parses "name', Shape: [1, 20, 20, 96]".
+  void ParseShapeComment(const char* p) {
+    const char* quote = strchr(p, '\'');
+    const char* open = strstr(p, "Shape: [");
+    if (quote == nullptr || open == nullptr) return;
+    shape_name_.assign(p, quote);
+    shape_.clear();
+    p = open + 8;
+    while (*p != ']' && *p != '\0') {
+      char* end;
+      shape_.push_back(strtol(p, &end, 10));
+      if (end == p) break;
+      p = end;
+      while (*p == ',' || *p == ' ') ++p;
+    }
+  }
+
+  // Reads values up to the closing brace, which ends the array. int8 values
+  // may come sign-extended, as 0xffffffec.
+  void Values(const char* p) {
+    while (*p != '\0') {
+      if (*p == '}') {
+        const std::string name = array_.name();
+        if (!array_.Close()) {
+          fprintf(stderr,
+                  "capture_extract: %s does not match its shape; "
+                  "written flat\n",
+                  name.c_str());
+        }
+        return;
+      }
+      char* end;
+      const long long value = strtoll(p, &end, 0);
+      if (end != p) {
+        array_.Put(static_cast<long>(value));
+        p = end;
+      } else {
+        ++p;
+      }
+    }
+  }
+
+  void WriteScalar(const std::string& name, const DType& dtype, long value) {
+    const std::string path = dir_ + "/" + name;
+    FILE* npy = fopen((path + ".npy").c_str(), "wb");
+    FILE* h = fopen((path + ".h").c_str(), "w");
+    if (npy != nullptr && h != nullptr) {
+      WriteNpyHeader(npy, dtype, {});
+      WriteValue(npy, dtype, value);
+      fprintf(h, "#pragma once\n#include <stdint.h>\n\n");
+      fprintf(h, "const %s %s = %ld;\n", dtype.c_name, name.c_str(),
+              dtype.size == 1 ? static_cast<long>(static_cast<int8_t>(value))
+                              : static_cast<long>(static_cast<int32_t>(value)));
+      ++arrays_;
+    } else {
+      CannotWrite(name);
+    }
+    if (npy != nullptr) fclose(npy);
+    if (h != nullptr) fclose(h);
+  }
+
+  // The name, numbered if it has been seen before.
+  std::string Unique(const std::string& name) {
+    const int seen = seen_[name]++;
+    return seen == 0 ? name : name + "_" + std::to_string(seen);
+  }
+
+  void CannotWrite(const std::string& name) {
+    fprintf(stderr, "capture_extract: cannot write %s/%s\n", dir_.c_str(),
+            name.c_str());
+    unwritable_ = true;
+  }
+
+  std::string dir_;
+  ArrayWriter array_;
+  // The last "// Tensor" comment.
+  std::string shape_name_;
+  std::vector<long> shape_;
+  // Times each name has been seen.
+  std::map<std::string, int> seen_;
+  int arrays_ = 0;
+  bool cut_short_ = false;
+  bool unwritable_ = false;
+};
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  std::string dir = ".";
+  int arg = 1;
+  if (arg + 1 < argc && strcmp(argv[arg], "-o") == 0) {
+    dir = argv[arg + 1];
+    arg += 2;
+  }
+  if (argc - arg > 1) {
+    fprintf(stderr, "usage: capture_extract [-o dir] [log]\n");
+    return 2;
+  }
+  std::ifstream file;
+  if (arg < argc) {
+    file.open(argv[arg]);
+    if (!file) {
+      fprintf(stderr, "capture_extract: cannot open %s\n", argv[arg]);
+      return 2;
+    }
+  }
+  std::istream& in = arg < argc ? file : std::cin;
+  std::error_code error;
+  std::filesystem::create_directories(dir, error);
+
+  Extractor extractor(dir);
+  std::string line;
+  std::string text;
+  while (std::getline(in, line)) {
+    if (!line.empty() && line.back() == '\r') line.pop_back();
+    if (ConsoleText(line, &text)) extractor.Line(text);
+  }
+  extractor.Finish();
+  fprintf(stderr, "capture_extract: %d arrays in %s\n", extractor.arrays(),
+          dir.c_str());
+  return extractor.status();
+}
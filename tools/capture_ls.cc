@@ -0,0 +1,125 @@
+// Lists the records of a capture archive (see capture_archive.h): one line
+// each with its offset, kind, dtype, shape, op, zero point, requantization
+// channels, encoding, payload size and name.
+//
+//   capture_ls [-c] archive [name...]
+//
+// With names, only records whose name starts with one of them are listed.
+// The archive is mapped rather than read, so a listing touches only the
+// record headers; -c also checks every listed record's CRC, which reads it
+// all. The exit status is 0 if every record parsed (and passed its CRC), 1
+// otherwise and 2 if the archive cannot be opened.
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "capture_archive.h"
+#include "capture_format.h"
+
+namespace {
+
+namespace cf = capture_format;
+
+const char* KindName(uint8_t kind) {
+  switch (kind) {
+    case cf::kTensor:
+      return "tensor";
+    case cf::kQuantParams:
+      return "quant";
+    case cf::kText:
+      return "text";
+    case cf::kAccumulators:
+      return "acc";
+    case cf::kStats:
+      return "stats";
+    default:
+      return "?";
+  }
+}
+
+const char* EncodingName(uint8_t encoding) {
+  switch (encoding) {
+    case cf::kRaw:
+      return "raw";
+    case cf::kRunLength:
+      return "rle";
+    case cf::kDeltaRunLength:
+      return "delta";
+    case cf::kSparse:
+      return "sparse";
+    default:
+      return "?";
+  }
+}
+
+bool Selected(const std::string& name, const std::vector<std::string>& names) {
+  if (names.empty()) return true;
+  for (const std::string& prefix : names) {
+    if (name.compare(0, prefix.size(), prefix) == 0) return true;
+  }
+  return false;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  int arg = 1;
+  bool check = false;
+  if (arg < argc && strcmp(argv[arg], "-c") == 0) {
+    check = true;
+    ++arg;
+  }
+  if (arg >= argc) {
+    fprintf(stderr, "usage: capture_ls [-c] archive [name...]\n");
+    return 2;
+  }
+  capture_archive::Reader reader;
+  const std::string error = reader.Open(argv[arg]);
+  if (!error.empty()) {
+    fprintf(stderr, "capture_ls: %s\n", error.c_str());
+    return 2;
+  }
+  const std::vector<std::string> names(argv + arg + 1, argv + argc);
+
+  printf("%12s %-6s %-5s %-18s %4s %5s %8s %-6s %9s  %s\n", "offset", "kind",
+         "dtype", "shape", "op", "zp", "channels", "code", "bytes", "name");
+  int records = 0;
+  int bad = 0;
+  size_t offset = reader.begin();
+  capture_archive::Record record;
+  for (size_t start = offset; reader.Next(&offset, &record); start = offset) {
+    ++records;
+    const cf::Header& header = record.header;
+    const std::string name = record.Name();
+    if (!Selected(name, names)) continue;
+    std::string shape = "[";
+    for (int i = 0; i < header.rank; ++i) {
+      if (i > 0) shape += ",";
+      shape += std::to_string(record.dim(i));
+    }
+    shape += "]";
+    const std::string op = header.op < 0 ? "-" : std::to_string(header.op);
+    const std::string zero_point =
+        header.has_zero_point ? std::to_string(header.zero_point) : "-";
+    printf("%12zu %-6s %-5s %-18s %4s %5s %8" PRIu32 " %-6s %9" PRIu32 "  %s",
+           start, KindName(header.kind),
+           header.dtype == cf::kInt32 ? "int32" : "int8", shape.c_str(),
+           op.c_str(), zero_point.c_str(), header.channels,
+           EncodingName(header.encoding), header.payload_bytes, name.c_str());
+    if (check && !record.CrcMatches()) {
+      printf("  CRC MISMATCH");
+      ++bad;
+    }
+    printf("\n");
+  }
+  if (offset != reader.size()) {
+    fprintf(stderr, "capture_ls: no record at offset %zu of %zu\n", offset,
+            reader.size());
+    ++bad;
+  }
+  printf("%d records, %zu bytes\n", records, reader.size());
+  return bad == 0 ? 0 : 1;
+}
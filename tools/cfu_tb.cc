@@ -0,0 +1,342 @@
+// Verilator testbench for cfu.v: replays one captured layer through the CFU
+// with the call sequence of the firmware kernel that runs it, and checks
+// every accumulator the CFU returns against the captured or host-computed
+// one.
+//
+//   cfu_tb layer_dir
+//
+// `layer_dir` is one layer as tools/cfu_testbench writes it, and the
+// Makefile written next to it verilates cfu.v with this file and runs every
+// layer. The kernels mirrored are those of conv.cc:
+//
+//   first_layer     FirstLayerConvPerChannel: 3x3x3 patches of seven words
+//   streaming_1x1   StreamingConv1x1PerChannel: MAC4_FIRST, summed here
+//   conv_1x1        Conv1x1ResidualPerChannel: SET_ACC, then MAC4 per word
+//
+// The firmware only runs conv_1x1 for projections folded into a residual ADD
+// (FUSE_RESIDUAL_ADD), so cfu_testbench marks such layers synthetic, and so
+// does the result line.
+//
+// The exit status is 0 if every accumulator matches, 1 if any differs and
+// 2 if the layer cannot be read or the CFU stops answering.
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "VCfu.h"
+#include "verilated.h"
+
+namespace {
+
+// Cycles to wait for the CFU to take a command or answer it.
+constexpr int kMaxWaitCycles = 1000;
+// As in conv.cc.
+constexpr int kFirstLayerPatchSize = 28;
+
+// Drives the CFU bus of cfu.v as the CPU does, one command at a time.
+class Cfu {
+ public:
+  explicit Cfu(VCfu* top) : top_(top) {
+    top_->cmd_valid = 0;
+    top_->rsp_ready = 1;
+    top_->reset = 1;
+    Tick();
+    Tick();
+    top_->reset = 0;
+    top_->eval();
+  }
+
+  // Sends one command and returns the response. Works for a CFU that
+  // answers in the same cycle, as cfu.v does, and for one that takes longer.
+  uint32_t Op(int funct3, int funct7, uint32_t in0, uint32_t in1) {
+    top_->cmd_valid = 1;
+    top_->cmd_payload_function_id = funct7 << 3 | funct3;
+    top_->cmd_payload_inputs_0 = in0;
+    top_->cmd_payload_inputs_1 = in1;
+    top_->eval();
+    ++ops_;
+    for (int wait = 0; wait < kMaxWaitCycles; ++wait) {
+      const bool taken = top_->cmd_ready;
+      if (top_->rsp_valid) {
+        const uint32_t out = top_->rsp_payload_outputs_0;
+        Tick();
+        top_->cmd_valid = 0;
+        top_->eval();
+        return out;
+      }
+      Tick();
+      if (taken) top_->cmd_valid = 0;
+      top_->eval();
+    }
+    fprintf(stderr, "cfu_tb: no response to funct3 %d funct7 %d\n", funct3,
+            funct7);
+    exit(2);
+  }
+
+  // As in mnv2_cfu.h.
+  uint32_t Mac4(uint32_t input, uint32_t filter) {
+    return Op(2, 0, input, filter);
+  }
+  uint32_t Mac4First(uint32_t input, uint32_t filter) {
+    return Op(2, 1, input, filter);
+  }
+  uint32_t SetInputOffset(int32_t offset) { return Op(3, 0, offset, 0); }
+  uint32_t SetAcc(int32_t value) { return Op(3, 1, value, 0); }
+  uint32_t GetAcc() { return Op(3, 2, 0, 0); }
+  uint32_t GetInputOffset() { return Op(3, 3, 0, 0); }
+
+  uint64_t ops() const { return ops_; }
+  uint64_t cycles() const { return cycles_; }
+
+ private:
+  void Tick() {
+    top_->clk = 1;
+    top_->eval();
+    top_->clk = 0;
+    top_->eval();
+    ++cycles_;
+  }
+
+  VCfu* top_;
+  uint64_t ops_ = 0;
+  uint64_t cycles_ = 0;
+};
+
+struct Layer {
+  std::string kernel;
+  bool synthetic;
+  int height, width, depth;
+  int out_height, out_width, out_depth;
+  int stride_height, stride_width;
+  int pad_height, pad_width;
+  // As the kernel sees it: the negated input zero point.
+  int32_t input_offset;
+  // The ifmap and filter packed four int8 values to a word, and zero-padded
+  // to a whole word.
+  std::vector<uint32_t> input;
+  std::vector<uint32_t> filter;
+  std::vector<uint32_t> bias;
+  std::vector<uint32_t> expected;
+
+  int8_t InputByte(size_t i) const { return input[i / 4] >> (8 * (i % 4)); }
+  int8_t FilterByte(size_t i) const { return filter[i / 4] >> (8 * (i % 4)); }
+};
+
+// Reads a $readmemh file of one 32-bit word per line.
+bool ReadHex(const std::string& path, std::vector<uint32_t>* words) {
+  std::ifstream file(path);
+  if (!file) {
+    fprintf(stderr, "cfu_tb: cannot open %s\n", path.c_str());
+    return false;
+  }
+  std::string line;
+  while (std::getline(file, line)) {
+    if (line.empty() || line[0] == '/') continue;
+    words->push_back(strtoul(line.c_str(), nullptr, 16));
+  }
+  return true;
+}
+
+bool ReadLayer(const std::string& dir, Layer* layer) {
+  std::ifstream file(dir + "/layer.txt");
+  if (!file) {
+    fprintf(stderr, "cfu_tb: cannot open %s/layer.txt\n", dir.c_str());
+    return false;
+  }
+  std::map<std::string, std::vector<long>> numbers;
+  std::string line;
+  while (std::getline(file, line)) {
+    std::istringstream fields(line);
+    std::string key;
+    fields >> key;
+    if (key == "kernel") {
+      fields >> layer->kernel;
+      continue;
+    }
+    long value;
+    while (fields >> value) numbers[key].push_back(value);
+  }
+  auto get = [&](const char* key, size_t i) -> long {
+    const auto found = numbers.find(key);
+    return found == numbers.end() || found->second.size() <= i
+               ? 0
+               : found->second[i];
+  };
+  layer->height = get("input", 0);
+  layer->width = get("input", 1);
+  layer->depth = get("input", 2);
+  layer->out_height = get("output", 0);
+  layer->out_width = get("output", 1);
+  layer->out_depth = get("output", 2);
+  layer->stride_height = get("stride", 0);
+  layer->stride_width = get("stride", 1);
+  layer->pad_height = get("padding", 0);
+  layer->pad_width = get("padding", 1);
+  layer->input_offset = get("input_offset", 0);
+  layer->synthetic = get("synthetic", 0) != 0;
+  return ReadHex(dir + "/ifmap.hex", &layer->input) &&
+         ReadHex(dir + "/filter.hex", &layer->filter) &&
+         ReadHex(dir + "/bias.hex", &layer->bias) &&
+         ReadHex(dir + "/expected.hex", &layer->expected);
+}
+
+// FirstLayerConvPerChannel, up to requantization.
+void FirstLayer(Cfu& cfu, const Layer& layer, std::vector<int32_t>* acc) {
+  std::vector<uint32_t> packed(layer.out_depth * kFirstLayerPatchSize / 4);
+  for (int out_channel = 0; out_channel < layer.out_depth; ++out_channel) {
+    uint8_t row[kFirstLayerPatchSize] = {};
+    for (int i = 0; i < 27; ++i) {
+      row[i] = layer.FilterByte(out_channel * 27 + i);
+    }
+    memcpy(&packed[out_channel * kFirstLayerPatchSize / 4], row, sizeof(row));
+  }
+  const int8_t pad_value = static_cast<int8_t>(-layer.input_offset);
+  cfu.SetInputOffset(layer.input_offset);
+
+  union {
+    int8_t bytes[kFirstLayerPatchSize];
+    uint32_t words[kFirstLayerPatchSize / 4];
+  } patch;
+  patch.bytes[kFirstLayerPatchSize - 1] = pad_value;
+  for (int out_y = 0; out_y < layer.out_height; ++out_y) {
+    const int in_y_origin = out_y * layer.stride_height - layer.pad_height;
+    for (int out_x = 0; out_x < layer.out_width; ++out_x) {
+      const int in_x_origin = out_x * layer.stride_width - layer.pad_width;
+      for (int filter_y = 0; filter_y < 3; ++filter_y) {
+        const int in_y = in_y_origin + filter_y;
+        for (int filter_x = 0; filter_x < 3; ++filter_x) {
+          const int in_x = in_x_origin + filter_x;
+          const bool inside = in_x >= 0 && in_x < layer.width && in_y >= 0 &&
+                              in_y < layer.height;
+          for (int c = 0; c < 3; ++c) {
+            patch.bytes[filter_y * 9 + filter_x * 3 + c] =
+                inside ? layer.InputByte((in_y * layer.width + in_x) * 3 + c)
+                       : pad_value;
+          }
+        }
+      }
+      const uint32_t* filter = packed.data();
+      const int out = (out_y * layer.out_width + out_x) * layer.out_depth;
+      for (int out_channel = 0; out_channel < layer.out_depth; ++out_channel) {
+        cfu.SetAcc(layer.bias[out_channel]);
+        for (int w = 0; w < kFirstLayerPatchSize / 4 - 1; ++w) {
+          cfu.Mac4(patch.words[w], filter[w]);
+        }
+        (*acc)[out + out_channel] =
+            cfu.Mac4(patch.words[kFirstLayerPatchSize / 4 - 1],
+                     filter[kFirstLayerPatchSize / 4 - 1]);
+        filter += kFirstLayerPatchSize / 4;
+      }
+    }
+  }
+}
+
+// StreamingConv1x1PerChannel, up to requantization.
+void Streaming1x1(Cfu& cfu, const Layer& layer, std::vector<int32_t>* acc) {
+  const int pixels = layer.out_height * layer.out_width;
+  const int input_words = layer.depth / 4;
+  cfu.SetInputOffset(layer.input_offset);
+  const uint32_t* filter = layer.filter.data();
+  for (int out_channel = 0; out_channel < layer.out_depth; ++out_channel) {
+    for (int p = 0; p < pixels; ++p) {
+      (*acc)[p * layer.out_depth + out_channel] = layer.bias[out_channel];
+    }
+    for (int w = 0; w < input_words; ++w) {
+      const uint32_t weights = *filter++;
+      for (int p = 0; p < pixels; ++p) {
+        (*acc)[p * layer.out_depth + out_channel] += static_cast<int32_t>(
+            cfu.Mac4First(layer.input[p * input_words + w], weights));
+      }
+    }
+  }
+}
+
+// Conv1x1ResidualPerChannel, up to requantization.
+void Conv1x1(Cfu& cfu, const Layer& layer, std::vector<int32_t>* acc) {
+  const int pixels = layer.out_height * layer.out_width;
+  const int input_words = layer.depth / 4;
+  cfu.SetInputOffset(layer.input_offset);
+  for (int p = 0; p < pixels; ++p) {
+    const uint32_t* in = &layer.input[p * input_words];
+    const uint32_t* filter = layer.filter.data();
+    for (int out_channel = 0; out_channel < layer.out_depth; ++out_channel) {
+      cfu.SetAcc(layer.bias[out_channel]);
+      uint32_t result = layer.bias[out_channel];
+      for (int w = 0; w < input_words; ++w) {
+        result = cfu.Mac4(in[w], *filter++);
+      }
+      (*acc)[p * layer.out_depth + out_channel] = result;
+    }
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  Verilated::commandArgs(argc, argv);
+  if (argc != 2) {
+    fprintf(stderr, "usage: cfu_tb layer_dir\n");
+    return 2;
+  }
+  const std::string dir = argv[1];
+  Layer layer;
+  if (!ReadLayer(dir, &layer)) return 2;
+  const size_t outputs =
+      static_cast<size_t>(layer.out_height) * layer.out_width * layer.out_depth;
+  if (layer.expected.size() != outputs ||
+      layer.bias.size() != static_cast<size_t>(layer.out_depth)) {
+    fprintf(stderr,
+            "cfu_tb: %s: %zu expected values and %zu biases for %dx%dx%d\n",
+            dir.c_str(), layer.expected.size(), layer.bias.size(),
+            layer.out_height, layer.out_width, layer.out_depth);
+    return 2;
+  }
+
+  std::unique_ptr<VCfu> top(new VCfu);
+  Cfu cfu(top.get());
+  std::vector<int32_t> acc(outputs);
+  if (layer.kernel == "first_layer") {
+    FirstLayer(cfu, layer, &acc);
+  } else if (layer.kernel == "streaming_1x1") {
+    Streaming1x1(cfu, layer, &acc);
+  } else if (layer.kernel == "conv_1x1") {
+    Conv1x1(cfu, layer, &acc);
+  } else {
+    fprintf(stderr, "cfu_tb: %s: unknown kernel '%s'\n", dir.c_str(),
+            layer.kernel.c_str());
+    return 2;
+  }
+  int differ = 0;
+  const int32_t input_offset = cfu.GetInputOffset();
+  if (input_offset != layer.input_offset) {
+    printf("%s: input offset reads back as %d, set to %d\n", dir.c_str(),
+           input_offset, layer.input_offset);
+    ++differ;
+  }
+  for (size_t i = 0; i < outputs; ++i) {
+    const int32_t expected = static_cast<int32_t>(layer.expected[i]);
+    if (acc[i] == expected) continue;
+    if (differ++ == 0) {
+      printf("%s: first difference at y=%zu x=%zu c=%zu: %d, expected %d\n",
+             dir.c_str(), i / layer.out_depth / layer.out_width,
+             i / layer.out_depth % layer.out_width, i % layer.out_depth,
+             acc[i], expected);
+    }
+  }
+  printf("%s: %s%s, %zu accumulators, %d differ; %llu CFU ops in %llu "
+         "cycles\n",
+         dir.c_str(), layer.kernel.c_str(),
+         layer.synthetic ? " (synthetic)" : "", outputs, differ,
+         static_cast<unsigned long long>(cfu.ops()),
+         static_cast<unsigned long long>(cfu.cycles()));
+  top->final();
+  return differ == 0 ? 0 : 1;
+}
@@ -0,0 +1,401 @@
+// Turns captured conv layers into Verilator testbenches for cfu.v, so that
+// the RTL can be checked against dozens of real layers at once.
+//
+//   cfu_testbench [-o dir] [-c cfu.v] [-s] capture_dir [layer...]
+//
+// `capture_dir` holds the arrays that capture_extract wrote from a log, and
+// each layer is a capture prefix such as bn5_pr or op63_conv_2d; by default
+// every layer there with a filter is tried. Numbered captures (bn5_pr_ifmap_1
+// and so on) become layers of their own, bn5_pr_1.
+//
+// Each layer the firmware runs on the CFU gets a directory in `dir`
+// (cfu_tb by default) of $readmemh memories, one 32-bit word per line, and
+// the shape and kernel in layer.txt:
+//
+//   ifmap.hex     the input, four int8 values to a word
+//   filter.hex    the filter, likewise
+//   bias.hex      one bias per output channel
+//   expected.hex  one accumulator per output, from <layer>_acc if captured
+//                 and computed here otherwise
+//
+// Next to them go tools/cfu_tb.cc, the driver that replays the firmware's
+// CFU calls for a layer, and a Makefile that verilates cfu.v with it and
+// runs every layer: `make -C cfu_tb -j$(nproc)`. Layers the firmware runs
+// without the CFU, such as depthwise convs, are skipped.
+//
+// That includes the 1x1 convs on maps too big for the streaming kernel: the
+// firmware runs them with reference ConvPerChannel, or, built with
+// FUSE_RESIDUAL_ADD, a projection folded into a residual ADD on the CFU with
+// Conv1x1ResidualPerChannel. A capture does not say which, so -s writes them
+// all with that kernel's call sequence and marks them synthetic in layer.txt
+// and in what cfu_tb prints. They still check the RTL, but not a sequence
+// the firmware is known to issue for that layer.
+//
+// The exit status is 0 if every layer named was written (or, naming none, if
+// any was), 1 if one was skipped and 2 if the arrays or cfu.v cannot be read.
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "npy.h"
+
+namespace fs = std::filesystem;
+
+namespace {
+
+// As in conv.cc.
+constexpr int kMaxStreamingPixels = 32;
+
+struct Layer {
+  std::string name;
+  std::string kernel;
+  NpyArray ifmap;
+  NpyArray filter;
+  NpyArray bias;
+  int out_height, out_width;
+  int stride_height, stride_width;
+  int pad_height, pad_width;
+  int32_t input_offset;
+  std::vector<int32_t> expected;
+  // Not a call sequence the firmware is known to issue for this layer.
+  bool synthetic = false;
+};
+
+class Reader {
+ public:
+  explicit Reader(const std::string& dir) : dir_(dir) {}
+
+  bool Exists(const std::string& name) const {
+    return fs::exists(dir_ + "/" + name + ".npy");
+  }
+
+  bool Read(const std::string& name, NpyArray* array) const {
+    if (ReadNpy(dir_ + "/" + name + ".npy", array)) return true;
+    fprintf(stderr, "cfu_testbench: cannot read %s/%s.npy\n", dir_.c_str(),
+            name.c_str());
+    return false;
+  }
+
+  // Every layer with a filter: "bn5_pr" for bn5_pr_filter.npy, "bn5_pr_1"
+  // for bn5_pr_filter_1.npy.
+  std::vector<std::string> Layers() const {
+    std::vector<std::string> layers;
+    for (const fs::directory_entry& entry : fs::directory_iterator(dir_)) {
+      if (entry.path().extension() != ".npy") continue;
+      const std::string stem = entry.path().stem().string();
+      const size_t at = stem.rfind("_filter");
+      if (at == std::string::npos || at == 0) continue;
+      const std::string rest = stem.substr(at + 7);
+      if (!rest.empty() &&
+          (rest[0] != '_' || rest.size() == 1 ||
+           rest.find_first_not_of("0123456789", 1) != std::string::npos)) {
+        continue;
+      }
+      layers.push_back(stem.substr(0, at) + rest);
+    }
+    std::sort(layers.begin(), layers.end());
+    return layers;
+  }
+
+  // The array `tensor` of `layer`: bn5_pr_1 and ifmap give bn5_pr_ifmap_1.
+  static std::string Name(const std::string& layer, const char* tensor) {
+    size_t at = layer.rfind('_');
+    if (at != std::string::npos && at + 1 < layer.size() &&
+        layer.find_first_not_of("0123456789", at + 1) == std::string::npos) {
+      return layer.substr(0, at) + "_" + tensor + layer.substr(at);
+    }
+    return layer + "_" + tensor;
+  }
+
+ private:
+  std::string dir_;
+};
+
+// Sets the output shape, stride and SAME padding from the input and output
+// heights and widths.
+void SetGeometry(Layer* layer, int out_height, int out_width) {
+  const int height = layer->ifmap.dim(1);
+  const int width = layer->ifmap.dim(2);
+  layer->out_height = out_height;
+  layer->out_width = out_width;
+  layer->stride_height = (height + out_height - 1) / out_height;
+  layer->stride_width = (width + out_width - 1) / out_width;
+  layer->pad_height = std::max((out_height - 1) * layer->stride_height +
+                                   layer->filter.dim(1) - height,
+                               0) /
+                      2;
+  layer->pad_width = std::max((out_width - 1) * layer->stride_width +
+                                  layer->filter.dim(2) - width,
+                              0) /
+                     2;
+}
+
+// The accumulators of ConvPerChannel, with int32 wraparound as on the CFU.
+std::vector<int32_t> Accumulators(const Layer& layer) {
+  const int height = layer.ifmap.dim(1);
+  const int width = layer.ifmap.dim(2);
+  const int depth = layer.ifmap.dim(3);
+  const int out_depth = layer.filter.dim(0);
+  const int filter_height = layer.filter.dim(1);
+  const int filter_width = layer.filter.dim(2);
+  std::vector<int32_t> acc;
+  acc.reserve(static_cast<size_t>(layer.out_height) * layer.out_width *
+              out_depth);
+  for (int out_y = 0; out_y < layer.out_height; ++out_y) {
+    for (int out_x = 0; out_x < layer.out_width; ++out_x) {
+      for (int o = 0; o < out_depth; ++o) {
+        uint32_t sum = layer.bias.values[o];
+        for (int fy = 0; fy < filter_height; ++fy) {
+          const int y = out_y * layer.stride_height - layer.pad_height + fy;
+          if (y < 0 || y >= height) continue;
+          for (int fx = 0; fx < filter_width; ++fx) {
+            const int x = out_x * layer.stride_width - layer.pad_width + fx;
+            if (x < 0 || x >= width) continue;
+            for (int c = 0; c < depth; ++c) {
+              sum += static_cast<uint32_t>(
+                  layer.filter.i8(((o * filter_height + fy) * filter_width +
+                                   fx) *
+                                      depth +
+                                  c) *
+                  (layer.ifmap.i8((y * width + x) * depth + c) +
+                   layer.input_offset));
+            }
+          }
+        }
+        acc.push_back(static_cast<int32_t>(sum));
+      }
+    }
+  }
+  return acc;
+}
+
+// Reads `name` and works out which kernel runs it. Returns false, having
+// said why, if there is nothing for the CFU to run, counting synthetic layers
+// only if `synthetic` is set.
+bool LoadLayer(const Reader& reader, const std::string& name, bool synthetic,
+               Layer* layer) {
+  layer->name = name;
+  NpyArray zero_point;
+  if (!reader.Read(Reader::Name(name, "ifmap"), &layer->ifmap) ||
+      !reader.Read(Reader::Name(name, "filter"), &layer->filter) ||
+      !reader.Read(Reader::Name(name, "bias"), &layer->bias) ||
+      !reader.Read(Reader::Name(name, "input_offset"), &zero_point) ||
+      zero_point.values.size() != 1) {
+    return false;
+  }
+  layer->input_offset = -zero_point.values[0];
+  const NpyArray& ifmap = layer->ifmap;
+  const NpyArray& filter = layer->filter;
+  if (ifmap.shape.size() != 4 || filter.shape.size() != 4 ||
+      filter.dim(3) != ifmap.dim(3) ||
+      layer->bias.values.size() != static_cast<size_t>(filter.dim(0))) {
+    printf("%s: skipped, not a CONV_2D\n", name.c_str());
+    return false;
+  }
+
+  NpyArray acc;
+  NpyArray ofmap;
+  const bool have_acc = reader.Exists(Reader::Name(name, "acc")) &&
+                        reader.Read(Reader::Name(name, "acc"), &acc) &&
+                        acc.shape.size() == 4;
+  const bool have_ofmap = reader.Exists(Reader::Name(name, "ofmap")) &&
+                          reader.Read(Reader::Name(name, "ofmap"), &ofmap) &&
+                          ofmap.shape.size() == 4;
+  if (filter.dim(1) == 1 && filter.dim(2) == 1 && ifmap.dim(3) % 4 == 0) {
+    SetGeometry(layer, ifmap.dim(1), ifmap.dim(2));
+    if (ifmap.dim(1) * ifmap.dim(2) <= kMaxStreamingPixels) {
+      layer->kernel = "streaming_1x1";
+    } else if (synthetic) {
+      layer->kernel = "conv_1x1";
+      layer->synthetic = true;
+    } else {
+      printf("%s: skipped, the firmware runs it on the CFU only as a folded "
+             "residual projection; -s writes it as a synthetic layer\n",
+             name.c_str());
+      return false;
+    }
+  } else if (ifmap.dim(3) == 3 && filter.dim(1) == 3 && filter.dim(2) == 3) {
+    if (!have_acc && !have_ofmap) {
+      printf("%s: skipped, needs %s for its output shape\n", name.c_str(),
+             Reader::Name(name, "ofmap").c_str());
+      return false;
+    }
+    const NpyArray& shape = have_acc ? acc : ofmap;
+    SetGeometry(layer, shape.dim(1), shape.dim(2));
+    layer->kernel = "first_layer";
+  } else {
+    printf("%s: skipped, the firmware runs it without the CFU\n",
+           name.c_str());
+    return false;
+  }
+
+  const size_t outputs = static_cast<size_t>(layer->out_height) *
+                         layer->out_width * filter.dim(0);
+  if (have_acc && acc.values.size() == outputs) {
+    layer->expected = acc.values;
+  } else {
+    layer->expected = Accumulators(*layer);
+  }
+  return true;
+}
+
+bool WriteWords(const fs::path& path, const std::vector<uint32_t>& words) {
+  FILE* file = fopen(path.c_str(), "w");
+  if (file == nullptr) return false;
+  for (const uint32_t word : words) fprintf(file, "%08x\n", word);
+  return fclose(file) == 0;
+}
+
+// int8 values four to a word, the first in the low byte, as the CPU loads
+// them.
+std::vector<uint32_t> PackBytes(const NpyArray& array) {
+  std::vector<uint32_t> words((array.values.size() + 3) / 4);
+  for (size_t i = 0; i < array.values.size(); ++i) {
+    words[i / 4] |= static_cast<uint32_t>(static_cast<uint8_t>(array.i8(i)))
+                    << (8 * (i % 4));
+  }
+  return words;
+}
+
+bool WriteLayer(const fs::path& dir, const Layer& layer) {
+  std::error_code error;
+  fs::create_directories(dir, error);
+  FILE* file = fopen((dir / "layer.txt").c_str(), "w");
+  if (file == nullptr) return false;
+  fprintf(file, "kernel %s\n", layer.kernel.c_str());
+  if (layer.synthetic) fprintf(file, "synthetic 1\n");
+  fprintf(file, "input %d %d %d\n", layer.ifmap.dim(1), layer.ifmap.dim(2),
+          layer.ifmap.dim(3));
+  fprintf(file, "output %d %d %d\n", layer.out_height, layer.out_width,
+          layer.filter.dim(0));
+  fprintf(file, "stride %d %d\n", layer.stride_height, layer.stride_width);
+  fprintf(file, "padding %d %d\n", layer.pad_height, layer.pad_width);
+  fprintf(file, "input_offset %d\n", layer.input_offset);
+  if (fclose(file) != 0) return false;
+
+  const std::vector<uint32_t> bias(layer.bias.values.begin(),
+                                   layer.bias.values.end());
+  const std::vector<uint32_t> expected(layer.expected.begin(),
+                                       layer.expected.end());
+  return WriteWords(dir / "ifmap.hex", PackBytes(layer.ifmap)) &&
+         WriteWords(dir / "filter.hex", PackBytes(layer.filter)) &&
+         WriteWords(dir / "bias.hex", bias) &&
+         WriteWords(dir / "expected.hex", expected);
+}
+
+bool WriteMakefile(const fs::path& dir, const fs::path& cfu_v,
+                   const std::vector<std::string>& layers) {
+  FILE* file = fopen((dir / "Makefile").c_str(), "w");
+  if (file == nullptr) return false;
+  fprintf(file,
+          "# Written by tools/cfu_testbench. Verilates cfu.v with cfu_tb.cc "
+          "and runs\n"
+          "# every layer; -j runs layers in parallel and -k goes on past a "
+          "failing one.\n\n"
+          "VERILATOR ?= verilator\n"
+          "CFU_V := %s\n"
+          "LAYERS :=",
+          cfu_v.c_str());
+  for (const std::string& layer : layers) fprintf(file, " %s", layer.c_str());
+  fprintf(file,
+          "\n\n"
+          "all: $(LAYERS:%%=%%/pass)\n\n"
+          "obj_dir/cfu_tb: cfu_tb.cc $(CFU_V)\n"
+          "\t$(VERILATOR) --cc --exe --build -O3 -Wno-fatal --top-module Cfu "
+          "\\\n"
+          "\t    -Mdir obj_dir -o cfu_tb $(CFU_V) $(CURDIR)/cfu_tb.cc\n\n"
+          "%%/pass: obj_dir/cfu_tb %%/layer.txt\n"
+          "\tobj_dir/cfu_tb $* && touch $@\n\n"
+          "clean:\n"
+          "\trm -rf obj_dir $(LAYERS:%%=%%/pass)\n\n"
+          ".PHONY: all clean\n");
+  return fclose(file) == 0;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  std::string out = "cfu_tb";
+  std::string cfu_v;
+  bool synthetic = false;
+  int arg = 1;
+  while (arg < argc && argv[arg][0] == '-') {
+    if (strcmp(argv[arg], "-s") == 0) {
+      synthetic = true;
+      ++arg;
+      continue;
+    }
+    if (arg + 1 >= argc) break;
+    if (strcmp(argv[arg], "-o") == 0) {
+      out = argv[arg + 1];
+    } else if (strcmp(argv[arg], "-c") == 0) {
+      cfu_v = argv[arg + 1];
+    } else {
+      break;
+    }
+    arg += 2;
+  }
+  if (arg >= argc || argv[arg][0] == '-') {
+    fprintf(stderr,
+            "usage: cfu_testbench [-o dir] [-c cfu.v] [-s] capture_dir "
+            "[layer...]\n");
+    return 2;
+  }
+  // Run from the project or from tools/, cfu.v is found without -c.
+  if (cfu_v.empty()) cfu_v = fs::exists("cfu.v") ? "cfu.v" : "../cfu.v";
+  std::error_code error;
+  const fs::path cfu_path = fs::canonical(cfu_v, error);
+  const fs::path driver = cfu_path.parent_path() / "tools" / "cfu_tb.cc";
+  if (error || !fs::exists(driver)) {
+    fprintf(stderr, "cfu_testbench: cannot find %s and tools/cfu_tb.cc\n",
+            cfu_v.c_str());
+    return 2;
+  }
+
+  const Reader reader(argv[arg]);
+  if (!fs::is_directory(argv[arg])) {
+    fprintf(stderr, "cfu_testbench: cannot read %s\n", argv[arg]);
+    return 2;
+  }
+  std::vector<std::string> names(argv + arg + 1, argv + argc);
+  const bool every_layer = names.empty();
+  if (every_layer) names = reader.Layers();
+
+  int skipped = 0;
+  std::vector<std::string> written;
+  for (const std::string& name : names) {
+    Layer layer;
+    if (!LoadLayer(reader, name, synthetic, &layer)) {
+      ++skipped;
+      continue;
+    }
+    if (!WriteLayer(fs::path(out) / name, layer)) {
+      fprintf(stderr, "cfu_testbench: cannot write %s/%s\n", out.c_str(),
+              name.c_str());
+      return 2;
+    }
+    printf("%s: %s%s, %dx%dx%d -> %dx%dx%d\n", name.c_str(),
+           layer.kernel.c_str(), layer.synthetic ? " (synthetic)" : "",
+           layer.ifmap.dim(1), layer.ifmap.dim(2), layer.ifmap.dim(3),
+           layer.out_height, layer.out_width, layer.filter.dim(0));
+    written.push_back(name);
+  }
+  if (written.empty()) {
+    fprintf(stderr, "cfu_testbench: no layer for the CFU in %s\n", argv[arg]);
+    return 2;
+  }
+  fs::copy_file(driver, fs::path(out) / "cfu_tb.cc",
+                fs::copy_options::overwrite_existing, error);
+  if (error || !WriteMakefile(out, cfu_path, written)) {
+    fprintf(stderr, "cfu_testbench: cannot write %s\n", out.c_str());
+    return 2;
+  }
+  printf("%zu layers in %s; run them with make -C %s -j\n", written.size(),
+         out.c_str(), out.c_str());
+  return skipped == 0 || every_layer ? 0 : 1;
+}
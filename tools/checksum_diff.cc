@@ -0,0 +1,144 @@
+// Compares the op checksum tables (see src/op_checksums.h) of two console
+// logs and reports the first op whose output differs.
+//
+//   checksum_diff before.log after.log
+//
+// Each log may hold several tables, one per inference; the n-th table of one
+// is compared with the n-th table of the other. Logs are read as by
+// capture_decode. The exit status is 0 if every table matches, 1 if any op
+// differs and 2 if the logs cannot be compared.
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "console_log.h"
+
+namespace {
+
+constexpr char kTableHeader[] = "\"Event\",\"Tag\",\"Checksum\"";
+
+struct OpChecksum {
+  std::string tag;
+  uint32_t checksum;
+};
+
+using Table = std::map<int, OpChecksum>;
+
+// Parses "15,DEPTHWISE_CONV_2D,0x1c9a07e3".
+bool ParseRow(const std::string& text, int* op, OpChecksum* row) {
+  const size_t first = text.find(',');
+  const size_t second = text.find(',', first + 1);
+  if (first == std::string::npos || second == std::string::npos) return false;
+  char* end;
+  *op = strtol(text.c_str(), &end, 10);
+  if (end != text.c_str() + first) return false;
+  row->tag = text.substr(first + 1, second - first - 1);
+  const char* hex = text.c_str() + second + 1;
+  if (hex[0] != '0' || hex[1] != 'x') return false;
+  row->checksum = strtoul(hex + 2, &end, 16);
+  return end != hex + 2 && *end == '\0';
+}
+
+bool ReadTables(const char* path, std::vector<Table>* tables) {
+  std::ifstream file(path);
+  if (!file) {
+    fprintf(stderr, "checksum_diff: cannot open %s\n", path);
+    return false;
+  }
+  std::string line;
+  std::string text;
+  bool in_table = false;
+  while (std::getline(file, line)) {
+    if (!line.empty() && line.back() == '\r') line.pop_back();
+    if (!ConsoleText(line, &text)) continue;
+    if (text == kTableHeader) {
+      tables->emplace_back();
+      in_table = true;
+      continue;
+    }
+    int op;
+    OpChecksum row;
+    if (in_table && ParseRow(text, &op, &row)) {
+      tables->back()[op] = row;
+    } else {
+      in_table = false;
+    }
+  }
+  return true;
+}
+
+// Returns the number of ops that differ.
+int CompareTables(int number, const Table& a, const Table& b) {
+  int differ = 0;
+  auto report = [&](int op, const char* message) {
+    if (differ++ == 0) {
+      printf("inference %d: first divergence at op %d\n", number, op);
+    }
+    printf("  %s\n", message);
+  };
+  std::set<int> ops;
+  for (const auto& entry : a) ops.insert(entry.first);
+  for (const auto& entry : b) ops.insert(entry.first);
+  char message[160];
+  for (const int op : ops) {
+    const auto in_a = a.find(op);
+    const auto in_b = b.find(op);
+    if (in_b == b.end()) {
+      snprintf(message, sizeof(message), "op %d %s: only in the first log", op,
+               in_a->second.tag.c_str());
+      report(op, message);
+    } else if (in_a == a.end()) {
+      snprintf(message, sizeof(message), "op %d %s: only in the second log",
+               op, in_b->second.tag.c_str());
+      report(op, message);
+    } else if (in_a->second.checksum != in_b->second.checksum ||
+               in_a->second.tag != in_b->second.tag) {
+      snprintf(message, sizeof(message),
+               "op %d %s: 0x%08" PRIx32 " vs %s 0x%08" PRIx32, op,
+               in_a->second.tag.c_str(), in_a->second.checksum,
+               in_b->second.tag.c_str(), in_b->second.checksum);
+      report(op, message);
+    }
+  }
+  if (differ == 0) {
+    printf("inference %d: %zu ops match\n", number, a.size());
+  } else {
+    printf("inference %d: %d of %zu ops differ\n", number, differ,
+           ops.size());
+  }
+  return differ;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc != 3) {
+    fprintf(stderr, "usage: checksum_diff before.log after.log\n");
+    return 2;
+  }
+  std::vector<Table> a;
+  std::vector<Table> b;
+  if (!ReadTables(argv[1], &a) || !ReadTables(argv[2], &b)) return 2;
+  if (a.empty() || b.empty()) {
+    fprintf(stderr, "checksum_diff: no checksum table in %s\n",
+            a.empty() ? argv[1] : argv[2]);
+    return 2;
+  }
+  if (a.size() != b.size()) {
+    printf("%zu tables vs %zu; comparing the first %zu\n", a.size(), b.size(),
+           std::min(a.size(), b.size()));
+  }
+
+  int differ = 0;
+  for (size_t i = 0; i < a.size() && i < b.size(); ++i) {
+    differ += CompareTables(i + 1, a[i], b[i]);
+  }
+  return differ == 0 ? 0 : 1;
+}
@@ -0,0 +1,21 @@
+#pragma once
+#include <string>
+
+// Console text of a log line, for the host tools. Renode lines look like
+//   12:03:31.0910 [INFO] uart: [host: 0.33s (+0.33s)|virt: 8.6ms] text
+// and other Renode output is dropped; anything else is console text as is.
+// Returns false for a line to drop.
+inline bool ConsoleText(const std::string& line, std::string* text) {
+  const size_t uart = line.find("] uart: [host:");
+  if (uart != std::string::npos) {
+    const size_t end = line.find("] ", uart + 2);
+    *text = end == std::string::npos ? "" : line.substr(end + 2);
+    return true;
+  }
+  if (line.size() > 14 && line[2] == ':' && line[5] == ':' &&
+      line.find(" [") == 13) {
+    return false;
+  }
+  *text = line;
+  return true;
+}
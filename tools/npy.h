@@ -0,0 +1,72 @@
+#pragma once
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// An int8 or int32 array as capture_extract writes it, for the host tools
+// that read those arrays back.
+struct NpyArray {
+  std::vector<int> shape;
+  std::vector<int32_t> values;
+
+  int dim(int i) const { return shape[i]; }
+  int8_t i8(size_t i) const { return static_cast<int8_t>(values[i]); }
+};
+
+// Reads a little-endian int8 or int32 .npy file. Returns false if it cannot
+// be read or holds anything else.
+inline bool ReadNpy(const std::string& path, NpyArray* array) {
+  std::ifstream file(path, std::ios::binary);
+  if (!file) return false;
+  char preamble[10];
+  if (!file.read(preamble, sizeof(preamble)) ||
+      memcmp(preamble, "\x93NUMPY", 6) != 0 || preamble[6] != 1) {
+    return false;
+  }
+  const int header_length = static_cast<uint8_t>(preamble[8]) |
+                            static_cast<uint8_t>(preamble[9]) << 8;
+  std::string header(header_length, '\0');
+  if (!file.read(&header[0], header_length)) return false;
+
+  int size;
+  if (header.find("'descr': '|i1'") != std::string::npos) {
+    size = 1;
+  } else if (header.find("'descr': '<i4'") != std::string::npos) {
+    size = 4;
+  } else {
+    return false;
+  }
+  const size_t open = header.find("'shape': (");
+  if (open == std::string::npos) return false;
+  array->shape.clear();
+  size_t count = 1;
+  for (const char* p = header.c_str() + open + 10; *p != ')';) {
+    char* end;
+    const long dim = strtol(p, &end, 10);
+    if (end == p) break;
+    array->shape.push_back(dim);
+    count *= dim;
+    p = end;
+    while (*p == ',' || *p == ' ') ++p;
+  }
+
+  std::vector<uint8_t> bytes(count * size);
+  if (!file.read(reinterpret_cast<char*>(bytes.data()), bytes.size())) {
+    return false;
+  }
+  array->values.resize(count);
+  for (size_t i = 0; i < count; ++i) {
+    if (size == 1) {
+      array->values[i] = static_cast<int8_t>(bytes[i]);
+    } else {
+      const uint8_t* b = &bytes[4 * i];
+      array->values[i] = static_cast<int32_t>(b[0] | b[1] << 8 | b[2] << 16 |
+                                              static_cast<uint32_t>(b[3])
+                                                  << 24);
+    }
+  }
+  return true;
+}
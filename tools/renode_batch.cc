@@ -0,0 +1,360 @@
+// Runs several builds of the firmware under headless Renode at once, drives
+// their menus and compares the tick tables of the runs, for sweeping
+// kernels, CFU variants and capture targets overnight on one machine.
+//
+//   renode_batch [-j jobs] [-o dir] [-r renode] [-T minutes] jobs.txt
+//
+// Each line of jobs.txt is one run: a name, the firmware ELF, the Renode
+// script the project build generated for it, and the menu keys to type,
+// by default the golden tests of mnv2:
+//
+//   # name      elf                          script                  keys
+//   baseline    base/software.elf            base/renode/mnv2.resc   1 1 g
+//   fused_add   fused/software.elf           fused/renode/mnv2.resc  1 1 g
+//
+// For each run a wrapper script sets $bin, which the LiteX Renode scripts
+// load, to the ELF, includes the project's script, connects the UART to a
+// socket terminal and starts the machine. Each key goes out once the console
+// shows a menu prompt ("mnv2> "), and the run ends at the prompt after the
+// last key, or after `minutes` (60 by default). If no prompt appears within
+// kFirstPromptSeconds, e.g. because the script started the machine before
+// the terminal was connected, the first key goes out anyway.
+//
+// Up to `jobs` runs (by default a quarter of the host's cores, as each
+// Renode uses several) go at once. The console of run `name` is written to
+// dir/name.log, in the plain form the other tools read, and Renode's own
+// output to dir/name.renode.log. Then tick_diff compares the runs, the first
+// as the baseline. The exit status is that of tick_diff, or 2 if a run fails.
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <signal.h>
+#include <spawn.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+// Socket terminals listen on kBasePort + the run's number.
+constexpr int kBasePort = 33400;
+constexpr int kConnectSeconds = 120;
+constexpr int kFirstPromptSeconds = 30;
+// Time Renode has to quit before it is killed.
+constexpr int kQuitSeconds = 10;
+
+struct Job {
+  std::string name;
+  std::string elf;
+  std::string script;
+  std::vector<std::string> keys;
+};
+
+struct Options {
+  int jobs;
+  fs::path dir;
+  std::string renode;
+  int minutes;
+};
+
+using Clock = std::chrono::steady_clock;
+
+std::mutex print_mutex;
+
+void Note(const char* format, const std::string& name,
+          const std::string& detail = "") {
+  std::lock_guard<std::mutex> lock(print_mutex);
+  printf(format, name.c_str(), detail.c_str());
+  fflush(stdout);
+}
+
+bool ReadJobs(const char* path, std::vector<Job>* jobs) {
+  std::ifstream file(path);
+  if (!file) {
+    fprintf(stderr, "renode_batch: cannot open %s\n", path);
+    return false;
+  }
+  std::string line;
+  for (int number = 1; std::getline(file, line); ++number) {
+    const size_t hash = line.find('#');
+    if (hash != std::string::npos) line.resize(hash);
+    std::istringstream fields(line);
+    Job job;
+    if (!(fields >> job.name)) continue;
+    if (!(fields >> job.elf >> job.script)) {
+      fprintf(stderr,
+              "renode_batch: %s:%d: needs a name, an ELF and a script\n", path,
+              number);
+      return false;
+    }
+    std::string key;
+    while (fields >> key) job.keys.push_back(key);
+    if (job.keys.empty()) job.keys = {"1", "1", "g"};
+    jobs->push_back(job);
+  }
+  return true;
+}
+
+bool WriteScript(const fs::path& path, const Job& job, int port) {
+  FILE* script = fopen(path.c_str(), "we");
+  if (script == nullptr) return false;
+  fprintf(script,
+          "$bin=@%s\n"
+          "i @%s\n"
+          "emulation CreateServerSocketTerminal %d \"batch_uart\" false\n"
+          "connector Connect sysbus.uart batch_uart\n"
+          "start\n",
+          fs::absolute(job.elf).c_str(), fs::absolute(job.script).c_str(),
+          port);
+  return fclose(script) == 0;
+}
+
+// Starts Renode on `script`, its output going to `log`. Returns its pid and
+// the write end of its monitor's stdin.
+//
+// Jobs start Renode from several threads at once, so there is no fork here:
+// posix_spawn sets up the child from what the parent prepared, and every
+// descriptor the tool opens is close-on-exec, so that no Renode inherits a
+// sibling's monitor pipe, console socket or log.
+pid_t StartRenode(const Options& options, const fs::path& script,
+                  const fs::path& log, int* monitor) {
+  int pipe_fds[2];
+  if (pipe2(pipe_fds, O_CLOEXEC) != 0) return -1;
+  const std::string include = "i @" + script.string();
+  const char* argv[] = {options.renode.c_str(), "--disable-xwt", "--console",
+                        "--plain", "-e", include.c_str(), nullptr};
+
+  posix_spawn_file_actions_t actions;
+  posix_spawn_file_actions_init(&actions);
+  posix_spawn_file_actions_addopen(&actions, 1, log.c_str(),
+                                   O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  posix_spawn_file_actions_adddup2(&actions, 1, 2);
+  posix_spawn_file_actions_adddup2(&actions, pipe_fds[0], 0);
+  pid_t pid;
+  const int error =
+      posix_spawnp(&pid, options.renode.c_str(), &actions, nullptr,
+                   const_cast<char* const*>(argv), environ);
+  posix_spawn_file_actions_destroy(&actions);
+  close(pipe_fds[0]);
+  if (error != 0) {
+    close(pipe_fds[1]);
+    return -1;
+  }
+  *monitor = pipe_fds[1];
+  return pid;
+}
+
+void StopRenode(pid_t pid, int monitor) {
+  const char quit[] = "quit\n";
+  if (write(monitor, quit, sizeof(quit) - 1) < 0) {
+    // Renode has gone already; waitpid below reaps it.
+  }
+  close(monitor);
+  const Clock::time_point deadline =
+      Clock::now() + std::chrono::seconds(kQuitSeconds);
+  while (Clock::now() < deadline) {
+    if (waitpid(pid, nullptr, WNOHANG) == pid) return;
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  }
+  kill(pid, SIGKILL);
+  waitpid(pid, nullptr, 0);
+}
+
+// Connects to the socket terminal, waiting for Renode to open it.
+int Connect(int port, pid_t renode) {
+  const Clock::time_point deadline =
+      Clock::now() + std::chrono::seconds(kConnectSeconds);
+  sockaddr_in address = {};
+  address.sin_family = AF_INET;
+  address.sin_port = htons(port);
+  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  while (Clock::now() < deadline) {
+    if (waitpid(renode, nullptr, WNOHANG) == renode) return -1;
+    const int fd = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0) return -1;
+    if (connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) ==
+        0) {
+      return fd;
+    }
+    close(fd);
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+  }
+  return -1;
+}
+
+// Types the keys of `job` into the console on `fd` and writes what it prints
+// to `log`. Returns an error message, or "" once the last key's prompt is
+// back.
+std::string DriveConsole(const Job& job, int fd, const fs::path& log,
+                         const Clock::time_point deadline) {
+  FILE* out = fopen(log.c_str(), "we");
+  if (out == nullptr) return "cannot write " + log.string();
+  std::string line;
+  size_t next_key = 0;
+  Clock::time_point last_key = Clock::now();
+  // Whether a key has gone out since the console last printed anything.
+  bool answered = false;
+  std::string error;
+  for (;;) {
+    // A prompt is a line, not yet ended, such as "mnv2> ".
+    const bool prompt = !answered && line.size() >= 2 &&
+                        line.compare(line.size() - 2, 2, "> ") == 0;
+    const bool first_timeout =
+        next_key == 0 && Clock::now() - last_key >
+                             std::chrono::seconds(kFirstPromptSeconds);
+    if (prompt || first_timeout) {
+      if (next_key == job.keys.size()) break;
+      const std::string& key = job.keys[next_key++];
+      if (send(fd, key.data(), key.size(), 0) < 0) {
+        error = "console closed";
+        break;
+      }
+      last_key = Clock::now();
+      answered = true;
+    }
+    if (Clock::now() > deadline) {
+      error = "timed out";
+      break;
+    }
+    pollfd poll_fd = {fd, POLLIN, 0};
+    if (poll(&poll_fd, 1, 1000) <= 0) continue;
+    char buffer[4096];
+    const ssize_t size = recv(fd, buffer, sizeof(buffer), 0);
+    if (size <= 0) {
+      error = "console closed";
+      break;
+    }
+    answered = false;
+    for (ssize_t i = 0; i < size; ++i) {
+      const char c = buffer[i];
+      if (c == '\r') continue;
+      if (c == '\n') {
+        fprintf(out, "%s\n", line.c_str());
+        line.clear();
+      } else {
+        line += c;
+      }
+    }
+  }
+  if (!line.empty()) fprintf(out, "%s\n", line.c_str());
+  fclose(out);
+  return error;
+}
+
+// Runs `job` to the end. Returns an error message, or "".
+std::string RunJob(const Options& options, const Job& job, int port) {
+  const fs::path script = options.dir / (job.name + ".resc");
+  if (!WriteScript(script, job, port)) return "cannot write " + script.string();
+  int monitor;
+  const pid_t pid = StartRenode(
+      options, script, options.dir / (job.name + ".renode.log"), &monitor);
+  if (pid < 0) return "cannot start " + options.renode;
+  const Clock::time_point deadline =
+      Clock::now() + std::chrono::minutes(options.minutes);
+  std::string error;
+  const int fd = Connect(port, pid);
+  if (fd < 0) {
+    error = "no console; see " + job.name + ".renode.log";
+  } else {
+    error = DriveConsole(job, fd, options.dir / (job.name + ".log"), deadline);
+    close(fd);
+  }
+  StopRenode(pid, monitor);
+  return error;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  Options options = {
+      std::max(1, static_cast<int>(std::thread::hardware_concurrency()) / 4),
+      "renode_batch", "renode", 60};
+  int arg = 1;
+  while (arg + 1 < argc && argv[arg][0] == '-') {
+    if (strcmp(argv[arg], "-j") == 0) {
+      options.jobs = std::max(1, atoi(argv[arg + 1]));
+    } else if (strcmp(argv[arg], "-o") == 0) {
+      options.dir = argv[arg + 1];
+    } else if (strcmp(argv[arg], "-r") == 0) {
+      options.renode = argv[arg + 1];
+    } else if (strcmp(argv[arg], "-T") == 0) {
+      options.minutes = std::max(1, atoi(argv[arg + 1]));
+    } else {
+      break;
+    }
+    arg += 2;
+  }
+  if (argc - arg != 1) {
+    fprintf(stderr,
+            "usage: renode_batch [-j jobs] [-o dir] [-r renode] [-T minutes] "
+            "jobs.txt\n");
+    return 2;
+  }
+  std::vector<Job> jobs;
+  if (!ReadJobs(argv[arg], &jobs)) return 2;
+  if (jobs.empty()) {
+    fprintf(stderr, "renode_batch: no runs in %s\n", argv[arg]);
+    return 2;
+  }
+  std::error_code error;
+  fs::create_directories(options.dir, error);
+  signal(SIGPIPE, SIG_IGN);
+
+  std::vector<std::string> errors(jobs.size());
+  std::atomic<size_t> next(0);
+  auto work = [&] {
+    for (size_t i = next++; i < jobs.size(); i = next++) {
+      Note("%s: started\n", jobs[i].name);
+      const Clock::time_point start = Clock::now();
+      errors[i] = RunJob(options, jobs[i], kBasePort + i);
+      const int seconds = std::chrono::duration_cast<std::chrono::seconds>(
+                              Clock::now() - start)
+                              .count();
+      if (errors[i].empty()) {
+        Note("%s: done in %s\n", jobs[i].name, std::to_string(seconds) + " s");
+      } else {
+        Note("%s: failed: %s\n", jobs[i].name, errors[i]);
+      }
+    }
+  };
+  std::vector<std::thread> pool;
+  for (int i = 1; i < options.jobs; ++i) pool.emplace_back(work);
+  work();
+  for (std::thread& thread : pool) thread.join();
+
+  const bool failed =
+      std::any_of(errors.begin(), errors.end(),
+                  [](const std::string& e) { return !e.empty(); });
+  std::string command =
+      (fs::path(argv[0]).parent_path() / "tick_diff").string();
+  int logs = 0;
+  for (size_t i = 0; i < jobs.size(); ++i) {
+    if (errors[i].empty()) {
+      command += " '" + (options.dir / (jobs[i].name + ".log")).string() + "'";
+      ++logs;
+    }
+  }
+  if (logs == 0) return 2;
+  fflush(stdout);
+  const int status = system(command.c_str());
+  if (failed) return 2;
+  return WIFEXITED(status) ? WEXITSTATUS(status) : 2;
+}
@@ -0,0 +1,149 @@
+// Packs input images for the replay benchmark (see src/replay_inputs.h) into
+// a blob, written as C++ source to be linked into the firmware.
+//
+//   replay_pack [-o replay_inputs_data.cc] image...
+//
+// An image is a binary PPM (P6) of 160x160 pixels, whose values go in less
+// 128, as the int8 mnv2 input takes them, or 76800 int8 values as they go
+// into the input tensor: an .npy from capture_extract, or raw bytes. Images
+// go in the order given, so the same command gives the same blob. Write it
+// to src/replay_inputs_data.cc and rebuild; the exit status is 0 if every
+// image was packed and 2 otherwise.
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "npy.h"
+#include "replay_format.h"
+
+namespace {
+
+namespace rf = replay_format;
+
+// Reads a P6 header: magic, width, height and maxval, separated by white
+// space and comments.
+bool ReadPpmHeader(std::ifstream& file, int* width, int* height,
+                   int* maxval) {
+  std::string magic;
+  file >> magic;
+  if (magic != "P6") return false;
+  int* fields[] = {width, height, maxval};
+  for (int* field : fields) {
+    file >> std::ws;
+    while (file.peek() == '#') {
+      file.ignore(1 << 20, '\n');
+      file >> std::ws;
+    }
+    if (!(file >> *field)) return false;
+  }
+  file.get();  // The single white space before the pixels.
+  return true;
+}
+
+// Reads one image into `image`, as int8 values. Returns an error message, or
+// "".
+std::string ReadImage(const std::string& path, std::vector<int8_t>* image) {
+  image->clear();
+  const size_t dot = path.rfind('.');
+  const std::string extension =
+      dot == std::string::npos ? "" : path.substr(dot + 1);
+  if (extension == "npy") {
+    NpyArray array;
+    if (!ReadNpy(path, &array)) return "not an int8 .npy";
+    image->assign(array.values.begin(), array.values.end());
+  } else {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) return "cannot open";
+    if (extension == "ppm") {
+      int width, height, maxval;
+      if (!ReadPpmHeader(file, &width, &height, &maxval) || maxval != 255) {
+        return "not a binary PPM with 8-bit values";
+      }
+      if (width != 160 || height != 160) return "not 160x160";
+      std::vector<uint8_t> pixels(rf::kMnv2InputBytes);
+      if (!file.read(reinterpret_cast<char*>(pixels.data()), pixels.size())) {
+        return "cut short";
+      }
+      for (const uint8_t pixel : pixels) image->push_back(pixel - 128);
+    } else {
+      const std::vector<char> bytes((std::istreambuf_iterator<char>(file)),
+                                    std::istreambuf_iterator<char>());
+      image->assign(bytes.begin(), bytes.end());
+    }
+  }
+  if (image->size() != static_cast<size_t>(rf::kMnv2InputBytes)) {
+    return std::to_string(image->size()) + " values, not " +
+           std::to_string(rf::kMnv2InputBytes);
+  }
+  return "";
+}
+
+void PutU32(std::vector<uint8_t>* blob, uint32_t value) {
+  for (int i = 0; i < 4; ++i) blob->push_back(value >> (8 * i));
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  std::string out = "replay_inputs_data.cc";
+  int arg = 1;
+  if (arg + 1 < argc && strcmp(argv[arg], "-o") == 0) {
+    out = argv[arg + 1];
+    arg += 2;
+  }
+  if (arg >= argc) {
+    fprintf(stderr, "usage: replay_pack [-o replay_inputs_data.cc] image...\n");
+    return 2;
+  }
+
+  std::vector<uint8_t> blob;
+  PutU32(&blob, rf::kMagic);
+  PutU32(&blob, rf::kVersion);
+  PutU32(&blob, argc - arg);
+  PutU32(&blob, rf::kMnv2InputBytes);
+  std::vector<int8_t> image;
+  for (int i = arg; i < argc; ++i) {
+    const std::string error = ReadImage(argv[i], &image);
+    if (!error.empty()) {
+      fprintf(stderr, "replay_pack: %s: %s\n", argv[i], error.c_str());
+      return 2;
+    }
+    blob.insert(blob.end(), image.begin(), image.end());
+  }
+
+  FILE* file = fopen(out.c_str(), "w");
+  if (file == nullptr) {
+    fprintf(stderr, "replay_pack: cannot write %s\n", out.c_str());
+    return 2;
+  }
+  fprintf(file,
+          "// Generated by tools/replay_pack from %d images (see "
+          "replay_format.h):\n",
+          argc - arg);
+  for (int i = arg; i < argc; ++i) fprintf(file, "//   %s\n", argv[i]);
+  fprintf(file,
+          "\n#include <stdint.h>\n\n"
+          "extern const uint8_t replay_blob[];\n"
+          "extern const uint32_t replay_blob_bytes;\n\n"
+          "alignas(4) const uint8_t replay_blob[%zu] = {",
+          blob.size());
+  for (size_t i = 0; i < blob.size(); ++i) {
+    if (i % 16 == 0) fputs("\n   ", file);
+    fprintf(file, " 0x%02x,", blob[i]);
+  }
+  fprintf(file,
+          "\n};\n"
+          "const uint32_t replay_blob_bytes = sizeof(replay_blob);\n");
+  if (fclose(file) != 0) {
+    fprintf(stderr, "replay_pack: cannot write %s\n", out.c_str());
+    return 2;
+  }
+  fprintf(stderr, "replay_pack: %d images, %zu bytes, in %s\n", argc - arg,
+          blob.size(), out.c_str());
+  return 0;
+}
@@ -0,0 +1,321 @@
+// Reads the profiler's per-op tick tables and "cycles total" lines out of
+// console logs, ranks where the time goes and flags ops that got slower.
+//
+//   tick_diff [-t percent] [-m ticks] baseline.log [log...]
+//
+// For each log, prints the share of the ticks taken by each op type and by
+// the slowest ops. Every further log is compared with the first: in total,
+// per op type and for each op whose ticks moved by more than `ticks` (100 by
+// default). An op or op type is a regression if its ticks also grew by more
+// than `percent` (5 by default), so that ops of a few ticks do not count.
+//
+// A log may hold several tables, one per inference, so each op's ticks, and
+// the total cycles, are the median over the log's inferences. Where the
+// capture hook reports its own ticks after a table (see
+// src/capture_hook.h), they are taken off that table's ops and its
+// inference's cycles, so that runs with capture compare with runs without.
+// Tables it marks as not valid, as the kernels stored accumulators while
+// they ran, are left out. Logs are read as by capture_decode. The exit
+// status is 0 if nothing regressed, 1 if anything did and 2 if a log cannot
+// be read.
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "console_log.h"
+
+namespace {
+
+constexpr char kTableHeader[] = "\"Event\",\"Tag\",\"Ticks\"";
+constexpr char kCaptureTableHeader[] = "\"Event\",\"Tag\",\"Capture ticks\"";
+constexpr char kCyclesTotal[] = "cycles total";
+constexpr char kCaptureCycles[] = "// capture: %lld cycles in the capture hook";
+constexpr char kTableNotValid[] =
+    "// capture: tick table not valid, accumulators were captured";
+// Ops in the hotspot table.
+constexpr int kHotspots = 10;
+
+struct OpTicks {
+  std::string tag;
+  long ticks;
+};
+
+using Table = std::map<int, OpTicks>;
+
+struct Log {
+  const char* path;
+  int inferences;
+  // Medians over the inferences.
+  Table ops;
+  long long cycles;
+};
+
+// Parses "16,DEPTHWISE_CONV_2D,12996".
+bool ParseRow(const std::string& text, int* op, OpTicks* row) {
+  const size_t first = text.find(',');
+  const size_t second = text.find(',', first + 1);
+  if (first == std::string::npos || second == std::string::npos) return false;
+  char* end;
+  *op = strtol(text.c_str(), &end, 10);
+  if (end != text.c_str() + first) return false;
+  row->tag = text.substr(first + 1, second - first - 1);
+  const char* ticks = text.c_str() + second + 1;
+  row->ticks = strtol(ticks, &end, 10);
+  return end != ticks && *end == '\0';
+}
+
+// Parses "   664M (    664505996 )  cycles total".
+bool ParseCycles(const std::string& text, long long* cycles) {
+  const size_t open = text.find('(');
+  if (open == std::string::npos ||
+      text.find(kCyclesTotal) == std::string::npos) {
+    return false;
+  }
+  char* end;
+  *cycles = strtoll(text.c_str() + open + 1, &end, 10);
+  return end != text.c_str() + open + 1;
+}
+
+template <typename T>
+T Median(std::vector<T> values) {
+  std::sort(values.begin(), values.end());
+  return values[(values.size() - 1) / 2];
+}
+
+bool ReadLog(const char* path, Log* log) {
+  std::ifstream file(path);
+  if (!file) {
+    fprintf(stderr, "tick_diff: cannot open %s\n", path);
+    return false;
+  }
+  std::vector<Table> tables;
+  std::vector<long long> cycles;
+  std::string line;
+  std::string text;
+  bool in_table = false;
+  bool in_capture_table = false;
+  while (std::getline(file, line)) {
+    if (!line.empty() && line.back() == '\r') line.pop_back();
+    if (!ConsoleText(line, &text)) continue;
+    if (text == kTableHeader) {
+      tables.emplace_back();
+      in_table = true;
+      continue;
+    }
+    if (text == kCaptureTableHeader) {
+      in_table = false;
+      in_capture_table = !tables.empty();
+      continue;
+    }
+    int op;
+    OpTicks row;
+    long long total;
+    if (in_table && ParseRow(text, &op, &row)) {
+      tables.back()[op] = row;
+    } else if (in_capture_table && ParseRow(text, &op, &row)) {
+      const auto entry = tables.back().find(op);
+      if (entry != tables.back().end() && entry->second.tag == row.tag) {
+        entry->second.ticks -= row.ticks;
+      }
+    } else if (ParseCycles(text, &total)) {
+      cycles.push_back(total);
+      in_table = false;
+      in_capture_table = false;
+    } else if (text == kTableNotValid) {
+      if (!tables.empty()) {
+        if (cycles.size() == tables.size()) cycles.pop_back();
+        tables.pop_back();
+      }
+      in_table = false;
+      in_capture_table = false;
+    } else {
+      // The capture hook's cycles belong to the inference of the table
+      // before, whose cycles total comes first.
+      if (sscanf(text.c_str(), kCaptureCycles, &total) == 1 &&
+          !cycles.empty() && cycles.size() == tables.size()) {
+        cycles.back() -= total;
+      }
+      in_table = false;
+      in_capture_table = false;
+    }
+  }
+  if (tables.empty()) {
+    fprintf(stderr, "tick_diff: no valid tick table in %s\n", path);
+    return false;
+  }
+
+  log->path = path;
+  log->inferences = tables.size();
+  log->cycles = cycles.empty() ? 0 : Median(cycles);
+  std::map<int, std::vector<long>> ticks;
+  for (const Table& table : tables) {
+    for (const auto& entry : table) {
+      ticks[entry.first].push_back(entry.second.ticks);
+      log->ops[entry.first].tag = entry.second.tag;
+    }
+  }
+  for (const auto& entry : ticks) {
+    log->ops[entry.first].ticks = Median(entry.second);
+  }
+  return true;
+}
+
+long TotalTicks(const Table& ops) {
+  long total = 0;
+  for (const auto& entry : ops) total += entry.second.ticks;
+  return total;
+}
+
+std::map<std::string, long> TicksByType(const Table& ops) {
+  std::map<std::string, long> by_type;
+  for (const auto& entry : ops) by_type[entry.second.tag] += entry.second.ticks;
+  return by_type;
+}
+
+double Percent(long part, long whole) {
+  return whole == 0 ? 0 : 100.0 * part / whole;
+}
+
+void PrintHotspots(const Log& log) {
+  const long total = TotalTicks(log.ops);
+  printf("%s: %d inferences, %zu ops, %ld ticks", log.path, log.inferences,
+         log.ops.size(), total);
+  if (log.cycles != 0) printf(", %lld cycles", log.cycles);
+  printf("\n");
+
+  std::vector<std::pair<long, std::string>> types;
+  for (const auto& entry : TicksByType(log.ops)) {
+    types.emplace_back(entry.second, entry.first);
+  }
+  std::sort(types.rbegin(), types.rend());
+  for (const auto& type : types) {
+    printf("  %-20s %10ld %5.1f%%\n", type.second.c_str(), type.first,
+           Percent(type.first, total));
+  }
+
+  std::vector<std::pair<long, int>> ops;
+  for (const auto& entry : log.ops) {
+    ops.emplace_back(entry.second.ticks, entry.first);
+  }
+  std::sort(ops.rbegin(), ops.rend());
+  ops.resize(std::min<size_t>(ops.size(), kHotspots));
+  printf("  slowest ops:\n");
+  for (const auto& op : ops) {
+    printf("    op %2d %-20s %10ld %5.1f%%\n", op.second,
+           log.ops.at(op.second).tag.c_str(), op.first,
+           Percent(op.first, total));
+  }
+}
+
+struct Thresholds {
+  double percent;
+  long ticks;
+
+  bool Regressed(long before, long after) const {
+    return after - before > ticks &&
+           after - before > percent / 100 * before;
+  }
+};
+
+void PrintDelta(const char* label, long before, long after, bool flag) {
+  printf("  %-26s %10ld -> %10ld %+7.1f%%%s\n", label, before, after,
+         Percent(after - before, before), flag ? "  REGRESSION" : "");
+}
+
+// Returns the number of ops and op types that regressed.
+int CompareLogs(const Log& base, const Log& log, const Thresholds& limits) {
+  printf("%s vs %s:\n", log.path, base.path);
+  if (base.cycles != 0 && log.cycles != 0) {
+    printf("  %-26s %10lld -> %10lld %+7.1f%%\n", "cycles total", base.cycles,
+           log.cycles, 100.0 * (log.cycles - base.cycles) / base.cycles);
+  }
+  PrintDelta("ticks total", TotalTicks(base.ops), TotalTicks(log.ops), false);
+
+  const std::map<std::string, long> base_types = TicksByType(base.ops);
+  const std::map<std::string, long> types = TicksByType(log.ops);
+  std::set<std::string> tags;
+  for (const auto& entry : base_types) tags.insert(entry.first);
+  for (const auto& entry : types) tags.insert(entry.first);
+  int types_regressed = 0;
+  for (const std::string& tag : tags) {
+    const auto before = base_types.find(tag);
+    const auto after = types.find(tag);
+    const long b = before == base_types.end() ? 0 : before->second;
+    const long a = after == types.end() ? 0 : after->second;
+    const bool flag = limits.Regressed(b, a);
+    if (flag) ++types_regressed;
+    PrintDelta(tag.c_str(), b, a, flag);
+  }
+
+  int regressed = 0;
+  int changed = 0;
+  char label[48];
+  for (const auto& entry : log.ops) {
+    const auto before = base.ops.find(entry.first);
+    if (before == base.ops.end() || before->second.tag != entry.second.tag) {
+      printf("  op %d %s: not in %s\n", entry.first, entry.second.tag.c_str(),
+             base.path);
+      ++changed;
+      continue;
+    }
+    const long b = before->second.ticks;
+    const long a = entry.second.ticks;
+    if (labs(a - b) <= limits.ticks) continue;
+    const bool flag = limits.Regressed(b, a);
+    if (flag) ++regressed;
+    ++changed;
+    snprintf(label, sizeof(label), "op %d %s", entry.first,
+             entry.second.tag.c_str());
+    PrintDelta(label, b, a, flag);
+  }
+  for (const auto& entry : base.ops) {
+    if (log.ops.count(entry.first) == 0) {
+      printf("  op %d %s: not in %s\n", entry.first, entry.second.tag.c_str(),
+             log.path);
+    }
+  }
+  printf("  %d ops changed by more than %ld ticks, %d of them slower by "
+         "more than %g%%\n",
+         changed, limits.ticks, regressed, limits.percent);
+  return regressed + types_regressed;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  Thresholds limits = {5, 100};
+  int arg = 1;
+  while (arg + 1 < argc && argv[arg][0] == '-') {
+    if (strcmp(argv[arg], "-t") == 0) {
+      limits.percent = atof(argv[arg + 1]);
+    } else if (strcmp(argv[arg], "-m") == 0) {
+      limits.ticks = atol(argv[arg + 1]);
+    } else {
+      break;
+    }
+    arg += 2;
+  }
+  if (arg >= argc || argv[arg][0] == '-') {
+    fprintf(stderr,
+            "usage: tick_diff [-t percent] [-m ticks] baseline.log [log...]\n");
+    return 2;
+  }
+  std::vector<Log> logs(argc - arg);
+  for (size_t i = 0; i < logs.size(); ++i) {
+    if (!ReadLog(argv[arg + i], &logs[i])) return 2;
+  }
+
+  for (const Log& log : logs) PrintHotspots(log);
+  int regressed = 0;
+  for (size_t i = 1; i < logs.size(); ++i) {
+    regressed += CompareLogs(logs[0], logs[i], limits);
+  }
+  return regressed == 0 ? 0 : 1;
+}